@@ -0,0 +1,255 @@
+#pragma once
+
+#include "setup.hpp"
+#include <cstring>
+#include <cmath>
+#include <limits>
+
+// Approximations used by the lowp and mediump float vectors instead of the C library.
+// Maximum errors measured against the double precision C library:
+//
+// | Function              | mediump               | lowp                  |
+// |-----------------------|-----------------------|-----------------------|
+// | sqrt, inversesqrt     | 5e-6 relative         | 2e-3 relative         |
+// | normalize             | 5e-6 relative         | 2e-3 relative         |
+// | sin, cos (|x| < 8192) | 1.5e-6 absolute       | 1.2e-4 absolute       |
+// | tan (|x| < 8192)      | quotient of sin / cos | quotient of sin / cos |
+// | exp2                  | 3e-6 relative         | 8e-5 relative         |
+// | log2                  | 5e-7 absolute         | 2e-5 absolute         |
+// | exp, log              | exp2(x * log2(e)) and log2(x) * ln(2)         |
+//
+// log2 and log errors exclude the rounding of the result, the rounding of x * log2(e) adds |x| * 1e-7 to the relative error of exp.
+// sin, cos and tan use the C library beyond |x| = 8192 and for NaN and infinite inputs.
+// sqrt, exp2, exp, log2 and log return the IEEE results for zeros, infinities, NaN and negative inputs, exp2 and exp overflow to +inf and underflow to 0.
+// Other inputs must be finite, positive for inversesqrt, normal for log2 and log. The aligned vec4 SSE implementations are at least as accurate.
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q>
+	struct is_lowp
+	{
+		static const bool value = false;
+	};
+
+	template<>
+	struct is_lowp<packed_lowp>
+	{
+		static const bool value = true;
+	};
+
+	template<qualifier Q>
+	struct is_mediump
+	{
+		static const bool value = false;
+	};
+
+	template<>
+	struct is_mediump<packed_mediump>
+	{
+		static const bool value = true;
+	};
+
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		template<>
+		struct is_lowp<aligned_lowp>
+		{
+			static const bool value = true;
+		};
+
+		template<>
+		struct is_mediump<aligned_mediump>
+		{
+			static const bool value = true;
+		};
+#	endif
+
+	// Only float vectors use approximations, double vectors keep the precision of the C library
+	template<typename T, qualifier Q>
+	struct is_approximate
+	{
+		static const bool value = false;
+	};
+
+	template<qualifier Q>
+	struct is_approximate<float, Q>
+	{
+		static const bool value = is_lowp<Q>::value || is_mediump<Q>::value;
+	};
+
+	// Select the type of the functions used by the T and Q vectors
+	template<typename Exact, typename Approximate, typename T, qualifier Q, bool IsApproximate = is_approximate<T, Q>::value>
+	struct compute_precision
+	{
+		typedef Exact type;
+	};
+
+	template<typename Exact, typename Approximate, typename T, qualifier Q>
+	struct compute_precision<Exact, Approximate, T, Q, true>
+	{
+		typedef Approximate type;
+	};
+
+	GLM_FUNC_QUALIFIER int approx_float_bits(float x)
+	{
+		int Bits;
+		std::memcpy(&Bits, &x, sizeof(Bits));
+		return Bits;
+	}
+
+	GLM_FUNC_QUALIFIER float approx_bits_float(int x)
+	{
+		float Value;
+		std::memcpy(&Value, &x, sizeof(Value));
+		return Value;
+	}
+
+	// Initial guess by the SSE reciprocal square root, refined by one Newton-Raphson step for mediump.
+	// Without SSE, initial guess by integer arithmetic on the bits of x, then one Newton-Raphson step for lowp and two for mediump
+	template<bool Lowp>
+	GLM_FUNC_QUALIFIER float approx_inversesqrt(float x)
+	{
+		float const Half = x * 0.5f;
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			float Result = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x)));
+#		else
+			float Result = approx_bits_float(0x5f375a86 - (approx_float_bits(x) >> 1));
+			Result = Result * (1.5f - Half * Result * Result);
+#		endif
+		if(!Lowp)
+			Result = Result * (1.5f - Half * Result * Result);
+		return Result;
+	}
+
+	// The reciprocal square root of 0 may be infinite and the one of +inf is 0, so both are returned unchanged like -0
+	template<bool Lowp>
+	GLM_FUNC_QUALIFIER float approx_sqrt(float x)
+	{
+		if(x > 0.0f && x <= std::numeric_limits<float>::max())
+			return x * approx_inversesqrt<Lowp>(x);
+		return x < 0.0f ? std::numeric_limits<float>::quiet_NaN() : x;
+	}
+
+	// Relative minimax polynomials of sin(y) for y in [-pi/2, pi/2]
+	template<bool Lowp>
+	GLM_FUNC_QUALIFIER float approx_sin_poly(float y)
+	{
+		float const z = y * y;
+		if(Lowp)
+			return y * (0.999891877f + z * (-0.165960222f + z * 0.00760293612f));
+		return y * (0.999999046f + z * (-0.16665554f + z * (0.00831190124f + z * -0.000184881734f)));
+	}
+
+	// False for NaN, the reduction below needs |x| <= 8192 for n to fit an int and the reduction to be accurate
+	GLM_FUNC_QUALIFIER bool approx_trig_in_range(float x)
+	{
+		return x >= -8192.0f && x <= 8192.0f;
+	}
+
+	// x = (n + Offset) * pi + y with y in [-pi/2, pi/2] and |n| small enough for n * 3.140625 to be exact
+	template<bool Lowp>
+	GLM_FUNC_QUALIFIER float approx_sin_reduced(float x, float Offset)
+	{
+		float const t = x * 0.318309886f - Offset;
+		int const n = static_cast<int>(t + (t < 0.0f ? -0.5f : 0.5f));
+		float const k = static_cast<float>(n) + Offset;
+		float const y = (x - k * 3.140625f) - k * 9.67653589793e-4f;
+		float const s = approx_sin_poly<Lowp>(y);
+		return n & 1 ? -s : s;
+	}
+
+	template<bool Lowp>
+	GLM_FUNC_QUALIFIER float approx_sin(float x)
+	{
+		if(!approx_trig_in_range(x))
+			return std::sin(x);
+		return approx_sin_reduced<Lowp>(x, 0.0f);
+	}
+
+	// cos(x) = -sin(x - pi/2)
+	template<bool Lowp>
+	GLM_FUNC_QUALIFIER float approx_cos(float x)
+	{
+		if(!approx_trig_in_range(x))
+			return std::cos(x);
+		return -approx_sin_reduced<Lowp>(x, 0.5f);
+	}
+
+	template<bool Lowp>
+	GLM_FUNC_QUALIFIER float approx_tan(float x)
+	{
+		if(!approx_trig_in_range(x))
+			return std::tan(x);
+		return approx_sin_reduced<Lowp>(x, 0.0f) / -approx_sin_reduced<Lowp>(x, 0.5f);
+	}
+
+	// Relative minimax polynomials of 2^f for f in [-0.5, 0.5]
+	template<bool Lowp>
+	GLM_FUNC_QUALIFIER float approx_exp2_poly(float f)
+	{
+		if(Lowp)
+			return 0.999928057f + f * (0.693260968f + f * (0.24261114f + f * 0.0551716685f));
+		return 0.999999285f + f * (0.693121791f + f * (0.240247443f + f * (0.0559178628f + f * 0.00957010221f)));
+	}
+
+	// p * 2^n for n in [-151, 129], split in two factors so that denormal and infinite results are rounded by the multiplications
+	GLM_FUNC_QUALIFIER float approx_ldexp(float p, int n)
+	{
+		int const Half0 = n / 2;
+		int const Half1 = n - Half0;
+		return p * approx_bits_float((Half0 + 127) << 23) * approx_bits_float((Half1 + 127) << 23);
+	}
+
+	template<bool Lowp>
+	GLM_FUNC_QUALIFIER float approx_exp2(float x)
+	{
+		// NaN would pass the clamp and make the conversion to int undefined
+		if(x != x)
+			return x;
+
+		// 2^-151 rounds to 0 and 2^129 overflows to +inf
+		float const Clamped = x < -151.0f ? -151.0f : (x > 129.0f ? 129.0f : x);
+
+		// Round to nearest with a truncation of a positive value
+		int const n = static_cast<int>(Clamped + 151.5f) - 151;
+		float const p = approx_exp2_poly<Lowp>(Clamped - static_cast<float>(n));
+		return approx_ldexp(p, n);
+	}
+
+	// Absolute minimax polynomials of log2(1 + u) / u for 1 + u in [sqrt(2) / 2, sqrt(2)]
+	template<bool Lowp>
+	GLM_FUNC_QUALIFIER float approx_log2_poly(float u)
+	{
+		if(Lowp)
+			return 1.44257796f + u * (-0.720241785f + u * (0.48668617f + u * (-0.394575506f + u * 0.252660364f)));
+		return 1.44269967f + u * (-0.721375883f + u * (0.480465025f + u * (-0.35896185f + u * (0.297262609f + u * (-0.272698045f + u * 0.170634538f)))));
+	}
+
+	template<bool Lowp>
+	GLM_FUNC_QUALIFIER float approx_log2(float x)
+	{
+		// log2(0) = -inf, log2(+inf) = +inf, log2(x < 0) = log2(NaN) = NaN
+		if(!(x > 0.0f && x <= std::numeric_limits<float>::max()))
+			return x == 0.0f ? -std::numeric_limits<float>::infinity() : (x > 0.0f ? x : std::numeric_limits<float>::quiet_NaN());
+
+		// x = 2^e * (1 + u) with 1 + u in [sqrt(2) / 2, sqrt(2)), 0x3f3504f3 are the bits of sqrt(2) / 2
+		unsigned int const Bits = static_cast<unsigned int>(approx_float_bits(x)) - 0x3f3504f3u;
+		// Arithmetic shift of Bits as a signed integer, negative for x < sqrt(2) / 2
+		int const e = static_cast<int>(Bits >> 23) - (Bits & 0x80000000u ? 512 : 0);
+		float const u = approx_bits_float(static_cast<int>((Bits & 0x007fffffu) + 0x3f3504f3u)) - 1.0f;
+		return static_cast<float>(e) + u * approx_log2_poly<Lowp>(u);
+	}
+
+	template<bool Lowp>
+	GLM_FUNC_QUALIFIER float approx_exp(float x)
+	{
+		return approx_exp2<Lowp>(x * 1.44269504f);
+	}
+
+	template<bool Lowp>
+	GLM_FUNC_QUALIFIER float approx_log(float x)
+	{
+		return approx_log2<Lowp>(x) * 0.693147181f;
+	}
+}//namespace detail
+}//namespace glm
@@ -3,6 +3,7 @@
 
 #include "../vector_relational.hpp"
 #include "_vectorize.hpp"
+#include "compute_approximation.hpp"
 #include <limits>
 #include <cmath>
 #include <cassert>
@@ -20,6 +21,52 @@ namespace detail
 		}
 #	endif
 
+#	if GLM_HAS_CXX11_STL
+		using std::exp2;
+#	else
+		template<typename genType>
+		genType exp2(genType Value)
+		{
+			return std::exp(static_cast<genType>(0.69314718055994530941723212145818) * Value);
+		}
+#	endif
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_pow
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& base, vec<L, T, Q> const& exponent)
+		{
+			return detail::functor2<vec, L, T, Q>::call(std::pow, base, exponent);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_exp
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& x)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(std::exp, x);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_log
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& x)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(std::log, x);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_exp2
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& x)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(exp2, x);
+		}
+	};
+
 	template<length_t L, typename T, qualifier Q, bool isFloat, bool Aligned>
 	struct compute_log2
 	{
@@ -49,19 +96,57 @@ namespace detail
 		}
 	};
 
-	template<length_t L, bool Aligned>
-	struct compute_inversesqrt<L, float, lowp, Aligned>
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_exp_approx
 	{
-		GLM_FUNC_QUALIFIER static vec<L, float, lowp> call(vec<L, float, lowp> const& x)
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& x)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(approx_exp<is_lowp<Q>::value>, x);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_log_approx
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& x)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(approx_log<is_lowp<Q>::value>, x);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_exp2_approx
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& x)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(approx_exp2<is_lowp<Q>::value>, x);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_log2_approx
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& x)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(approx_log2<is_lowp<Q>::value>, x);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_sqrt_approx
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& x)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(approx_sqrt<is_lowp<Q>::value>, x);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_inversesqrt_approx
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& x)
 		{
-			vec<L, float, lowp> tmp(x);
-			vec<L, float, lowp> xhalf(tmp * 0.5f);
-			vec<L, uint, lowp>* p = reinterpret_cast<vec<L, uint, lowp>*>(const_cast<vec<L, float, lowp>*>(&x));
-			vec<L, uint, lowp> i = vec<L, uint, lowp>(0x5f375a86) - (*p >> vec<L, uint, lowp>(1));
-			vec<L, float, lowp>* ptmp = reinterpret_cast<vec<L, float, lowp>*>(&i);
-			tmp = *ptmp;
-			tmp = tmp * (1.5f - xhalf * tmp * tmp);
-			return tmp;
+			return detail::functor1<vec, L, T, T, Q>::call(approx_inversesqrt<is_lowp<Q>::value>, x);
 		}
 	};
 }//namespace detail
@@ -71,7 +156,7 @@ namespace detail
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> pow(vec<L, T, Q> const& base, vec<L, T, Q> const& exponent)
 	{
-		return detail::functor2<vec, L, T, Q>::call(pow, base, exponent);
+		return detail::compute_pow<L, T, Q, detail::is_aligned<Q>::value>::call(base, exponent);
 	}
 
 	// exp
@@ -79,7 +164,9 @@ namespace detail
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> exp(vec<L, T, Q> const& x)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(exp, x);
+		return detail::compute_precision<
+			detail::compute_exp<L, T, Q, detail::is_aligned<Q>::value>,
+			detail::compute_exp_approx<L, T, Q, detail::is_aligned<Q>::value>, T, Q>::type::call(x);
 	}
 
 	// log
@@ -87,7 +174,9 @@ namespace detail
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> log(vec<L, T, Q> const& x)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(log, x);
+		return detail::compute_precision<
+			detail::compute_log<L, T, Q, detail::is_aligned<Q>::value>,
+			detail::compute_log_approx<L, T, Q, detail::is_aligned<Q>::value>, T, Q>::type::call(x);
 	}
 
 #   if GLM_HAS_CXX11_STL
@@ -106,7 +195,9 @@ namespace detail
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> exp2(vec<L, T, Q> const& x)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(exp2, x);
+		return detail::compute_precision<
+			detail::compute_exp2<L, T, Q, detail::is_aligned<Q>::value>,
+			detail::compute_exp2_approx<L, T, Q, detail::is_aligned<Q>::value>, T, Q>::type::call(x);
 	}
 
 	// log2, ln2 = 0.69314718055994530941723212145818f
@@ -119,7 +210,9 @@ namespace detail
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> log2(vec<L, T, Q> const& x)
 	{
-		return detail::compute_log2<L, T, Q, std::numeric_limits<T>::is_iec559, detail::is_aligned<Q>::value>::call(x);
+		return detail::compute_precision<
+			detail::compute_log2<L, T, Q, std::numeric_limits<T>::is_iec559, detail::is_aligned<Q>::value>,
+			detail::compute_log2_approx<L, T, Q, detail::is_aligned<Q>::value>, T, Q>::type::call(x);
 	}
 
 	// sqrt
@@ -128,7 +221,9 @@ namespace detail
 	GLM_FUNC_QUALIFIER vec<L, T, Q> sqrt(vec<L, T, Q> const& x)
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'sqrt' only accept floating-point inputs");
-		return detail::compute_sqrt<L, T, Q, detail::is_aligned<Q>::value>::call(x);
+		return detail::compute_precision<
+			detail::compute_sqrt<L, T, Q, detail::is_aligned<Q>::value>,
+			detail::compute_sqrt_approx<L, T, Q, detail::is_aligned<Q>::value>, T, Q>::type::call(x);
 	}
 
 	// inversesqrt
@@ -142,7 +237,9 @@ namespace detail
 	GLM_FUNC_QUALIFIER vec<L, T, Q> inversesqrt(vec<L, T, Q> const& x)
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'inversesqrt' only accept floating-point inputs");
-		return detail::compute_inversesqrt<L, T, Q, detail::is_aligned<Q>::value>::call(x);
+		return detail::compute_precision<
+			detail::compute_inversesqrt<L, T, Q, detail::is_aligned<Q>::value>,
+			detail::compute_inversesqrt_approx<L, T, Q, detail::is_aligned<Q>::value>, T, Q>::type::call(x);
 	}
 }//namespace glm
 
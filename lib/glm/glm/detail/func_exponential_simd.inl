@@ -19,18 +19,137 @@ namespace detail
 		}
 	};
 
-#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
-	template<>
-	struct compute_sqrt<4, float, aligned_lowp, true>
+	// The polynomial only handles finite positive bases and |exponent| <= 65536, other lanes use the C library
+	GLM_FUNC_QUALIFIER bool compute_pow_in_range(glm_vec4 base, glm_vec4 exponent)
 	{
-		GLM_FUNC_QUALIFIER static vec<4, float, aligned_lowp> call(vec<4, float, aligned_lowp> const& v)
+		glm_vec4 const cmp0 = _mm_and_ps(_mm_cmpgt_ps(base, _mm_setzero_ps()), _mm_cmplt_ps(base, _mm_set1_ps(std::numeric_limits<float>::infinity())));
+		glm_vec4 const cmp1 = _mm_cmple_ps(glm_vec4_abs(exponent), _mm_set1_ps(65536.0f));
+		return _mm_movemask_ps(_mm_and_ps(cmp0, cmp1)) == 0xF;
+	}
+
+	template<qualifier Q>
+	struct compute_pow<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& base, vec<4, float, Q> const& exponent)
+		{
+			if(!compute_pow_in_range(base.data, exponent.data))
+				return compute_pow<4, float, Q, false>::call(base, exponent);
+
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_pow(base.data, exponent.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_exp<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_exp(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_log<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_log(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_exp2<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_exp2(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_log2<4, float, Q, true, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
 		{
-			vec<4, float, aligned_lowp> Result;
-			Result.data = glm_vec4_sqrt_lowp(v.data);
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_log2(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_exp_approx<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			vec<4, float, Q> Result;
+			Result.data = is_lowp<Q>::value ? glm_vec4_exp_lowp(v.data) : glm_vec4_exp_mediump(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_log_approx<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			vec<4, float, Q> Result;
+			Result.data = is_lowp<Q>::value ? glm_vec4_log_lowp(v.data) : glm_vec4_log_mediump(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_exp2_approx<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			vec<4, float, Q> Result;
+			Result.data = is_lowp<Q>::value ? glm_vec4_exp2_lowp(v.data) : glm_vec4_exp2_mediump(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_log2_approx<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			vec<4, float, Q> Result;
+			Result.data = is_lowp<Q>::value ? glm_vec4_log2_lowp(v.data) : glm_vec4_log2_mediump(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_sqrt_approx<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			vec<4, float, Q> Result;
+			Result.data = is_lowp<Q>::value ? glm_vec4_sqrt_lowp(v.data) : glm_vec4_sqrt_mediump(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_inversesqrt_approx<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			vec<4, float, Q> Result;
+			Result.data = is_lowp<Q>::value ? glm_vec4_inversesqrt_lowp(v.data) : glm_vec4_inversesqrt_mediump(v.data);
 			return Result;
 		}
 	};
-#	endif
 }//namespace detail
 }//namespace glm
 
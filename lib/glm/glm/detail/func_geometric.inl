@@ -1,5 +1,6 @@
 #include "../exponential.hpp"
 #include "../common.hpp"
+#include "compute_approximation.hpp"
 
 namespace glm{
 namespace detail
@@ -89,6 +90,15 @@ namespace detail
 		}
 	};
 
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_normalize_approx
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& v)
+		{
+			return v * approx_inversesqrt<is_lowp<Q>::value>(dot(v, v));
+		}
+	};
+
 	template<length_t L, typename T, qualifier Q, bool Aligned>
 	struct compute_faceforward
 	{
@@ -191,7 +201,9 @@ namespace detail
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'normalize' accepts only floating-point inputs");
 
-		return detail::compute_normalize<L, T, Q, detail::is_aligned<Q>::value>::call(x);
+		return detail::compute_precision<
+			detail::compute_normalize<L, T, Q, detail::is_aligned<Q>::value>,
+			detail::compute_normalize_approx<L, T, Q, detail::is_aligned<Q>::value>, T, Q>::type::call(x);
 	}
 
 	// faceforward
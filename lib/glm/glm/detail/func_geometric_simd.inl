@@ -61,6 +61,17 @@ namespace detail
 		}
 	};
 
+	template<qualifier Q>
+	struct compute_normalize_approx<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			vec<4, float, Q> Result;
+			Result.data = is_lowp<Q>::value ? glm_vec4_normalize_lowp(v.data) : glm_vec4_normalize_mediump(v.data);
+			return Result;
+		}
+	};
+
 	template<qualifier Q>
 	struct compute_faceforward<4, float, Q, true>
 	{
@@ -93,6 +104,61 @@ namespace detail
 			return Result;
 		}
 	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	template<qualifier Q>
+	struct compute_length<4, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static double call(vec<4, double, Q> const& v)
+		{
+			return _mm256_cvtsd_f64(glm_dvec4_length(v.data));
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_distance<4, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static double call(vec<4, double, Q> const& p0, vec<4, double, Q> const& p1)
+		{
+			return _mm256_cvtsd_f64(glm_dvec4_distance(p0.data, p1.data));
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_dot<vec<4, double, Q>, double, true>
+	{
+		GLM_FUNC_QUALIFIER static double call(vec<4, double, Q> const& x, vec<4, double, Q> const& y)
+		{
+			return _mm256_cvtsd_f64(glm_dvec4_dot(x.data, y.data));
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_cross<double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<3, double, Q> call(vec<3, double, Q> const& a, vec<3, double, Q> const& b)
+		{
+			__m256d const set0 = _mm256_set_pd(0.0, a.z, a.y, a.x);
+			__m256d const set1 = _mm256_set_pd(0.0, b.z, b.y, b.x);
+			__m256d const xpd0 = glm_dvec4_cross(set0, set1);
+
+			vec<4, double, Q> Result;
+			Result.data = xpd0;
+			return vec<3, double, Q>(Result);
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_normalize<4, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, double, Q> call(vec<4, double, Q> const& v)
+		{
+			vec<4, double, Q> Result;
+			Result.data = glm_dvec4_normalize(v.data);
+			return Result;
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
 }//namespace detail
 }//namespace glm
 
@@ -170,6 +170,104 @@ namespace detail
 		};
 #		endif
 #	endif//GLM_HAS_BITSCAN_WINDOWS
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_findMSB_vector
+	{
+		GLM_FUNC_QUALIFIER static vec<L, int, Q> call(vec<L, T, Q> const& v)
+		{
+			return compute_findMSB_vec<L, T, Q, sizeof(T) * 8>::call(v);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_findLSB_vector
+	{
+		GLM_FUNC_QUALIFIER static vec<L, int, Q> call(vec<L, T, Q> const& v)
+		{
+			return detail::functor1<vec, L, int, T, Q>::call(compute_findLSB<T, sizeof(T) * 8>::call, v);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_bitCount_vector
+	{
+		GLM_FUNC_QUALIFIER static vec<L, int, Q> call(vec<L, T, Q> const& v)
+		{
+#			if GLM_COMPILER & GLM_COMPILER_VC
+#				pragma warning(push)
+#				pragma warning(disable : 4310) //cast truncates constant value
+#			endif
+
+			typedef typename detail::make_unsigned<T>::type U;
+
+			vec<L, U, Q> x(v);
+			x = compute_bitfieldBitCountStep<L, U, Q, Aligned, sizeof(T) * 8>=  2>::call(x, U(0x5555555555555555ull), U( 1));
+			x = compute_bitfieldBitCountStep<L, U, Q, Aligned, sizeof(T) * 8>=  4>::call(x, U(0x3333333333333333ull), U( 2));
+			x = compute_bitfieldBitCountStep<L, U, Q, Aligned, sizeof(T) * 8>=  8>::call(x, U(0x0F0F0F0F0F0F0F0Full), U( 4));
+			x = compute_bitfieldBitCountStep<L, U, Q, Aligned, sizeof(T) * 8>= 16>::call(x, U(0x00FF00FF00FF00FFull), U( 8));
+			x = compute_bitfieldBitCountStep<L, U, Q, Aligned, sizeof(T) * 8>= 32>::call(x, U(0x0000FFFF0000FFFFull), U(16));
+			x = compute_bitfieldBitCountStep<L, U, Q, Aligned, sizeof(T) * 8>= 64>::call(x, U(0x00000000FFFFFFFFull), U(32));
+			return vec<L, int, Q>(x);
+
+#			if GLM_COMPILER & GLM_COMPILER_VC
+#				pragma warning(pop)
+#			endif
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_bitfieldExtract_vector
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& Value, int Offset, int Bits)
+		{
+			return (Value >> static_cast<T>(Offset)) & static_cast<T>(detail::mask(Bits));
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_bitfieldInsert_vector
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& Base, vec<L, T, Q> const& Insert, int Offset, int Bits)
+		{
+			T const Mask = static_cast<T>(detail::mask(Bits) << Offset);
+			return (Base & ~Mask) | ((Insert << static_cast<T>(Offset)) & Mask);
+		}
+	};
+
+	template<length_t L, qualifier Q, bool Aligned>
+	struct compute_uaddCarry_vector
+	{
+		GLM_FUNC_QUALIFIER static vec<L, uint, Q> call(vec<L, uint, Q> const& x, vec<L, uint, Q> const& y, vec<L, uint, Q>& Carry)
+		{
+			vec<L, detail::uint64, Q> Value64(vec<L, detail::uint64, Q>(x) + vec<L, detail::uint64, Q>(y));
+			vec<L, detail::uint64, Q> Max32((static_cast<detail::uint64>(1) << static_cast<detail::uint64>(32)) - static_cast<detail::uint64>(1));
+			Carry = mix(vec<L, uint, Q>(0), vec<L, uint, Q>(1), greaterThan(Value64, Max32));
+			return vec<L, uint, Q>(Value64 % (Max32 + static_cast<detail::uint64>(1)));
+		}
+	};
+
+	template<length_t L, qualifier Q, bool Aligned>
+	struct compute_umulExtended_vector
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<L, uint, Q> const& x, vec<L, uint, Q> const& y, vec<L, uint, Q>& msb, vec<L, uint, Q>& lsb)
+		{
+			vec<L, detail::uint64, Q> Value64(vec<L, detail::uint64, Q>(x) * vec<L, detail::uint64, Q>(y));
+			msb = vec<L, uint, Q>(Value64 >> static_cast<detail::uint64>(32));
+			lsb = vec<L, uint, Q>(Value64);
+		}
+	};
+
+	template<length_t L, qualifier Q, bool Aligned>
+	struct compute_imulExtended_vector
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<L, int, Q> const& x, vec<L, int, Q> const& y, vec<L, int, Q>& msb, vec<L, int, Q>& lsb)
+		{
+			vec<L, detail::int64, Q> Value64(vec<L, detail::int64, Q>(x) * vec<L, detail::int64, Q>(y));
+			lsb = vec<L, int, Q>(Value64 & static_cast<detail::int64>(0xFFFFFFFF));
+			msb = vec<L, int, Q>((Value64 >> static_cast<detail::int64>(32)) & static_cast<detail::int64>(0xFFFFFFFF));
+		}
+	};
 }//namespace detail
 
 	// uaddCarry
@@ -184,10 +282,7 @@ namespace detail
 	template<length_t L, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, uint, Q> uaddCarry(vec<L, uint, Q> const& x, vec<L, uint, Q> const& y, vec<L, uint, Q>& Carry)
 	{
-		vec<L, detail::uint64, Q> Value64(vec<L, detail::uint64, Q>(x) + vec<L, detail::uint64, Q>(y));
-		vec<L, detail::uint64, Q> Max32((static_cast<detail::uint64>(1) << static_cast<detail::uint64>(32)) - static_cast<detail::uint64>(1));
-		Carry = mix(vec<L, uint, Q>(0), vec<L, uint, Q>(1), greaterThan(Value64, Max32));
-		return vec<L, uint, Q>(Value64 % (Max32 + static_cast<detail::uint64>(1)));
+		return detail::compute_uaddCarry_vector<L, Q, detail::is_aligned<Q>::value>::call(x, y, Carry);
 	}
 
 	// usubBorrow
@@ -220,9 +315,7 @@ namespace detail
 	template<length_t L, qualifier Q>
 	GLM_FUNC_QUALIFIER void umulExtended(vec<L, uint, Q> const& x, vec<L, uint, Q> const& y, vec<L, uint, Q>& msb, vec<L, uint, Q>& lsb)
 	{
-		vec<L, detail::uint64, Q> Value64(vec<L, detail::uint64, Q>(x) * vec<L, detail::uint64, Q>(y));
-		msb = vec<L, uint, Q>(Value64 >> static_cast<detail::uint64>(32));
-		lsb = vec<L, uint, Q>(Value64);
+		detail::compute_umulExtended_vector<L, Q, detail::is_aligned<Q>::value>::call(x, y, msb, lsb);
 	}
 
 	// imulExtended
@@ -236,9 +329,7 @@ namespace detail
 	template<length_t L, qualifier Q>
 	GLM_FUNC_QUALIFIER void imulExtended(vec<L, int, Q> const& x, vec<L, int, Q> const& y, vec<L, int, Q>& msb, vec<L, int, Q>& lsb)
 	{
-		vec<L, detail::int64, Q> Value64(vec<L, detail::int64, Q>(x) * vec<L, detail::int64, Q>(y));
-		lsb = vec<L, int, Q>(Value64 & static_cast<detail::int64>(0xFFFFFFFF));
-		msb = vec<L, int, Q>((Value64 >> static_cast<detail::int64>(32)) & static_cast<detail::int64>(0xFFFFFFFF));
+		detail::compute_imulExtended_vector<L, Q, detail::is_aligned<Q>::value>::call(x, y, msb, lsb);
 	}
 
 	// bitfieldExtract
@@ -253,7 +344,7 @@ namespace detail
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_integer, "'bitfieldExtract' only accept integer inputs");
 
-		return (Value >> static_cast<T>(Offset)) & static_cast<T>(detail::mask(Bits));
+		return detail::compute_bitfieldExtract_vector<L, T, Q, detail::is_aligned<Q>::value>::call(Value, Offset, Bits);
 	}
 
 	// bitfieldInsert
@@ -270,8 +361,7 @@ namespace detail
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_integer, "'bitfieldInsert' only accept integer values");
 
-		T const Mask = static_cast<T>(detail::mask(Bits) << Offset);
-		return (Base & ~Mask) | ((Insert << static_cast<T>(Offset)) & Mask);
+		return detail::compute_bitfieldInsert_vector<L, T, Q, detail::is_aligned<Q>::value>::call(Base, Insert, Offset, Bits);
 	}
 
 	// bitfieldReverse
@@ -312,23 +402,7 @@ namespace detail
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_integer, "'bitCount' only accept integer values");
 
-#		if GLM_COMPILER & GLM_COMPILER_VC
-#			pragma warning(push)
-#			pragma warning(disable : 4310) //cast truncates constant value
-#		endif
-
-		vec<L, typename detail::make_unsigned<T>::type, Q> x(*reinterpret_cast<vec<L, typename detail::make_unsigned<T>::type, Q> const *>(&v));
-		x = detail::compute_bitfieldBitCountStep<L, typename detail::make_unsigned<T>::type, Q, detail::is_aligned<Q>::value, sizeof(T) * 8>=  2>::call(x, typename detail::make_unsigned<T>::type(0x5555555555555555ull), typename detail::make_unsigned<T>::type( 1));
-		x = detail::compute_bitfieldBitCountStep<L, typename detail::make_unsigned<T>::type, Q, detail::is_aligned<Q>::value, sizeof(T) * 8>=  4>::call(x, typename detail::make_unsigned<T>::type(0x3333333333333333ull), typename detail::make_unsigned<T>::type( 2));
-		x = detail::compute_bitfieldBitCountStep<L, typename detail::make_unsigned<T>::type, Q, detail::is_aligned<Q>::value, sizeof(T) * 8>=  8>::call(x, typename detail::make_unsigned<T>::type(0x0F0F0F0F0F0F0F0Full), typename detail::make_unsigned<T>::type( 4));
-		x = detail::compute_bitfieldBitCountStep<L, typename detail::make_unsigned<T>::type, Q, detail::is_aligned<Q>::value, sizeof(T) * 8>= 16>::call(x, typename detail::make_unsigned<T>::type(0x00FF00FF00FF00FFull), typename detail::make_unsigned<T>::type( 8));
-		x = detail::compute_bitfieldBitCountStep<L, typename detail::make_unsigned<T>::type, Q, detail::is_aligned<Q>::value, sizeof(T) * 8>= 32>::call(x, typename detail::make_unsigned<T>::type(0x0000FFFF0000FFFFull), typename detail::make_unsigned<T>::type(16));
-		x = detail::compute_bitfieldBitCountStep<L, typename detail::make_unsigned<T>::type, Q, detail::is_aligned<Q>::value, sizeof(T) * 8>= 64>::call(x, typename detail::make_unsigned<T>::type(0x00000000FFFFFFFFull), typename detail::make_unsigned<T>::type(32));
-		return vec<L, int, Q>(x);
-
-#		if GLM_COMPILER & GLM_COMPILER_VC
-#			pragma warning(pop)
-#		endif
+		return detail::compute_bitCount_vector<L, T, Q, detail::is_aligned<Q>::value>::call(v);
 	}
 
 	// findLSB
@@ -345,7 +419,7 @@ namespace detail
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_integer, "'findLSB' only accept integer values");
 
-		return detail::functor1<vec, L, int, T, Q>::call(findLSB, x);
+		return detail::compute_findLSB_vector<L, T, Q, detail::is_aligned<Q>::value>::call(x);
 	}
 
 	// findMSB
@@ -362,7 +436,7 @@ namespace detail
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_integer, "'findMSB' only accept integer values");
 
-		return detail::compute_findMSB_vec<L, T, Q, sizeof(T) * 8>::call(v);
+		return detail::compute_findMSB_vector<L, T, Q, detail::is_aligned<Q>::value>::call(v);
 	}
 }//namespace glm
 
@@ -14,15 +14,16 @@ namespace detail
 
 			__m128i const set1 = _mm_set1_epi32(static_cast<int>(Mask));
 			__m128i const and1 = _mm_and_si128(set0, set1);
-			__m128i const sft1 = _mm_slli_epi32(and1, Shift);
+			__m128i const sft1 = _mm_slli_epi32(and1, static_cast<int>(Shift));
 
-			__m128i const set2 = _mm_andnot_si128(set0, _mm_set1_epi32(-1));
-			__m128i const and2 = _mm_and_si128(set0, set2);
-			__m128i const sft2 = _mm_srai_epi32(and2, Shift);
+			__m128i const and2 = _mm_andnot_si128(set1, set0);
+			__m128i const sft2 = _mm_srli_epi32(and2, static_cast<int>(Shift));
 
 			__m128i const or0 = _mm_or_si128(sft1, sft2);
 
-			return or0;
+			vec<4, uint, Q> Result;
+			Result.data = or0;
+			return Result;
 		}
 	};
 
@@ -35,11 +36,155 @@ namespace detail
 
 			__m128i const set1 = _mm_set1_epi32(static_cast<int>(Mask));
 			__m128i const and0 = _mm_and_si128(set0, set1);
-			__m128i const sft0 = _mm_slli_epi32(set0, Shift);
+			__m128i const sft0 = _mm_srli_epi32(set0, static_cast<int>(Shift));
 			__m128i const and1 = _mm_and_si128(sft0, set1);
 			__m128i const add0 = _mm_add_epi32(and0, and1);
 
-			return add0;
+			vec<4, uint, Q> Result;
+			Result.data = add0;
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_findMSB_vector<4, int, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, int, Q> call(vec<4, int, Q> const& v)
+		{
+			vec<4, int, Q> Result;
+			Result.data = glm_ivec4_find_msb(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_findMSB_vector<4, uint, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, int, Q> call(vec<4, uint, Q> const& v)
+		{
+			vec<4, int, Q> Result;
+			Result.data = glm_ivec4_find_msb(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_findLSB_vector<4, int, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, int, Q> call(vec<4, int, Q> const& v)
+		{
+			vec<4, int, Q> Result;
+			Result.data = glm_ivec4_find_lsb(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_findLSB_vector<4, uint, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, int, Q> call(vec<4, uint, Q> const& v)
+		{
+			vec<4, int, Q> Result;
+			Result.data = glm_ivec4_find_lsb(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_bitCount_vector<4, int, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, int, Q> call(vec<4, int, Q> const& v)
+		{
+			vec<4, int, Q> Result;
+			Result.data = glm_ivec4_bit_count(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_bitCount_vector<4, uint, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, int, Q> call(vec<4, uint, Q> const& v)
+		{
+			vec<4, int, Q> Result;
+			Result.data = glm_ivec4_bit_count(v.data);
+			return Result;
+		}
+	};
+
+	// Arithmetic shift for signed values, as the generic code
+	template<qualifier Q>
+	struct compute_bitfieldExtract_vector<4, int, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, int, Q> call(vec<4, int, Q> const& Value, int Offset, int Bits)
+		{
+			vec<4, int, Q> Result;
+			Result.data = _mm_and_si128(_mm_sra_epi32(Value.data, _mm_cvtsi32_si128(Offset)), _mm_set1_epi32(detail::mask(Bits)));
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_bitfieldExtract_vector<4, uint, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, uint, Q> call(vec<4, uint, Q> const& Value, int Offset, int Bits)
+		{
+			vec<4, uint, Q> Result;
+			Result.data = _mm_and_si128(_mm_srl_epi32(Value.data, _mm_cvtsi32_si128(Offset)), _mm_set1_epi32(detail::mask(Bits)));
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_bitfieldInsert_vector<4, int, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, int, Q> call(vec<4, int, Q> const& Base, vec<4, int, Q> const& Insert, int Offset, int Bits)
+		{
+			__m128i const Mask = _mm_set1_epi32(static_cast<int>(detail::mask(Bits) << Offset));
+			vec<4, int, Q> Result;
+			Result.data = _mm_or_si128(_mm_andnot_si128(Mask, Base.data), _mm_and_si128(_mm_sll_epi32(Insert.data, _mm_cvtsi32_si128(Offset)), Mask));
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_bitfieldInsert_vector<4, uint, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, uint, Q> call(vec<4, uint, Q> const& Base, vec<4, uint, Q> const& Insert, int Offset, int Bits)
+		{
+			__m128i const Mask = _mm_set1_epi32(static_cast<int>(detail::mask(Bits) << Offset));
+			vec<4, uint, Q> Result;
+			Result.data = _mm_or_si128(_mm_andnot_si128(Mask, Base.data), _mm_and_si128(_mm_sll_epi32(Insert.data, _mm_cvtsi32_si128(Offset)), Mask));
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_uaddCarry_vector<4, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, uint, Q> call(vec<4, uint, Q> const& x, vec<4, uint, Q> const& y, vec<4, uint, Q>& Carry)
+		{
+			vec<4, uint, Q> Result;
+			Result.data = glm_uvec4_add_carry(x.data, y.data, &Carry.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_umulExtended_vector<4, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<4, uint, Q> const& x, vec<4, uint, Q> const& y, vec<4, uint, Q>& msb, vec<4, uint, Q>& lsb)
+		{
+			glm_uvec4_mul_extended(x.data, y.data, &msb.data, &lsb.data);
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_imulExtended_vector<4, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<4, int, Q> const& x, vec<4, int, Q> const& y, vec<4, int, Q>& msb, vec<4, int, Q>& lsb)
+		{
+			glm_ivec4_mul_extended(x.data, y.data, &msb.data, &lsb.data);
 		}
 	};
 }//namespace detail
@@ -60,6 +205,62 @@ namespace detail
 #	endif//GLM_MODEL
 #	endif//GLM_ARCH
 
+#	if GLM_ARCH_LZCNT
+	template<>
+	GLM_FUNC_QUALIFIER int findMSB(uint x)
+	{
+		return 31 - static_cast<int>(_lzcnt_u32(x));
+	}
+
+	template<>
+	GLM_FUNC_QUALIFIER int findMSB(int x)
+	{
+		return 31 - static_cast<int>(_lzcnt_u32(static_cast<uint>(x)));
+	}
+
+#	if(GLM_MODEL == GLM_MODEL_64)
+	template<>
+	GLM_FUNC_QUALIFIER int findMSB(detail::uint64 x)
+	{
+		return 63 - static_cast<int>(_lzcnt_u64(x));
+	}
+
+	template<>
+	GLM_FUNC_QUALIFIER int findMSB(detail::int64 x)
+	{
+		return 63 - static_cast<int>(_lzcnt_u64(static_cast<detail::uint64>(x)));
+	}
+#	endif//GLM_MODEL
+#	endif//GLM_ARCH_LZCNT
+
+#	if GLM_ARCH_BMI
+	template<>
+	GLM_FUNC_QUALIFIER int findLSB(uint x)
+	{
+		return x == 0 ? -1 : static_cast<int>(_tzcnt_u32(x));
+	}
+
+	template<>
+	GLM_FUNC_QUALIFIER int findLSB(int x)
+	{
+		return x == 0 ? -1 : static_cast<int>(_tzcnt_u32(static_cast<uint>(x)));
+	}
+
+#	if(GLM_MODEL == GLM_MODEL_64)
+	template<>
+	GLM_FUNC_QUALIFIER int findLSB(detail::uint64 x)
+	{
+		return x == 0 ? -1 : static_cast<int>(_tzcnt_u64(x));
+	}
+
+	template<>
+	GLM_FUNC_QUALIFIER int findLSB(detail::int64 x)
+	{
+		return x == 0 ? -1 : static_cast<int>(_tzcnt_u64(static_cast<detail::uint64>(x)));
+	}
+#	endif//GLM_MODEL
+#	endif//GLM_ARCH_BMI
+
 }//namespace glm
 
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -1,5 +1,6 @@
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
+#include "type_mat3x3.hpp"
 #include "type_mat4x4.hpp"
 #include "../geometric.hpp"
 #include "../simd/matrix.h"
@@ -56,6 +57,98 @@ namespace detail
 			return Result;
 		}
 	};
+
+	// Aligned vec3 are padded to 16 bytes, the padding is cleared on load and overwritten on store
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void load_mat3(mat<3, 3, float, Q> const& m, glm_vec4 out[3])
+	{
+		glm_vec4 const Mask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+		out[0] = _mm_and_ps(_mm_load_ps(&m[0][0]), Mask);
+		out[1] = _mm_and_ps(_mm_load_ps(&m[1][0]), Mask);
+		out[2] = _mm_and_ps(_mm_load_ps(&m[2][0]), Mask);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void store_mat3(glm_vec4 const in[3], mat<3, 3, float, Q>& m)
+	{
+		_mm_store_ps(&m[0][0], in[0]);
+		_mm_store_ps(&m[1][0], in[1]);
+		_mm_store_ps(&m[2][0], in[2]);
+	}
+
+	template<qualifier Q>
+	struct compute_determinant<3, 3, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static float call(mat<3, 3, float, Q> const& m)
+		{
+			glm_vec4 In[3];
+			load_mat3(m, In);
+			return _mm_cvtss_f32(glm_mat3_determinant(In));
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_inverse<3, 3, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<3, 3, float, Q> call(mat<3, 3, float, Q> const& m)
+		{
+			glm_vec4 In[3], Out[3];
+			load_mat3(m, In);
+			glm_mat3_inverse(In, Out);
+
+			mat<3, 3, float, Q> Result;
+			store_mat3(Out, Result);
+			return Result;
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+	template<qualifier Q>
+	struct compute_matrixCompMult<4, 4, double, Q, true>
+	{
+		GLM_STATIC_ASSERT(detail::is_aligned<Q>::value, "Specialization requires aligned");
+
+		GLM_FUNC_QUALIFIER static mat<4, 4, double, Q> call(mat<4, 4, double, Q> const& x, mat<4, 4, double, Q> const& y)
+		{
+			mat<4, 4, double, Q> Result;
+			glm_dmat4_matrixCompMult(&x[0].data, &y[0].data, &Result[0].data);
+			return Result;
+		}
+	};
+#	endif
+
+	template<qualifier Q>
+	struct compute_transpose<4, 4, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, double, Q> call(mat<4, 4, double, Q> const& m)
+		{
+			mat<4, 4, double, Q> Result;
+			glm_dmat4_transpose(&m[0].data, &Result[0].data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_determinant<4, 4, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static double call(mat<4, 4, double, Q> const& m)
+		{
+			return _mm256_cvtsd_f64(glm_dmat4_determinant(&m[0].data));
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_inverse<4, 4, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, double, Q> call(mat<4, 4, double, Q> const& m)
+		{
+			mat<4, 4, double, Q> Result;
+			glm_dmat4_inverse(&m[0].data, &Result[0].data);
+			return Result;
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
 }//namespace detail
 
 #	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
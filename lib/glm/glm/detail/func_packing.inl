@@ -3,6 +3,32 @@
 
 #include "../common.hpp"
 #include "type_half.hpp"
+#include <cstddef>
+
+namespace glm{
+namespace detail
+{
+	template<bool UseSimd>
+	struct compute_half_array
+	{
+		GLM_FUNC_QUALIFIER static void pack(float const* In, unsigned short* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = static_cast<unsigned short>(toFloat16(In[i]));
+		}
+
+		GLM_FUNC_QUALIFIER static void unpack(unsigned short const* In, float* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = toFloat32(static_cast<hdata>(In[i]));
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "func_packing_simd.inl"
+#endif
 
 namespace glm
 {
@@ -157,12 +183,11 @@ namespace glm
 	{
 		union
 		{
-			signed short in[2];
+			unsigned short in[2];
 			uint out;
 		} u;
 
-		u.in[0] = detail::toFloat16(v.x);
-		u.in[1] = detail::toFloat16(v.y);
+		detail::compute_half_array<GLM_CONFIG_SIMD == GLM_ENABLE>::pack(&v.x, u.in, 2);
 
 		return u.out;
 	}
@@ -172,18 +197,13 @@ namespace glm
 		union
 		{
 			uint in;
-			signed short out[2];
+			unsigned short out[2];
 		} u;
 
 		u.in = v;
 
-		return vec2(
-			detail::toFloat32(u.out[0]),
-			detail::toFloat32(u.out[1]));
+		vec2 Result;
+		detail::compute_half_array<GLM_CONFIG_SIMD == GLM_ENABLE>::unpack(u.out, &Result.x, 2);
+		return Result;
 	}
 }//namespace glm
-
-#if GLM_CONFIG_SIMD == GLM_ENABLE
-#	include "func_packing_simd.inl"
-#endif
-
@@ -1,6 +1,62 @@
+/// @ref core
+/// @file glm/detail/func_packing_simd.inl
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#include "../simd/packing.h"
+#include <cstring>
+
 namespace glm{
 namespace detail
 {
+	template<>
+	struct compute_half_array<true>
+	{
+		GLM_FUNC_QUALIFIER static void pack(float const* In, unsigned short* Out, std::size_t Count)
+		{
+			std::size_t i = 0;
+
+#			if GLM_ARCH_F16C
+				for(; i + 8 <= Count; i += 8)
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + i), glm_vec8_pack_half(_mm256_loadu_ps(In + i)));
+#			endif
+
+			for(; i + 4 <= Count; i += 4)
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(Out + i), glm_vec4_pack_half(_mm_loadu_ps(In + i)));
 
+			if(i < Count)
+			{
+				float Tail[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+				unsigned short Packed[4];
+				std::memcpy(Tail, In + i, (Count - i) * sizeof(float));
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(Packed), glm_vec4_pack_half(_mm_loadu_ps(Tail)));
+				std::memcpy(Out + i, Packed, (Count - i) * sizeof(unsigned short));
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void unpack(unsigned short const* In, float* Out, std::size_t Count)
+		{
+			std::size_t i = 0;
+
+#			if GLM_ARCH_F16C
+				for(; i + 8 <= Count; i += 8)
+					_mm256_storeu_ps(Out + i, glm_vec8_unpack_half(_mm_loadu_si128(reinterpret_cast<__m128i const*>(In + i))));
+#			endif
+
+			for(; i + 4 <= Count; i += 4)
+				_mm_storeu_ps(Out + i, glm_vec4_unpack_half(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(In + i))));
+
+			if(i < Count)
+			{
+				unsigned short Tail[4] = {0, 0, 0, 0};
+				float Unpacked[4];
+				std::memcpy(Tail, In + i, (Count - i) * sizeof(unsigned short));
+				_mm_storeu_ps(Unpacked, glm_vec4_unpack_half(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(Tail))));
+				std::memcpy(Out + i, Unpacked, (Count - i) * sizeof(float));
+			}
+		}
+	};
 }//namespace detail
 }//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
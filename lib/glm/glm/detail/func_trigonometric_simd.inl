@@ -0,0 +1,177 @@
+/// @ref core
+/// @file glm/detail/func_trigonometric_simd.inl
+
+#include "../simd/trigonometric.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	// Lanes beyond the accurate range of the argument reduction use the C library
+	GLM_FUNC_QUALIFIER bool compute_trig_out_of_range(glm_vec4 x)
+	{
+		return _mm_movemask_ps(_mm_cmpgt_ps(glm_vec4_abs(x), _mm_set1_ps(8192.0f))) != 0;
+	}
+
+	template<qualifier Q>
+	struct compute_sin<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			if(compute_trig_out_of_range(v.data))
+				return compute_sin<4, float, Q, false>::call(v);
+
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_sin(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_cos<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			if(compute_trig_out_of_range(v.data))
+				return compute_cos<4, float, Q, false>::call(v);
+
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_cos(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_tan<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			if(compute_trig_out_of_range(v.data))
+				return compute_tan<4, float, Q, false>::call(v);
+
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_tan(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_asin<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_asin(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_acos<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_acos(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_atan<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_atan(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_sin_approx<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			if(compute_trig_out_of_range(v.data))
+				return compute_sin<4, float, Q, false>::call(v);
+
+			vec<4, float, Q> Result;
+			Result.data = is_lowp<Q>::value ? glm_vec4_sin_lowp(v.data) : glm_vec4_sin_mediump(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_cos_approx<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			if(compute_trig_out_of_range(v.data))
+				return compute_cos<4, float, Q, false>::call(v);
+
+			vec<4, float, Q> Result;
+			Result.data = is_lowp<Q>::value ? glm_vec4_cos_lowp(v.data) : glm_vec4_cos_mediump(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_tan_approx<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			if(compute_trig_out_of_range(v.data))
+				return compute_tan<4, float, Q, false>::call(v);
+
+			vec<4, float, Q> Result;
+			Result.data = is_lowp<Q>::value ? glm_vec4_tan_lowp(v.data) : glm_vec4_tan_mediump(v.data);
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#elif GLM_ARCH & GLM_ARCH_NEON_BIT
+namespace glm{
+namespace detail
+{
+	GLM_FUNC_QUALIFIER bool compute_trig_out_of_range(float32x4_t x)
+	{
+		uint32x4_t const cmp0 = vcagtq_f32(x, vdupq_n_f32(8192.0f));
+		uint32x2_t const cmp1 = vorr_u32(vget_low_u32(cmp0), vget_high_u32(cmp0));
+		return (vget_lane_u32(cmp1, 0) | vget_lane_u32(cmp1, 1)) != 0;
+	}
+
+	template<qualifier Q>
+	struct compute_sin<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			if(compute_trig_out_of_range(v.data))
+				return compute_sin<4, float, Q, false>::call(v);
+
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_sin(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_cos<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			if(compute_trig_out_of_range(v.data))
+				return compute_cos<4, float, Q, false>::call(v);
+
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_cos(v.data);
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
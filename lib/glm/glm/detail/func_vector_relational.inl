@@ -1,57 +1,136 @@
+namespace glm{
+namespace detail
+{
+	template<length_t L, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR int compute_mask(vec<L, bool, Q> const& v)
+	{
+		int Mask = 0;
+		for(length_t i = 0; i < L; ++i)
+			Mask |= v[i] ? 1 << i : 0;
+		return Mask;
+	}
+
+	// The Mask members set the bit i of the result to the comparison of the components i
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_relational
+	{
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static vec<L, bool, Q> lessThan(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
+		{
+			vec<L, bool, Q> Result(true);
+			for(length_t i = 0; i < L; ++i)
+				Result[i] = x[i] < y[i];
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static vec<L, bool, Q> lessThanEqual(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
+		{
+			vec<L, bool, Q> Result(true);
+			for(length_t i = 0; i < L; ++i)
+				Result[i] = x[i] <= y[i];
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static vec<L, bool, Q> greaterThan(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
+		{
+			vec<L, bool, Q> Result(true);
+			for(length_t i = 0; i < L; ++i)
+				Result[i] = x[i] > y[i];
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static vec<L, bool, Q> greaterThanEqual(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
+		{
+			vec<L, bool, Q> Result(true);
+			for(length_t i = 0; i < L; ++i)
+				Result[i] = x[i] >= y[i];
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static vec<L, bool, Q> equal(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
+		{
+			vec<L, bool, Q> Result(true);
+			for(length_t i = 0; i < L; ++i)
+				Result[i] = x[i] == y[i];
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static vec<L, bool, Q> notEqual(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
+		{
+			vec<L, bool, Q> Result(true);
+			for(length_t i = 0; i < L; ++i)
+				Result[i] = x[i] != y[i];
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static int lessThanMask(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
+		{
+			return compute_mask(lessThan(x, y));
+		}
+
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static int lessThanEqualMask(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
+		{
+			return compute_mask(lessThanEqual(x, y));
+		}
+
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static int greaterThanMask(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
+		{
+			return compute_mask(greaterThan(x, y));
+		}
+
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static int greaterThanEqualMask(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
+		{
+			return compute_mask(greaterThanEqual(x, y));
+		}
+
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static int equalMask(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
+		{
+			return compute_mask(equal(x, y));
+		}
+
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static int notEqualMask(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
+		{
+			return compute_mask(notEqual(x, y));
+		}
+	};
+}//namespace detail
+}//namespace glm
+
 namespace glm
 {
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, bool, Q> lessThan(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
 	{
-		vec<L, bool, Q> Result(true);
-		for(length_t i = 0; i < L; ++i)
-			Result[i] = x[i] < y[i];
-		return Result;
+		return detail::compute_relational<L, T, Q, detail::is_aligned<Q>::value>::lessThan(x, y);
 	}
 
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, bool, Q> lessThanEqual(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
 	{
-		vec<L, bool, Q> Result(true);
-		for(length_t i = 0; i < L; ++i)
-			Result[i] = x[i] <= y[i];
-		return Result;
+		return detail::compute_relational<L, T, Q, detail::is_aligned<Q>::value>::lessThanEqual(x, y);
 	}
 
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, bool, Q> greaterThan(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
 	{
-		vec<L, bool, Q> Result(true);
-		for(length_t i = 0; i < L; ++i)
-			Result[i] = x[i] > y[i];
-		return Result;
+		return detail::compute_relational<L, T, Q, detail::is_aligned<Q>::value>::greaterThan(x, y);
 	}
 
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, bool, Q> greaterThanEqual(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
 	{
-		vec<L, bool, Q> Result(true);
-		for(length_t i = 0; i < L; ++i)
-			Result[i] = x[i] >= y[i];
-		return Result;
+		return detail::compute_relational<L, T, Q, detail::is_aligned<Q>::value>::greaterThanEqual(x, y);
 	}
 
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, bool, Q> equal(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
 	{
-		vec<L, bool, Q> Result(true);
-		for(length_t i = 0; i < L; ++i)
-			Result[i] = x[i] == y[i];
-		return Result;
+		return detail::compute_relational<L, T, Q, detail::is_aligned<Q>::value>::equal(x, y);
 	}
 
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, bool, Q> notEqual(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
 	{
-		vec<L, bool, Q> Result(true);
-		for(length_t i = 0; i < L; ++i)
-			Result[i] = x[i] != y[i];
-		return Result;
+		return detail::compute_relational<L, T, Q, detail::is_aligned<Q>::value>::notEqual(x, y);
 	}
 
 	template<length_t L, qualifier Q>
@@ -1,6 +1,216 @@
+/// @ref core
+/// @file glm/detail/func_vector_relational_simd.inl
+
+#include "../simd/vector_relational.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
 namespace glm{
 namespace detail
 {
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER vec<4, bool, Q> compute_bvec4(int Mask)
+	{
+		return vec<4, bool, Q>((Mask & 1) != 0, (Mask & 2) != 0, (Mask & 4) != 0, (Mask & 8) != 0);
+	}
+
+	// Comparisons stay in registers until the movemask, the bool vectors are built from the bits
+	template<qualifier Q>
+	struct compute_relational<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, bool, Q> lessThan(vec<4, float, Q> const& x, vec<4, float, Q> const& y)
+		{
+			return compute_bvec4<Q>(lessThanMask(x, y));
+		}
+
+		GLM_FUNC_QUALIFIER static vec<4, bool, Q> lessThanEqual(vec<4, float, Q> const& x, vec<4, float, Q> const& y)
+		{
+			return compute_bvec4<Q>(lessThanEqualMask(x, y));
+		}
+
+		GLM_FUNC_QUALIFIER static vec<4, bool, Q> greaterThan(vec<4, float, Q> const& x, vec<4, float, Q> const& y)
+		{
+			return compute_bvec4<Q>(greaterThanMask(x, y));
+		}
+
+		GLM_FUNC_QUALIFIER static vec<4, bool, Q> greaterThanEqual(vec<4, float, Q> const& x, vec<4, float, Q> const& y)
+		{
+			return compute_bvec4<Q>(greaterThanEqualMask(x, y));
+		}
+
+		GLM_FUNC_QUALIFIER static vec<4, bool, Q> equal(vec<4, float, Q> const& x, vec<4, float, Q> const& y)
+		{
+			return compute_bvec4<Q>(equalMask(x, y));
+		}
+
+		GLM_FUNC_QUALIFIER static vec<4, bool, Q> notEqual(vec<4, float, Q> const& x, vec<4, float, Q> const& y)
+		{
+			return compute_bvec4<Q>(notEqualMask(x, y));
+		}
+
+		GLM_FUNC_QUALIFIER static int lessThanMask(vec<4, float, Q> const& x, vec<4, float, Q> const& y)
+		{
+			return _mm_movemask_ps(_mm_cmplt_ps(x.data, y.data));
+		}
+
+		GLM_FUNC_QUALIFIER static int lessThanEqualMask(vec<4, float, Q> const& x, vec<4, float, Q> const& y)
+		{
+			return _mm_movemask_ps(_mm_cmple_ps(x.data, y.data));
+		}
+
+		GLM_FUNC_QUALIFIER static int greaterThanMask(vec<4, float, Q> const& x, vec<4, float, Q> const& y)
+		{
+			return _mm_movemask_ps(_mm_cmpgt_ps(x.data, y.data));
+		}
+
+		GLM_FUNC_QUALIFIER static int greaterThanEqualMask(vec<4, float, Q> const& x, vec<4, float, Q> const& y)
+		{
+			return _mm_movemask_ps(_mm_cmpge_ps(x.data, y.data));
+		}
+
+		GLM_FUNC_QUALIFIER static int equalMask(vec<4, float, Q> const& x, vec<4, float, Q> const& y)
+		{
+			return _mm_movemask_ps(_mm_cmpeq_ps(x.data, y.data));
+		}
+
+		GLM_FUNC_QUALIFIER static int notEqualMask(vec<4, float, Q> const& x, vec<4, float, Q> const& y)
+		{
+			return _mm_movemask_ps(_mm_cmpneq_ps(x.data, y.data));
+		}
+	};
+
+	// SSE2 has no integer less equal or not equal comparisons, they are the complement of the greater than, less than and equal masks
+	template<qualifier Q>
+	struct compute_relational<4, int, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, bool, Q> lessThan(vec<4, int, Q> const& x, vec<4, int, Q> const& y)
+		{
+			return compute_bvec4<Q>(lessThanMask(x, y));
+		}
+
+		GLM_FUNC_QUALIFIER static vec<4, bool, Q> lessThanEqual(vec<4, int, Q> const& x, vec<4, int, Q> const& y)
+		{
+			return compute_bvec4<Q>(lessThanEqualMask(x, y));
+		}
+
+		GLM_FUNC_QUALIFIER static vec<4, bool, Q> greaterThan(vec<4, int, Q> const& x, vec<4, int, Q> const& y)
+		{
+			return compute_bvec4<Q>(greaterThanMask(x, y));
+		}
+
+		GLM_FUNC_QUALIFIER static vec<4, bool, Q> greaterThanEqual(vec<4, int, Q> const& x, vec<4, int, Q> const& y)
+		{
+			return compute_bvec4<Q>(greaterThanEqualMask(x, y));
+		}
+
+		GLM_FUNC_QUALIFIER static vec<4, bool, Q> equal(vec<4, int, Q> const& x, vec<4, int, Q> const& y)
+		{
+			return compute_bvec4<Q>(equalMask(x, y));
+		}
 
+		GLM_FUNC_QUALIFIER static vec<4, bool, Q> notEqual(vec<4, int, Q> const& x, vec<4, int, Q> const& y)
+		{
+			return compute_bvec4<Q>(notEqualMask(x, y));
+		}
+
+		GLM_FUNC_QUALIFIER static int lessThanMask(vec<4, int, Q> const& x, vec<4, int, Q> const& y)
+		{
+			return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(x.data, y.data)));
+		}
+
+		GLM_FUNC_QUALIFIER static int lessThanEqualMask(vec<4, int, Q> const& x, vec<4, int, Q> const& y)
+		{
+			return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(x.data, y.data))) ^ 0xF;
+		}
+
+		GLM_FUNC_QUALIFIER static int greaterThanMask(vec<4, int, Q> const& x, vec<4, int, Q> const& y)
+		{
+			return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(x.data, y.data)));
+		}
+
+		GLM_FUNC_QUALIFIER static int greaterThanEqualMask(vec<4, int, Q> const& x, vec<4, int, Q> const& y)
+		{
+			return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(x.data, y.data))) ^ 0xF;
+		}
+
+		GLM_FUNC_QUALIFIER static int equalMask(vec<4, int, Q> const& x, vec<4, int, Q> const& y)
+		{
+			return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(x.data, y.data)));
+		}
+
+		GLM_FUNC_QUALIFIER static int notEqualMask(vec<4, int, Q> const& x, vec<4, int, Q> const& y)
+		{
+			return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(x.data, y.data))) ^ 0xF;
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	// Ordered comparisons like the scalar operators except notEqual which is true with NaN
+	template<qualifier Q>
+	struct compute_relational<4, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, bool, Q> lessThan(vec<4, double, Q> const& x, vec<4, double, Q> const& y)
+		{
+			return compute_bvec4<Q>(lessThanMask(x, y));
+		}
+
+		GLM_FUNC_QUALIFIER static vec<4, bool, Q> lessThanEqual(vec<4, double, Q> const& x, vec<4, double, Q> const& y)
+		{
+			return compute_bvec4<Q>(lessThanEqualMask(x, y));
+		}
+
+		GLM_FUNC_QUALIFIER static vec<4, bool, Q> greaterThan(vec<4, double, Q> const& x, vec<4, double, Q> const& y)
+		{
+			return compute_bvec4<Q>(greaterThanMask(x, y));
+		}
+
+		GLM_FUNC_QUALIFIER static vec<4, bool, Q> greaterThanEqual(vec<4, double, Q> const& x, vec<4, double, Q> const& y)
+		{
+			return compute_bvec4<Q>(greaterThanEqualMask(x, y));
+		}
+
+		GLM_FUNC_QUALIFIER static vec<4, bool, Q> equal(vec<4, double, Q> const& x, vec<4, double, Q> const& y)
+		{
+			return compute_bvec4<Q>(equalMask(x, y));
+		}
+
+		GLM_FUNC_QUALIFIER static vec<4, bool, Q> notEqual(vec<4, double, Q> const& x, vec<4, double, Q> const& y)
+		{
+			return compute_bvec4<Q>(notEqualMask(x, y));
+		}
+
+		GLM_FUNC_QUALIFIER static int lessThanMask(vec<4, double, Q> const& x, vec<4, double, Q> const& y)
+		{
+			return _mm256_movemask_pd(_mm256_cmp_pd(x.data, y.data, _CMP_LT_OQ));
+		}
+
+		GLM_FUNC_QUALIFIER static int lessThanEqualMask(vec<4, double, Q> const& x, vec<4, double, Q> const& y)
+		{
+			return _mm256_movemask_pd(_mm256_cmp_pd(x.data, y.data, _CMP_LE_OQ));
+		}
+
+		GLM_FUNC_QUALIFIER static int greaterThanMask(vec<4, double, Q> const& x, vec<4, double, Q> const& y)
+		{
+			return _mm256_movemask_pd(_mm256_cmp_pd(x.data, y.data, _CMP_GT_OQ));
+		}
+
+		GLM_FUNC_QUALIFIER static int greaterThanEqualMask(vec<4, double, Q> const& x, vec<4, double, Q> const& y)
+		{
+			return _mm256_movemask_pd(_mm256_cmp_pd(x.data, y.data, _CMP_GE_OQ));
+		}
+
+		GLM_FUNC_QUALIFIER static int equalMask(vec<4, double, Q> const& x, vec<4, double, Q> const& y)
+		{
+			return _mm256_movemask_pd(_mm256_cmp_pd(x.data, y.data, _CMP_EQ_OQ));
+		}
+
+		GLM_FUNC_QUALIFIER static int notEqualMask(vec<4, double, Q> const& x, vec<4, double, Q> const& y)
+		{
+			return _mm256_movemask_pd(_mm256_cmp_pd(x.data, y.data, _CMP_NEQ_UQ));
+		}
+	};
+#	endif
 }//namespace detail
 }//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
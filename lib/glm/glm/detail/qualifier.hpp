@@ -13,8 +13,8 @@ namespace glm
 
 #		if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
 			aligned_highp, ///< Typed data is aligned in memory allowing SIMD optimizations and operations are executed with high precision in term of ULPs
-			aligned_mediump, ///< Typed data is aligned in memory allowing SIMD optimizations and operations are executed with high precision in term of ULPs for higher performance
-			aligned_lowp, // ///< Typed data is aligned in memory allowing SIMD optimizations and operations are executed with high precision in term of ULPs to maximize performance
+			aligned_mediump, ///< Typed data is aligned in memory allowing SIMD optimizations and operations are executed with medium precision in term of ULPs for higher performance
+			aligned_lowp, ///< Typed data is aligned in memory allowing SIMD optimizations and operations are executed with low precision in term of ULPs to maximize performance
 			aligned = aligned_highp, ///< By default aligned qualifier is also high precision
 #		endif
 
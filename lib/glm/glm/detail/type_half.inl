@@ -148,10 +148,14 @@ namespace detail
 			// We convert f to a denormalized half.
 			//
 
-			m = (m | 0x00800000) >> (1 - e);
+			int const t = 1 - e;
+			int const l = (m | 0x00800000) & ((1 << t) - 1);
+			m = (m | 0x00800000) >> t;
 
 			//
-			// Round to nearest, round "0.5" up.
+			// Round to nearest, round "0.5" to even, like the F16C
+			// instructions. The bits lost by the shift above break
+			// the tie like the bits below 0x00001000.
 			//
 			// Rounding may cause the significand to overflow and make
 			// our number normalized.  Because of the way a half's bits
@@ -159,7 +163,7 @@ namespace detail
 			// the code below will handle it correctly.
 			//
 
-			if(m & 0x00001000)
+			if((m & 0x00001000) && ((m & 0x00002fff) || l))
 				m += 0x00002000;
 
 			//
@@ -203,10 +207,10 @@ namespace detail
 			//
 
 			//
-			// Round to nearest, round "0.5" up
+			// Round to nearest, round "0.5" to even
 			//
 
-			if(m &  0x00001000)
+			if((m & 0x00001000) && (m & 0x00002fff))
 			{
 				m += 0x00002000;
 
@@ -1,6 +1,166 @@
 /// @ref core
 
-namespace glm
+#include "../simd/matrix.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
 {
+	template<qualifier Q>
+	struct compute_mat4_add<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, float, Q> call(mat<4, 4, float, Q> const& m1, mat<4, 4, float, Q> const& m2)
+		{
+			mat<4, 4, float, Q> Result;
+			glm_mat4_add(&m1[0].data, &m2[0].data, &Result[0].data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_mat4_sub<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, float, Q> call(mat<4, 4, float, Q> const& m1, mat<4, 4, float, Q> const& m2)
+		{
+			mat<4, 4, float, Q> Result;
+			glm_mat4_sub(&m1[0].data, &m2[0].data, &Result[0].data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_mat4_add_scalar<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, float, Q> call(mat<4, 4, float, Q> const& m, float s)
+		{
+			glm_vec4 const s0 = _mm_set1_ps(s);
+
+			mat<4, 4, float, Q> Result;
+			Result[0].data = _mm_add_ps(m[0].data, s0);
+			Result[1].data = _mm_add_ps(m[1].data, s0);
+			Result[2].data = _mm_add_ps(m[2].data, s0);
+			Result[3].data = _mm_add_ps(m[3].data, s0);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_mat4_mul_scalar<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, float, Q> call(mat<4, 4, float, Q> const& m, float s)
+		{
+			glm_vec4 const s0 = _mm_set1_ps(s);
+
+			mat<4, 4, float, Q> Result;
+			Result[0].data = _mm_mul_ps(m[0].data, s0);
+			Result[1].data = _mm_mul_ps(m[1].data, s0);
+			Result[2].data = _mm_mul_ps(m[2].data, s0);
+			Result[3].data = _mm_mul_ps(m[3].data, s0);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_mat4_mul_vec4<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(mat<4, 4, float, Q> const& m, vec<4, float, Q> const& v)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_mat4_mul_vec4(&m[0].data, v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_mat4_mul<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, float, Q> call(mat<4, 4, float, Q> const& m1, mat<4, 4, float, Q> const& m2)
+		{
+			mat<4, 4, float, Q> Result;
+			glm_mat4_mul(&m1[0].data, &m2[0].data, &Result[0].data);
+			return Result;
+		}
+	};
 
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	template<qualifier Q>
+	struct compute_mat4_add<double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, double, Q> call(mat<4, 4, double, Q> const& m1, mat<4, 4, double, Q> const& m2)
+		{
+			mat<4, 4, double, Q> Result;
+			glm_dmat4_add(&m1[0].data, &m2[0].data, &Result[0].data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_mat4_sub<double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, double, Q> call(mat<4, 4, double, Q> const& m1, mat<4, 4, double, Q> const& m2)
+		{
+			mat<4, 4, double, Q> Result;
+			glm_dmat4_sub(&m1[0].data, &m2[0].data, &Result[0].data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_mat4_add_scalar<double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, double, Q> call(mat<4, 4, double, Q> const& m, double s)
+		{
+			glm_dvec4 const s0 = _mm256_set1_pd(s);
+
+			mat<4, 4, double, Q> Result;
+			Result[0].data = _mm256_add_pd(m[0].data, s0);
+			Result[1].data = _mm256_add_pd(m[1].data, s0);
+			Result[2].data = _mm256_add_pd(m[2].data, s0);
+			Result[3].data = _mm256_add_pd(m[3].data, s0);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_mat4_mul_scalar<double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, double, Q> call(mat<4, 4, double, Q> const& m, double s)
+		{
+			glm_dvec4 const s0 = _mm256_set1_pd(s);
+
+			mat<4, 4, double, Q> Result;
+			Result[0].data = _mm256_mul_pd(m[0].data, s0);
+			Result[1].data = _mm256_mul_pd(m[1].data, s0);
+			Result[2].data = _mm256_mul_pd(m[2].data, s0);
+			Result[3].data = _mm256_mul_pd(m[3].data, s0);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_mat4_mul_vec4<double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, double, Q> call(mat<4, 4, double, Q> const& m, vec<4, double, Q> const& v)
+		{
+			vec<4, double, Q> Result;
+			Result.data = glm_dmat4_mul_dvec4(&m[0].data, v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_mat4_mul<double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, double, Q> call(mat<4, 4, double, Q> const& m1, mat<4, 4, double, Q> const& m2)
+		{
+			mat<4, 4, double, Q> Result;
+			glm_dmat4_mul(&m1[0].data, &m2[0].data, &Result[0].data);
+			return Result;
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+}//namespace detail
 }//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
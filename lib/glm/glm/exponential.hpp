@@ -9,6 +9,8 @@
 /// Provides GLSL exponential functions
 ///
 /// These all operate component-wise. The description is per component.
+/// With lowp and mediump float vectors, exp, log, exp2, log2, sqrt and inversesqrt use faster approximations.
+/// Their maximum errors are listed in glm/detail/compute_approximation.hpp.
 ///
 /// Include <glm/exponential.hpp> to use these core features.
 
@@ -13,6 +13,10 @@
 #	pragma message("GLM: All extensions included (not recommended)")
 #endif//GLM_MESSAGES
 
+#include "./ext/batch_transform.hpp"
+#include "./ext/culling.hpp"
+
+#include "./ext/matrix_affine.hpp"
 #include "./ext/matrix_clip_space.hpp"
 #include "./ext/matrix_common.hpp"
 
@@ -104,6 +108,7 @@
 #include "./ext/quaternion_exponential.hpp"
 #include "./ext/quaternion_geometric.hpp"
 #include "./ext/quaternion_relational.hpp"
+#include "./ext/quaternion_soa.hpp"
 #include "./ext/quaternion_transform.hpp"
 #include "./ext/quaternion_trigonometric.hpp"
 
@@ -117,10 +122,13 @@
 #include "./ext/scalar_int_sized.hpp"
 #include "./ext/scalar_uint_sized.hpp"
 
+#include "./ext/simd_dispatch.hpp"
+
 #include "./ext/vector_common.hpp"
 #include "./ext/vector_integer.hpp"
 #include "./ext/vector_packing.hpp"
 #include "./ext/vector_relational.hpp"
+#include "./ext/vector_soa.hpp"
 #include "./ext/vector_ulp.hpp"
 
 #include "./ext/vector_bool1.hpp"
@@ -194,6 +202,9 @@
 #ifdef GLM_ENABLE_EXPERIMENTAL
 #include "./gtx/associated_min_max.hpp"
 #include "./gtx/bit.hpp"
+#if !(GLM_COMPILER & GLM_COMPILER_CUDA)
+#	include "./gtx/bvh.hpp"
+#endif
 #include "./gtx/closest_point.hpp"
 #include "./gtx/color_encoding.hpp"
 #include "./gtx/color_space.hpp"
@@ -230,7 +241,9 @@
 #include "./gtx/projection.hpp"
 #include "./gtx/quaternion.hpp"
 #include "./gtx/raw_data.hpp"
+#include "./gtx/reduce.hpp"
 #include "./gtx/rotate_vector.hpp"
+#include "./gtx/skinning.hpp"
 #include "./gtx/spline.hpp"
 #include "./gtx/std_based_type.hpp"
 #if !(GLM_COMPILER & GLM_COMPILER_CUDA)
@@ -238,6 +251,7 @@
 #endif
 #include "./gtx/transform.hpp"
 #include "./gtx/transform2.hpp"
+#include "./gtx/transform_hierarchy.hpp"
 #include "./gtx/vec_swizzle.hpp"
 #include "./gtx/vector_angle.hpp"
 #include "./gtx/vector_query.hpp"
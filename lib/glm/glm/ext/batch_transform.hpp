@@ -0,0 +1,93 @@
+/// @ref ext_batch_transform
+/// @file glm/ext/batch_transform.hpp
+///
+/// @defgroup ext_batch_transform GLM_EXT_batch_transform
+/// @ingroup ext
+///
+/// Transform arrays of vectors or points by a single 4x4 matrix.
+///
+/// Inputs are either structure of arrays (SoA), one array per component, or arrays of packed 3 components vectors.
+/// For float values and when SIMD is enabled, 4 (SSE2) or 8 (AVX) elements are transformed per iteration.
+///
+/// Arrays don't need to be aligned. Each output array may be the same as the matching input array
+/// but must not partially overlap any input array.
+///
+/// Include <glm/ext/batch_transform.hpp> to use the features of this extension.
+///
+/// @see ext_matrix_transform
+/// @see ext_matrix_projection
+
+#pragma once
+
+// Dependencies
+#include "../detail/qualifier.hpp"
+#include "../mat4x4.hpp"
+#include "../vec3.hpp"
+#include "../vec4.hpp"
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_EXT_batch_transform extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup ext_batch_transform
+	/// @{
+
+	/// Transform Count 4 components vectors stored as structure of arrays: out[i] = m * in[i].
+	///
+	/// @param m Transformation matrix.
+	/// @param inX, inY, inZ, inW Arrays of Count input components.
+	/// @param outX, outY, outZ, outW Arrays of Count output components.
+	/// @param Count Number of vectors to transform.
+	///
+	/// @tparam T A floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void batchTransform(mat<4, 4, T, Q> const& m,
+		T const* inX, T const* inY, T const* inZ, T const* inW,
+		T* outX, T* outY, T* outZ, T* outW, std::size_t Count);
+
+	/// Transform Count points stored as structure of arrays: out[i] = vec3(m * vec4(in[i], 1)).
+	///
+	/// The w component of the result is discarded, this is intended for affine transformations.
+	///
+	/// @tparam T A floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void batchTransformPoints(mat<4, 4, T, Q> const& m,
+		T const* inX, T const* inY, T const* inZ,
+		T* outX, T* outY, T* outZ, std::size_t Count);
+
+	/// Transform Count packed points: out[i] = vec3(m * vec4(in[i], 1)).
+	///
+	/// The w component of the result is discarded, this is intended for affine transformations.
+	///
+	/// @tparam T A floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void batchTransformPoints(mat<4, 4, T, Q> const& m, vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t Count);
+
+	/// Transform Count points stored as structure of arrays and apply the perspective divide:
+	/// out[i] = vec3(m * vec4(in[i], 1)) / (m * vec4(in[i], 1)).w
+	///
+	/// @tparam T A floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void batchProjectPoints(mat<4, 4, T, Q> const& m,
+		T const* inX, T const* inY, T const* inZ,
+		T* outX, T* outY, T* outZ, std::size_t Count);
+
+	/// Transform Count packed points and apply the perspective divide:
+	/// out[i] = vec3(m * vec4(in[i], 1)) / (m * vec4(in[i], 1)).w
+	///
+	/// @tparam T A floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void batchProjectPoints(mat<4, 4, T, Q> const& m, vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t Count);
+
+	/// @}
+}//namespace glm
+
+#include "batch_transform.inl"
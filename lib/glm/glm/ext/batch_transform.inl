@@ -0,0 +1,117 @@
+namespace glm{
+namespace detail
+{
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_batch_transform
+	{
+		GLM_FUNC_QUALIFIER static void vectors(mat<4, 4, T, Q> const& m,
+			T const* inX, T const* inY, T const* inZ, T const* inW,
+			T* outX, T* outY, T* outZ, T* outW, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				vec<4, T, Q> const Result(m * vec<4, T, Q>(inX[i], inY[i], inZ[i], inW[i]));
+				outX[i] = Result.x;
+				outY[i] = Result.y;
+				outZ[i] = Result.z;
+				outW[i] = Result.w;
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void points(mat<4, 4, T, Q> const& m,
+			T const* inX, T const* inY, T const* inZ,
+			T* outX, T* outY, T* outZ, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				vec<4, T, Q> const Result(m * vec<4, T, Q>(inX[i], inY[i], inZ[i], static_cast<T>(1)));
+				outX[i] = Result.x;
+				outY[i] = Result.y;
+				outZ[i] = Result.z;
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void project(mat<4, 4, T, Q> const& m,
+			T const* inX, T const* inY, T const* inZ,
+			T* outX, T* outY, T* outZ, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				vec<4, T, Q> const Result(m * vec<4, T, Q>(inX[i], inY[i], inZ[i], static_cast<T>(1)));
+				outX[i] = Result.x / Result.w;
+				outY[i] = Result.y / Result.w;
+				outZ[i] = Result.z / Result.w;
+			}
+		}
+	};
+
+	template<typename T, qualifier Q, bool Packed>
+	struct compute_batch_transform_vec3
+	{
+		GLM_FUNC_QUALIFIER static void points(mat<4, 4, T, Q> const& m, vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				out[i] = vec<3, T, Q>(m * vec<4, T, Q>(in[i], static_cast<T>(1)));
+		}
+
+		GLM_FUNC_QUALIFIER static void project(mat<4, 4, T, Q> const& m, vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				vec<4, T, Q> const Result(m * vec<4, T, Q>(in[i], static_cast<T>(1)));
+				out[i] = vec<3, T, Q>(Result) / Result.w;
+			}
+		}
+	};
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void batchTransform(mat<4, 4, T, Q> const& m,
+		T const* inX, T const* inY, T const* inZ, T const* inW,
+		T* outX, T* outY, T* outZ, T* outW, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'batchTransform' only accept floating-point inputs");
+
+		detail::compute_batch_transform<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::vectors(m, inX, inY, inZ, inW, outX, outY, outZ, outW, Count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void batchTransformPoints(mat<4, 4, T, Q> const& m,
+		T const* inX, T const* inY, T const* inZ,
+		T* outX, T* outY, T* outZ, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'batchTransformPoints' only accept floating-point inputs");
+
+		detail::compute_batch_transform<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::points(m, inX, inY, inZ, outX, outY, outZ, Count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void batchTransformPoints(mat<4, 4, T, Q> const& m, vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'batchTransformPoints' only accept floating-point inputs");
+
+		detail::compute_batch_transform_vec3<T, Q, sizeof(vec<3, T, Q>) == sizeof(T) * 3>::points(m, in, out, Count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void batchProjectPoints(mat<4, 4, T, Q> const& m,
+		T const* inX, T const* inY, T const* inZ,
+		T* outX, T* outY, T* outZ, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'batchProjectPoints' only accept floating-point inputs");
+
+		detail::compute_batch_transform<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::project(m, inX, inY, inZ, outX, outY, outZ, Count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void batchProjectPoints(mat<4, 4, T, Q> const& m, vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'batchProjectPoints' only accept floating-point inputs");
+
+		detail::compute_batch_transform_vec3<T, Q, sizeof(vec<3, T, Q>) == sizeof(T) * 3>::project(m, in, out, Count);
+	}
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "batch_transform_simd.inl"
+#endif
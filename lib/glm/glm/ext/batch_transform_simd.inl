@@ -0,0 +1,269 @@
+#include "../simd/packing.h"
+
+namespace glm{
+namespace detail
+{
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	// Row r of m * (x, y, z, w) for 4 vectors, Row[c] holds the broadcasted m[c][r]
+	GLM_FUNC_QUALIFIER glm_vec4 batch_transform_row(glm_vec4 const Row[4], glm_vec4 x, glm_vec4 y, glm_vec4 z, glm_vec4 w)
+	{
+		return glm_vec4_fma(Row[3], w, glm_vec4_fma(Row[2], z, glm_vec4_fma(Row[1], y, _mm_mul_ps(Row[0], x))));
+	}
+
+	// Row r of m * (x, y, z, 1) for 4 points
+	GLM_FUNC_QUALIFIER glm_vec4 batch_transform_row(glm_vec4 const Row[4], glm_vec4 x, glm_vec4 y, glm_vec4 z)
+	{
+		return glm_vec4_fma(Row[2], z, glm_vec4_fma(Row[1], y, glm_vec4_fma(Row[0], x, Row[3])));
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void batch_load_matrix(mat<4, 4, float, Q> const& m, glm_vec4 Rows[4][4])
+	{
+		for(length_t r = 0; r < 4; ++r)
+		for(length_t c = 0; c < 4; ++c)
+			Rows[r][c] = _mm_set1_ps(m[c][r]);
+	}
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	GLM_FUNC_QUALIFIER glm_vec8 batch_transform_row(glm_vec8 const Row[4], glm_vec8 x, glm_vec8 y, glm_vec8 z, glm_vec8 w)
+	{
+		return glm_vec8_fma(Row[3], w, glm_vec8_fma(Row[2], z, glm_vec8_fma(Row[1], y, _mm256_mul_ps(Row[0], x))));
+	}
+
+	GLM_FUNC_QUALIFIER glm_vec8 batch_transform_row(glm_vec8 const Row[4], glm_vec8 x, glm_vec8 y, glm_vec8 z)
+	{
+		return glm_vec8_fma(Row[2], z, glm_vec8_fma(Row[1], y, glm_vec8_fma(Row[0], x, Row[3])));
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void batch_load_matrix(mat<4, 4, float, Q> const& m, glm_vec8 Rows[4][4])
+	{
+		for(length_t r = 0; r < 4; ++r)
+		for(length_t c = 0; c < 4; ++c)
+			Rows[r][c] = _mm256_set1_ps(m[c][r]);
+	}
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+	template<qualifier Q>
+	struct compute_batch_transform<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void vectors(mat<4, 4, float, Q> const& m,
+			float const* inX, float const* inY, float const* inZ, float const* inW,
+			float* outX, float* outY, float* outZ, float* outW, std::size_t Count)
+		{
+			std::size_t i = 0;
+
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+			{
+				glm_vec8 Rows[4][4];
+				batch_load_matrix(m, Rows);
+
+				for(; i + 8 <= Count; i += 8)
+				{
+					glm_vec8 const x = _mm256_loadu_ps(inX + i);
+					glm_vec8 const y = _mm256_loadu_ps(inY + i);
+					glm_vec8 const z = _mm256_loadu_ps(inZ + i);
+					glm_vec8 const w = _mm256_loadu_ps(inW + i);
+
+					_mm256_storeu_ps(outX + i, batch_transform_row(Rows[0], x, y, z, w));
+					_mm256_storeu_ps(outY + i, batch_transform_row(Rows[1], x, y, z, w));
+					_mm256_storeu_ps(outZ + i, batch_transform_row(Rows[2], x, y, z, w));
+					_mm256_storeu_ps(outW + i, batch_transform_row(Rows[3], x, y, z, w));
+				}
+			}
+#			endif
+
+			{
+				glm_vec4 Rows[4][4];
+				batch_load_matrix(m, Rows);
+
+				for(; i + 4 <= Count; i += 4)
+				{
+					glm_vec4 const x = _mm_loadu_ps(inX + i);
+					glm_vec4 const y = _mm_loadu_ps(inY + i);
+					glm_vec4 const z = _mm_loadu_ps(inZ + i);
+					glm_vec4 const w = _mm_loadu_ps(inW + i);
+
+					_mm_storeu_ps(outX + i, batch_transform_row(Rows[0], x, y, z, w));
+					_mm_storeu_ps(outY + i, batch_transform_row(Rows[1], x, y, z, w));
+					_mm_storeu_ps(outZ + i, batch_transform_row(Rows[2], x, y, z, w));
+					_mm_storeu_ps(outW + i, batch_transform_row(Rows[3], x, y, z, w));
+				}
+			}
+
+			compute_batch_transform<float, Q, false>::vectors(m, inX + i, inY + i, inZ + i, inW + i, outX + i, outY + i, outZ + i, outW + i, Count - i);
+		}
+
+		GLM_FUNC_QUALIFIER static void points(mat<4, 4, float, Q> const& m,
+			float const* inX, float const* inY, float const* inZ,
+			float* outX, float* outY, float* outZ, std::size_t Count)
+		{
+			std::size_t i = 0;
+
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+			{
+				glm_vec8 Rows[4][4];
+				batch_load_matrix(m, Rows);
+
+				for(; i + 8 <= Count; i += 8)
+				{
+					glm_vec8 const x = _mm256_loadu_ps(inX + i);
+					glm_vec8 const y = _mm256_loadu_ps(inY + i);
+					glm_vec8 const z = _mm256_loadu_ps(inZ + i);
+
+					_mm256_storeu_ps(outX + i, batch_transform_row(Rows[0], x, y, z));
+					_mm256_storeu_ps(outY + i, batch_transform_row(Rows[1], x, y, z));
+					_mm256_storeu_ps(outZ + i, batch_transform_row(Rows[2], x, y, z));
+				}
+			}
+#			endif
+
+			{
+				glm_vec4 Rows[4][4];
+				batch_load_matrix(m, Rows);
+
+				for(; i + 4 <= Count; i += 4)
+				{
+					glm_vec4 const x = _mm_loadu_ps(inX + i);
+					glm_vec4 const y = _mm_loadu_ps(inY + i);
+					glm_vec4 const z = _mm_loadu_ps(inZ + i);
+
+					_mm_storeu_ps(outX + i, batch_transform_row(Rows[0], x, y, z));
+					_mm_storeu_ps(outY + i, batch_transform_row(Rows[1], x, y, z));
+					_mm_storeu_ps(outZ + i, batch_transform_row(Rows[2], x, y, z));
+				}
+			}
+
+			compute_batch_transform<float, Q, false>::points(m, inX + i, inY + i, inZ + i, outX + i, outY + i, outZ + i, Count - i);
+		}
+
+		GLM_FUNC_QUALIFIER static void project(mat<4, 4, float, Q> const& m,
+			float const* inX, float const* inY, float const* inZ,
+			float* outX, float* outY, float* outZ, std::size_t Count)
+		{
+			std::size_t i = 0;
+
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+			{
+				glm_vec8 Rows[4][4];
+				batch_load_matrix(m, Rows);
+
+				for(; i + 8 <= Count; i += 8)
+				{
+					glm_vec8 const x = _mm256_loadu_ps(inX + i);
+					glm_vec8 const y = _mm256_loadu_ps(inY + i);
+					glm_vec8 const z = _mm256_loadu_ps(inZ + i);
+					glm_vec8 const w = batch_transform_row(Rows[3], x, y, z);
+
+					_mm256_storeu_ps(outX + i, _mm256_div_ps(batch_transform_row(Rows[0], x, y, z), w));
+					_mm256_storeu_ps(outY + i, _mm256_div_ps(batch_transform_row(Rows[1], x, y, z), w));
+					_mm256_storeu_ps(outZ + i, _mm256_div_ps(batch_transform_row(Rows[2], x, y, z), w));
+				}
+			}
+#			endif
+
+			{
+				glm_vec4 Rows[4][4];
+				batch_load_matrix(m, Rows);
+
+				for(; i + 4 <= Count; i += 4)
+				{
+					glm_vec4 const x = _mm_loadu_ps(inX + i);
+					glm_vec4 const y = _mm_loadu_ps(inY + i);
+					glm_vec4 const z = _mm_loadu_ps(inZ + i);
+					glm_vec4 const w = batch_transform_row(Rows[3], x, y, z);
+
+					_mm_storeu_ps(outX + i, _mm_div_ps(batch_transform_row(Rows[0], x, y, z), w));
+					_mm_storeu_ps(outY + i, _mm_div_ps(batch_transform_row(Rows[1], x, y, z), w));
+					_mm_storeu_ps(outZ + i, _mm_div_ps(batch_transform_row(Rows[2], x, y, z), w));
+				}
+			}
+
+			compute_batch_transform<float, Q, false>::project(m, inX + i, inY + i, inZ + i, outX + i, outY + i, outZ + i, Count - i);
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_batch_transform_vec3<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void points(mat<4, 4, float, Q> const& m, vec<3, float, Q> const* in, vec<3, float, Q>* out, std::size_t Count)
+		{
+			float const* const In = reinterpret_cast<float const*>(in);
+			float* const Out = reinterpret_cast<float*>(out);
+			std::size_t i = 0;
+
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+			{
+				glm_vec8 Rows[4][4];
+				batch_load_matrix(m, Rows);
+
+				for(; i + 8 <= Count; i += 8)
+				{
+					glm_vec8 x, y, z;
+					glm_vec8_load_packed3(In + i * 3, &x, &y, &z);
+					glm_vec8_store_packed3(Out + i * 3, batch_transform_row(Rows[0], x, y, z), batch_transform_row(Rows[1], x, y, z), batch_transform_row(Rows[2], x, y, z));
+				}
+			}
+#			endif
+
+			{
+				glm_vec4 Rows[4][4];
+				batch_load_matrix(m, Rows);
+
+				for(; i + 4 <= Count; i += 4)
+				{
+					glm_vec4 x, y, z;
+					glm_vec4_load_packed3(In + i * 3, &x, &y, &z);
+					glm_vec4_store_packed3(Out + i * 3, batch_transform_row(Rows[0], x, y, z), batch_transform_row(Rows[1], x, y, z), batch_transform_row(Rows[2], x, y, z));
+				}
+			}
+
+			compute_batch_transform_vec3<float, Q, false>::points(m, in + i, out + i, Count - i);
+		}
+
+		GLM_FUNC_QUALIFIER static void project(mat<4, 4, float, Q> const& m, vec<3, float, Q> const* in, vec<3, float, Q>* out, std::size_t Count)
+		{
+			float const* const In = reinterpret_cast<float const*>(in);
+			float* const Out = reinterpret_cast<float*>(out);
+			std::size_t i = 0;
+
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+			{
+				glm_vec8 Rows[4][4];
+				batch_load_matrix(m, Rows);
+
+				for(; i + 8 <= Count; i += 8)
+				{
+					glm_vec8 x, y, z;
+					glm_vec8_load_packed3(In + i * 3, &x, &y, &z);
+					glm_vec8 const w = batch_transform_row(Rows[3], x, y, z);
+					glm_vec8_store_packed3(Out + i * 3,
+						_mm256_div_ps(batch_transform_row(Rows[0], x, y, z), w),
+						_mm256_div_ps(batch_transform_row(Rows[1], x, y, z), w),
+						_mm256_div_ps(batch_transform_row(Rows[2], x, y, z), w));
+				}
+			}
+#			endif
+
+			{
+				glm_vec4 Rows[4][4];
+				batch_load_matrix(m, Rows);
+
+				for(; i + 4 <= Count; i += 4)
+				{
+					glm_vec4 x, y, z;
+					glm_vec4_load_packed3(In + i * 3, &x, &y, &z);
+					glm_vec4 const w = batch_transform_row(Rows[3], x, y, z);
+					glm_vec4_store_packed3(Out + i * 3,
+						_mm_div_ps(batch_transform_row(Rows[0], x, y, z), w),
+						_mm_div_ps(batch_transform_row(Rows[1], x, y, z), w),
+						_mm_div_ps(batch_transform_row(Rows[2], x, y, z), w));
+				}
+			}
+
+			compute_batch_transform_vec3<float, Q, false>::project(m, in + i, out + i, Count - i);
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+}//namespace detail
+}//namespace glm
@@ -0,0 +1,106 @@
+/// @ref ext_culling
+/// @file glm/ext/culling.hpp
+///
+/// @defgroup ext_culling GLM_EXT_culling
+/// @ingroup ext
+///
+/// Extract the clipping planes of a projection matrix and test arrays of bounding volumes against them.
+///
+/// A plane is stored as vec4(normal, distance) with a unit normal pointing inside the frustum so that
+/// dot(vec3(Plane), p) + Plane.w is the signed distance of the point p to the plane.
+///
+/// Bounding volumes are structure of arrays (SoA), one array per component. Results are visibility bitmasks:
+/// bit i % 32 of Visible[i / 32] is set when the volume i may be visible, the tests are conservative.
+/// (Count + 31) / 32 words are written and the bits after Count are cleared.
+/// For float values and when SIMD is enabled, 4 (SSE2) or 8 (AVX) volumes are tested per iteration.
+///
+/// Include <glm/ext/culling.hpp> to use the features of this extension.
+///
+/// @see ext_matrix_clip_space
+/// @see ext_batch_transform
+
+#pragma once
+
+// Dependencies
+#include "../detail/qualifier.hpp"
+#include "../common.hpp"
+#include "../geometric.hpp"
+#include "../integer.hpp"
+#include "../mat4x4.hpp"
+#include "../vec4.hpp"
+#include "scalar_uint_sized.hpp"
+#include <cstddef>
+#include <limits>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_EXT_culling extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup ext_culling
+	/// @{
+
+	/// Extract the 6 normalized frustum planes of m, a projection or view projection matrix
+	/// with a clip space depth in [0, 1]: left, right, bottom, top, near and far.
+	///
+	/// A degenerate plane, such as the far plane of infinitePerspective, is replaced by vec4(0, 0, 0, 1)
+	/// that never culls.
+	///
+	/// @tparam T A floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void frustumPlanesZO(mat<4, 4, T, Q> const& m, vec<4, T, Q> Planes[6]);
+
+	/// Extract the 6 normalized frustum planes of m, a projection or view projection matrix
+	/// with a clip space depth in [-1, 1]: left, right, bottom, top, near and far.
+	///
+	/// @tparam T A floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void frustumPlanesNO(mat<4, 4, T, Q> const& m, vec<4, T, Q> Planes[6]);
+
+	/// Extract the 6 normalized frustum planes of m, a projection or view projection matrix
+	/// with the clip space depth of GLM_FORCE_DEPTH_ZERO_TO_ONE: left, right, bottom, top, near and far.
+	///
+	/// @tparam T A floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void frustumPlanes(mat<4, 4, T, Q> const& m, vec<4, T, Q> Planes[6]);
+
+	/// Test Count spheres against 6 planes. A sphere is visible unless it is entirely behind one of the planes.
+	///
+	/// @param Planes Normalized planes, such as the output of frustumPlanes.
+	/// @param centerX, centerY, centerZ, radius Arrays of Count sphere components.
+	/// @param Visible Array of (Count + 31) / 32 visibility masks.
+	/// @param Count Number of spheres.
+	/// @return The number of visible spheres.
+	///
+	/// @tparam T A floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL std::size_t cullSpheres(vec<4, T, Q> const Planes[6],
+		T const* centerX, T const* centerY, T const* centerZ, T const* radius,
+		uint32* Visible, std::size_t Count);
+
+	/// Test Count axis aligned bounding boxes against 6 planes. A box is visible unless it is entirely behind one of the planes.
+	///
+	/// @param Planes Normalized planes, such as the output of frustumPlanes.
+	/// @param minX, minY, minZ Arrays of Count box minimum corner components.
+	/// @param maxX, maxY, maxZ Arrays of Count box maximum corner components.
+	/// @param Visible Array of (Count + 31) / 32 visibility masks.
+	/// @param Count Number of boxes.
+	/// @return The number of visible boxes.
+	///
+	/// @tparam T A floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL std::size_t cullAABBs(vec<4, T, Q> const Planes[6],
+		T const* minX, T const* minY, T const* minZ,
+		T const* maxX, T const* maxY, T const* maxZ,
+		uint32* Visible, std::size_t Count);
+
+	/// @}
+}//namespace glm
+
+#include "culling.inl"
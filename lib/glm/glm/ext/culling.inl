@@ -0,0 +1,142 @@
+namespace glm{
+namespace detail
+{
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<4, T, Q> culling_normalize_plane(vec<4, T, Q> const& Plane)
+	{
+		T const Length = length(vec<3, T, Q>(Plane));
+		return Length > static_cast<T>(0) ? Plane / Length : vec<4, T, Q>(static_cast<T>(0), static_cast<T>(0), static_cast<T>(0), static_cast<T>(1));
+	}
+
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_culling
+	{
+		GLM_FUNC_QUALIFIER static std::size_t spheres(vec<4, T, Q> const Planes[6],
+			T const* centerX, T const* centerY, T const* centerZ, T const* radius,
+			uint32* Visible, std::size_t Count)
+		{
+			std::size_t Result = 0;
+			for(std::size_t i = 0; i < Count; i += 32)
+			{
+				std::size_t const n = glm::min(Count - i, static_cast<std::size_t>(32));
+
+				uint32 Mask = 0;
+				for(std::size_t j = 0; j < n; ++j)
+				{
+					vec<3, T, Q> const Center(centerX[i + j], centerY[i + j], centerZ[i + j]);
+					T const Radius = -radius[i + j];
+
+					bool Inside = true;
+					for(length_t p = 0; p < 6; ++p)
+						Inside = Inside && dot(vec<3, T, Q>(Planes[p]), Center) + Planes[p].w >= Radius;
+
+					Mask |= static_cast<uint32>(Inside) << j;
+					Result += static_cast<std::size_t>(Inside);
+				}
+				Visible[i / 32] = Mask;
+			}
+			return Result;
+		}
+
+		// Only the corner the furthest along the plane normal needs to be tested
+		GLM_FUNC_QUALIFIER static std::size_t aabbs(vec<4, T, Q> const Planes[6],
+			T const* minX, T const* minY, T const* minZ,
+			T const* maxX, T const* maxY, T const* maxZ,
+			uint32* Visible, std::size_t Count)
+		{
+			std::size_t Result = 0;
+			for(std::size_t i = 0; i < Count; i += 32)
+			{
+				std::size_t const n = glm::min(Count - i, static_cast<std::size_t>(32));
+
+				uint32 Mask = 0;
+				for(std::size_t j = 0; j < n; ++j)
+				{
+					vec<3, T, Q> const Min(minX[i + j], minY[i + j], minZ[i + j]);
+					vec<3, T, Q> const Max(maxX[i + j], maxY[i + j], maxZ[i + j]);
+
+					bool Inside = true;
+					for(length_t p = 0; p < 6; ++p)
+					{
+						vec<3, T, Q> const Corner(
+							Planes[p].x >= static_cast<T>(0) ? Max.x : Min.x,
+							Planes[p].y >= static_cast<T>(0) ? Max.y : Min.y,
+							Planes[p].z >= static_cast<T>(0) ? Max.z : Min.z);
+						Inside = Inside && dot(vec<3, T, Q>(Planes[p]), Corner) + Planes[p].w >= static_cast<T>(0);
+					}
+
+					Mask |= static_cast<uint32>(Inside) << j;
+					Result += static_cast<std::size_t>(Inside);
+				}
+				Visible[i / 32] = Mask;
+			}
+			return Result;
+		}
+	};
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void frustumPlanesZO(mat<4, 4, T, Q> const& m, vec<4, T, Q> Planes[6])
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'frustumPlanesZO' only accept floating-point inputs");
+
+		vec<4, T, Q> const Row0(m[0][0], m[1][0], m[2][0], m[3][0]);
+		vec<4, T, Q> const Row1(m[0][1], m[1][1], m[2][1], m[3][1]);
+		vec<4, T, Q> const Row2(m[0][2], m[1][2], m[2][2], m[3][2]);
+		vec<4, T, Q> const Row3(m[0][3], m[1][3], m[2][3], m[3][3]);
+
+		Planes[0] = detail::culling_normalize_plane(Row3 + Row0);
+		Planes[1] = detail::culling_normalize_plane(Row3 - Row0);
+		Planes[2] = detail::culling_normalize_plane(Row3 + Row1);
+		Planes[3] = detail::culling_normalize_plane(Row3 - Row1);
+		Planes[4] = detail::culling_normalize_plane(Row2);
+		Planes[5] = detail::culling_normalize_plane(Row3 - Row2);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void frustumPlanesNO(mat<4, 4, T, Q> const& m, vec<4, T, Q> Planes[6])
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'frustumPlanesNO' only accept floating-point inputs");
+
+		frustumPlanesZO(m, Planes);
+
+		vec<4, T, Q> const Row2(m[0][2], m[1][2], m[2][2], m[3][2]);
+		vec<4, T, Q> const Row3(m[0][3], m[1][3], m[2][3], m[3][3]);
+		Planes[4] = detail::culling_normalize_plane(Row3 + Row2);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void frustumPlanes(mat<4, 4, T, Q> const& m, vec<4, T, Q> Planes[6])
+	{
+#		if GLM_CONFIG_CLIP_CONTROL & GLM_CLIP_CONTROL_ZO_BIT
+			frustumPlanesZO(m, Planes);
+#		else
+			frustumPlanesNO(m, Planes);
+#		endif
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t cullSpheres(vec<4, T, Q> const Planes[6],
+		T const* centerX, T const* centerY, T const* centerZ, T const* radius,
+		uint32* Visible, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'cullSpheres' only accept floating-point inputs");
+
+		return detail::compute_culling<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::spheres(Planes, centerX, centerY, centerZ, radius, Visible, Count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t cullAABBs(vec<4, T, Q> const Planes[6],
+		T const* minX, T const* minY, T const* minZ,
+		T const* maxX, T const* maxY, T const* maxZ,
+		uint32* Visible, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'cullAABBs' only accept floating-point inputs");
+
+		return detail::compute_culling<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::aabbs(Planes, minX, minY, minZ, maxX, maxY, maxZ, Visible, Count);
+	}
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "culling_simd.inl"
+#endif
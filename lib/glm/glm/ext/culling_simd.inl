@@ -0,0 +1,165 @@
+#include "../simd/common.h"
+
+namespace glm{
+namespace detail
+{
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void culling_load_planes(vec<4, float, Q> const Planes[6], glm_vec4 Broadcast[6][4])
+	{
+		for(length_t p = 0; p < 6; ++p)
+		for(length_t c = 0; c < 4; ++c)
+			Broadcast[p][c] = _mm_set1_ps(Planes[p][c]);
+	}
+
+	// Signed distance of 4 points to a plane
+	GLM_FUNC_QUALIFIER glm_vec4 culling_distance(glm_vec4 const Plane[4], glm_vec4 x, glm_vec4 y, glm_vec4 z)
+	{
+		return glm_vec4_fma(Plane[2], z, glm_vec4_fma(Plane[1], y, glm_vec4_fma(Plane[0], x, Plane[3])));
+	}
+
+	GLM_FUNC_QUALIFIER int culling_spheres_mask(glm_vec4 const Planes[6][4], float const* centerX, float const* centerY, float const* centerZ, float const* radius)
+	{
+		glm_vec4 const x = _mm_loadu_ps(centerX);
+		glm_vec4 const y = _mm_loadu_ps(centerY);
+		glm_vec4 const z = _mm_loadu_ps(centerZ);
+		glm_vec4 const r = _mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(radius));
+
+		glm_vec4 Inside = _mm_cmpge_ps(culling_distance(Planes[0], x, y, z), r);
+		for(length_t p = 1; p < 6; ++p)
+			Inside = _mm_and_ps(Inside, _mm_cmpge_ps(culling_distance(Planes[p], x, y, z), r));
+		return _mm_movemask_ps(Inside);
+	}
+
+	GLM_FUNC_QUALIFIER int culling_aabbs_mask(glm_vec4 const Planes[6][4], bool const Positive[6][3],
+		float const* minX, float const* minY, float const* minZ,
+		float const* maxX, float const* maxY, float const* maxZ)
+	{
+		glm_vec4 const Min[3] = {_mm_loadu_ps(minX), _mm_loadu_ps(minY), _mm_loadu_ps(minZ)};
+		glm_vec4 const Max[3] = {_mm_loadu_ps(maxX), _mm_loadu_ps(maxY), _mm_loadu_ps(maxZ)};
+
+		glm_vec4 Inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+		for(length_t p = 0; p < 6; ++p)
+		{
+			glm_vec4 const Distance = culling_distance(Planes[p],
+				Positive[p][0] ? Max[0] : Min[0],
+				Positive[p][1] ? Max[1] : Min[1],
+				Positive[p][2] ? Max[2] : Min[2]);
+			Inside = _mm_and_ps(Inside, _mm_cmpge_ps(Distance, _mm_setzero_ps()));
+		}
+		return _mm_movemask_ps(Inside);
+	}
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void culling_load_planes(vec<4, float, Q> const Planes[6], glm_vec8 Broadcast[6][4])
+	{
+		for(length_t p = 0; p < 6; ++p)
+		for(length_t c = 0; c < 4; ++c)
+			Broadcast[p][c] = _mm256_set1_ps(Planes[p][c]);
+	}
+
+	GLM_FUNC_QUALIFIER glm_vec8 culling_distance(glm_vec8 const Plane[4], glm_vec8 x, glm_vec8 y, glm_vec8 z)
+	{
+		return glm_vec8_fma(Plane[2], z, glm_vec8_fma(Plane[1], y, glm_vec8_fma(Plane[0], x, Plane[3])));
+	}
+
+	GLM_FUNC_QUALIFIER int culling_spheres_mask(glm_vec8 const Planes[6][4], float const* centerX, float const* centerY, float const* centerZ, float const* radius)
+	{
+		glm_vec8 const x = _mm256_loadu_ps(centerX);
+		glm_vec8 const y = _mm256_loadu_ps(centerY);
+		glm_vec8 const z = _mm256_loadu_ps(centerZ);
+		glm_vec8 const r = _mm256_sub_ps(_mm256_setzero_ps(), _mm256_loadu_ps(radius));
+
+		glm_vec8 Inside = _mm256_cmp_ps(culling_distance(Planes[0], x, y, z), r, _CMP_GE_OQ);
+		for(length_t p = 1; p < 6; ++p)
+			Inside = _mm256_and_ps(Inside, _mm256_cmp_ps(culling_distance(Planes[p], x, y, z), r, _CMP_GE_OQ));
+		return _mm256_movemask_ps(Inside);
+	}
+
+	GLM_FUNC_QUALIFIER int culling_aabbs_mask(glm_vec8 const Planes[6][4], bool const Positive[6][3],
+		float const* minX, float const* minY, float const* minZ,
+		float const* maxX, float const* maxY, float const* maxZ)
+	{
+		glm_vec8 const Min[3] = {_mm256_loadu_ps(minX), _mm256_loadu_ps(minY), _mm256_loadu_ps(minZ)};
+		glm_vec8 const Max[3] = {_mm256_loadu_ps(maxX), _mm256_loadu_ps(maxY), _mm256_loadu_ps(maxZ)};
+
+		glm_vec8 Inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+		for(length_t p = 0; p < 6; ++p)
+		{
+			glm_vec8 const Distance = culling_distance(Planes[p],
+				Positive[p][0] ? Max[0] : Min[0],
+				Positive[p][1] ? Max[1] : Min[1],
+				Positive[p][2] ? Max[2] : Min[2]);
+			Inside = _mm256_and_ps(Inside, _mm256_cmp_ps(Distance, _mm256_setzero_ps(), _CMP_GE_OQ));
+		}
+		return _mm256_movemask_ps(Inside);
+	}
+
+	typedef glm_vec8 culling_register;
+	static std::size_t const culling_lanes = 8;
+#	else
+	typedef glm_vec4 culling_register;
+	static std::size_t const culling_lanes = 4;
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+	// Whole 32 volume words use the SIMD masks, the last partial word uses the generic code
+	template<qualifier Q>
+	struct compute_culling<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static std::size_t spheres(vec<4, float, Q> const Planes[6],
+			float const* centerX, float const* centerY, float const* centerZ, float const* radius,
+			uint32* Visible, std::size_t Count)
+		{
+			culling_register Broadcast[6][4];
+			culling_load_planes(Planes, Broadcast);
+
+			std::size_t Result = 0;
+			std::size_t i = 0;
+			for(; i + 32 <= Count; i += 32)
+			{
+				uint32 Mask = 0;
+				for(std::size_t j = 0; j < 32; j += culling_lanes)
+					Mask |= static_cast<uint32>(culling_spheres_mask(Broadcast, centerX + i + j, centerY + i + j, centerZ + i + j, radius + i + j)) << j;
+
+				Visible[i / 32] = Mask;
+				Result += static_cast<std::size_t>(bitCount(Mask));
+			}
+
+			return Result + compute_culling<float, Q, false>::spheres(Planes, centerX + i, centerY + i, centerZ + i, radius + i, Visible + i / 32, Count - i);
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t aabbs(vec<4, float, Q> const Planes[6],
+			float const* minX, float const* minY, float const* minZ,
+			float const* maxX, float const* maxY, float const* maxZ,
+			uint32* Visible, std::size_t Count)
+		{
+			culling_register Broadcast[6][4];
+			culling_load_planes(Planes, Broadcast);
+
+			bool Positive[6][3];
+			for(length_t p = 0; p < 6; ++p)
+			for(length_t c = 0; c < 3; ++c)
+				Positive[p][c] = Planes[p][c] >= 0.0f;
+
+			std::size_t Result = 0;
+			std::size_t i = 0;
+			for(; i + 32 <= Count; i += 32)
+			{
+				uint32 Mask = 0;
+				for(std::size_t j = 0; j < 32; j += culling_lanes)
+				{
+					std::size_t const k = i + j;
+					Mask |= static_cast<uint32>(culling_aabbs_mask(Broadcast, Positive, minX + k, minY + k, minZ + k, maxX + k, maxY + k, maxZ + k)) << j;
+				}
+
+				Visible[i / 32] = Mask;
+				Result += static_cast<std::size_t>(bitCount(Mask));
+			}
+
+			return Result + compute_culling<float, Q, false>::aabbs(Planes, minX + i, minY + i, minZ + i, maxX + i, maxY + i, maxZ + i, Visible + i / 32, Count - i);
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+}//namespace detail
+}//namespace glm
@@ -0,0 +1,108 @@
+/// @ref ext_matrix_affine
+/// @file glm/ext/matrix_affine.hpp
+///
+/// @defgroup ext_matrix_affine GLM_EXT_matrix_affine
+/// @ingroup ext
+///
+/// Affine transforms stored in 3x4 matrices, the last row (0, 0, 0, 1) of the equivalent mat4 being implicit.
+///
+/// An affine mat<3, 4, T, Q> stores rows like mat3x4_cast(tdualquat) and the palettes of skinLinearBlend:
+/// m[r] = vec4(row r of the linear part, translation[r]). This is the transpose of the upper 3 rows of a mat4
+/// so the mat3x4 constructors and operators don't apply, use mat3x4_cast and mat4_cast to convert from and to mat4.
+///
+/// Composing two affine transforms takes 36 multiplications instead of 64 and loads 96 bytes instead of 128 with float.
+/// For float values and when SIMD is enabled, the functions work on the rows with SSE2 whatever the alignment.
+///
+/// Include <glm/ext/matrix_affine.hpp> to use the features of this extension.
+///
+/// @see ext_batch_transform
+/// @see gtc_matrix_inverse
+
+#pragma once
+
+// Dependencies
+#include "../detail/qualifier.hpp"
+#include "../geometric.hpp"
+#include "../matrix.hpp"
+#include "../mat3x3.hpp"
+#include "../mat3x4.hpp"
+#include "../mat4x4.hpp"
+#include <cstddef>
+#include <limits>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_EXT_matrix_affine extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup ext_matrix_affine
+	/// @{
+
+	/// Build the affine 3x4 matrix of the upper 3 rows of m. The last row of m is ignored.
+	///
+	/// @tparam T A floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<3, 4, T, Q> mat3x4_cast(mat<4, 4, T, Q> const& m);
+
+	/// Build the mat4 of an affine 3x4 matrix, its last row is (0, 0, 0, 1).
+	///
+	/// @tparam T A floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<4, 4, T, Q> mat4_cast(mat<3, 4, T, Q> const& m);
+
+	/// Compose two affine transforms, the result applies b then a.
+	/// Equivalent to mat3x4_cast(mat4_cast(a) * mat4_cast(b)).
+	///
+	/// @tparam T A floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<3, 4, T, Q> affineCompose(mat<3, 4, T, Q> const& a, mat<3, 4, T, Q> const& b);
+
+	/// Compose Count pairs of affine transforms: Out[i] = affineCompose(a[i], b[i]).
+	///
+	/// @param a, b Arrays of Count affine transforms.
+	/// @param Out Array of Count affine transforms. It may be a or b but must not partially overlap them.
+	/// @param Count Number of transforms.
+	///
+	/// @tparam T A floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void affineCompose(mat<3, 4, T, Q> const* a, mat<3, 4, T, Q> const* b, mat<3, 4, T, Q>* Out, std::size_t Count);
+
+	/// Transform the point p by an affine transform, translation included.
+	///
+	/// @tparam T A floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL vec<3, T, Q> affineTransformPoint(mat<3, 4, T, Q> const& m, vec<3, T, Q> const& p);
+
+	/// Transform the direction v by the linear part of an affine transform, translation excluded.
+	///
+	/// @tparam T A floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL vec<3, T, Q> affineTransformVector(mat<3, 4, T, Q> const& m, vec<3, T, Q> const& v);
+
+	/// Inverse of an affine transform with an invertible linear part.
+	///
+	/// @tparam T A floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	/// @see gtc_matrix_inverse
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<3, 4, T, Q> affineInverse(mat<3, 4, T, Q> const& m);
+
+	/// Inverse of a rigid transform, a rotation followed by a translation, by transposing the linear part.
+	/// The result is wrong if the linear part is not orthonormal, use affineInverse with scales and shears.
+	///
+	/// @tparam T A floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<3, 4, T, Q> rigidInverse(mat<3, 4, T, Q> const& m);
+
+	/// @}
+}//namespace glm
+
+#include "matrix_affine.inl"
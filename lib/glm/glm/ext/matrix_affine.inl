@@ -0,0 +1,128 @@
+namespace glm{
+namespace detail
+{
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_affine
+	{
+		// Row r of a * b is the row r of a linear part applied to the rows of b, plus the translation of a
+		GLM_FUNC_QUALIFIER static mat<3, 4, T, Q> compose(mat<3, 4, T, Q> const& a, mat<3, 4, T, Q> const& b)
+		{
+			mat<3, 4, T, Q> Result;
+			for(length_t r = 0; r < 3; ++r)
+			{
+				Result[r] = a[r].x * b[0] + a[r].y * b[1] + a[r].z * b[2];
+				Result[r].w += a[r].w;
+			}
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static void compose(mat<3, 4, T, Q> const* a, mat<3, 4, T, Q> const* b, mat<3, 4, T, Q>* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = compose(a[i], b[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static vec<3, T, Q> transformPoint(mat<3, 4, T, Q> const& m, vec<3, T, Q> const& p)
+		{
+			vec<4, T, Q> const v(p, static_cast<T>(1));
+			return vec<3, T, Q>(dot(m[0], v), dot(m[1], v), dot(m[2], v));
+		}
+
+		GLM_FUNC_QUALIFIER static vec<3, T, Q> transformVector(mat<3, 4, T, Q> const& m, vec<3, T, Q> const& v)
+		{
+			return vec<3, T, Q>(dot(vec<3, T, Q>(m[0]), v), dot(vec<3, T, Q>(m[1]), v), dot(vec<3, T, Q>(m[2]), v));
+		}
+
+		// The columns of mat3(m[0], m[1], m[2]) are the rows of the linear part so the columns of its inverse are the rows of the inverse
+		GLM_FUNC_QUALIFIER static mat<3, 4, T, Q> inverse(mat<3, 4, T, Q> const& m)
+		{
+			mat<3, 3, T, Q> const Inv(glm::inverse(mat<3, 3, T, Q>(vec<3, T, Q>(m[0]), vec<3, T, Q>(m[1]), vec<3, T, Q>(m[2]))));
+			vec<3, T, Q> const Translation(m[0].w, m[1].w, m[2].w);
+
+			mat<3, 4, T, Q> Result;
+			for(length_t r = 0; r < 3; ++r)
+				Result[r] = vec<4, T, Q>(Inv[r], -dot(Inv[r], Translation));
+			return Result;
+		}
+
+		// The rows of the inverse linear part are its columns
+		GLM_FUNC_QUALIFIER static mat<3, 4, T, Q> rigidInverse(mat<3, 4, T, Q> const& m)
+		{
+			vec<3, T, Q> const Translation(m[0].w, m[1].w, m[2].w);
+
+			mat<3, 4, T, Q> Result;
+			for(length_t r = 0; r < 3; ++r)
+			{
+				vec<3, T, Q> const Row(m[0][r], m[1][r], m[2][r]);
+				Result[r] = vec<4, T, Q>(Row, -dot(Row, Translation));
+			}
+			return Result;
+		}
+	};
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 4, T, Q> mat3x4_cast(mat<4, 4, T, Q> const& m)
+	{
+		mat<4, 4, T, Q> const Rows(transpose(m));
+		return mat<3, 4, T, Q>(Rows[0], Rows[1], Rows[2]);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<4, 4, T, Q> mat4_cast(mat<3, 4, T, Q> const& m)
+	{
+		return transpose(mat<4, 4, T, Q>(m[0], m[1], m[2], vec<4, T, Q>(static_cast<T>(0), static_cast<T>(0), static_cast<T>(0), static_cast<T>(1))));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 4, T, Q> affineCompose(mat<3, 4, T, Q> const& a, mat<3, 4, T, Q> const& b)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'affineCompose' only accept floating-point inputs");
+
+		return detail::compute_affine<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::compose(a, b);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void affineCompose(mat<3, 4, T, Q> const* a, mat<3, 4, T, Q> const* b, mat<3, 4, T, Q>* Out, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'affineCompose' only accept floating-point inputs");
+
+		detail::compute_affine<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::compose(a, b, Out, Count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<3, T, Q> affineTransformPoint(mat<3, 4, T, Q> const& m, vec<3, T, Q> const& p)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'affineTransformPoint' only accept floating-point inputs");
+
+		return detail::compute_affine<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::transformPoint(m, p);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<3, T, Q> affineTransformVector(mat<3, 4, T, Q> const& m, vec<3, T, Q> const& v)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'affineTransformVector' only accept floating-point inputs");
+
+		return detail::compute_affine<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::transformVector(m, v);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 4, T, Q> affineInverse(mat<3, 4, T, Q> const& m)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'affineInverse' only accept floating-point inputs");
+
+		return detail::compute_affine<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::inverse(m);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 4, T, Q> rigidInverse(mat<3, 4, T, Q> const& m)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'rigidInverse' only accept floating-point inputs");
+
+		return detail::compute_affine<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::rigidInverse(m);
+	}
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "matrix_affine_simd.inl"
+#endif
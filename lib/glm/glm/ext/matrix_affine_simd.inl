@@ -0,0 +1,128 @@
+#include "../simd/matrix.h"
+
+namespace glm{
+namespace detail
+{
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void affine_load(mat<3, 4, float, Q> const& m, glm_vec4 Rows[3])
+	{
+		Rows[0] = _mm_loadu_ps(&m[0][0]);
+		Rows[1] = _mm_loadu_ps(&m[1][0]);
+		Rows[2] = _mm_loadu_ps(&m[2][0]);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void affine_store(glm_vec4 const Rows[3], mat<3, 4, float, Q>& m)
+	{
+		_mm_storeu_ps(&m[0][0], Rows[0]);
+		_mm_storeu_ps(&m[1][0], Rows[1]);
+		_mm_storeu_ps(&m[2][0], Rows[2]);
+	}
+
+	GLM_FUNC_QUALIFIER glm_vec4 affine_compose_row(glm_vec4 a, glm_vec4 const b[3])
+	{
+		glm_vec4 const MaskW = _mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0));
+		glm_vec4 const x = _mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 0, 0));
+		glm_vec4 const y = _mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 1, 1, 1));
+		glm_vec4 const z = _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 2, 2));
+
+		glm_vec4 const mul0 = _mm_mul_ps(b[0], x);
+		glm_vec4 const fma0 = glm_vec4_fma(b[1], y, mul0);
+		glm_vec4 const fma1 = glm_vec4_fma(b[2], z, fma0);
+		return _mm_add_ps(fma1, _mm_and_ps(a, MaskW));
+	}
+
+	GLM_FUNC_QUALIFIER void affine_compose(glm_vec4 const a[3], glm_vec4 const b[3], glm_vec4 Out[3])
+	{
+		Out[0] = affine_compose_row(a[0], b);
+		Out[1] = affine_compose_row(a[1], b);
+		Out[2] = affine_compose_row(a[2], b);
+	}
+
+	template<qualifier Q>
+	struct compute_affine<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<3, 4, float, Q> compose(mat<3, 4, float, Q> const& a, mat<3, 4, float, Q> const& b)
+		{
+			glm_vec4 A[3], B[3], Out[3];
+			affine_load(a, A);
+			affine_load(b, B);
+			affine_compose(A, B, Out);
+
+			mat<3, 4, float, Q> Result;
+			affine_store(Out, Result);
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static void compose(mat<3, 4, float, Q> const* a, mat<3, 4, float, Q> const* b, mat<3, 4, float, Q>* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				glm_vec4 A[3], B[3], Result[3];
+				affine_load(a[i], A);
+				affine_load(b[i], B);
+				affine_compose(A, B, Result);
+				affine_store(Result, Out[i]);
+			}
+		}
+
+		// The horizontal sums of the row products are slower than the scalar dot products
+		GLM_FUNC_QUALIFIER static vec<3, float, Q> transformPoint(mat<3, 4, float, Q> const& m, vec<3, float, Q> const& p)
+		{
+			return compute_affine<float, Q, false>::transformPoint(m, p);
+		}
+
+		GLM_FUNC_QUALIFIER static vec<3, float, Q> transformVector(mat<3, 4, float, Q> const& m, vec<3, float, Q> const& v)
+		{
+			return compute_affine<float, Q, false>::transformVector(m, v);
+		}
+
+		// The columns of the inverse linear part are the cross products of its rows divided by the determinant,
+		// a transpose with the new translation gives the rows of the result
+		GLM_FUNC_QUALIFIER static mat<3, 4, float, Q> inverse(mat<3, 4, float, Q> const& m)
+		{
+			glm_vec4 const Mask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+
+			glm_vec4 Rows[3], Linear[3], Columns[4];
+			affine_load(m, Rows);
+			Linear[0] = _mm_and_ps(Rows[0], Mask);
+			Linear[1] = _mm_and_ps(Rows[1], Mask);
+			Linear[2] = _mm_and_ps(Rows[2], Mask);
+			glm_mat3_inverse_transpose(Linear, Columns);
+
+			glm_vec4 const unp0 = _mm_unpackhi_ps(Rows[0], Rows[1]);
+			glm_vec4 const Translation = _mm_shuffle_ps(unp0, Rows[2], _MM_SHUFFLE(3, 3, 3, 2));
+			Columns[3] = _mm_sub_ps(_mm_setzero_ps(), glm_mat3_mul_vec3(Columns, Translation));
+
+			_MM_TRANSPOSE4_PS(Columns[0], Columns[1], Columns[2], Columns[3]);
+
+			mat<3, 4, float, Q> Result;
+			affine_store(Columns, Result);
+			return Result;
+		}
+
+		// The rows of the inverse linear part are its columns, a transpose with the new translation gives the rows of the result
+		GLM_FUNC_QUALIFIER static mat<3, 4, float, Q> rigidInverse(mat<3, 4, float, Q> const& m)
+		{
+			glm_vec4 Rows[4];
+			affine_load(m, Rows);
+
+			glm_vec4 const x = _mm_shuffle_ps(Rows[0], Rows[0], _MM_SHUFFLE(3, 3, 3, 3));
+			glm_vec4 const y = _mm_shuffle_ps(Rows[1], Rows[1], _MM_SHUFFLE(3, 3, 3, 3));
+			glm_vec4 const z = _mm_shuffle_ps(Rows[2], Rows[2], _MM_SHUFFLE(3, 3, 3, 3));
+			glm_vec4 const mul0 = _mm_mul_ps(Rows[0], x);
+			glm_vec4 const fma0 = glm_vec4_fma(Rows[1], y, mul0);
+			glm_vec4 const fma1 = glm_vec4_fma(Rows[2], z, fma0);
+			Rows[3] = _mm_sub_ps(_mm_setzero_ps(), fma1);
+
+			_MM_TRANSPOSE4_PS(Rows[0], Rows[1], Rows[2], Rows[3]);
+
+			mat<3, 4, float, Q> Result;
+			affine_store(Rows, Result);
+			return Result;
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+}//namespace detail
+}//namespace glm
@@ -0,0 +1,168 @@
+/// @ref ext_quaternion_soa
+/// @file glm/ext/quaternion_soa.hpp
+///
+/// @defgroup ext_quaternion_soa GLM_EXT_quaternion_soa
+/// @ingroup ext
+///
+/// Structure of arrays (SoA) quaternion type and array functions to blend and convert many quaternions at once.
+///
+/// soa_qua<T, W> holds W quaternions, one soa_scalar per component, and is built on GLM_EXT_vector_soa
+/// so float x4 uses SSE2, float x8 uses AVX or a pair of SSE2 registers and double x4 uses AVX.
+///
+/// slerp evaluates sin(t * angle) / sin(angle) with a polynomial in cos(angle) instead of acos and sin
+/// so that every lane runs the same instructions. The interpolation weights differ from glm::slerp by
+/// at most 1e-7 plus the rounding of T.
+///
+/// The array functions process 8 floats or 4 doubles per iteration. Arrays don't need to be aligned.
+///
+/// Include <glm/ext/quaternion_soa.hpp> to use the features of this extension.
+///
+/// @see ext_vector_soa
+/// @see ext_quaternion_common
+
+#pragma once
+
+// Dependencies
+#include "../detail/type_quat.hpp"
+#include "../mat3x4.hpp"
+#include "../mat4x4.hpp"
+#include "vector_soa.hpp"
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_EXT_quaternion_soa extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup ext_quaternion_soa
+	/// @{
+
+	/// W quaternions of type T processed together.
+	///
+	/// @tparam T Floating-point scalar type
+	/// @tparam W Number of lanes
+	template<typename T, length_t W>
+	struct soa_qua
+	{
+		typedef T value_type;
+		typedef soa_scalar<T, W> scalar_type;
+		typedef soa_qua<T, W> type;
+
+		// -- Data --
+
+		scalar_type x, y, z, w;
+
+		// -- Constructors --
+
+		GLM_FUNC_DECL soa_qua() GLM_DEFAULT;
+		GLM_FUNC_DECL soa_qua(scalar_type const& w, scalar_type const& x, scalar_type const& y, scalar_type const& z);
+
+		/// Broadcast q to every lane.
+		template<qualifier Q>
+		GLM_FUNC_DECL explicit soa_qua(qua<T, Q> const& q);
+
+		// -- Conversions --
+
+		/// Gather W consecutive quaternions, p doesn't need to be aligned.
+		template<qualifier Q>
+		GLM_FUNC_DECL static soa_qua<T, W> load(qua<T, Q> const* p);
+
+		/// Scatter the W lanes to consecutive quaternions, p doesn't need to be aligned.
+		template<qualifier Q>
+		GLM_FUNC_DECL void store(qua<T, Q>* p) const;
+	};
+
+	typedef soa_qua<float, 4>		quatx4;
+	typedef soa_qua<float, 8>		quatx8;
+	typedef soa_qua<double, 4>		dquatx4;
+
+	// -- soa_qua operators --
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_qua<T, W> operator-(soa_qua<T, W> const& q);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_qua<T, W> operator+(soa_qua<T, W> const& p, soa_qua<T, W> const& q);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_qua<T, W> operator-(soa_qua<T, W> const& p, soa_qua<T, W> const& q);
+
+	/// Quaternion product of each lane, the rotation q followed by p.
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_qua<T, W> operator*(soa_qua<T, W> const& p, soa_qua<T, W> const& q);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_qua<T, W> operator*(soa_qua<T, W> const& q, soa_scalar<T, W> const& s);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_qua<T, W> operator*(soa_scalar<T, W> const& s, soa_qua<T, W> const& q);
+
+	// -- soa_qua functions --
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_scalar<T, W> dot(soa_qua<T, W> const& x, soa_qua<T, W> const& y);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_qua<T, W> conjugate(soa_qua<T, W> const& q);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_qua<T, W> normalize(soa_qua<T, W> const& q);
+
+	/// Normalized linear interpolation along the short path, cheaper than slerp but not at constant angular velocity.
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_qua<T, W> nlerp(soa_qua<T, W> const& x, soa_qua<T, W> const& y, soa_scalar<T, W> const& a);
+
+	/// Spherical linear interpolation along the short path like slerp(qua<T, Q> const& x, qua<T, Q> const& y, T a).
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_qua<T, W> slerp(soa_qua<T, W> const& x, soa_qua<T, W> const& y, soa_scalar<T, W> const& a);
+
+	// -- Array functions --
+
+	/// Out[i] = slerp(x[i], y[i], a) for Count quaternion pairs.
+	///
+	/// @tparam T Floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void slerp(qua<T, Q> const* x, qua<T, Q> const* y, T a, qua<T, Q>* Out, std::size_t Count);
+
+	/// Out[i] = slerp(x[i], y[i], a[i]) for Count quaternion pairs.
+	///
+	/// @tparam T Floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void slerp(qua<T, Q> const* x, qua<T, Q> const* y, T const* a, qua<T, Q>* Out, std::size_t Count);
+
+	/// Out[i] = nlerp(x[i], y[i], a) for Count quaternion pairs.
+	///
+	/// @tparam T Floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void nlerp(qua<T, Q> const* x, qua<T, Q> const* y, T a, qua<T, Q>* Out, std::size_t Count);
+
+	/// Out[i] = nlerp(x[i], y[i], a[i]) for Count quaternion pairs.
+	///
+	/// @tparam T Floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void nlerp(qua<T, Q> const* x, qua<T, Q> const* y, T const* a, qua<T, Q>* Out, std::size_t Count);
+
+	/// Out[i] = mat4_cast(q[i]) for Count unit quaternions.
+	///
+	/// @tparam T Floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void mat4_cast(qua<T, Q> const* q, mat<4, 4, T, Q>* Out, std::size_t Count);
+
+	/// Convert Count unit quaternions to the rows of their rotation matrix, the 3x4 layout of mat3x4_cast(tdualquat)
+	/// and of skinning palettes: Out[i][r] = vec4(row r of mat3_cast(q[i]), 0).
+	///
+	/// @tparam T Floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void mat3x4_cast(qua<T, Q> const* q, mat<3, 4, T, Q>* Out, std::size_t Count);
+
+	/// @}
+}//namespace glm
+
+#include "quaternion_soa.inl"
@@ -0,0 +1,361 @@
+namespace glm{
+namespace detail
+{
+	// sin(t * angle) / sin(angle) = t * (1 + b[0] * (1 + b[1] * (... * (1 + b[15])))) with b[i] = (U[i] * t^2 - V[i]) * (cos(angle) - 1),
+	// the Taylor series in cos(angle) - 1 truncated after 16 terms and its last term scaled to spread the truncation error,
+	// see "A Fast and Accurate Algorithm for Computing SLERP", David Eberly
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W> slerp_weight(soa_scalar<T, W> const& t, soa_scalar<T, W> const& CosMinusOne)
+	{
+		// U[i] = 1 / ((i + 1) * (2 * i + 3)), V[i] = (i + 1) / (2 * i + 3)
+		static T const U[16] = {
+			static_cast<T>(1.0 / 3.0), static_cast<T>(1.0 / 10.0), static_cast<T>(1.0 / 21.0), static_cast<T>(1.0 / 36.0),
+			static_cast<T>(1.0 / 55.0), static_cast<T>(1.0 / 78.0), static_cast<T>(1.0 / 105.0), static_cast<T>(1.0 / 136.0),
+			static_cast<T>(1.0 / 171.0), static_cast<T>(1.0 / 210.0), static_cast<T>(1.0 / 253.0), static_cast<T>(1.0 / 300.0),
+			static_cast<T>(1.0 / 351.0), static_cast<T>(1.0 / 406.0), static_cast<T>(1.0 / 465.0), static_cast<T>(1.9166733817113828 / 528.0)};
+		static T const V[16] = {
+			static_cast<T>(1.0 / 3.0), static_cast<T>(2.0 / 5.0), static_cast<T>(3.0 / 7.0), static_cast<T>(4.0 / 9.0),
+			static_cast<T>(5.0 / 11.0), static_cast<T>(6.0 / 13.0), static_cast<T>(7.0 / 15.0), static_cast<T>(8.0 / 17.0),
+			static_cast<T>(9.0 / 19.0), static_cast<T>(10.0 / 21.0), static_cast<T>(11.0 / 23.0), static_cast<T>(12.0 / 25.0),
+			static_cast<T>(13.0 / 27.0), static_cast<T>(14.0 / 29.0), static_cast<T>(15.0 / 31.0), static_cast<T>(1.9166733817113828 * 16.0 / 33.0)};
+
+		soa_scalar<T, W> const One(static_cast<T>(1));
+		soa_scalar<T, W> const Square = t * t;
+
+		soa_scalar<T, W> Result(One);
+		for(int i = 15; i >= 0; --i)
+			Result = fma((Square * U[i] - V[i]) * CosMinusOne, Result, One);
+		return t * Result;
+	}
+
+	// Columns of mat3_cast(q)
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER void quat_rotation(soa_qua<T, W> const& q, soa_vec<3, T, W>& c0, soa_vec<3, T, W>& c1, soa_vec<3, T, W>& c2)
+	{
+		T const Two = static_cast<T>(2);
+
+		soa_scalar<T, W> const qxx = q.x * q.x;
+		soa_scalar<T, W> const qyy = q.y * q.y;
+		soa_scalar<T, W> const qzz = q.z * q.z;
+		soa_scalar<T, W> const qxz = q.x * q.z;
+		soa_scalar<T, W> const qxy = q.x * q.y;
+		soa_scalar<T, W> const qyz = q.y * q.z;
+		soa_scalar<T, W> const qwx = q.w * q.x;
+		soa_scalar<T, W> const qwy = q.w * q.y;
+		soa_scalar<T, W> const qwz = q.w * q.z;
+
+		c0 = soa_vec<3, T, W>(static_cast<T>(1) - Two * (qyy + qzz), Two * (qxy + qwz), Two * (qxz - qwy));
+		c1 = soa_vec<3, T, W>(Two * (qxy - qwz), static_cast<T>(1) - Two * (qxx + qzz), Two * (qyz + qwx));
+		c2 = soa_vec<3, T, W>(Two * (qxz + qwy), Two * (qyz - qwx), static_cast<T>(1) - Two * (qxx + qyy));
+	}
+
+	template<typename T>
+	struct quat_soa_lanes
+	{
+		static length_t const value = 4;
+	};
+
+	template<>
+	struct quat_soa_lanes<float>
+	{
+		static length_t const value = 8;
+	};
+
+	// Load the n <= W first quaternions of p, the other lanes are identities
+	template<typename T, length_t W, qualifier Q>
+	GLM_FUNC_QUALIFIER soa_qua<T, W> quat_load(qua<T, Q> const* p, std::size_t n)
+	{
+		if(n == static_cast<std::size_t>(W))
+			return soa_qua<T, W>::load(p);
+
+		qua<T, Q> Tail[W];
+		for(length_t j = 0; j < W; ++j)
+			Tail[j] = static_cast<std::size_t>(j) < n ? p[j] : qua<T, Q>(static_cast<T>(1), static_cast<T>(0), static_cast<T>(0), static_cast<T>(0));
+		return soa_qua<T, W>::load(Tail);
+	}
+
+	template<typename T>
+	struct quat_weight_scalar
+	{
+		T a;
+
+		template<length_t W>
+		GLM_FUNC_QUALIFIER soa_scalar<T, W> load(std::size_t, std::size_t) const
+		{
+			return soa_scalar<T, W>(a);
+		}
+	};
+
+	template<typename T>
+	struct quat_weight_array
+	{
+		T const* a;
+
+		template<length_t W>
+		GLM_FUNC_QUALIFIER soa_scalar<T, W> load(std::size_t i, std::size_t n) const
+		{
+			if(n == static_cast<std::size_t>(W))
+				return soa_scalar<T, W>::load(a + i);
+
+			T Tail[W];
+			for(length_t j = 0; j < W; ++j)
+				Tail[j] = static_cast<std::size_t>(j) < n ? a[i + j] : static_cast<T>(0);
+			return soa_scalar<T, W>::load(Tail);
+		}
+	};
+
+	struct quat_slerp_func
+	{
+		template<typename T, length_t W>
+		GLM_FUNC_QUALIFIER soa_qua<T, W> operator()(soa_qua<T, W> const& x, soa_qua<T, W> const& y, soa_scalar<T, W> const& a) const
+		{
+			return slerp(x, y, a);
+		}
+	};
+
+	struct quat_nlerp_func
+	{
+		template<typename T, length_t W>
+		GLM_FUNC_QUALIFIER soa_qua<T, W> operator()(soa_qua<T, W> const& x, soa_qua<T, W> const& y, soa_scalar<T, W> const& a) const
+		{
+			return nlerp(x, y, a);
+		}
+	};
+
+	// Run Func over Count quaternion pairs, W at a time
+	template<typename T, qualifier Q, typename weightType, typename soaFunc>
+	GLM_FUNC_QUALIFIER void quat_blend_array(qua<T, Q> const* x, qua<T, Q> const* y, weightType const& Weight, qua<T, Q>* Out, std::size_t Count, soaFunc const& Func)
+	{
+		length_t const W = quat_soa_lanes<T>::value;
+
+		for(std::size_t i = 0; i < Count; i += W)
+		{
+			std::size_t const n = glm::min(Count - i, static_cast<std::size_t>(W));
+			soa_qua<T, W> const Result = Func(quat_load<T, W>(x + i, n), quat_load<T, W>(y + i, n), Weight.template load<W>(i, n));
+
+			if(n == static_cast<std::size_t>(W))
+				Result.store(Out + i);
+			else
+			{
+				qua<T, Q> Tail[W];
+				Result.store(Tail);
+				for(std::size_t j = 0; j < n; ++j)
+					Out[i + j] = Tail[j];
+			}
+		}
+	}
+
+	// Scatter the n first lanes of v to the column or row c of n consecutive matrices
+	template<typename matType, typename T, length_t W>
+	GLM_FUNC_QUALIFIER void quat_store_column(soa_vec<4, T, W> const& v, matType* Out, length_t c, std::size_t n)
+	{
+		typename matType::col_type Column[W];
+		v.store(Column);
+		for(std::size_t j = 0; j < n; ++j)
+			Out[j][c] = Column[j];
+	}
+}//namespace detail
+
+	// -- soa_qua constructors --
+
+#	if GLM_CONFIG_DEFAULTED_FUNCTIONS == GLM_DISABLE
+		template<typename T, length_t W>
+		GLM_FUNC_QUALIFIER soa_qua<T, W>::soa_qua()
+		{}
+#	endif
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_qua<T, W>::soa_qua(scalar_type const& _w, scalar_type const& _x, scalar_type const& _y, scalar_type const& _z)
+		: x(_x), y(_y), z(_z), w(_w)
+	{}
+
+	template<typename T, length_t W>
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER soa_qua<T, W>::soa_qua(qua<T, Q> const& q)
+		: x(q.x), y(q.y), z(q.z), w(q.w)
+	{}
+
+	// -- soa_qua conversions --
+
+	template<typename T, length_t W>
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER soa_qua<T, W> soa_qua<T, W>::load(qua<T, Q> const* p)
+	{
+		typename detail::compute_soa<T, W>::type Data[4];
+		detail::compute_soa<T, W>::template load_packed<4>(reinterpret_cast<T const*>(p), Data);
+
+#		ifdef GLM_FORCE_QUAT_DATA_WXYZ
+			return soa_qua<T, W>(scalar_type(Data[0]), scalar_type(Data[1]), scalar_type(Data[2]), scalar_type(Data[3]));
+#		else
+			return soa_qua<T, W>(scalar_type(Data[3]), scalar_type(Data[0]), scalar_type(Data[1]), scalar_type(Data[2]));
+#		endif
+	}
+
+	template<typename T, length_t W>
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void soa_qua<T, W>::store(qua<T, Q>* p) const
+	{
+#		ifdef GLM_FORCE_QUAT_DATA_WXYZ
+			typename detail::compute_soa<T, W>::type const Data[4] = {this->w.data, this->x.data, this->y.data, this->z.data};
+#		else
+			typename detail::compute_soa<T, W>::type const Data[4] = {this->x.data, this->y.data, this->z.data, this->w.data};
+#		endif
+
+		detail::compute_soa<T, W>::template store_packed<4>(reinterpret_cast<T*>(p), Data);
+	}
+
+	// -- soa_qua operators --
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_qua<T, W> operator-(soa_qua<T, W> const& q)
+	{
+		return soa_qua<T, W>(-q.w, -q.x, -q.y, -q.z);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_qua<T, W> operator+(soa_qua<T, W> const& p, soa_qua<T, W> const& q)
+	{
+		return soa_qua<T, W>(p.w + q.w, p.x + q.x, p.y + q.y, p.z + q.z);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_qua<T, W> operator-(soa_qua<T, W> const& p, soa_qua<T, W> const& q)
+	{
+		return soa_qua<T, W>(p.w - q.w, p.x - q.x, p.y - q.y, p.z - q.z);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_qua<T, W> operator*(soa_qua<T, W> const& p, soa_qua<T, W> const& q)
+	{
+		return soa_qua<T, W>(
+			p.w * q.w - p.x * q.x - p.y * q.y - p.z * q.z,
+			p.w * q.x + p.x * q.w + p.y * q.z - p.z * q.y,
+			p.w * q.y + p.y * q.w + p.z * q.x - p.x * q.z,
+			p.w * q.z + p.z * q.w + p.x * q.y - p.y * q.x);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_qua<T, W> operator*(soa_qua<T, W> const& q, soa_scalar<T, W> const& s)
+	{
+		return soa_qua<T, W>(q.w * s, q.x * s, q.y * s, q.z * s);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_qua<T, W> operator*(soa_scalar<T, W> const& s, soa_qua<T, W> const& q)
+	{
+		return q * s;
+	}
+
+	// -- soa_qua functions --
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W> dot(soa_qua<T, W> const& x, soa_qua<T, W> const& y)
+	{
+		return (x.x * y.x + x.y * y.y) + (x.z * y.z + x.w * y.w);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_qua<T, W> conjugate(soa_qua<T, W> const& q)
+	{
+		return soa_qua<T, W>(q.w, -q.x, -q.y, -q.z);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_qua<T, W> normalize(soa_qua<T, W> const& q)
+	{
+		return q * inversesqrt(dot(q, q));
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_qua<T, W> nlerp(soa_qua<T, W> const& x, soa_qua<T, W> const& y, soa_scalar<T, W> const& a)
+	{
+		// -1 where the short path goes through -y
+		soa_scalar<T, W> const Sign = step(soa_scalar<T, W>(static_cast<T>(0)), dot(x, y)) * static_cast<T>(2) - static_cast<T>(1);
+
+		return normalize(x * (static_cast<T>(1) - a) + y * (a * Sign));
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_qua<T, W> slerp(soa_qua<T, W> const& x, soa_qua<T, W> const& y, soa_scalar<T, W> const& a)
+	{
+		soa_scalar<T, W> const Cos = dot(x, y);
+
+		// -1 where the short path goes through -y
+		soa_scalar<T, W> const Sign = step(soa_scalar<T, W>(static_cast<T>(0)), Cos) * static_cast<T>(2) - static_cast<T>(1);
+		soa_scalar<T, W> const CosMinusOne = min(abs(Cos), soa_scalar<T, W>(static_cast<T>(1))) - static_cast<T>(1);
+
+		soa_scalar<T, W> const WeightX = detail::slerp_weight(static_cast<T>(1) - a, CosMinusOne);
+		soa_scalar<T, W> const WeightY = detail::slerp_weight(a, CosMinusOne) * Sign;
+		return x * WeightX + y * WeightY;
+	}
+
+	// -- Array functions --
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void slerp(qua<T, Q> const* x, qua<T, Q> const* y, T a, qua<T, Q>* Out, std::size_t Count)
+	{
+		detail::quat_weight_scalar<T> const Weight = {a};
+		detail::quat_blend_array(x, y, Weight, Out, Count, detail::quat_slerp_func());
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void slerp(qua<T, Q> const* x, qua<T, Q> const* y, T const* a, qua<T, Q>* Out, std::size_t Count)
+	{
+		detail::quat_weight_array<T> const Weight = {a};
+		detail::quat_blend_array(x, y, Weight, Out, Count, detail::quat_slerp_func());
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void nlerp(qua<T, Q> const* x, qua<T, Q> const* y, T a, qua<T, Q>* Out, std::size_t Count)
+	{
+		detail::quat_weight_scalar<T> const Weight = {a};
+		detail::quat_blend_array(x, y, Weight, Out, Count, detail::quat_nlerp_func());
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void nlerp(qua<T, Q> const* x, qua<T, Q> const* y, T const* a, qua<T, Q>* Out, std::size_t Count)
+	{
+		detail::quat_weight_array<T> const Weight = {a};
+		detail::quat_blend_array(x, y, Weight, Out, Count, detail::quat_nlerp_func());
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void mat4_cast(qua<T, Q> const* q, mat<4, 4, T, Q>* Out, std::size_t Count)
+	{
+		length_t const W = detail::quat_soa_lanes<T>::value;
+		soa_scalar<T, W> const Zero(static_cast<T>(0));
+
+		for(std::size_t i = 0; i < Count; i += W)
+		{
+			std::size_t const n = glm::min(Count - i, static_cast<std::size_t>(W));
+
+			soa_vec<3, T, W> c0, c1, c2;
+			detail::quat_rotation(detail::quat_load<T, W>(q + i, n), c0, c1, c2);
+
+			detail::quat_store_column(soa_vec<4, T, W>(c0.x, c0.y, c0.z, Zero), Out + i, 0, n);
+			detail::quat_store_column(soa_vec<4, T, W>(c1.x, c1.y, c1.z, Zero), Out + i, 1, n);
+			detail::quat_store_column(soa_vec<4, T, W>(c2.x, c2.y, c2.z, Zero), Out + i, 2, n);
+			for(std::size_t j = 0; j < n; ++j)
+				Out[i + j][3] = vec<4, T, Q>(static_cast<T>(0), static_cast<T>(0), static_cast<T>(0), static_cast<T>(1));
+		}
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void mat3x4_cast(qua<T, Q> const* q, mat<3, 4, T, Q>* Out, std::size_t Count)
+	{
+		length_t const W = detail::quat_soa_lanes<T>::value;
+		soa_scalar<T, W> const Zero(static_cast<T>(0));
+
+		for(std::size_t i = 0; i < Count; i += W)
+		{
+			std::size_t const n = glm::min(Count - i, static_cast<std::size_t>(W));
+
+			soa_vec<3, T, W> c0, c1, c2;
+			detail::quat_rotation(detail::quat_load<T, W>(q + i, n), c0, c1, c2);
+
+			detail::quat_store_column(soa_vec<4, T, W>(c0.x, c1.x, c2.x, Zero), Out + i, 0, n);
+			detail::quat_store_column(soa_vec<4, T, W>(c0.y, c1.y, c2.y, Zero), Out + i, 1, n);
+			detail::quat_store_column(soa_vec<4, T, W>(c0.z, c1.z, c2.z, Zero), Out + i, 2, n);
+		}
+	}
+}//namespace glm
@@ -0,0 +1,138 @@
+/// @ref ext_simd_dispatch
+/// @file glm/ext/simd_dispatch.hpp
+///
+/// @defgroup ext_simd_dispatch GLM_EXT_simd_dispatch
+/// @ingroup ext
+///
+/// Select the kernels of the heavy array functions at runtime according to the instruction sets of the CPU.
+///
+/// GLM_ARCH selects the SIMD instruction sets at compile time so a binary built for an SSE2 baseline
+/// never uses AVX2 or AVX-512 even when the CPU supports them. The functions of the glm::dispatch
+/// namespace take the same parameters as their float array counterparts but query the CPU with cpuid
+/// the first time one of them is called and run AVX2 (with FMA and F16C) or AVX-512 kernels when available.
+/// Otherwise, they call the counterparts built for GLM_ARCH.
+///
+/// The kernels are compiled with function target attributes on GCC and Clang, so the translation
+/// unit doesn't need -mavx2. Runtime dispatch is enabled on x86 when GLM_CONFIG_SIMD is enabled and the
+/// compiler is at least GCC 4.9, Clang 3.9 or Visual C++ 2017, see GLM_CONFIG_SIMD_DISPATCH.
+///
+/// The results of the AVX2 and AVX-512 kernels may differ from the other paths by the rounding of fused multiply-adds.
+///
+/// Include <glm/ext/simd_dispatch.hpp> to use the features of this extension.
+///
+/// @see ext_batch_transform
+/// @see ext_culling
+/// @see gtc_packing
+/// @see gtc_noise
+
+#pragma once
+
+// Dependencies
+#include "../detail/setup.hpp"
+#include "../ext/batch_transform.hpp"
+#include "../ext/culling.hpp"
+#include "../gtc/noise.hpp"
+#include "../gtc/packing.hpp"
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_EXT_simd_dispatch extension included")
+#endif
+
+#if (GLM_CONFIG_SIMD == GLM_ENABLE) && (GLM_ARCH & GLM_ARCH_SSE2_BIT) && !(GLM_COMPILER & GLM_COMPILER_CUDA) && ( \
+	((GLM_COMPILER & GLM_COMPILER_GCC) && GLM_COMPILER >= GLM_COMPILER_GCC49) || \
+	((GLM_COMPILER & GLM_COMPILER_CLANG) && GLM_COMPILER >= GLM_COMPILER_CLANG39) || \
+	((GLM_COMPILER & GLM_COMPILER_VC) && GLM_COMPILER >= GLM_COMPILER_VC15))
+#	define GLM_CONFIG_SIMD_DISPATCH GLM_ENABLE
+#else
+#	define GLM_CONFIG_SIMD_DISPATCH GLM_DISABLE
+#endif
+
+namespace glm
+{
+	/// @addtogroup ext_simd_dispatch
+	/// @{
+
+	/// Kernels selected by the glm::dispatch functions, in increasing order of requirements.
+	enum simd_level
+	{
+		/// The functions built for GLM_ARCH.
+		simd_level_generic,
+		/// 8 floats wide kernels: AVX2, FMA and F16C.
+		simd_level_avx2,
+		/// 16 floats wide kernels: AVX-512F in addition to the AVX2 level.
+		simd_level_avx512
+	};
+
+	/// Returns the highest level supported by the CPU and the operating system.
+	/// Returns simd_level_generic when GLM_CONFIG_SIMD_DISPATCH is disabled.
+	GLM_FUNC_DECL simd_level detectSimdLevel();
+
+	/// Returns the level used by the glm::dispatch functions: the detected level unless forceSimdLevel was called.
+	GLM_FUNC_DECL simd_level simdLevel();
+
+	/// Select the level used by the glm::dispatch functions, such as to test or benchmark each kernel.
+	/// The level is clamped to the detected level so that it's always safe to run.
+	/// The level is shared by all threads, it's an atomic with C++11 and must not be set concurrently before.
+	///
+	/// @return The level actually selected.
+	GLM_FUNC_DECL simd_level forceSimdLevel(simd_level Level);
+
+	/// Returns the name of a level: "generic", "avx2" or "avx512".
+	GLM_FUNC_DECL char const* simdLevelName(simd_level Level);
+
+namespace dispatch
+{
+	/// Runtime dispatched batchTransform of float arrays.
+	/// @see ext_batch_transform
+	GLM_FUNC_DECL void batchTransform(mat4 const& m,
+		float const* inX, float const* inY, float const* inZ, float const* inW,
+		float* outX, float* outY, float* outZ, float* outW, std::size_t Count);
+
+	/// Runtime dispatched batchTransformPoints of float arrays.
+	/// @see ext_batch_transform
+	GLM_FUNC_DECL void batchTransformPoints(mat4 const& m,
+		float const* inX, float const* inY, float const* inZ,
+		float* outX, float* outY, float* outZ, std::size_t Count);
+
+	/// Runtime dispatched batchProjectPoints of float arrays.
+	/// @see ext_batch_transform
+	GLM_FUNC_DECL void batchProjectPoints(mat4 const& m,
+		float const* inX, float const* inY, float const* inZ,
+		float* outX, float* outY, float* outZ, std::size_t Count);
+
+	/// Runtime dispatched cullSpheres of float arrays.
+	/// @see ext_culling
+	GLM_FUNC_DECL std::size_t cullSpheres(vec4 const Planes[6],
+		float const* centerX, float const* centerY, float const* centerZ, float const* radius,
+		uint32* Visible, std::size_t Count);
+
+	/// Runtime dispatched cullAABBs of float arrays.
+	/// @see ext_culling
+	GLM_FUNC_DECL std::size_t cullAABBs(vec4 const Planes[6],
+		float const* minX, float const* minY, float const* minZ,
+		float const* maxX, float const* maxY, float const* maxZ,
+		uint32* Visible, std::size_t Count);
+
+	/// Runtime dispatched packHalf of a float array.
+	/// @see gtc_packing
+	GLM_FUNC_DECL void packHalf(float const* In, uint16* Out, std::size_t Count);
+
+	/// Runtime dispatched unpackHalf of a half float array.
+	/// @see gtc_packing
+	GLM_FUNC_DECL void unpackHalf(uint16 const* In, float* Out, std::size_t Count);
+
+	/// Runtime dispatched simplex noise of Count points. The AVX-512 level uses the AVX2 kernel.
+	/// @see gtc_noise
+	GLM_FUNC_DECL void simplex(vec3 const* p, float* Out, std::size_t Count);
+
+	/// Runtime dispatched fractal Brownian motion of Count points. The AVX-512 level uses the AVX2 kernel.
+	/// @see gtc_noise
+	GLM_FUNC_DECL void simplexFbm(vec3 const* p, float* Out, std::size_t Count,
+		int Octaves, float Lacunarity = 2.0f, float Gain = 0.5f);
+}//namespace dispatch
+
+	/// @}
+}//namespace glm
+
+#include "simd_dispatch.inl"
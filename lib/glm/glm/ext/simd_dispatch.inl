@@ -0,0 +1,319 @@
+#if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+#	if GLM_COMPILER & GLM_COMPILER_VC
+#		include <intrin.h>
+#		define GLM_DISPATCH_AVX2
+#		define GLM_DISPATCH_AVX512
+#	else
+#		include <cpuid.h>
+#		define GLM_DISPATCH_AVX2 __attribute__((target("popcnt,avx2,fma,f16c")))
+#		define GLM_DISPATCH_AVX512 __attribute__((target("popcnt,avx2,fma,f16c,avx512f")))
+#	endif
+#	include <immintrin.h>
+#	include "simd_dispatch_avx2.inl"
+#	include "simd_dispatch_avx512.inl"
+#endif
+
+#if GLM_HAS_CXX11_STL
+#	include <atomic>
+#endif
+
+namespace glm{
+namespace detail
+{
+#	if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+		// Registers are eax, ebx, ecx and edx
+		GLM_FUNC_QUALIFIER void simd_cpuid(unsigned Leaf, unsigned Registers[4])
+		{
+#			if GLM_COMPILER & GLM_COMPILER_VC
+				int Info[4];
+				__cpuidex(Info, static_cast<int>(Leaf), 0);
+				for(int i = 0; i < 4; ++i)
+					Registers[i] = static_cast<unsigned>(Info[i]);
+#			else
+				__cpuid_count(Leaf, 0, Registers[0], Registers[1], Registers[2], Registers[3]);
+#			endif
+		}
+
+		// Register states enabled by the operating system
+		GLM_FUNC_QUALIFIER uint64 simd_xgetbv()
+		{
+#			if GLM_COMPILER & GLM_COMPILER_VC
+				return static_cast<uint64>(_xgetbv(0));
+#			else
+				unsigned Low, High;
+				__asm__ __volatile__("xgetbv" : "=a"(Low), "=d"(High) : "c"(0));
+				return (static_cast<uint64>(High) << 32) | Low;
+#			endif
+		}
+#	endif//GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+
+	// -1 until the first call to simdLevel. Every thread detects the same level so relaxed ordering is enough,
+	// before C++11 there is no portable atomic and concurrent calls to forceSimdLevel must be synchronized by the caller.
+#	if GLM_HAS_CXX11_STL
+		GLM_FUNC_QUALIFIER std::atomic<int>& simd_level_storage()
+		{
+			static std::atomic<int> Level(-1);
+			return Level;
+		}
+
+		GLM_FUNC_QUALIFIER int simd_level_load()
+		{
+			return simd_level_storage().load(std::memory_order_relaxed);
+		}
+
+		GLM_FUNC_QUALIFIER void simd_level_store(int Level)
+		{
+			simd_level_storage().store(Level, std::memory_order_relaxed);
+		}
+#	else
+		GLM_FUNC_QUALIFIER int& simd_level_storage()
+		{
+			static int Level = -1;
+			return Level;
+		}
+
+		GLM_FUNC_QUALIFIER int simd_level_load()
+		{
+			return simd_level_storage();
+		}
+
+		GLM_FUNC_QUALIFIER void simd_level_store(int Level)
+		{
+			simd_level_storage() = Level;
+		}
+#	endif
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER simd_level detectSimdLevel()
+	{
+#		if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+			unsigned Registers[4];
+			detail::simd_cpuid(0, Registers);
+			if(Registers[0] < 7)
+				return simd_level_generic;
+
+			detail::simd_cpuid(1, Registers);
+			unsigned const Features1 = Registers[2];
+			bool const OSXSave = (Features1 & (1u << 27)) != 0;
+			bool const FMA = (Features1 & (1u << 12)) != 0;
+			bool const POPCNT = (Features1 & (1u << 23)) != 0;
+			bool const AVX = (Features1 & (1u << 28)) != 0;
+			bool const F16C = (Features1 & (1u << 29)) != 0;
+			if(!OSXSave || !FMA || !POPCNT || !AVX || !F16C)
+				return simd_level_generic;
+
+			// The operating system must save the XMM and YMM registers, and the opmask and ZMM registers for AVX-512
+			uint64 const XCR0 = detail::simd_xgetbv();
+			if((XCR0 & 0x06) != 0x06)
+				return simd_level_generic;
+
+			detail::simd_cpuid(7, Registers);
+			unsigned const Features7 = Registers[1];
+			if(!(Features7 & (1u << 5)))
+				return simd_level_generic;
+
+			if((Features7 & (1u << 16)) && (XCR0 & 0xE0) == 0xE0)
+				return simd_level_avx512;
+			return simd_level_avx2;
+#		else
+			return simd_level_generic;
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER simd_level simdLevel()
+	{
+		int Level = detail::simd_level_load();
+		if(Level < 0)
+		{
+			Level = static_cast<int>(detectSimdLevel());
+			detail::simd_level_store(Level);
+		}
+		return static_cast<simd_level>(Level);
+	}
+
+	GLM_FUNC_QUALIFIER simd_level forceSimdLevel(simd_level Level)
+	{
+		simd_level const Detected = detectSimdLevel();
+		simd_level const Result = Level < Detected ? Level : Detected;
+		detail::simd_level_store(static_cast<int>(Result));
+		return Result;
+	}
+
+	GLM_FUNC_QUALIFIER char const* simdLevelName(simd_level Level)
+	{
+		switch(Level)
+		{
+		default:
+			return "generic";
+		case simd_level_avx2:
+			return "avx2";
+		case simd_level_avx512:
+			return "avx512";
+		}
+	}
+
+namespace detail
+{
+	// Transform with the best kernel, w pointers are null for points. Returns the number of elements processed.
+	GLM_FUNC_QUALIFIER std::size_t dispatch_transform(mat4 const& m, float const* const In[4], float* const Out[4], std::size_t Count, bool Project)
+	{
+#		if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+			switch(simdLevel())
+			{
+			case simd_level_avx512:
+				return glm::detail::dispatch_avx512_transform(m, In, Out, Count, Project);
+			case simd_level_avx2:
+				return glm::detail::dispatch_avx2_transform(m, In, Out, Count, Project);
+			default:
+				break;
+			}
+#		else
+			static_cast<void>(m);
+			static_cast<void>(In);
+			static_cast<void>(Out);
+			static_cast<void>(Count);
+			static_cast<void>(Project);
+#		endif
+		return 0;
+	}
+}//namespace detail
+
+namespace dispatch
+{
+	GLM_FUNC_QUALIFIER void batchTransform(mat4 const& m,
+		float const* inX, float const* inY, float const* inZ, float const* inW,
+		float* outX, float* outY, float* outZ, float* outW, std::size_t Count)
+	{
+		float const* const In[4] = {inX, inY, inZ, inW};
+		float* const Out[4] = {outX, outY, outZ, outW};
+		std::size_t const i = glm::detail::dispatch_transform(m, In, Out, Count, false);
+		glm::batchTransform(m, inX + i, inY + i, inZ + i, inW + i, outX + i, outY + i, outZ + i, outW + i, Count - i);
+	}
+
+	GLM_FUNC_QUALIFIER void batchTransformPoints(mat4 const& m,
+		float const* inX, float const* inY, float const* inZ,
+		float* outX, float* outY, float* outZ, std::size_t Count)
+	{
+		float const* const In[4] = {inX, inY, inZ, 0};
+		float* const Out[4] = {outX, outY, outZ, 0};
+		std::size_t const i = glm::detail::dispatch_transform(m, In, Out, Count, false);
+		glm::batchTransformPoints(m, inX + i, inY + i, inZ + i, outX + i, outY + i, outZ + i, Count - i);
+	}
+
+	GLM_FUNC_QUALIFIER void batchProjectPoints(mat4 const& m,
+		float const* inX, float const* inY, float const* inZ,
+		float* outX, float* outY, float* outZ, std::size_t Count)
+	{
+		float const* const In[4] = {inX, inY, inZ, 0};
+		float* const Out[4] = {outX, outY, outZ, 0};
+		std::size_t const i = glm::detail::dispatch_transform(m, In, Out, Count, true);
+		glm::batchProjectPoints(m, inX + i, inY + i, inZ + i, outX + i, outY + i, outZ + i, Count - i);
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t cullSpheres(vec4 const Planes[6],
+		float const* centerX, float const* centerY, float const* centerZ, float const* radius,
+		uint32* Visible, std::size_t Count)
+	{
+		std::size_t Result = 0;
+		std::size_t i = 0;
+#		if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+			switch(simdLevel())
+			{
+			case simd_level_avx512:
+				Result = glm::detail::dispatch_avx512_cull_spheres(Planes, centerX, centerY, centerZ, radius, Visible, Count, i);
+				break;
+			case simd_level_avx2:
+				Result = glm::detail::dispatch_avx2_cull_spheres(Planes, centerX, centerY, centerZ, radius, Visible, Count, i);
+				break;
+			default:
+				break;
+			}
+#		endif
+		return Result + glm::cullSpheres(Planes, centerX + i, centerY + i, centerZ + i, radius + i, Visible + i / 32, Count - i);
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t cullAABBs(vec4 const Planes[6],
+		float const* minX, float const* minY, float const* minZ,
+		float const* maxX, float const* maxY, float const* maxZ,
+		uint32* Visible, std::size_t Count)
+	{
+		std::size_t Result = 0;
+		std::size_t i = 0;
+#		if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+			float const* const Min[3] = {minX, minY, minZ};
+			float const* const Max[3] = {maxX, maxY, maxZ};
+			switch(simdLevel())
+			{
+			case simd_level_avx512:
+				Result = glm::detail::dispatch_avx512_cull_aabbs(Planes, Min, Max, Visible, Count, i);
+				break;
+			case simd_level_avx2:
+				Result = glm::detail::dispatch_avx2_cull_aabbs(Planes, Min, Max, Visible, Count, i);
+				break;
+			default:
+				break;
+			}
+#		endif
+		return Result + glm::cullAABBs(Planes, minX + i, minY + i, minZ + i, maxX + i, maxY + i, maxZ + i, Visible + i / 32, Count - i);
+	}
+
+	GLM_FUNC_QUALIFIER void packHalf(float const* In, uint16* Out, std::size_t Count)
+	{
+		std::size_t i = 0;
+#		if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+			switch(simdLevel())
+			{
+			case simd_level_avx512:
+				i = glm::detail::dispatch_avx512_pack_half(In, Out, Count);
+				break;
+			case simd_level_avx2:
+				i = glm::detail::dispatch_avx2_pack_half(In, Out, Count);
+				break;
+			default:
+				break;
+			}
+#		endif
+		glm::packHalf(In + i, Out + i, Count - i);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackHalf(uint16 const* In, float* Out, std::size_t Count)
+	{
+		std::size_t i = 0;
+#		if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+			switch(simdLevel())
+			{
+			case simd_level_avx512:
+				i = glm::detail::dispatch_avx512_unpack_half(In, Out, Count);
+				break;
+			case simd_level_avx2:
+				i = glm::detail::dispatch_avx2_unpack_half(In, Out, Count);
+				break;
+			default:
+				break;
+			}
+#		endif
+		glm::unpackHalf(In + i, Out + i, Count - i);
+	}
+
+	GLM_FUNC_QUALIFIER void simplex(vec3 const* p, float* Out, std::size_t Count)
+	{
+		std::size_t i = 0;
+#		if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+			if(simdLevel() >= simd_level_avx2)
+				i = glm::detail::dispatch_avx2_simplex_fbm(p, Out, Count, 0, 0.0f, 0.0f);
+#		endif
+		glm::simplex(p + i, Out + i, Count - i);
+	}
+
+	GLM_FUNC_QUALIFIER void simplexFbm(vec3 const* p, float* Out, std::size_t Count,
+		int Octaves, float Lacunarity, float Gain)
+	{
+		std::size_t i = 0;
+#		if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+			if(simdLevel() >= simd_level_avx2 && Octaves > 0)
+				i = glm::detail::dispatch_avx2_simplex_fbm(p, Out, Count, Octaves, Lacunarity, Gain);
+#		endif
+		glm::simplexFbm(p + i, Out + i, Count - i, Octaves, Lacunarity, Gain);
+	}
+}//namespace dispatch
+}//namespace glm
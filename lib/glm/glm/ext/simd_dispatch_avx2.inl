@@ -0,0 +1,293 @@
+// AVX2, FMA and F16C kernels of GLM_EXT_simd_dispatch, compiled with a function target attribute.
+// Each kernel processes whole blocks and returns the number of elements processed, the caller processes the tail.
+
+namespace glm{
+namespace detail
+{
+	// Vectors read and write w, points have an implicit w of 1
+	template<bool Vectors, bool Project>
+	inline GLM_DISPATCH_AVX2 std::size_t dispatch_avx2_transform(mat4 const& m,
+		float const* inX, float const* inY, float const* inZ, float const* inW,
+		float* outX, float* outY, float* outZ, float* outW, std::size_t Count)
+	{
+		__m256 const m00 = _mm256_set1_ps(m[0][0]), m01 = _mm256_set1_ps(m[0][1]), m02 = _mm256_set1_ps(m[0][2]), m03 = _mm256_set1_ps(m[0][3]);
+		__m256 const m10 = _mm256_set1_ps(m[1][0]), m11 = _mm256_set1_ps(m[1][1]), m12 = _mm256_set1_ps(m[1][2]), m13 = _mm256_set1_ps(m[1][3]);
+		__m256 const m20 = _mm256_set1_ps(m[2][0]), m21 = _mm256_set1_ps(m[2][1]), m22 = _mm256_set1_ps(m[2][2]), m23 = _mm256_set1_ps(m[2][3]);
+		__m256 const m30 = _mm256_set1_ps(m[3][0]), m31 = _mm256_set1_ps(m[3][1]), m32 = _mm256_set1_ps(m[3][2]), m33 = _mm256_set1_ps(m[3][3]);
+
+		std::size_t i = 0;
+		for(; i + 8 <= Count; i += 8)
+		{
+			__m256 const x = _mm256_loadu_ps(inX + i);
+			__m256 const y = _mm256_loadu_ps(inY + i);
+			__m256 const z = _mm256_loadu_ps(inZ + i);
+			__m256 const w = Vectors ? _mm256_loadu_ps(inW + i) : _mm256_setzero_ps();
+
+			__m256 rx = _mm256_fmadd_ps(m00, x, _mm256_fmadd_ps(m10, y, _mm256_fmadd_ps(m20, z, Vectors ? _mm256_mul_ps(m30, w) : m30)));
+			__m256 ry = _mm256_fmadd_ps(m01, x, _mm256_fmadd_ps(m11, y, _mm256_fmadd_ps(m21, z, Vectors ? _mm256_mul_ps(m31, w) : m31)));
+			__m256 rz = _mm256_fmadd_ps(m02, x, _mm256_fmadd_ps(m12, y, _mm256_fmadd_ps(m22, z, Vectors ? _mm256_mul_ps(m32, w) : m32)));
+			if(Vectors || Project)
+			{
+				__m256 const rw = _mm256_fmadd_ps(m03, x, _mm256_fmadd_ps(m13, y, _mm256_fmadd_ps(m23, z, Vectors ? _mm256_mul_ps(m33, w) : m33)));
+				if(Project)
+				{
+					rx = _mm256_div_ps(rx, rw);
+					ry = _mm256_div_ps(ry, rw);
+					rz = _mm256_div_ps(rz, rw);
+				}
+				if(Vectors)
+					_mm256_storeu_ps(outW + i, rw);
+			}
+
+			_mm256_storeu_ps(outX + i, rx);
+			_mm256_storeu_ps(outY + i, ry);
+			_mm256_storeu_ps(outZ + i, rz);
+		}
+		return i;
+	}
+
+	// In[3] and Out[3] are null for points
+	inline GLM_DISPATCH_AVX2 std::size_t dispatch_avx2_transform(mat4 const& m,
+		float const* const In[4], float* const Out[4], std::size_t Count, bool Project)
+	{
+		if(In[3] != 0)
+			return dispatch_avx2_transform<true, false>(m, In[0], In[1], In[2], In[3], Out[0], Out[1], Out[2], Out[3], Count);
+		else if(Project)
+			return dispatch_avx2_transform<false, true>(m, In[0], In[1], In[2], 0, Out[0], Out[1], Out[2], 0, Count);
+		else
+			return dispatch_avx2_transform<false, false>(m, In[0], In[1], In[2], 0, Out[0], Out[1], Out[2], 0, Count);
+	}
+
+	inline GLM_DISPATCH_AVX2 __m256 dispatch_avx2_plane_distance(__m256 const Plane[4], __m256 x, __m256 y, __m256 z)
+	{
+		return _mm256_fmadd_ps(Plane[2], z, _mm256_fmadd_ps(Plane[1], y, _mm256_fmadd_ps(Plane[0], x, Plane[3])));
+	}
+
+	inline GLM_DISPATCH_AVX2 std::size_t dispatch_avx2_cull_spheres(vec4 const Planes[6],
+		float const* centerX, float const* centerY, float const* centerZ, float const* radius,
+		uint32* Visible, std::size_t Count, std::size_t& Processed)
+	{
+		__m256 Broadcast[6][4];
+		for(length_t p = 0; p < 6; ++p)
+		for(length_t c = 0; c < 4; ++c)
+			Broadcast[p][c] = _mm256_set1_ps(Planes[p][c]);
+
+		std::size_t Result = 0;
+		std::size_t i = 0;
+		for(; i + 32 <= Count; i += 32)
+		{
+			uint32 Mask = 0;
+			for(std::size_t j = 0; j < 32; j += 8)
+			{
+				std::size_t const k = i + j;
+				__m256 const x = _mm256_loadu_ps(centerX + k);
+				__m256 const y = _mm256_loadu_ps(centerY + k);
+				__m256 const z = _mm256_loadu_ps(centerZ + k);
+				__m256 const r = _mm256_sub_ps(_mm256_setzero_ps(), _mm256_loadu_ps(radius + k));
+
+				__m256 Inside = _mm256_cmp_ps(dispatch_avx2_plane_distance(Broadcast[0], x, y, z), r, _CMP_GE_OQ);
+				for(length_t p = 1; p < 6; ++p)
+					Inside = _mm256_and_ps(Inside, _mm256_cmp_ps(dispatch_avx2_plane_distance(Broadcast[p], x, y, z), r, _CMP_GE_OQ));
+				Mask |= static_cast<uint32>(_mm256_movemask_ps(Inside)) << j;
+			}
+
+			Visible[i / 32] = Mask;
+			Result += static_cast<std::size_t>(_mm_popcnt_u32(Mask));
+		}
+
+		Processed = i;
+		return Result;
+	}
+
+	inline GLM_DISPATCH_AVX2 std::size_t dispatch_avx2_cull_aabbs(vec4 const Planes[6],
+		float const* const Min[3], float const* const Max[3],
+		uint32* Visible, std::size_t Count, std::size_t& Processed)
+	{
+		__m256 Broadcast[6][4];
+		for(length_t p = 0; p < 6; ++p)
+		for(length_t c = 0; c < 4; ++c)
+			Broadcast[p][c] = _mm256_set1_ps(Planes[p][c]);
+
+		// Only the corner the furthest along the plane normal needs to be tested
+		float const* Corner[6][3];
+		for(length_t p = 0; p < 6; ++p)
+		for(length_t c = 0; c < 3; ++c)
+			Corner[p][c] = Planes[p][c] >= 0.0f ? Max[c] : Min[c];
+
+		std::size_t Result = 0;
+		std::size_t i = 0;
+		for(; i + 32 <= Count; i += 32)
+		{
+			uint32 Mask = 0;
+			for(std::size_t j = 0; j < 32; j += 8)
+			{
+				std::size_t const k = i + j;
+				__m256 Inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+				for(length_t p = 0; p < 6; ++p)
+				{
+					__m256 const Distance = dispatch_avx2_plane_distance(Broadcast[p],
+						_mm256_loadu_ps(Corner[p][0] + k), _mm256_loadu_ps(Corner[p][1] + k), _mm256_loadu_ps(Corner[p][2] + k));
+					Inside = _mm256_and_ps(Inside, _mm256_cmp_ps(Distance, _mm256_setzero_ps(), _CMP_GE_OQ));
+				}
+				Mask |= static_cast<uint32>(_mm256_movemask_ps(Inside)) << j;
+			}
+
+			Visible[i / 32] = Mask;
+			Result += static_cast<std::size_t>(_mm_popcnt_u32(Mask));
+		}
+
+		Processed = i;
+		return Result;
+	}
+
+	inline GLM_DISPATCH_AVX2 std::size_t dispatch_avx2_pack_half(float const* In, uint16* Out, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i + 8 <= Count; i += 8)
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + i), _mm256_cvtps_ph(_mm256_loadu_ps(In + i), _MM_FROUND_TO_NEAREST_INT));
+		return i;
+	}
+
+	inline GLM_DISPATCH_AVX2 std::size_t dispatch_avx2_unpack_half(uint16 const* In, float* Out, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i + 8 <= Count; i += 8)
+			_mm256_storeu_ps(Out + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<__m128i const*>(In + i))));
+		return i;
+	}
+
+	// Simplex noise helpers, in the order of operations of the soa_vec version of GLM_GTC_noise
+	inline GLM_DISPATCH_AVX2 __m256 dispatch_avx2_step(__m256 Edge, __m256 x)
+	{
+		return _mm256_and_ps(_mm256_cmp_ps(x, Edge, _CMP_NLT_UQ), _mm256_set1_ps(1.0f));
+	}
+
+	inline GLM_DISPATCH_AVX2 __m256 dispatch_avx2_abs(__m256 x)
+	{
+		return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x);
+	}
+
+	inline GLM_DISPATCH_AVX2 __m256 dispatch_avx2_mod289(__m256 x)
+	{
+		__m256 const Floor = _mm256_floor_ps(_mm256_mul_ps(x, _mm256_set1_ps(1.0f / 289.0f)));
+		return _mm256_sub_ps(x, _mm256_mul_ps(Floor, _mm256_set1_ps(289.0f)));
+	}
+
+	inline GLM_DISPATCH_AVX2 __m256 dispatch_avx2_permute(__m256 x)
+	{
+		return dispatch_avx2_mod289(_mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(x, _mm256_set1_ps(34.0f)), _mm256_set1_ps(1.0f)), x));
+	}
+
+	inline GLM_DISPATCH_AVX2 __m256 dispatch_avx2_dot(__m256 const a[3], __m256 const b[3])
+	{
+		return _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(a[0], b[0]), _mm256_mul_ps(a[1], b[1])), _mm256_mul_ps(a[2], b[2]));
+	}
+
+	inline GLM_DISPATCH_AVX2 __m256 dispatch_avx2_simplex(__m256 const v[3])
+	{
+		float const Cx = static_cast<float>(1.0 / 6.0);
+		float const Cy = static_cast<float>(1.0 / 3.0);
+		__m256 const One = _mm256_set1_ps(1.0f);
+
+		// First corner
+		__m256 const CyCy[3] = {_mm256_set1_ps(Cy), _mm256_set1_ps(Cy), _mm256_set1_ps(Cy)};
+		__m256 const Skew = dispatch_avx2_dot(v, CyCy);
+		__m256 i[3];
+		for(length_t c = 0; c < 3; ++c)
+			i[c] = _mm256_floor_ps(_mm256_add_ps(v[c], Skew));
+		__m256 const CxCx[3] = {_mm256_set1_ps(Cx), _mm256_set1_ps(Cx), _mm256_set1_ps(Cx)};
+		__m256 const Unskew = dispatch_avx2_dot(i, CxCx);
+		__m256 x[4][3];
+		for(length_t c = 0; c < 3; ++c)
+			x[0][c] = _mm256_add_ps(_mm256_sub_ps(v[c], i[c]), Unskew);
+
+		// Other corners
+		__m256 const g[3] = {dispatch_avx2_step(x[0][1], x[0][0]), dispatch_avx2_step(x[0][2], x[0][1]), dispatch_avx2_step(x[0][0], x[0][2])};
+		__m256 const l[3] = {_mm256_sub_ps(One, g[2]), _mm256_sub_ps(One, g[0]), _mm256_sub_ps(One, g[1])};
+		__m256 i1[3], i2[3];
+		for(length_t c = 0; c < 3; ++c)
+		{
+			i1[c] = _mm256_min_ps(g[c], l[c]);
+			i2[c] = _mm256_max_ps(g[c], l[c]);
+			x[1][c] = _mm256_add_ps(_mm256_sub_ps(x[0][c], i1[c]), _mm256_set1_ps(Cx));
+			x[2][c] = _mm256_add_ps(_mm256_sub_ps(x[0][c], i2[c]), _mm256_set1_ps(Cy));
+			x[3][c] = _mm256_sub_ps(x[0][c], _mm256_set1_ps(0.5f));
+			i[c] = dispatch_avx2_mod289(i[c]);
+		}
+
+		// Permutations
+		__m256 const p[4] = {
+			dispatch_avx2_permute(_mm256_add_ps(dispatch_avx2_permute(_mm256_add_ps(dispatch_avx2_permute(i[2]), i[1])), i[0])),
+			dispatch_avx2_permute(_mm256_add_ps(_mm256_add_ps(dispatch_avx2_permute(_mm256_add_ps(_mm256_add_ps(dispatch_avx2_permute(_mm256_add_ps(i[2], i1[2])), i[1]), i1[1])), i[0]), i1[0])),
+			dispatch_avx2_permute(_mm256_add_ps(_mm256_add_ps(dispatch_avx2_permute(_mm256_add_ps(_mm256_add_ps(dispatch_avx2_permute(_mm256_add_ps(i[2], i2[2])), i[1]), i2[1])), i[0]), i2[0])),
+			dispatch_avx2_permute(_mm256_add_ps(_mm256_add_ps(dispatch_avx2_permute(_mm256_add_ps(_mm256_add_ps(dispatch_avx2_permute(_mm256_add_ps(i[2], One)), i[1]), One)), i[0]), One))};
+
+		// Gradients: 7x7 points over a square, mapped onto an octahedron
+		float const n_ = 0.142857142857f;
+		__m256 const nsx = _mm256_set1_ps(n_ * 2.0f - 0.0f);
+		__m256 const nsy = _mm256_set1_ps(n_ * 0.5f - 1.0f);
+		__m256 const nsz = _mm256_set1_ps(n_ * 1.0f - 0.0f);
+
+		__m256 n[4];
+		for(length_t c = 0; c < 4; ++c)
+		{
+			__m256 const j = _mm256_sub_ps(p[c], _mm256_mul_ps(_mm256_set1_ps(49.0f), _mm256_floor_ps(_mm256_mul_ps(_mm256_mul_ps(p[c], nsz), nsz))));
+			__m256 const x_ = _mm256_floor_ps(_mm256_mul_ps(j, nsz));
+			__m256 const y_ = _mm256_floor_ps(_mm256_sub_ps(j, _mm256_mul_ps(_mm256_set1_ps(7.0f), x_)));
+
+			__m256 const gx = _mm256_add_ps(_mm256_mul_ps(x_, nsx), nsy);
+			__m256 const gy = _mm256_add_ps(_mm256_mul_ps(y_, nsx), nsy);
+			__m256 const h = _mm256_sub_ps(_mm256_sub_ps(One, dispatch_avx2_abs(gx)), dispatch_avx2_abs(gy));
+
+			__m256 const sh = _mm256_sub_ps(_mm256_setzero_ps(), dispatch_avx2_step(h, _mm256_setzero_ps()));
+			__m256 Grad[3] = {
+				_mm256_add_ps(gx, _mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_floor_ps(gx), _mm256_set1_ps(2.0f)), One), sh)),
+				_mm256_add_ps(gy, _mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_floor_ps(gy), _mm256_set1_ps(2.0f)), One), sh)),
+				h};
+			__m256 const Norm = _mm256_sub_ps(_mm256_set1_ps(1.79284291400159f), _mm256_mul_ps(_mm256_set1_ps(0.85373472095314f), dispatch_avx2_dot(Grad, Grad)));
+			for(length_t k = 0; k < 3; ++k)
+				Grad[k] = _mm256_mul_ps(Grad[k], Norm);
+
+			__m256 m = _mm256_max_ps(_mm256_sub_ps(_mm256_set1_ps(0.6f), dispatch_avx2_dot(x[c], x[c])), _mm256_setzero_ps());
+			m = _mm256_mul_ps(m, m);
+			n[c] = _mm256_mul_ps(_mm256_mul_ps(m, m), dispatch_avx2_dot(Grad, x[c]));
+		}
+		return _mm256_mul_ps(_mm256_set1_ps(42.0f), _mm256_add_ps(_mm256_add_ps(n[0], n[1]), _mm256_add_ps(n[2], n[3])));
+	}
+
+	// Octaves is 0 for a single simplex noise without normalization
+	inline GLM_DISPATCH_AVX2 std::size_t dispatch_avx2_simplex_fbm(vec3 const* p, float* Out, std::size_t Count, int Octaves, float Lacunarity, float Gain)
+	{
+		std::size_t i = 0;
+		for(; i + 8 <= Count; i += 8)
+		{
+			float Transposed[3][8];
+			for(std::size_t k = 0; k < 8; ++k)
+			for(length_t c = 0; c < 3; ++c)
+				Transposed[c][k] = p[i + k][c];
+			__m256 const v[3] = {_mm256_loadu_ps(Transposed[0]), _mm256_loadu_ps(Transposed[1]), _mm256_loadu_ps(Transposed[2])};
+
+			if(Octaves == 0)
+			{
+				_mm256_storeu_ps(Out + i, dispatch_avx2_simplex(v));
+				continue;
+			}
+
+			__m256 Sum = _mm256_setzero_ps();
+			float Norm = 0.0f;
+			float Frequency = 1.0f;
+			float Amplitude = 1.0f;
+			for(int o = 0; o < Octaves; ++o)
+			{
+				__m256 const Scaled[3] = {_mm256_mul_ps(v[0], _mm256_set1_ps(Frequency)), _mm256_mul_ps(v[1], _mm256_set1_ps(Frequency)), _mm256_mul_ps(v[2], _mm256_set1_ps(Frequency))};
+				Sum = _mm256_add_ps(Sum, _mm256_mul_ps(dispatch_avx2_simplex(Scaled), _mm256_set1_ps(Amplitude)));
+				Norm += Amplitude;
+				Frequency *= Lacunarity;
+				Amplitude *= Gain;
+			}
+			_mm256_storeu_ps(Out + i, _mm256_div_ps(Sum, _mm256_set1_ps(Norm)));
+		}
+		return i;
+	}
+}//namespace detail
+}//namespace glm
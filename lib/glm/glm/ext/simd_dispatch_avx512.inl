@@ -0,0 +1,159 @@
+// AVX-512F kernels of GLM_EXT_simd_dispatch, compiled with a function target attribute.
+// Each kernel processes whole blocks and returns the number of elements processed, the caller processes the tail.
+
+namespace glm{
+namespace detail
+{
+	// Vectors read and write w, points have an implicit w of 1
+	template<bool Vectors, bool Project>
+	inline GLM_DISPATCH_AVX512 std::size_t dispatch_avx512_transform(mat4 const& m,
+		float const* inX, float const* inY, float const* inZ, float const* inW,
+		float* outX, float* outY, float* outZ, float* outW, std::size_t Count)
+	{
+		__m512 const m00 = _mm512_set1_ps(m[0][0]), m01 = _mm512_set1_ps(m[0][1]), m02 = _mm512_set1_ps(m[0][2]), m03 = _mm512_set1_ps(m[0][3]);
+		__m512 const m10 = _mm512_set1_ps(m[1][0]), m11 = _mm512_set1_ps(m[1][1]), m12 = _mm512_set1_ps(m[1][2]), m13 = _mm512_set1_ps(m[1][3]);
+		__m512 const m20 = _mm512_set1_ps(m[2][0]), m21 = _mm512_set1_ps(m[2][1]), m22 = _mm512_set1_ps(m[2][2]), m23 = _mm512_set1_ps(m[2][3]);
+		__m512 const m30 = _mm512_set1_ps(m[3][0]), m31 = _mm512_set1_ps(m[3][1]), m32 = _mm512_set1_ps(m[3][2]), m33 = _mm512_set1_ps(m[3][3]);
+
+		std::size_t i = 0;
+		for(; i + 16 <= Count; i += 16)
+		{
+			__m512 const x = _mm512_loadu_ps(inX + i);
+			__m512 const y = _mm512_loadu_ps(inY + i);
+			__m512 const z = _mm512_loadu_ps(inZ + i);
+			__m512 const w = Vectors ? _mm512_loadu_ps(inW + i) : _mm512_setzero_ps();
+
+			__m512 rx = _mm512_fmadd_ps(m00, x, _mm512_fmadd_ps(m10, y, _mm512_fmadd_ps(m20, z, Vectors ? _mm512_mul_ps(m30, w) : m30)));
+			__m512 ry = _mm512_fmadd_ps(m01, x, _mm512_fmadd_ps(m11, y, _mm512_fmadd_ps(m21, z, Vectors ? _mm512_mul_ps(m31, w) : m31)));
+			__m512 rz = _mm512_fmadd_ps(m02, x, _mm512_fmadd_ps(m12, y, _mm512_fmadd_ps(m22, z, Vectors ? _mm512_mul_ps(m32, w) : m32)));
+			if(Vectors || Project)
+			{
+				__m512 const rw = _mm512_fmadd_ps(m03, x, _mm512_fmadd_ps(m13, y, _mm512_fmadd_ps(m23, z, Vectors ? _mm512_mul_ps(m33, w) : m33)));
+				if(Project)
+				{
+					rx = _mm512_div_ps(rx, rw);
+					ry = _mm512_div_ps(ry, rw);
+					rz = _mm512_div_ps(rz, rw);
+				}
+				if(Vectors)
+					_mm512_storeu_ps(outW + i, rw);
+			}
+
+			_mm512_storeu_ps(outX + i, rx);
+			_mm512_storeu_ps(outY + i, ry);
+			_mm512_storeu_ps(outZ + i, rz);
+		}
+		return i;
+	}
+
+	// In[3] and Out[3] are null for points
+	inline GLM_DISPATCH_AVX512 std::size_t dispatch_avx512_transform(mat4 const& m,
+		float const* const In[4], float* const Out[4], std::size_t Count, bool Project)
+	{
+		if(In[3] != 0)
+			return dispatch_avx512_transform<true, false>(m, In[0], In[1], In[2], In[3], Out[0], Out[1], Out[2], Out[3], Count);
+		else if(Project)
+			return dispatch_avx512_transform<false, true>(m, In[0], In[1], In[2], 0, Out[0], Out[1], Out[2], 0, Count);
+		else
+			return dispatch_avx512_transform<false, false>(m, In[0], In[1], In[2], 0, Out[0], Out[1], Out[2], 0, Count);
+	}
+
+	inline GLM_DISPATCH_AVX512 __m512 dispatch_avx512_plane_distance(__m512 const Plane[4], __m512 x, __m512 y, __m512 z)
+	{
+		return _mm512_fmadd_ps(Plane[2], z, _mm512_fmadd_ps(Plane[1], y, _mm512_fmadd_ps(Plane[0], x, Plane[3])));
+	}
+
+	inline GLM_DISPATCH_AVX512 std::size_t dispatch_avx512_cull_spheres(vec4 const Planes[6],
+		float const* centerX, float const* centerY, float const* centerZ, float const* radius,
+		uint32* Visible, std::size_t Count, std::size_t& Processed)
+	{
+		__m512 Broadcast[6][4];
+		for(length_t p = 0; p < 6; ++p)
+		for(length_t c = 0; c < 4; ++c)
+			Broadcast[p][c] = _mm512_set1_ps(Planes[p][c]);
+
+		std::size_t Result = 0;
+		std::size_t i = 0;
+		for(; i + 32 <= Count; i += 32)
+		{
+			uint32 Mask = 0;
+			for(std::size_t j = 0; j < 32; j += 16)
+			{
+				std::size_t const k = i + j;
+				__m512 const x = _mm512_loadu_ps(centerX + k);
+				__m512 const y = _mm512_loadu_ps(centerY + k);
+				__m512 const z = _mm512_loadu_ps(centerZ + k);
+				__m512 const r = _mm512_sub_ps(_mm512_setzero_ps(), _mm512_loadu_ps(radius + k));
+
+				__mmask16 Inside = _mm512_cmp_ps_mask(dispatch_avx512_plane_distance(Broadcast[0], x, y, z), r, _CMP_GE_OQ);
+				for(length_t p = 1; p < 6; ++p)
+					Inside = _mm512_mask_cmp_ps_mask(Inside, dispatch_avx512_plane_distance(Broadcast[p], x, y, z), r, _CMP_GE_OQ);
+				Mask |= static_cast<uint32>(Inside) << j;
+			}
+
+			Visible[i / 32] = Mask;
+			Result += static_cast<std::size_t>(_mm_popcnt_u32(Mask));
+		}
+
+		Processed = i;
+		return Result;
+	}
+
+	inline GLM_DISPATCH_AVX512 std::size_t dispatch_avx512_cull_aabbs(vec4 const Planes[6],
+		float const* const Min[3], float const* const Max[3],
+		uint32* Visible, std::size_t Count, std::size_t& Processed)
+	{
+		__m512 Broadcast[6][4];
+		for(length_t p = 0; p < 6; ++p)
+		for(length_t c = 0; c < 4; ++c)
+			Broadcast[p][c] = _mm512_set1_ps(Planes[p][c]);
+
+		// Only the corner the furthest along the plane normal needs to be tested
+		float const* Corner[6][3];
+		for(length_t p = 0; p < 6; ++p)
+		for(length_t c = 0; c < 3; ++c)
+			Corner[p][c] = Planes[p][c] >= 0.0f ? Max[c] : Min[c];
+
+		std::size_t Result = 0;
+		std::size_t i = 0;
+		for(; i + 32 <= Count; i += 32)
+		{
+			uint32 Mask = 0;
+			for(std::size_t j = 0; j < 32; j += 16)
+			{
+				std::size_t const k = i + j;
+				__mmask16 Inside = static_cast<__mmask16>(0xFFFF);
+				for(length_t p = 0; p < 6; ++p)
+				{
+					__m512 const Distance = dispatch_avx512_plane_distance(Broadcast[p],
+						_mm512_loadu_ps(Corner[p][0] + k), _mm512_loadu_ps(Corner[p][1] + k), _mm512_loadu_ps(Corner[p][2] + k));
+					Inside = _mm512_mask_cmp_ps_mask(Inside, Distance, _mm512_setzero_ps(), _CMP_GE_OQ);
+				}
+				Mask |= static_cast<uint32>(Inside) << j;
+			}
+
+			Visible[i / 32] = Mask;
+			Result += static_cast<std::size_t>(_mm_popcnt_u32(Mask));
+		}
+
+		Processed = i;
+		return Result;
+	}
+
+	inline GLM_DISPATCH_AVX512 std::size_t dispatch_avx512_pack_half(float const* In, uint16* Out, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i + 16 <= Count; i += 16)
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(Out + i), _mm512_cvtps_ph(_mm512_loadu_ps(In + i), _MM_FROUND_TO_NEAREST_INT));
+		return i;
+	}
+
+	inline GLM_DISPATCH_AVX512 std::size_t dispatch_avx512_unpack_half(uint16 const* In, float* Out, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i + 16 <= Count; i += 16)
+			_mm512_storeu_ps(Out + i, _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(In + i))));
+		return i;
+	}
+}//namespace detail
+}//namespace glm
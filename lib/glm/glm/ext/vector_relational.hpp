@@ -9,6 +9,10 @@
 ///
 /// Exposes comparison functions for vector types that take a user defined epsilon values.
 ///
+/// The Mask functions return the comparisons as a bitmask, bit i being set when the comparison of the components i is true,
+/// so that all(v) is Mask == (1 << L) - 1 and any(v) is Mask != 0. For aligned vec4 with SIMD enabled, the comparisons
+/// don't go through bool vectors.
+///
 /// Include <glm/ext/vector_relational.hpp> to use the features of this extension.
 ///
 /// @see core_vector_relational
@@ -101,6 +105,118 @@ namespace glm
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_DECL GLM_CONSTEXPR vec<L, bool, Q> notEqual(vec<L, T, Q> const& x, vec<L, T, Q> const& y, vec<L, int, Q> const& ULPs);
 
+	/// Returns the bitmask of the component-wise comparison of x < y.
+	///
+	/// @tparam L Integer between 1 and 4 included that qualify the dimension of the vector
+	/// @tparam T A floating-point or integer scalar type
+	/// @tparam Q Value from qualifier enum
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL GLM_CONSTEXPR int lessThanMask(vec<L, T, Q> const& x, vec<L, T, Q> const& y);
+
+	/// Returns the bitmask of the component-wise comparison of x <= y.
+	///
+	/// @tparam L Integer between 1 and 4 included that qualify the dimension of the vector
+	/// @tparam T A floating-point or integer scalar type
+	/// @tparam Q Value from qualifier enum
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL GLM_CONSTEXPR int lessThanEqualMask(vec<L, T, Q> const& x, vec<L, T, Q> const& y);
+
+	/// Returns the bitmask of the component-wise comparison of x > y.
+	///
+	/// @tparam L Integer between 1 and 4 included that qualify the dimension of the vector
+	/// @tparam T A floating-point or integer scalar type
+	/// @tparam Q Value from qualifier enum
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL GLM_CONSTEXPR int greaterThanMask(vec<L, T, Q> const& x, vec<L, T, Q> const& y);
+
+	/// Returns the bitmask of the component-wise comparison of x >= y.
+	///
+	/// @tparam L Integer between 1 and 4 included that qualify the dimension of the vector
+	/// @tparam T A floating-point or integer scalar type
+	/// @tparam Q Value from qualifier enum
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL GLM_CONSTEXPR int greaterThanEqualMask(vec<L, T, Q> const& x, vec<L, T, Q> const& y);
+
+	/// Returns the bitmask of the component-wise comparison of x == y.
+	///
+	/// @tparam L Integer between 1 and 4 included that qualify the dimension of the vector
+	/// @tparam T A floating-point or integer scalar type
+	/// @tparam Q Value from qualifier enum
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL GLM_CONSTEXPR int equalMask(vec<L, T, Q> const& x, vec<L, T, Q> const& y);
+
+	/// Returns the bitmask of the component-wise comparison of x != y.
+	///
+	/// @tparam L Integer between 1 and 4 included that qualify the dimension of the vector
+	/// @tparam T A floating-point or integer scalar type
+	/// @tparam Q Value from qualifier enum
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL GLM_CONSTEXPR int notEqualMask(vec<L, T, Q> const& x, vec<L, T, Q> const& y);
+
+	/// Returns the bitmask of the component-wise comparison of |x - y| <= epsilon.
+	///
+	/// @tparam L Integer between 1 and 4 included that qualify the dimension of the vector
+	/// @tparam T Floating-point or integer scalar types
+	/// @tparam Q Value from qualifier enum
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL GLM_CONSTEXPR int equalMask(vec<L, T, Q> const& x, vec<L, T, Q> const& y, T epsilon);
+
+	/// Returns the bitmask of the component-wise comparison of |x - y| <= epsilon.
+	///
+	/// @tparam L Integer between 1 and 4 included that qualify the dimension of the vector
+	/// @tparam T Floating-point or integer scalar types
+	/// @tparam Q Value from qualifier enum
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL GLM_CONSTEXPR int equalMask(vec<L, T, Q> const& x, vec<L, T, Q> const& y, vec<L, T, Q> const& epsilon);
+
+	/// Returns the bitmask of the component-wise comparison of |x - y| > epsilon.
+	///
+	/// @tparam L Integer between 1 and 4 included that qualify the dimension of the vector
+	/// @tparam T Floating-point or integer scalar types
+	/// @tparam Q Value from qualifier enum
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL GLM_CONSTEXPR int notEqualMask(vec<L, T, Q> const& x, vec<L, T, Q> const& y, T epsilon);
+
+	/// Returns the bitmask of the component-wise comparison of |x - y| > epsilon.
+	///
+	/// @tparam L Integer between 1 and 4 included that qualify the dimension of the vector
+	/// @tparam T Floating-point or integer scalar types
+	/// @tparam Q Value from qualifier enum
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL GLM_CONSTEXPR int notEqualMask(vec<L, T, Q> const& x, vec<L, T, Q> const& y, vec<L, T, Q> const& epsilon);
+
+	/// Returns the bitmask of the component-wise comparison between two vectors in term of ULPs.
+	///
+	/// @tparam L Integer between 1 and 4 included that qualify the dimension of the vector
+	/// @tparam T Floating-point
+	/// @tparam Q Value from qualifier enum
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL GLM_CONSTEXPR int equalMask(vec<L, T, Q> const& x, vec<L, T, Q> const& y, int ULPs);
+
+	/// Returns the bitmask of the component-wise comparison between two vectors in term of ULPs.
+	///
+	/// @tparam L Integer between 1 and 4 included that qualify the dimension of the vector
+	/// @tparam T Floating-point
+	/// @tparam Q Value from qualifier enum
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL GLM_CONSTEXPR int equalMask(vec<L, T, Q> const& x, vec<L, T, Q> const& y, vec<L, int, Q> const& ULPs);
+
+	/// Returns the bitmask of the component-wise negated comparison between two vectors in term of ULPs.
+	///
+	/// @tparam L Integer between 1 and 4 included that qualify the dimension of the vector
+	/// @tparam T Floating-point
+	/// @tparam Q Value from qualifier enum
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL GLM_CONSTEXPR int notEqualMask(vec<L, T, Q> const& x, vec<L, T, Q> const& y, int ULPs);
+
+	/// Returns the bitmask of the component-wise negated comparison between two vectors in term of ULPs.
+	///
+	/// @tparam L Integer between 1 and 4 included that qualify the dimension of the vector
+	/// @tparam T Floating-point
+	/// @tparam Q Value from qualifier enum
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL GLM_CONSTEXPR int notEqualMask(vec<L, T, Q> const& x, vec<L, T, Q> const& y, vec<L, int, Q> const& ULPs);
+
 	/// @}
 }//namespace glm
 
@@ -3,8 +3,43 @@
 #include "../detail/qualifier.hpp"
 #include "../detail/type_float.hpp"
 
-namespace glm
+namespace glm{
+namespace detail
 {
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_equal_ulps
+	{
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static vec<L, bool, Q> call(vec<L, T, Q> const& x, vec<L, T, Q> const& y, vec<L, int, Q> const& MaxULPs)
+		{
+			vec<L, bool, Q> Result(false);
+			for(length_t i = 0; i < L; ++i)
+			{
+				detail::float_t<T> const a(x[i]);
+				detail::float_t<T> const b(y[i]);
+
+				// Different signs means they do not match.
+				if(a.negative() != b.negative())
+				{
+					// Check for equality to make sure +0==-0
+					Result[i] = a.mantissa() == b.mantissa() && a.exponent() == b.exponent();
+				}
+				else
+				{
+					// Find the difference in ULPs.
+					typename detail::float_t<T>::int_type const DiffULPs = abs(a.i - b.i);
+					Result[i] = DiffULPs <= MaxULPs[i];
+				}
+			}
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static int mask(vec<L, T, Q> const& x, vec<L, T, Q> const& y, vec<L, int, Q> const& MaxULPs)
+		{
+			return compute_mask(call(x, y, MaxULPs));
+		}
+	};
+}//namespace detail
+
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, bool, Q> equal(vec<L, T, Q> const& x, vec<L, T, Q> const& y, T Epsilon)
 	{
@@ -39,26 +74,7 @@ namespace glm
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, bool, Q> equal(vec<L, T, Q> const& x, vec<L, T, Q> const& y, vec<L, int, Q> const& MaxULPs)
 	{
-		vec<L, bool, Q> Result(false);
-		for(length_t i = 0; i < L; ++i)
-		{
-			detail::float_t<T> const a(x[i]);
-			detail::float_t<T> const b(y[i]);
-
-			// Different signs means they do not match.
-			if(a.negative() != b.negative())
-			{
-				// Check for equality to make sure +0==-0
-				Result[i] = a.mantissa() == b.mantissa() && a.exponent() == b.exponent();
-			}
-			else
-			{
-				// Find the difference in ULPs.
-				typename detail::float_t<T>::int_type const DiffULPs = abs(a.i - b.i);
-				Result[i] = DiffULPs <= MaxULPs[i];
-			}
-		}
-		return Result;
+		return detail::compute_equal_ulps<L, T, Q, detail::is_aligned<Q>::value>::call(x, y, MaxULPs);
 	}
 
 	template<length_t L, typename T, qualifier Q>
@@ -72,4 +88,92 @@ namespace glm
 	{
 		return not_(equal(x, y, MaxULPs));
 	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR int lessThanMask(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
+	{
+		return detail::compute_relational<L, T, Q, detail::is_aligned<Q>::value>::lessThanMask(x, y);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR int lessThanEqualMask(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
+	{
+		return detail::compute_relational<L, T, Q, detail::is_aligned<Q>::value>::lessThanEqualMask(x, y);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR int greaterThanMask(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
+	{
+		return detail::compute_relational<L, T, Q, detail::is_aligned<Q>::value>::greaterThanMask(x, y);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR int greaterThanEqualMask(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
+	{
+		return detail::compute_relational<L, T, Q, detail::is_aligned<Q>::value>::greaterThanEqualMask(x, y);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR int equalMask(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
+	{
+		return detail::compute_relational<L, T, Q, detail::is_aligned<Q>::value>::equalMask(x, y);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR int notEqualMask(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
+	{
+		return detail::compute_relational<L, T, Q, detail::is_aligned<Q>::value>::notEqualMask(x, y);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR int equalMask(vec<L, T, Q> const& x, vec<L, T, Q> const& y, T Epsilon)
+	{
+		return equalMask(x, y, vec<L, T, Q>(Epsilon));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR int equalMask(vec<L, T, Q> const& x, vec<L, T, Q> const& y, vec<L, T, Q> const& Epsilon)
+	{
+		return lessThanEqualMask(abs(x - y), Epsilon);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR int notEqualMask(vec<L, T, Q> const& x, vec<L, T, Q> const& y, T Epsilon)
+	{
+		return notEqualMask(x, y, vec<L, T, Q>(Epsilon));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR int notEqualMask(vec<L, T, Q> const& x, vec<L, T, Q> const& y, vec<L, T, Q> const& Epsilon)
+	{
+		return greaterThanMask(abs(x - y), Epsilon);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR int equalMask(vec<L, T, Q> const& x, vec<L, T, Q> const& y, int MaxULPs)
+	{
+		return equalMask(x, y, vec<L, int, Q>(MaxULPs));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR int equalMask(vec<L, T, Q> const& x, vec<L, T, Q> const& y, vec<L, int, Q> const& MaxULPs)
+	{
+		return detail::compute_equal_ulps<L, T, Q, detail::is_aligned<Q>::value>::mask(x, y, MaxULPs);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR int notEqualMask(vec<L, T, Q> const& x, vec<L, T, Q> const& y, int MaxULPs)
+	{
+		return notEqualMask(x, y, vec<L, int, Q>(MaxULPs));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR int notEqualMask(vec<L, T, Q> const& x, vec<L, T, Q> const& y, vec<L, int, Q> const& MaxULPs)
+	{
+		return equalMask(x, y, MaxULPs) ^ ((1 << L) - 1);
+	}
 }//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "vector_relational_simd.inl"
+#endif
@@ -0,0 +1,38 @@
+#include "../simd/vector_relational.h"
+
+namespace glm{
+namespace detail
+{
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	template<qualifier Q>
+	struct compute_equal_ulps<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, bool, Q> call(vec<4, float, Q> const& x, vec<4, float, Q> const& y, vec<4, int, Q> const& MaxULPs)
+		{
+			return compute_bvec4<Q>(mask(x, y, MaxULPs));
+		}
+
+		GLM_FUNC_QUALIFIER static int mask(vec<4, float, Q> const& x, vec<4, float, Q> const& y, vec<4, int, Q> const& MaxULPs)
+		{
+			return glm_vec4_equal_ulps(x.data, y.data, MaxULPs.data);
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	template<qualifier Q>
+	struct compute_equal_ulps<4, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, bool, Q> call(vec<4, double, Q> const& x, vec<4, double, Q> const& y, vec<4, int, Q> const& MaxULPs)
+		{
+			return compute_bvec4<Q>(mask(x, y, MaxULPs));
+		}
+
+		GLM_FUNC_QUALIFIER static int mask(vec<4, double, Q> const& x, vec<4, double, Q> const& y, vec<4, int, Q> const& MaxULPs)
+		{
+			return glm_dvec4_equal_ulps(x.data, y.data, MaxULPs.data);
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
+}//namespace detail
+}//namespace glm
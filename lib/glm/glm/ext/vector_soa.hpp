@@ -0,0 +1,437 @@
+/// @ref ext_vector_soa
+/// @file glm/ext/vector_soa.hpp
+///
+/// @defgroup ext_vector_soa GLM_EXT_vector_soa
+/// @ingroup ext
+///
+/// Structure of arrays (SoA) vector types.
+///
+/// soa_scalar<T, W> holds W scalars and soa_vec<L, T, W> holds W vectors of L components,
+/// one soa_scalar per component. Every operation processes the W lanes at once.
+/// Unlike vec<3, T, Q>, soa_vec<3, T, W> uses the full SIMD width.
+///
+/// When SIMD is enabled, float x4 uses SSE2, float x8 uses AVX or a pair of SSE2 registers
+/// and double x4 uses AVX.
+/// Other types and widths use scalar loops over the lanes.
+///
+/// load and store convert between soa_vec and W consecutive vec<L, T, Q>
+/// or L component arrays.
+///
+/// Include <glm/ext/vector_soa.hpp> to use the features of this extension.
+///
+/// @see ext_batch_transform
+
+#pragma once
+
+// Dependencies
+#include "../detail/qualifier.hpp"
+#include "../common.hpp"
+#include "../exponential.hpp"
+#include "../geometric.hpp"
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_EXT_vector_soa extension included")
+#endif
+
+namespace glm{
+namespace detail
+{
+	template<typename T, length_t W>
+	struct compute_soa;
+}//namespace detail
+
+	/// @addtogroup ext_vector_soa
+	/// @{
+
+	/// W scalars of type T processed together.
+	///
+	/// @tparam T Scalar type
+	/// @tparam W Number of lanes
+	template<typename T, length_t W>
+	struct soa_scalar
+	{
+		typedef T value_type;
+		typedef soa_scalar<T, W> type;
+		typedef typename detail::compute_soa<T, W>::type storage_type;
+
+		// -- Data --
+
+		storage_type data;
+
+		/// Return the number of lanes.
+		GLM_FUNC_DECL static GLM_CONSTEXPR length_t length(){return W;}
+
+		// -- Constructors --
+
+		GLM_FUNC_DECL soa_scalar() GLM_DEFAULT;
+		GLM_FUNC_DECL soa_scalar(T Scalar);
+		GLM_FUNC_DECL explicit soa_scalar(storage_type const& Data);
+
+		// -- Conversions --
+
+		/// Load W consecutive scalars, p doesn't need to be aligned.
+		GLM_FUNC_DECL static soa_scalar<T, W> load(T const* p);
+
+		/// Store the W lanes to consecutive scalars, p doesn't need to be aligned.
+		GLM_FUNC_DECL void store(T* p) const;
+
+		/// Return the value of lane i.
+		GLM_FUNC_DECL T operator[](length_t i) const;
+
+		// -- Unary arithmetic operators --
+
+		GLM_FUNC_DECL soa_scalar<T, W>& operator+=(soa_scalar<T, W> const& s);
+		GLM_FUNC_DECL soa_scalar<T, W>& operator-=(soa_scalar<T, W> const& s);
+		GLM_FUNC_DECL soa_scalar<T, W>& operator*=(soa_scalar<T, W> const& s);
+		GLM_FUNC_DECL soa_scalar<T, W>& operator/=(soa_scalar<T, W> const& s);
+	};
+
+	/// W vectors of L components of type T processed together.
+	///
+	/// @tparam L Number of components, 2, 3 or 4
+	/// @tparam T Scalar type
+	/// @tparam W Number of lanes
+	template<length_t L, typename T, length_t W>
+	struct soa_vec;
+
+	template<typename T, length_t W>
+	struct soa_vec<2, T, W>
+	{
+		typedef T value_type;
+		typedef soa_scalar<T, W> scalar_type;
+		typedef soa_vec<2, T, W> type;
+
+		// -- Data --
+
+		scalar_type x, y;
+
+		/// Return the number of components.
+		GLM_FUNC_DECL static GLM_CONSTEXPR length_t length(){return 2;}
+
+		GLM_FUNC_DECL scalar_type& operator[](length_t i);
+		GLM_FUNC_DECL scalar_type const& operator[](length_t i) const;
+
+		// -- Constructors --
+
+		GLM_FUNC_DECL soa_vec() GLM_DEFAULT;
+		GLM_FUNC_DECL explicit soa_vec(scalar_type const& Scalar);
+		GLM_FUNC_DECL soa_vec(scalar_type const& x, scalar_type const& y);
+
+		/// Broadcast v to every lane.
+		template<qualifier Q>
+		GLM_FUNC_DECL explicit soa_vec(vec<2, T, Q> const& v);
+
+		// -- Conversions --
+
+		/// Gather W consecutive vectors, p doesn't need to be aligned.
+		template<qualifier Q>
+		GLM_FUNC_DECL static soa_vec<2, T, W> load(vec<2, T, Q> const* p);
+
+		/// Load W consecutive values from each component array.
+		GLM_FUNC_DECL static soa_vec<2, T, W> load(T const* px, T const* py);
+
+		/// Scatter the W lanes to consecutive vectors, p doesn't need to be aligned.
+		template<qualifier Q>
+		GLM_FUNC_DECL void store(vec<2, T, Q>* p) const;
+
+		/// Store the W lanes to each component array.
+		GLM_FUNC_DECL void store(T* px, T* py) const;
+
+		// -- Unary arithmetic operators --
+
+		GLM_FUNC_DECL soa_vec<2, T, W>& operator+=(soa_vec<2, T, W> const& v);
+		GLM_FUNC_DECL soa_vec<2, T, W>& operator-=(soa_vec<2, T, W> const& v);
+		GLM_FUNC_DECL soa_vec<2, T, W>& operator*=(soa_vec<2, T, W> const& v);
+		GLM_FUNC_DECL soa_vec<2, T, W>& operator*=(scalar_type const& s);
+		GLM_FUNC_DECL soa_vec<2, T, W>& operator/=(soa_vec<2, T, W> const& v);
+		GLM_FUNC_DECL soa_vec<2, T, W>& operator/=(scalar_type const& s);
+	};
+
+	template<typename T, length_t W>
+	struct soa_vec<3, T, W>
+	{
+		typedef T value_type;
+		typedef soa_scalar<T, W> scalar_type;
+		typedef soa_vec<3, T, W> type;
+
+		// -- Data --
+
+		scalar_type x, y, z;
+
+		/// Return the number of components.
+		GLM_FUNC_DECL static GLM_CONSTEXPR length_t length(){return 3;}
+
+		GLM_FUNC_DECL scalar_type& operator[](length_t i);
+		GLM_FUNC_DECL scalar_type const& operator[](length_t i) const;
+
+		// -- Constructors --
+
+		GLM_FUNC_DECL soa_vec() GLM_DEFAULT;
+		GLM_FUNC_DECL explicit soa_vec(scalar_type const& Scalar);
+		GLM_FUNC_DECL soa_vec(scalar_type const& x, scalar_type const& y, scalar_type const& z);
+
+		/// Broadcast v to every lane.
+		template<qualifier Q>
+		GLM_FUNC_DECL explicit soa_vec(vec<3, T, Q> const& v);
+
+		// -- Conversions --
+
+		/// Gather W consecutive vectors, p doesn't need to be aligned.
+		template<qualifier Q>
+		GLM_FUNC_DECL static soa_vec<3, T, W> load(vec<3, T, Q> const* p);
+
+		/// Load W consecutive values from each component array.
+		GLM_FUNC_DECL static soa_vec<3, T, W> load(T const* px, T const* py, T const* pz);
+
+		/// Scatter the W lanes to consecutive vectors, p doesn't need to be aligned.
+		template<qualifier Q>
+		GLM_FUNC_DECL void store(vec<3, T, Q>* p) const;
+
+		/// Store the W lanes to each component array.
+		GLM_FUNC_DECL void store(T* px, T* py, T* pz) const;
+
+		// -- Unary arithmetic operators --
+
+		GLM_FUNC_DECL soa_vec<3, T, W>& operator+=(soa_vec<3, T, W> const& v);
+		GLM_FUNC_DECL soa_vec<3, T, W>& operator-=(soa_vec<3, T, W> const& v);
+		GLM_FUNC_DECL soa_vec<3, T, W>& operator*=(soa_vec<3, T, W> const& v);
+		GLM_FUNC_DECL soa_vec<3, T, W>& operator*=(scalar_type const& s);
+		GLM_FUNC_DECL soa_vec<3, T, W>& operator/=(soa_vec<3, T, W> const& v);
+		GLM_FUNC_DECL soa_vec<3, T, W>& operator/=(scalar_type const& s);
+	};
+
+	template<typename T, length_t W>
+	struct soa_vec<4, T, W>
+	{
+		typedef T value_type;
+		typedef soa_scalar<T, W> scalar_type;
+		typedef soa_vec<4, T, W> type;
+
+		// -- Data --
+
+		scalar_type x, y, z, w;
+
+		/// Return the number of components.
+		GLM_FUNC_DECL static GLM_CONSTEXPR length_t length(){return 4;}
+
+		GLM_FUNC_DECL scalar_type& operator[](length_t i);
+		GLM_FUNC_DECL scalar_type const& operator[](length_t i) const;
+
+		// -- Constructors --
+
+		GLM_FUNC_DECL soa_vec() GLM_DEFAULT;
+		GLM_FUNC_DECL explicit soa_vec(scalar_type const& Scalar);
+		GLM_FUNC_DECL soa_vec(scalar_type const& x, scalar_type const& y, scalar_type const& z, scalar_type const& w);
+
+		/// Broadcast v to every lane.
+		template<qualifier Q>
+		GLM_FUNC_DECL explicit soa_vec(vec<4, T, Q> const& v);
+
+		// -- Conversions --
+
+		/// Gather W consecutive vectors, p doesn't need to be aligned.
+		template<qualifier Q>
+		GLM_FUNC_DECL static soa_vec<4, T, W> load(vec<4, T, Q> const* p);
+
+		/// Load W consecutive values from each component array.
+		GLM_FUNC_DECL static soa_vec<4, T, W> load(T const* px, T const* py, T const* pz, T const* pw);
+
+		/// Scatter the W lanes to consecutive vectors, p doesn't need to be aligned.
+		template<qualifier Q>
+		GLM_FUNC_DECL void store(vec<4, T, Q>* p) const;
+
+		/// Store the W lanes to each component array.
+		GLM_FUNC_DECL void store(T* px, T* py, T* pz, T* pw) const;
+
+		// -- Unary arithmetic operators --
+
+		GLM_FUNC_DECL soa_vec<4, T, W>& operator+=(soa_vec<4, T, W> const& v);
+		GLM_FUNC_DECL soa_vec<4, T, W>& operator-=(soa_vec<4, T, W> const& v);
+		GLM_FUNC_DECL soa_vec<4, T, W>& operator*=(soa_vec<4, T, W> const& v);
+		GLM_FUNC_DECL soa_vec<4, T, W>& operator*=(scalar_type const& s);
+		GLM_FUNC_DECL soa_vec<4, T, W>& operator/=(soa_vec<4, T, W> const& v);
+		GLM_FUNC_DECL soa_vec<4, T, W>& operator/=(scalar_type const& s);
+	};
+
+	typedef soa_scalar<float, 4>		floatx4;
+	typedef soa_scalar<float, 8>		floatx8;
+	typedef soa_scalar<double, 4>		doublex4;
+
+	typedef soa_vec<2, float, 4>		vec2x4;
+	typedef soa_vec<2, float, 8>		vec2x8;
+	typedef soa_vec<3, float, 4>		vec3x4;
+	typedef soa_vec<3, float, 8>		vec3x8;
+	typedef soa_vec<4, float, 4>		vec4x4;
+	typedef soa_vec<4, float, 8>		vec4x8;
+	typedef soa_vec<2, double, 4>		dvec2x4;
+	typedef soa_vec<3, double, 4>		dvec3x4;
+	typedef soa_vec<4, double, 4>		dvec4x4;
+
+	// -- soa_scalar operators --
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_scalar<T, W> operator-(soa_scalar<T, W> const& s);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_scalar<T, W> operator+(soa_scalar<T, W> const& a, soa_scalar<T, W> const& b);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_scalar<T, W> operator+(soa_scalar<T, W> const& a, T b);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_scalar<T, W> operator+(T a, soa_scalar<T, W> const& b);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_scalar<T, W> operator-(soa_scalar<T, W> const& a, soa_scalar<T, W> const& b);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_scalar<T, W> operator-(soa_scalar<T, W> const& a, T b);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_scalar<T, W> operator-(T a, soa_scalar<T, W> const& b);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_scalar<T, W> operator*(soa_scalar<T, W> const& a, soa_scalar<T, W> const& b);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_scalar<T, W> operator*(soa_scalar<T, W> const& a, T b);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_scalar<T, W> operator*(T a, soa_scalar<T, W> const& b);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_scalar<T, W> operator/(soa_scalar<T, W> const& a, soa_scalar<T, W> const& b);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_scalar<T, W> operator/(soa_scalar<T, W> const& a, T b);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_scalar<T, W> operator/(T a, soa_scalar<T, W> const& b);
+
+	// -- soa_scalar functions --
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_scalar<T, W> abs(soa_scalar<T, W> const& x);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_scalar<T, W> min(soa_scalar<T, W> const& x, soa_scalar<T, W> const& y);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_scalar<T, W> max(soa_scalar<T, W> const& x, soa_scalar<T, W> const& y);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_scalar<T, W> clamp(soa_scalar<T, W> const& x, soa_scalar<T, W> const& minVal, soa_scalar<T, W> const& maxVal);
+
+	/// Return x * (1 - a) + y * a for each lane.
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_scalar<T, W> mix(soa_scalar<T, W> const& x, soa_scalar<T, W> const& y, soa_scalar<T, W> const& a);
+
+	/// Return a * b + c for each lane, fused when the architecture supports it.
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_scalar<T, W> fma(soa_scalar<T, W> const& a, soa_scalar<T, W> const& b, soa_scalar<T, W> const& c);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_scalar<T, W> sqrt(soa_scalar<T, W> const& x);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_scalar<T, W> inversesqrt(soa_scalar<T, W> const& x);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_scalar<T, W> floor(soa_scalar<T, W> const& x);
+
+	/// Return x - floor(x) for each lane.
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_scalar<T, W> fract(soa_scalar<T, W> const& x);
+
+	/// Return x - y * floor(x / y) for each lane.
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_scalar<T, W> mod(soa_scalar<T, W> const& x, soa_scalar<T, W> const& y);
+
+	/// Return 0 if x < edge, 1 otherwise for each lane.
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_scalar<T, W> step(soa_scalar<T, W> const& edge, soa_scalar<T, W> const& x);
+
+	/// Return a bitmask with bit i set when lane i of x < y. Lanes with a NaN are false.
+	template<typename T, length_t W>
+	GLM_FUNC_DECL int lessThanMask(soa_scalar<T, W> const& x, soa_scalar<T, W> const& y);
+
+	/// Return a bitmask with bit i set when lane i of x <= y. Lanes with a NaN are false.
+	template<typename T, length_t W>
+	GLM_FUNC_DECL int lessThanEqualMask(soa_scalar<T, W> const& x, soa_scalar<T, W> const& y);
+
+	/// Return a bitmask with bit i set when lane i of x > y. Lanes with a NaN are false.
+	template<typename T, length_t W>
+	GLM_FUNC_DECL int greaterThanMask(soa_scalar<T, W> const& x, soa_scalar<T, W> const& y);
+
+	/// Return a bitmask with bit i set when lane i of x >= y. Lanes with a NaN are false.
+	template<typename T, length_t W>
+	GLM_FUNC_DECL int greaterThanEqualMask(soa_scalar<T, W> const& x, soa_scalar<T, W> const& y);
+
+	// -- soa_vec operators --
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa_vec<L, T, W> operator-(soa_vec<L, T, W> const& v);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa_vec<L, T, W> operator+(soa_vec<L, T, W> const& a, soa_vec<L, T, W> const& b);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa_vec<L, T, W> operator-(soa_vec<L, T, W> const& a, soa_vec<L, T, W> const& b);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa_vec<L, T, W> operator*(soa_vec<L, T, W> const& a, soa_vec<L, T, W> const& b);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa_vec<L, T, W> operator*(soa_vec<L, T, W> const& a, soa_scalar<T, W> const& b);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa_vec<L, T, W> operator*(soa_scalar<T, W> const& a, soa_vec<L, T, W> const& b);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa_vec<L, T, W> operator/(soa_vec<L, T, W> const& a, soa_vec<L, T, W> const& b);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa_vec<L, T, W> operator/(soa_vec<L, T, W> const& a, soa_scalar<T, W> const& b);
+
+	// -- soa_vec functions --
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa_vec<L, T, W> min(soa_vec<L, T, W> const& x, soa_vec<L, T, W> const& y);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa_vec<L, T, W> max(soa_vec<L, T, W> const& x, soa_vec<L, T, W> const& y);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa_vec<L, T, W> clamp(soa_vec<L, T, W> const& x, soa_scalar<T, W> const& minVal, soa_scalar<T, W> const& maxVal);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa_vec<L, T, W> clamp(soa_vec<L, T, W> const& x, soa_vec<L, T, W> const& minVal, soa_vec<L, T, W> const& maxVal);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa_vec<L, T, W> mix(soa_vec<L, T, W> const& x, soa_vec<L, T, W> const& y, soa_scalar<T, W> const& a);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa_vec<L, T, W> floor(soa_vec<L, T, W> const& x);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa_vec<L, T, W> fract(soa_vec<L, T, W> const& x);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa_scalar<T, W> dot(soa_vec<L, T, W> const& x, soa_vec<L, T, W> const& y);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa_scalar<T, W> length(soa_vec<L, T, W> const& x);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa_scalar<T, W> distance(soa_vec<L, T, W> const& p0, soa_vec<L, T, W> const& p1);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa_vec<L, T, W> normalize(soa_vec<L, T, W> const& x);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_vec<3, T, W> cross(soa_vec<3, T, W> const& x, soa_vec<3, T, W> const& y);
+
+	/// @}
+}//namespace glm
+
+#include "vector_soa.inl"
@@ -0,0 +1,1002 @@
+namespace glm{
+namespace detail
+{
+	template<typename T, length_t W>
+	struct compute_soa
+	{
+		struct type
+		{
+			T data[W];
+		};
+
+		GLM_FUNC_QUALIFIER static type broadcast(T s)
+		{
+			type Result;
+			for(length_t i = 0; i < W; ++i)
+				Result.data[i] = s;
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static type load(T const* p)
+		{
+			type Result;
+			for(length_t i = 0; i < W; ++i)
+				Result.data[i] = p[i];
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static void store(T* p, type const& v)
+		{
+			for(length_t i = 0; i < W; ++i)
+				p[i] = v.data[i];
+		}
+
+		GLM_FUNC_QUALIFIER static T extract(type const& v, length_t i)
+		{
+			return v.data[i];
+		}
+
+		// Load W consecutive packed vectors of L components, one output per component
+		template<length_t L>
+		GLM_FUNC_QUALIFIER static void load_packed(T const* p, type* v)
+		{
+			for(length_t i = 0; i < W; ++i)
+			for(length_t c = 0; c < L; ++c)
+				v[c].data[i] = p[i * L + c];
+		}
+
+		template<length_t L>
+		GLM_FUNC_QUALIFIER static void store_packed(T* p, type const* v)
+		{
+			for(length_t i = 0; i < W; ++i)
+			for(length_t c = 0; c < L; ++c)
+				p[i * L + c] = v[c].data[i];
+		}
+
+		GLM_FUNC_QUALIFIER static type add(type const& a, type const& b)
+		{
+			type Result;
+			for(length_t i = 0; i < W; ++i)
+				Result.data[i] = a.data[i] + b.data[i];
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static type sub(type const& a, type const& b)
+		{
+			type Result;
+			for(length_t i = 0; i < W; ++i)
+				Result.data[i] = a.data[i] - b.data[i];
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static type mul(type const& a, type const& b)
+		{
+			type Result;
+			for(length_t i = 0; i < W; ++i)
+				Result.data[i] = a.data[i] * b.data[i];
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static type div(type const& a, type const& b)
+		{
+			type Result;
+			for(length_t i = 0; i < W; ++i)
+				Result.data[i] = a.data[i] / b.data[i];
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static type fma(type const& a, type const& b, type const& c)
+		{
+			type Result;
+			for(length_t i = 0; i < W; ++i)
+				Result.data[i] = a.data[i] * b.data[i] + c.data[i];
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static type neg(type const& a)
+		{
+			type Result;
+			for(length_t i = 0; i < W; ++i)
+				Result.data[i] = -a.data[i];
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static type abs(type const& a)
+		{
+			type Result;
+			for(length_t i = 0; i < W; ++i)
+				Result.data[i] = glm::abs(a.data[i]);
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static type min(type const& a, type const& b)
+		{
+			type Result;
+			for(length_t i = 0; i < W; ++i)
+				Result.data[i] = glm::min(a.data[i], b.data[i]);
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static type max(type const& a, type const& b)
+		{
+			type Result;
+			for(length_t i = 0; i < W; ++i)
+				Result.data[i] = glm::max(a.data[i], b.data[i]);
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static type sqrt(type const& a)
+		{
+			type Result;
+			for(length_t i = 0; i < W; ++i)
+				Result.data[i] = glm::sqrt(a.data[i]);
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static type floor(type const& a)
+		{
+			type Result;
+			for(length_t i = 0; i < W; ++i)
+				Result.data[i] = glm::floor(a.data[i]);
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static type step(type const& edge, type const& x)
+		{
+			type Result;
+			for(length_t i = 0; i < W; ++i)
+				Result.data[i] = x.data[i] < edge.data[i] ? static_cast<T>(0) : static_cast<T>(1);
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static int less_mask(type const& a, type const& b)
+		{
+			int Result = 0;
+			for(length_t i = 0; i < W; ++i)
+				Result |= (a.data[i] < b.data[i] ? 1 : 0) << i;
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static int less_equal_mask(type const& a, type const& b)
+		{
+			int Result = 0;
+			for(length_t i = 0; i < W; ++i)
+				Result |= (a.data[i] <= b.data[i] ? 1 : 0) << i;
+			return Result;
+		}
+	};
+
+	template<length_t L, typename T, length_t W, qualifier Q>
+	struct compute_soa_packed
+	{
+		// vec<L, T, Q> is tightly packed when it isn't padded for alignment
+		GLM_FUNC_QUALIFIER static void load(vec<L, T, Q> const* p, soa_vec<L, T, W>& v)
+		{
+			typename compute_soa<T, W>::type Data[L];
+			if(sizeof(vec<L, T, Q>) == sizeof(T) * L)
+				compute_soa<T, W>::template load_packed<L>(reinterpret_cast<T const*>(p), Data);
+			else
+			{
+				T Lanes[L][W];
+				for(length_t i = 0; i < W; ++i)
+				for(length_t c = 0; c < L; ++c)
+					Lanes[c][i] = p[i][c];
+				for(length_t c = 0; c < L; ++c)
+					Data[c] = compute_soa<T, W>::load(Lanes[c]);
+			}
+
+			for(length_t c = 0; c < L; ++c)
+				v[c] = soa_scalar<T, W>(Data[c]);
+		}
+
+		GLM_FUNC_QUALIFIER static void store(vec<L, T, Q>* p, soa_vec<L, T, W> const& v)
+		{
+			typename compute_soa<T, W>::type Data[L];
+			for(length_t c = 0; c < L; ++c)
+				Data[c] = v[c].data;
+
+			if(sizeof(vec<L, T, Q>) == sizeof(T) * L)
+				compute_soa<T, W>::template store_packed<L>(reinterpret_cast<T*>(p), Data);
+			else
+			{
+				T Lanes[L][W];
+				for(length_t c = 0; c < L; ++c)
+					compute_soa<T, W>::store(Lanes[c], Data[c]);
+				for(length_t i = 0; i < W; ++i)
+				for(length_t c = 0; c < L; ++c)
+					p[i][c] = Lanes[c][i];
+			}
+		}
+	};
+}//namespace detail
+
+	// -- soa_scalar constructors --
+
+#	if GLM_CONFIG_DEFAULTED_FUNCTIONS == GLM_DISABLE
+		template<typename T, length_t W>
+		GLM_FUNC_QUALIFIER soa_scalar<T, W>::soa_scalar()
+#			if GLM_CONFIG_CTOR_INIT != GLM_CTOR_INIT_DISABLE
+				: data(detail::compute_soa<T, W>::broadcast(static_cast<T>(0)))
+#			endif
+		{}
+#	endif
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W>::soa_scalar(T Scalar)
+		: data(detail::compute_soa<T, W>::broadcast(Scalar))
+	{}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W>::soa_scalar(storage_type const& Data)
+		: data(Data)
+	{}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W> soa_scalar<T, W>::load(T const* p)
+	{
+		return soa_scalar<T, W>(detail::compute_soa<T, W>::load(p));
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER void soa_scalar<T, W>::store(T* p) const
+	{
+		detail::compute_soa<T, W>::store(p, this->data);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER T soa_scalar<T, W>::operator[](length_t i) const
+	{
+		assert(i >= 0 && i < W);
+		return detail::compute_soa<T, W>::extract(this->data, i);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W>& soa_scalar<T, W>::operator+=(soa_scalar<T, W> const& s)
+	{
+		this->data = detail::compute_soa<T, W>::add(this->data, s.data);
+		return *this;
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W>& soa_scalar<T, W>::operator-=(soa_scalar<T, W> const& s)
+	{
+		this->data = detail::compute_soa<T, W>::sub(this->data, s.data);
+		return *this;
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W>& soa_scalar<T, W>::operator*=(soa_scalar<T, W> const& s)
+	{
+		this->data = detail::compute_soa<T, W>::mul(this->data, s.data);
+		return *this;
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W>& soa_scalar<T, W>::operator/=(soa_scalar<T, W> const& s)
+	{
+		this->data = detail::compute_soa<T, W>::div(this->data, s.data);
+		return *this;
+	}
+
+	// -- soa_scalar operators --
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W> operator-(soa_scalar<T, W> const& s)
+	{
+		return soa_scalar<T, W>(detail::compute_soa<T, W>::neg(s.data));
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W> operator+(soa_scalar<T, W> const& a, soa_scalar<T, W> const& b)
+	{
+		return soa_scalar<T, W>(detail::compute_soa<T, W>::add(a.data, b.data));
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W> operator+(soa_scalar<T, W> const& a, T b)
+	{
+		return a + soa_scalar<T, W>(b);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W> operator+(T a, soa_scalar<T, W> const& b)
+	{
+		return soa_scalar<T, W>(a) + b;
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W> operator-(soa_scalar<T, W> const& a, soa_scalar<T, W> const& b)
+	{
+		return soa_scalar<T, W>(detail::compute_soa<T, W>::sub(a.data, b.data));
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W> operator-(soa_scalar<T, W> const& a, T b)
+	{
+		return a - soa_scalar<T, W>(b);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W> operator-(T a, soa_scalar<T, W> const& b)
+	{
+		return soa_scalar<T, W>(a) - b;
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W> operator*(soa_scalar<T, W> const& a, soa_scalar<T, W> const& b)
+	{
+		return soa_scalar<T, W>(detail::compute_soa<T, W>::mul(a.data, b.data));
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W> operator*(soa_scalar<T, W> const& a, T b)
+	{
+		return a * soa_scalar<T, W>(b);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W> operator*(T a, soa_scalar<T, W> const& b)
+	{
+		return soa_scalar<T, W>(a) * b;
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W> operator/(soa_scalar<T, W> const& a, soa_scalar<T, W> const& b)
+	{
+		return soa_scalar<T, W>(detail::compute_soa<T, W>::div(a.data, b.data));
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W> operator/(soa_scalar<T, W> const& a, T b)
+	{
+		return a / soa_scalar<T, W>(b);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W> operator/(T a, soa_scalar<T, W> const& b)
+	{
+		return soa_scalar<T, W>(a) / b;
+	}
+
+	// -- soa_scalar functions --
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W> abs(soa_scalar<T, W> const& x)
+	{
+		return soa_scalar<T, W>(detail::compute_soa<T, W>::abs(x.data));
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W> min(soa_scalar<T, W> const& x, soa_scalar<T, W> const& y)
+	{
+		return soa_scalar<T, W>(detail::compute_soa<T, W>::min(x.data, y.data));
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W> max(soa_scalar<T, W> const& x, soa_scalar<T, W> const& y)
+	{
+		return soa_scalar<T, W>(detail::compute_soa<T, W>::max(x.data, y.data));
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W> clamp(soa_scalar<T, W> const& x, soa_scalar<T, W> const& minVal, soa_scalar<T, W> const& maxVal)
+	{
+		return min(max(x, minVal), maxVal);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W> mix(soa_scalar<T, W> const& x, soa_scalar<T, W> const& y, soa_scalar<T, W> const& a)
+	{
+		return x * (static_cast<T>(1) - a) + y * a;
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W> fma(soa_scalar<T, W> const& a, soa_scalar<T, W> const& b, soa_scalar<T, W> const& c)
+	{
+		return soa_scalar<T, W>(detail::compute_soa<T, W>::fma(a.data, b.data, c.data));
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W> sqrt(soa_scalar<T, W> const& x)
+	{
+		return soa_scalar<T, W>(detail::compute_soa<T, W>::sqrt(x.data));
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W> inversesqrt(soa_scalar<T, W> const& x)
+	{
+		return static_cast<T>(1) / sqrt(x);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W> floor(soa_scalar<T, W> const& x)
+	{
+		return soa_scalar<T, W>(detail::compute_soa<T, W>::floor(x.data));
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W> fract(soa_scalar<T, W> const& x)
+	{
+		return x - floor(x);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W> mod(soa_scalar<T, W> const& x, soa_scalar<T, W> const& y)
+	{
+		return x - y * floor(x / y);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W> step(soa_scalar<T, W> const& edge, soa_scalar<T, W> const& x)
+	{
+		return soa_scalar<T, W>(detail::compute_soa<T, W>::step(edge.data, x.data));
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER int lessThanMask(soa_scalar<T, W> const& x, soa_scalar<T, W> const& y)
+	{
+		return detail::compute_soa<T, W>::less_mask(x.data, y.data);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER int lessThanEqualMask(soa_scalar<T, W> const& x, soa_scalar<T, W> const& y)
+	{
+		return detail::compute_soa<T, W>::less_equal_mask(x.data, y.data);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER int greaterThanMask(soa_scalar<T, W> const& x, soa_scalar<T, W> const& y)
+	{
+		return detail::compute_soa<T, W>::less_mask(y.data, x.data);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER int greaterThanEqualMask(soa_scalar<T, W> const& x, soa_scalar<T, W> const& y)
+	{
+		return detail::compute_soa<T, W>::less_equal_mask(y.data, x.data);
+	}
+
+	// -- soa_vec<2, T, W> --
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER typename soa_vec<2, T, W>::scalar_type& soa_vec<2, T, W>::operator[](length_t i)
+	{
+		assert(i >= 0 && i < this->length());
+		switch(i)
+		{
+		default:
+		case 0:
+			return x;
+		case 1:
+			return y;
+		}
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER typename soa_vec<2, T, W>::scalar_type const& soa_vec<2, T, W>::operator[](length_t i) const
+	{
+		assert(i >= 0 && i < this->length());
+		switch(i)
+		{
+		default:
+		case 0:
+			return x;
+		case 1:
+			return y;
+		}
+	}
+
+#	if GLM_CONFIG_DEFAULTED_FUNCTIONS == GLM_DISABLE
+		template<typename T, length_t W>
+		GLM_FUNC_QUALIFIER soa_vec<2, T, W>::soa_vec()
+		{}
+#	endif
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<2, T, W>::soa_vec(scalar_type const& Scalar)
+		: x(Scalar), y(Scalar)
+	{}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<2, T, W>::soa_vec(scalar_type const& _x, scalar_type const& _y)
+		: x(_x), y(_y)
+	{}
+
+	template<typename T, length_t W>
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER soa_vec<2, T, W>::soa_vec(vec<2, T, Q> const& v)
+		: x(v.x), y(v.y)
+	{}
+
+	template<typename T, length_t W>
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER soa_vec<2, T, W> soa_vec<2, T, W>::load(vec<2, T, Q> const* p)
+	{
+		soa_vec<2, T, W> Result;
+		detail::compute_soa_packed<2, T, W, Q>::load(p, Result);
+		return Result;
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<2, T, W> soa_vec<2, T, W>::load(T const* px, T const* py)
+	{
+		return soa_vec<2, T, W>(scalar_type::load(px), scalar_type::load(py));
+	}
+
+	template<typename T, length_t W>
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void soa_vec<2, T, W>::store(vec<2, T, Q>* p) const
+	{
+		detail::compute_soa_packed<2, T, W, Q>::store(p, *this);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER void soa_vec<2, T, W>::store(T* px, T* py) const
+	{
+		this->x.store(px);
+		this->y.store(py);
+	}
+
+	// -- soa_vec<3, T, W> --
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER typename soa_vec<3, T, W>::scalar_type& soa_vec<3, T, W>::operator[](length_t i)
+	{
+		assert(i >= 0 && i < this->length());
+		switch(i)
+		{
+		default:
+		case 0:
+			return x;
+		case 1:
+			return y;
+		case 2:
+			return z;
+		}
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER typename soa_vec<3, T, W>::scalar_type const& soa_vec<3, T, W>::operator[](length_t i) const
+	{
+		assert(i >= 0 && i < this->length());
+		switch(i)
+		{
+		default:
+		case 0:
+			return x;
+		case 1:
+			return y;
+		case 2:
+			return z;
+		}
+	}
+
+#	if GLM_CONFIG_DEFAULTED_FUNCTIONS == GLM_DISABLE
+		template<typename T, length_t W>
+		GLM_FUNC_QUALIFIER soa_vec<3, T, W>::soa_vec()
+		{}
+#	endif
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<3, T, W>::soa_vec(scalar_type const& Scalar)
+		: x(Scalar), y(Scalar), z(Scalar)
+	{}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<3, T, W>::soa_vec(scalar_type const& _x, scalar_type const& _y, scalar_type const& _z)
+		: x(_x), y(_y), z(_z)
+	{}
+
+	template<typename T, length_t W>
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER soa_vec<3, T, W>::soa_vec(vec<3, T, Q> const& v)
+		: x(v.x), y(v.y), z(v.z)
+	{}
+
+	template<typename T, length_t W>
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER soa_vec<3, T, W> soa_vec<3, T, W>::load(vec<3, T, Q> const* p)
+	{
+		soa_vec<3, T, W> Result;
+		detail::compute_soa_packed<3, T, W, Q>::load(p, Result);
+		return Result;
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<3, T, W> soa_vec<3, T, W>::load(T const* px, T const* py, T const* pz)
+	{
+		return soa_vec<3, T, W>(scalar_type::load(px), scalar_type::load(py), scalar_type::load(pz));
+	}
+
+	template<typename T, length_t W>
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void soa_vec<3, T, W>::store(vec<3, T, Q>* p) const
+	{
+		detail::compute_soa_packed<3, T, W, Q>::store(p, *this);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER void soa_vec<3, T, W>::store(T* px, T* py, T* pz) const
+	{
+		this->x.store(px);
+		this->y.store(py);
+		this->z.store(pz);
+	}
+
+	// -- soa_vec<4, T, W> --
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER typename soa_vec<4, T, W>::scalar_type& soa_vec<4, T, W>::operator[](length_t i)
+	{
+		assert(i >= 0 && i < this->length());
+		switch(i)
+		{
+		default:
+		case 0:
+			return x;
+		case 1:
+			return y;
+		case 2:
+			return z;
+		case 3:
+			return w;
+		}
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER typename soa_vec<4, T, W>::scalar_type const& soa_vec<4, T, W>::operator[](length_t i) const
+	{
+		assert(i >= 0 && i < this->length());
+		switch(i)
+		{
+		default:
+		case 0:
+			return x;
+		case 1:
+			return y;
+		case 2:
+			return z;
+		case 3:
+			return w;
+		}
+	}
+
+#	if GLM_CONFIG_DEFAULTED_FUNCTIONS == GLM_DISABLE
+		template<typename T, length_t W>
+		GLM_FUNC_QUALIFIER soa_vec<4, T, W>::soa_vec()
+		{}
+#	endif
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<4, T, W>::soa_vec(scalar_type const& Scalar)
+		: x(Scalar), y(Scalar), z(Scalar), w(Scalar)
+	{}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<4, T, W>::soa_vec(scalar_type const& _x, scalar_type const& _y, scalar_type const& _z, scalar_type const& _w)
+		: x(_x), y(_y), z(_z), w(_w)
+	{}
+
+	template<typename T, length_t W>
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER soa_vec<4, T, W>::soa_vec(vec<4, T, Q> const& v)
+		: x(v.x), y(v.y), z(v.z), w(v.w)
+	{}
+
+	template<typename T, length_t W>
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER soa_vec<4, T, W> soa_vec<4, T, W>::load(vec<4, T, Q> const* p)
+	{
+		soa_vec<4, T, W> Result;
+		detail::compute_soa_packed<4, T, W, Q>::load(p, Result);
+		return Result;
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<4, T, W> soa_vec<4, T, W>::load(T const* px, T const* py, T const* pz, T const* pw)
+	{
+		return soa_vec<4, T, W>(scalar_type::load(px), scalar_type::load(py), scalar_type::load(pz), scalar_type::load(pw));
+	}
+
+	template<typename T, length_t W>
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void soa_vec<4, T, W>::store(vec<4, T, Q>* p) const
+	{
+		detail::compute_soa_packed<4, T, W, Q>::store(p, *this);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER void soa_vec<4, T, W>::store(T* px, T* py, T* pz, T* pw) const
+	{
+		this->x.store(px);
+		this->y.store(py);
+		this->z.store(pz);
+		this->w.store(pw);
+	}
+
+	// -- soa_vec unary arithmetic operators --
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<2, T, W>& soa_vec<2, T, W>::operator+=(soa_vec<2, T, W> const& v)
+	{
+		return (*this = *this + v);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<2, T, W>& soa_vec<2, T, W>::operator-=(soa_vec<2, T, W> const& v)
+	{
+		return (*this = *this - v);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<2, T, W>& soa_vec<2, T, W>::operator*=(soa_vec<2, T, W> const& v)
+	{
+		return (*this = *this * v);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<2, T, W>& soa_vec<2, T, W>::operator*=(scalar_type const& s)
+	{
+		return (*this = *this * s);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<2, T, W>& soa_vec<2, T, W>::operator/=(soa_vec<2, T, W> const& v)
+	{
+		return (*this = *this / v);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<2, T, W>& soa_vec<2, T, W>::operator/=(scalar_type const& s)
+	{
+		return (*this = *this / s);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<3, T, W>& soa_vec<3, T, W>::operator+=(soa_vec<3, T, W> const& v)
+	{
+		return (*this = *this + v);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<3, T, W>& soa_vec<3, T, W>::operator-=(soa_vec<3, T, W> const& v)
+	{
+		return (*this = *this - v);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<3, T, W>& soa_vec<3, T, W>::operator*=(soa_vec<3, T, W> const& v)
+	{
+		return (*this = *this * v);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<3, T, W>& soa_vec<3, T, W>::operator*=(scalar_type const& s)
+	{
+		return (*this = *this * s);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<3, T, W>& soa_vec<3, T, W>::operator/=(soa_vec<3, T, W> const& v)
+	{
+		return (*this = *this / v);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<3, T, W>& soa_vec<3, T, W>::operator/=(scalar_type const& s)
+	{
+		return (*this = *this / s);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<4, T, W>& soa_vec<4, T, W>::operator+=(soa_vec<4, T, W> const& v)
+	{
+		return (*this = *this + v);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<4, T, W>& soa_vec<4, T, W>::operator-=(soa_vec<4, T, W> const& v)
+	{
+		return (*this = *this - v);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<4, T, W>& soa_vec<4, T, W>::operator*=(soa_vec<4, T, W> const& v)
+	{
+		return (*this = *this * v);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<4, T, W>& soa_vec<4, T, W>::operator*=(scalar_type const& s)
+	{
+		return (*this = *this * s);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<4, T, W>& soa_vec<4, T, W>::operator/=(soa_vec<4, T, W> const& v)
+	{
+		return (*this = *this / v);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<4, T, W>& soa_vec<4, T, W>::operator/=(scalar_type const& s)
+	{
+		return (*this = *this / s);
+	}
+
+	// -- soa_vec operators --
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<L, T, W> operator-(soa_vec<L, T, W> const& v)
+	{
+		soa_vec<L, T, W> Result;
+		for(length_t i = 0; i < L; ++i)
+			Result[i] = -v[i];
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<L, T, W> operator+(soa_vec<L, T, W> const& a, soa_vec<L, T, W> const& b)
+	{
+		soa_vec<L, T, W> Result;
+		for(length_t i = 0; i < L; ++i)
+			Result[i] = a[i] + b[i];
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<L, T, W> operator-(soa_vec<L, T, W> const& a, soa_vec<L, T, W> const& b)
+	{
+		soa_vec<L, T, W> Result;
+		for(length_t i = 0; i < L; ++i)
+			Result[i] = a[i] - b[i];
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<L, T, W> operator*(soa_vec<L, T, W> const& a, soa_vec<L, T, W> const& b)
+	{
+		soa_vec<L, T, W> Result;
+		for(length_t i = 0; i < L; ++i)
+			Result[i] = a[i] * b[i];
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<L, T, W> operator*(soa_vec<L, T, W> const& a, soa_scalar<T, W> const& b)
+	{
+		soa_vec<L, T, W> Result;
+		for(length_t i = 0; i < L; ++i)
+			Result[i] = a[i] * b;
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<L, T, W> operator*(soa_scalar<T, W> const& a, soa_vec<L, T, W> const& b)
+	{
+		return b * a;
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<L, T, W> operator/(soa_vec<L, T, W> const& a, soa_vec<L, T, W> const& b)
+	{
+		soa_vec<L, T, W> Result;
+		for(length_t i = 0; i < L; ++i)
+			Result[i] = a[i] / b[i];
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<L, T, W> operator/(soa_vec<L, T, W> const& a, soa_scalar<T, W> const& b)
+	{
+		soa_vec<L, T, W> Result;
+		for(length_t i = 0; i < L; ++i)
+			Result[i] = a[i] / b;
+		return Result;
+	}
+
+	// -- soa_vec functions --
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<L, T, W> min(soa_vec<L, T, W> const& x, soa_vec<L, T, W> const& y)
+	{
+		soa_vec<L, T, W> Result;
+		for(length_t i = 0; i < L; ++i)
+			Result[i] = min(x[i], y[i]);
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<L, T, W> max(soa_vec<L, T, W> const& x, soa_vec<L, T, W> const& y)
+	{
+		soa_vec<L, T, W> Result;
+		for(length_t i = 0; i < L; ++i)
+			Result[i] = max(x[i], y[i]);
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<L, T, W> clamp(soa_vec<L, T, W> const& x, soa_scalar<T, W> const& minVal, soa_scalar<T, W> const& maxVal)
+	{
+		soa_vec<L, T, W> Result;
+		for(length_t i = 0; i < L; ++i)
+			Result[i] = clamp(x[i], minVal, maxVal);
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<L, T, W> clamp(soa_vec<L, T, W> const& x, soa_vec<L, T, W> const& minVal, soa_vec<L, T, W> const& maxVal)
+	{
+		soa_vec<L, T, W> Result;
+		for(length_t i = 0; i < L; ++i)
+			Result[i] = clamp(x[i], minVal[i], maxVal[i]);
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<L, T, W> mix(soa_vec<L, T, W> const& x, soa_vec<L, T, W> const& y, soa_scalar<T, W> const& a)
+	{
+		soa_vec<L, T, W> Result;
+		for(length_t i = 0; i < L; ++i)
+			Result[i] = mix(x[i], y[i], a);
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<L, T, W> floor(soa_vec<L, T, W> const& x)
+	{
+		soa_vec<L, T, W> Result;
+		for(length_t i = 0; i < L; ++i)
+			Result[i] = floor(x[i]);
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<L, T, W> fract(soa_vec<L, T, W> const& x)
+	{
+		soa_vec<L, T, W> Result;
+		for(length_t i = 0; i < L; ++i)
+			Result[i] = fract(x[i]);
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W> dot(soa_vec<L, T, W> const& x, soa_vec<L, T, W> const& y)
+	{
+		soa_scalar<T, W> Result(x[0] * y[0]);
+		for(length_t i = 1; i < L; ++i)
+			Result = fma(x[i], y[i], Result);
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W> length(soa_vec<L, T, W> const& x)
+	{
+		return sqrt(dot(x, x));
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W> distance(soa_vec<L, T, W> const& p0, soa_vec<L, T, W> const& p1)
+	{
+		return length(p1 - p0);
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<L, T, W> normalize(soa_vec<L, T, W> const& x)
+	{
+		return x * inversesqrt(dot(x, x));
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<3, T, W> cross(soa_vec<3, T, W> const& x, soa_vec<3, T, W> const& y)
+	{
+		return soa_vec<3, T, W>(
+			x.y * y.z - y.y * x.z,
+			x.z * y.x - y.z * x.x,
+			x.x * y.y - y.x * x.y);
+	}
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "vector_soa_simd.inl"
+#endif
@@ -0,0 +1,542 @@
+#include "../simd/packing.h"
+
+namespace glm{
+namespace detail
+{
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	template<>
+	struct compute_soa<float, 4>
+	{
+		typedef glm_vec4 type;
+
+		GLM_FUNC_QUALIFIER static type broadcast(float s)
+		{
+			return _mm_set1_ps(s);
+		}
+
+		GLM_FUNC_QUALIFIER static type load(float const* p)
+		{
+			return _mm_loadu_ps(p);
+		}
+
+		GLM_FUNC_QUALIFIER static void store(float* p, type v)
+		{
+			_mm_storeu_ps(p, v);
+		}
+
+		GLM_FUNC_QUALIFIER static float extract(type v, length_t i)
+		{
+			float Lanes[4];
+			_mm_storeu_ps(Lanes, v);
+			return Lanes[i];
+		}
+
+		template<length_t L>
+		GLM_FUNC_QUALIFIER static void load_packed(float const* p, type* v)
+		{
+			if(L == 2)
+				glm_vec4_load_packed2(p, &v[0], &v[1]);
+			else if(L == 3)
+				glm_vec4_load_packed3(p, &v[0], &v[1], &v[2]);
+			else
+				glm_vec4_load_packed4(p, &v[0], &v[1], &v[2], &v[3]);
+		}
+
+		template<length_t L>
+		GLM_FUNC_QUALIFIER static void store_packed(float* p, type const* v)
+		{
+			if(L == 2)
+				glm_vec4_store_packed2(p, v[0], v[1]);
+			else if(L == 3)
+				glm_vec4_store_packed3(p, v[0], v[1], v[2]);
+			else
+				glm_vec4_store_packed4(p, v[0], v[1], v[2], v[3]);
+		}
+
+		GLM_FUNC_QUALIFIER static type add(type a, type b)
+		{
+			return _mm_add_ps(a, b);
+		}
+
+		GLM_FUNC_QUALIFIER static type sub(type a, type b)
+		{
+			return _mm_sub_ps(a, b);
+		}
+
+		GLM_FUNC_QUALIFIER static type mul(type a, type b)
+		{
+			return _mm_mul_ps(a, b);
+		}
+
+		GLM_FUNC_QUALIFIER static type div(type a, type b)
+		{
+			return _mm_div_ps(a, b);
+		}
+
+		GLM_FUNC_QUALIFIER static type fma(type a, type b, type c)
+		{
+			return glm_vec4_fma(a, b, c);
+		}
+
+		GLM_FUNC_QUALIFIER static type neg(type a)
+		{
+			return _mm_xor_ps(a, _mm_set1_ps(-0.0f));
+		}
+
+		GLM_FUNC_QUALIFIER static type abs(type a)
+		{
+			return glm_vec4_abs(a);
+		}
+
+		GLM_FUNC_QUALIFIER static type min(type a, type b)
+		{
+			return _mm_min_ps(a, b);
+		}
+
+		GLM_FUNC_QUALIFIER static type max(type a, type b)
+		{
+			return _mm_max_ps(a, b);
+		}
+
+		GLM_FUNC_QUALIFIER static type sqrt(type a)
+		{
+			return _mm_sqrt_ps(a);
+		}
+
+		GLM_FUNC_QUALIFIER static type floor(type a)
+		{
+			return glm_vec4_floor(a);
+		}
+
+		// Unordered compare, NaN lanes give 1 like the scalar x < edge ? 0 : 1
+		GLM_FUNC_QUALIFIER static type step(type edge, type x)
+		{
+			return _mm_andnot_ps(_mm_cmplt_ps(x, edge), _mm_set1_ps(1.0f));
+		}
+
+		GLM_FUNC_QUALIFIER static int less_mask(type a, type b)
+		{
+			return _mm_movemask_ps(_mm_cmplt_ps(a, b));
+		}
+
+		GLM_FUNC_QUALIFIER static int less_equal_mask(type a, type b)
+		{
+			return _mm_movemask_ps(_mm_cmple_ps(a, b));
+		}
+	};
+
+#	if !(GLM_ARCH & GLM_ARCH_AVX_BIT)
+	// Without AVX, 8 lanes are processed as two SSE registers
+	template<>
+	struct compute_soa<float, 8>
+	{
+		struct type
+		{
+			glm_vec4 data[2];
+		};
+
+		GLM_FUNC_QUALIFIER static type broadcast(float s)
+		{
+			type Result;
+			Result.data[0] = Result.data[1] = _mm_set1_ps(s);
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static type load(float const* p)
+		{
+			type Result;
+			Result.data[0] = _mm_loadu_ps(p);
+			Result.data[1] = _mm_loadu_ps(p + 4);
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static void store(float* p, type const& v)
+		{
+			_mm_storeu_ps(p, v.data[0]);
+			_mm_storeu_ps(p + 4, v.data[1]);
+		}
+
+		GLM_FUNC_QUALIFIER static float extract(type const& v, length_t i)
+		{
+			return compute_soa<float, 4>::extract(v.data[i >> 2], i & 3);
+		}
+
+		template<length_t L>
+		GLM_FUNC_QUALIFIER static void load_packed(float const* p, type* v)
+		{
+			glm_vec4 Lo[L], Hi[L];
+			compute_soa<float, 4>::load_packed<L>(p, Lo);
+			compute_soa<float, 4>::load_packed<L>(p + 4 * L, Hi);
+			for(length_t c = 0; c < L; ++c)
+			{
+				v[c].data[0] = Lo[c];
+				v[c].data[1] = Hi[c];
+			}
+		}
+
+		template<length_t L>
+		GLM_FUNC_QUALIFIER static void store_packed(float* p, type const* v)
+		{
+			glm_vec4 Lo[L], Hi[L];
+			for(length_t c = 0; c < L; ++c)
+			{
+				Lo[c] = v[c].data[0];
+				Hi[c] = v[c].data[1];
+			}
+			compute_soa<float, 4>::store_packed<L>(p, Lo);
+			compute_soa<float, 4>::store_packed<L>(p + 4 * L, Hi);
+		}
+
+		GLM_FUNC_QUALIFIER static type add(type const& a, type const& b)
+		{
+			type Result;
+			Result.data[0] = compute_soa<float, 4>::add(a.data[0], b.data[0]);
+			Result.data[1] = compute_soa<float, 4>::add(a.data[1], b.data[1]);
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static type sub(type const& a, type const& b)
+		{
+			type Result;
+			Result.data[0] = compute_soa<float, 4>::sub(a.data[0], b.data[0]);
+			Result.data[1] = compute_soa<float, 4>::sub(a.data[1], b.data[1]);
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static type mul(type const& a, type const& b)
+		{
+			type Result;
+			Result.data[0] = compute_soa<float, 4>::mul(a.data[0], b.data[0]);
+			Result.data[1] = compute_soa<float, 4>::mul(a.data[1], b.data[1]);
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static type div(type const& a, type const& b)
+		{
+			type Result;
+			Result.data[0] = compute_soa<float, 4>::div(a.data[0], b.data[0]);
+			Result.data[1] = compute_soa<float, 4>::div(a.data[1], b.data[1]);
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static type min(type const& a, type const& b)
+		{
+			type Result;
+			Result.data[0] = compute_soa<float, 4>::min(a.data[0], b.data[0]);
+			Result.data[1] = compute_soa<float, 4>::min(a.data[1], b.data[1]);
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static type max(type const& a, type const& b)
+		{
+			type Result;
+			Result.data[0] = compute_soa<float, 4>::max(a.data[0], b.data[0]);
+			Result.data[1] = compute_soa<float, 4>::max(a.data[1], b.data[1]);
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static type fma(type const& a, type const& b, type const& c)
+		{
+			type Result;
+			Result.data[0] = compute_soa<float, 4>::fma(a.data[0], b.data[0], c.data[0]);
+			Result.data[1] = compute_soa<float, 4>::fma(a.data[1], b.data[1], c.data[1]);
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static type neg(type const& a)
+		{
+			type Result;
+			Result.data[0] = compute_soa<float, 4>::neg(a.data[0]);
+			Result.data[1] = compute_soa<float, 4>::neg(a.data[1]);
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static type abs(type const& a)
+		{
+			type Result;
+			Result.data[0] = compute_soa<float, 4>::abs(a.data[0]);
+			Result.data[1] = compute_soa<float, 4>::abs(a.data[1]);
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static type sqrt(type const& a)
+		{
+			type Result;
+			Result.data[0] = compute_soa<float, 4>::sqrt(a.data[0]);
+			Result.data[1] = compute_soa<float, 4>::sqrt(a.data[1]);
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static type floor(type const& a)
+		{
+			type Result;
+			Result.data[0] = compute_soa<float, 4>::floor(a.data[0]);
+			Result.data[1] = compute_soa<float, 4>::floor(a.data[1]);
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static type step(type const& edge, type const& x)
+		{
+			type Result;
+			Result.data[0] = compute_soa<float, 4>::step(edge.data[0], x.data[0]);
+			Result.data[1] = compute_soa<float, 4>::step(edge.data[1], x.data[1]);
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static int less_mask(type const& a, type const& b)
+		{
+			return compute_soa<float, 4>::less_mask(a.data[0], b.data[0]) | (compute_soa<float, 4>::less_mask(a.data[1], b.data[1]) << 4);
+		}
+
+		GLM_FUNC_QUALIFIER static int less_equal_mask(type const& a, type const& b)
+		{
+			return compute_soa<float, 4>::less_equal_mask(a.data[0], b.data[0]) | (compute_soa<float, 4>::less_equal_mask(a.data[1], b.data[1]) << 4);
+		}
+	};
+#	endif//!(GLM_ARCH & GLM_ARCH_AVX_BIT)
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	template<>
+	struct compute_soa<float, 8>
+	{
+		typedef glm_vec8 type;
+
+		GLM_FUNC_QUALIFIER static type broadcast(float s)
+		{
+			return _mm256_set1_ps(s);
+		}
+
+		GLM_FUNC_QUALIFIER static type load(float const* p)
+		{
+			return _mm256_loadu_ps(p);
+		}
+
+		GLM_FUNC_QUALIFIER static void store(float* p, type v)
+		{
+			_mm256_storeu_ps(p, v);
+		}
+
+		GLM_FUNC_QUALIFIER static float extract(type v, length_t i)
+		{
+			float Lanes[8];
+			_mm256_storeu_ps(Lanes, v);
+			return Lanes[i];
+		}
+
+		template<length_t L>
+		GLM_FUNC_QUALIFIER static void load_packed(float const* p, type* v)
+		{
+			if(L == 2)
+				glm_vec8_load_packed2(p, &v[0], &v[1]);
+			else if(L == 3)
+				glm_vec8_load_packed3(p, &v[0], &v[1], &v[2]);
+			else
+				glm_vec8_load_packed4(p, &v[0], &v[1], &v[2], &v[3]);
+		}
+
+		template<length_t L>
+		GLM_FUNC_QUALIFIER static void store_packed(float* p, type const* v)
+		{
+			if(L == 2)
+				glm_vec8_store_packed2(p, v[0], v[1]);
+			else if(L == 3)
+				glm_vec8_store_packed3(p, v[0], v[1], v[2]);
+			else
+				glm_vec8_store_packed4(p, v[0], v[1], v[2], v[3]);
+		}
+
+		GLM_FUNC_QUALIFIER static type add(type a, type b)
+		{
+			return _mm256_add_ps(a, b);
+		}
+
+		GLM_FUNC_QUALIFIER static type sub(type a, type b)
+		{
+			return _mm256_sub_ps(a, b);
+		}
+
+		GLM_FUNC_QUALIFIER static type mul(type a, type b)
+		{
+			return _mm256_mul_ps(a, b);
+		}
+
+		GLM_FUNC_QUALIFIER static type div(type a, type b)
+		{
+			return _mm256_div_ps(a, b);
+		}
+
+		GLM_FUNC_QUALIFIER static type fma(type a, type b, type c)
+		{
+			return glm_vec8_fma(a, b, c);
+		}
+
+		GLM_FUNC_QUALIFIER static type neg(type a)
+		{
+			return _mm256_xor_ps(a, _mm256_set1_ps(-0.0f));
+		}
+
+		GLM_FUNC_QUALIFIER static type abs(type a)
+		{
+			return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a);
+		}
+
+		GLM_FUNC_QUALIFIER static type min(type a, type b)
+		{
+			return _mm256_min_ps(a, b);
+		}
+
+		GLM_FUNC_QUALIFIER static type max(type a, type b)
+		{
+			return _mm256_max_ps(a, b);
+		}
+
+		GLM_FUNC_QUALIFIER static type sqrt(type a)
+		{
+			return _mm256_sqrt_ps(a);
+		}
+
+		GLM_FUNC_QUALIFIER static type floor(type a)
+		{
+			return _mm256_floor_ps(a);
+		}
+
+		GLM_FUNC_QUALIFIER static type step(type edge, type x)
+		{
+			return _mm256_andnot_ps(_mm256_cmp_ps(x, edge, _CMP_LT_OQ), _mm256_set1_ps(1.0f));
+		}
+
+		GLM_FUNC_QUALIFIER static int less_mask(type a, type b)
+		{
+			return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_LT_OQ));
+		}
+
+		GLM_FUNC_QUALIFIER static int less_equal_mask(type a, type b)
+		{
+			return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_LE_OQ));
+		}
+	};
+
+	template<>
+	struct compute_soa<double, 4>
+	{
+		typedef glm_dvec4 type;
+
+		GLM_FUNC_QUALIFIER static type broadcast(double s)
+		{
+			return _mm256_set1_pd(s);
+		}
+
+		GLM_FUNC_QUALIFIER static type load(double const* p)
+		{
+			return _mm256_loadu_pd(p);
+		}
+
+		GLM_FUNC_QUALIFIER static void store(double* p, type v)
+		{
+			_mm256_storeu_pd(p, v);
+		}
+
+		GLM_FUNC_QUALIFIER static double extract(type v, length_t i)
+		{
+			double Lanes[4];
+			_mm256_storeu_pd(Lanes, v);
+			return Lanes[i];
+		}
+
+		// No cheap double deinterleave, go through the lanes
+		template<length_t L>
+		GLM_FUNC_QUALIFIER static void load_packed(double const* p, type* v)
+		{
+			double Lanes[L][4];
+			for(length_t i = 0; i < 4; ++i)
+			for(length_t c = 0; c < L; ++c)
+				Lanes[c][i] = p[i * L + c];
+			for(length_t c = 0; c < L; ++c)
+				v[c] = _mm256_loadu_pd(Lanes[c]);
+		}
+
+		template<length_t L>
+		GLM_FUNC_QUALIFIER static void store_packed(double* p, type const* v)
+		{
+			double Lanes[L][4];
+			for(length_t c = 0; c < L; ++c)
+				_mm256_storeu_pd(Lanes[c], v[c]);
+			for(length_t i = 0; i < 4; ++i)
+			for(length_t c = 0; c < L; ++c)
+				p[i * L + c] = Lanes[c][i];
+		}
+
+		GLM_FUNC_QUALIFIER static type add(type a, type b)
+		{
+			return _mm256_add_pd(a, b);
+		}
+
+		GLM_FUNC_QUALIFIER static type sub(type a, type b)
+		{
+			return _mm256_sub_pd(a, b);
+		}
+
+		GLM_FUNC_QUALIFIER static type mul(type a, type b)
+		{
+			return _mm256_mul_pd(a, b);
+		}
+
+		GLM_FUNC_QUALIFIER static type div(type a, type b)
+		{
+			return _mm256_div_pd(a, b);
+		}
+
+		GLM_FUNC_QUALIFIER static type fma(type a, type b, type c)
+		{
+			return glm_dvec4_fma(a, b, c);
+		}
+
+		GLM_FUNC_QUALIFIER static type neg(type a)
+		{
+			return _mm256_xor_pd(a, _mm256_set1_pd(-0.0));
+		}
+
+		GLM_FUNC_QUALIFIER static type abs(type a)
+		{
+			return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a);
+		}
+
+		GLM_FUNC_QUALIFIER static type min(type a, type b)
+		{
+			return _mm256_min_pd(a, b);
+		}
+
+		GLM_FUNC_QUALIFIER static type max(type a, type b)
+		{
+			return _mm256_max_pd(a, b);
+		}
+
+		GLM_FUNC_QUALIFIER static type sqrt(type a)
+		{
+			return _mm256_sqrt_pd(a);
+		}
+
+		GLM_FUNC_QUALIFIER static type floor(type a)
+		{
+			return _mm256_floor_pd(a);
+		}
+
+		GLM_FUNC_QUALIFIER static type step(type edge, type x)
+		{
+			return _mm256_andnot_pd(_mm256_cmp_pd(x, edge, _CMP_LT_OQ), _mm256_set1_pd(1.0));
+		}
+
+		GLM_FUNC_QUALIFIER static int less_mask(type a, type b)
+		{
+			return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_LT_OQ));
+		}
+
+		GLM_FUNC_QUALIFIER static int less_equal_mask(type a, type b)
+		{
+			return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_LE_OQ));
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+}//namespace detail
+}//namespace glm
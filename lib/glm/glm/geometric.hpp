@@ -7,6 +7,8 @@
 /// @ingroup core
 ///
 /// These operate on vectors as vectors, not component-wise.
+/// With lowp and mediump float vectors, normalize uses a faster approximation.
+/// Its maximum error is listed in glm/detail/compute_approximation.hpp.
 ///
 /// Include <glm/geometric.hpp> to use these core features.
 
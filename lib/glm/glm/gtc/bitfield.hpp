@@ -22,6 +22,7 @@
 #include "../detail/_vectorize.hpp"
 #include "type_precision.hpp"
 #include <limits>
+#include <cstddef>
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
 #	pragma message("GLM: GLM_GTC_bitfield extension included")
@@ -260,6 +261,24 @@ namespace glm
 	/// @see gtc_bitfield
 	GLM_FUNC_DECL uint64 bitfieldInterleave(uint16 x, uint16 y, uint16 z, uint16 w);
 
+	/// Interleaves the bits of Count 2D coordinates, such as the Morton codes of a tile grid.
+	/// Converts 4 coordinates at a time with SSE2 and 8 with AVX2.
+	///
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL void bitfieldInterleave(u16vec2 const* In, uint32* Out, std::size_t Count);
+
+	/// Interleaves the bits of Count 3D coordinates, such as the Morton codes of the cells of a voxel grid.
+	/// Uses the BMI2 bit deposit instruction when available.
+	///
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL void bitfieldInterleave(u16vec3 const* In, uint64* Out, std::size_t Count);
+
+	/// Deinterleaves the bits of Count 2D Morton codes.
+	/// Converts 4 codes at a time with SSE2 and 8 with AVX2.
+	///
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL void bitfieldDeinterleave(uint32 const* In, u16vec2* Out, std::size_t Count);
+
 	/// @}
 } //namespace glm
 
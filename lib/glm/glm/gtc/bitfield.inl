@@ -17,210 +17,272 @@ namespace detail
 	template<>
 	GLM_FUNC_QUALIFIER glm::uint16 bitfieldInterleave(glm::uint8 x, glm::uint8 y)
 	{
-		glm::uint16 REG1(x);
-		glm::uint16 REG2(y);
+#		if GLM_ARCH_BMI2
+			return static_cast<glm::uint16>(_pdep_u32(x, 0x5555u) | _pdep_u32(y, 0xAAAAu));
+#		else
+			glm::uint16 REG1(x);
+			glm::uint16 REG2(y);
 
-		REG1 = ((REG1 <<  4) | REG1) & static_cast<glm::uint16>(0x0F0F);
-		REG2 = ((REG2 <<  4) | REG2) & static_cast<glm::uint16>(0x0F0F);
+			REG1 = ((REG1 <<  4) | REG1) & static_cast<glm::uint16>(0x0F0F);
+			REG2 = ((REG2 <<  4) | REG2) & static_cast<glm::uint16>(0x0F0F);
 
-		REG1 = ((REG1 <<  2) | REG1) & static_cast<glm::uint16>(0x3333);
-		REG2 = ((REG2 <<  2) | REG2) & static_cast<glm::uint16>(0x3333);
+			REG1 = ((REG1 <<  2) | REG1) & static_cast<glm::uint16>(0x3333);
+			REG2 = ((REG2 <<  2) | REG2) & static_cast<glm::uint16>(0x3333);
 
-		REG1 = ((REG1 <<  1) | REG1) & static_cast<glm::uint16>(0x5555);
-		REG2 = ((REG2 <<  1) | REG2) & static_cast<glm::uint16>(0x5555);
+			REG1 = ((REG1 <<  1) | REG1) & static_cast<glm::uint16>(0x5555);
+			REG2 = ((REG2 <<  1) | REG2) & static_cast<glm::uint16>(0x5555);
 
-		return REG1 | static_cast<glm::uint16>(REG2 << 1);
+			return REG1 | static_cast<glm::uint16>(REG2 << 1);
+#		endif
 	}
 
 	template<>
 	GLM_FUNC_QUALIFIER glm::uint32 bitfieldInterleave(glm::uint16 x, glm::uint16 y)
 	{
-		glm::uint32 REG1(x);
-		glm::uint32 REG2(y);
+#		if GLM_ARCH_BMI2
+			return _pdep_u32(x, 0x55555555u) | _pdep_u32(y, 0xAAAAAAAAu);
+#		else
+			glm::uint32 REG1(x);
+			glm::uint32 REG2(y);
 
-		REG1 = ((REG1 <<  8) | REG1) & static_cast<glm::uint32>(0x00FF00FF);
-		REG2 = ((REG2 <<  8) | REG2) & static_cast<glm::uint32>(0x00FF00FF);
+			REG1 = ((REG1 <<  8) | REG1) & static_cast<glm::uint32>(0x00FF00FF);
+			REG2 = ((REG2 <<  8) | REG2) & static_cast<glm::uint32>(0x00FF00FF);
 
-		REG1 = ((REG1 <<  4) | REG1) & static_cast<glm::uint32>(0x0F0F0F0F);
-		REG2 = ((REG2 <<  4) | REG2) & static_cast<glm::uint32>(0x0F0F0F0F);
+			REG1 = ((REG1 <<  4) | REG1) & static_cast<glm::uint32>(0x0F0F0F0F);
+			REG2 = ((REG2 <<  4) | REG2) & static_cast<glm::uint32>(0x0F0F0F0F);
 
-		REG1 = ((REG1 <<  2) | REG1) & static_cast<glm::uint32>(0x33333333);
-		REG2 = ((REG2 <<  2) | REG2) & static_cast<glm::uint32>(0x33333333);
+			REG1 = ((REG1 <<  2) | REG1) & static_cast<glm::uint32>(0x33333333);
+			REG2 = ((REG2 <<  2) | REG2) & static_cast<glm::uint32>(0x33333333);
 
-		REG1 = ((REG1 <<  1) | REG1) & static_cast<glm::uint32>(0x55555555);
-		REG2 = ((REG2 <<  1) | REG2) & static_cast<glm::uint32>(0x55555555);
+			REG1 = ((REG1 <<  1) | REG1) & static_cast<glm::uint32>(0x55555555);
+			REG2 = ((REG2 <<  1) | REG2) & static_cast<glm::uint32>(0x55555555);
 
-		return REG1 | (REG2 << 1);
+			return REG1 | (REG2 << 1);
+#		endif
 	}
 
 	template<>
 	GLM_FUNC_QUALIFIER glm::uint64 bitfieldInterleave(glm::uint32 x, glm::uint32 y)
 	{
-		glm::uint64 REG1(x);
-		glm::uint64 REG2(y);
+#		if GLM_ARCH_BMI2 && (GLM_MODEL == GLM_MODEL_64)
+			return _pdep_u64(x, 0x5555555555555555ull) | _pdep_u64(y, 0xAAAAAAAAAAAAAAAAull);
+#		else
+			glm::uint64 REG1(x);
+			glm::uint64 REG2(y);
 
-		REG1 = ((REG1 << 16) | REG1) & static_cast<glm::uint64>(0x0000FFFF0000FFFFull);
-		REG2 = ((REG2 << 16) | REG2) & static_cast<glm::uint64>(0x0000FFFF0000FFFFull);
+			REG1 = ((REG1 << 16) | REG1) & static_cast<glm::uint64>(0x0000FFFF0000FFFFull);
+			REG2 = ((REG2 << 16) | REG2) & static_cast<glm::uint64>(0x0000FFFF0000FFFFull);
 
-		REG1 = ((REG1 <<  8) | REG1) & static_cast<glm::uint64>(0x00FF00FF00FF00FFull);
-		REG2 = ((REG2 <<  8) | REG2) & static_cast<glm::uint64>(0x00FF00FF00FF00FFull);
+			REG1 = ((REG1 <<  8) | REG1) & static_cast<glm::uint64>(0x00FF00FF00FF00FFull);
+			REG2 = ((REG2 <<  8) | REG2) & static_cast<glm::uint64>(0x00FF00FF00FF00FFull);
 
-		REG1 = ((REG1 <<  4) | REG1) & static_cast<glm::uint64>(0x0F0F0F0F0F0F0F0Full);
-		REG2 = ((REG2 <<  4) | REG2) & static_cast<glm::uint64>(0x0F0F0F0F0F0F0F0Full);
+			REG1 = ((REG1 <<  4) | REG1) & static_cast<glm::uint64>(0x0F0F0F0F0F0F0F0Full);
+			REG2 = ((REG2 <<  4) | REG2) & static_cast<glm::uint64>(0x0F0F0F0F0F0F0F0Full);
 
-		REG1 = ((REG1 <<  2) | REG1) & static_cast<glm::uint64>(0x3333333333333333ull);
-		REG2 = ((REG2 <<  2) | REG2) & static_cast<glm::uint64>(0x3333333333333333ull);
+			REG1 = ((REG1 <<  2) | REG1) & static_cast<glm::uint64>(0x3333333333333333ull);
+			REG2 = ((REG2 <<  2) | REG2) & static_cast<glm::uint64>(0x3333333333333333ull);
 
-		REG1 = ((REG1 <<  1) | REG1) & static_cast<glm::uint64>(0x5555555555555555ull);
-		REG2 = ((REG2 <<  1) | REG2) & static_cast<glm::uint64>(0x5555555555555555ull);
+			REG1 = ((REG1 <<  1) | REG1) & static_cast<glm::uint64>(0x5555555555555555ull);
+			REG2 = ((REG2 <<  1) | REG2) & static_cast<glm::uint64>(0x5555555555555555ull);
 
-		return REG1 | (REG2 << 1);
+			return REG1 | (REG2 << 1);
+#		endif
 	}
 
 	template<>
 	GLM_FUNC_QUALIFIER glm::uint32 bitfieldInterleave(glm::uint8 x, glm::uint8 y, glm::uint8 z)
 	{
-		glm::uint32 REG1(x);
-		glm::uint32 REG2(y);
-		glm::uint32 REG3(z);
+#		if GLM_ARCH_BMI2
+			return _pdep_u32(x, 0x49249249u) | _pdep_u32(y, 0x92492492u) | _pdep_u32(z, 0x24924924u);
+#		else
+			glm::uint32 REG1(x);
+			glm::uint32 REG2(y);
+			glm::uint32 REG3(z);
 
-		REG1 = ((REG1 << 16) | REG1) & static_cast<glm::uint32>(0xFF0000FFu);
-		REG2 = ((REG2 << 16) | REG2) & static_cast<glm::uint32>(0xFF0000FFu);
-		REG3 = ((REG3 << 16) | REG3) & static_cast<glm::uint32>(0xFF0000FFu);
+			REG1 = ((REG1 << 16) | REG1) & static_cast<glm::uint32>(0xFF0000FFu);
+			REG2 = ((REG2 << 16) | REG2) & static_cast<glm::uint32>(0xFF0000FFu);
+			REG3 = ((REG3 << 16) | REG3) & static_cast<glm::uint32>(0xFF0000FFu);
 
-		REG1 = ((REG1 <<  8) | REG1) & static_cast<glm::uint32>(0x0F00F00Fu);
-		REG2 = ((REG2 <<  8) | REG2) & static_cast<glm::uint32>(0x0F00F00Fu);
-		REG3 = ((REG3 <<  8) | REG3) & static_cast<glm::uint32>(0x0F00F00Fu);
+			REG1 = ((REG1 <<  8) | REG1) & static_cast<glm::uint32>(0x0F00F00Fu);
+			REG2 = ((REG2 <<  8) | REG2) & static_cast<glm::uint32>(0x0F00F00Fu);
+			REG3 = ((REG3 <<  8) | REG3) & static_cast<glm::uint32>(0x0F00F00Fu);
 
-		REG1 = ((REG1 <<  4) | REG1) & static_cast<glm::uint32>(0xC30C30C3u);
-		REG2 = ((REG2 <<  4) | REG2) & static_cast<glm::uint32>(0xC30C30C3u);
-		REG3 = ((REG3 <<  4) | REG3) & static_cast<glm::uint32>(0xC30C30C3u);
+			REG1 = ((REG1 <<  4) | REG1) & static_cast<glm::uint32>(0xC30C30C3u);
+			REG2 = ((REG2 <<  4) | REG2) & static_cast<glm::uint32>(0xC30C30C3u);
+			REG3 = ((REG3 <<  4) | REG3) & static_cast<glm::uint32>(0xC30C30C3u);
 
-		REG1 = ((REG1 <<  2) | REG1) & static_cast<glm::uint32>(0x49249249u);
-		REG2 = ((REG2 <<  2) | REG2) & static_cast<glm::uint32>(0x49249249u);
-		REG3 = ((REG3 <<  2) | REG3) & static_cast<glm::uint32>(0x49249249u);
+			REG1 = ((REG1 <<  2) | REG1) & static_cast<glm::uint32>(0x49249249u);
+			REG2 = ((REG2 <<  2) | REG2) & static_cast<glm::uint32>(0x49249249u);
+			REG3 = ((REG3 <<  2) | REG3) & static_cast<glm::uint32>(0x49249249u);
 
-		return REG1 | (REG2 << 1) | (REG3 << 2);
+			return REG1 | (REG2 << 1) | (REG3 << 2);
+#		endif
 	}
 
 	template<>
 	GLM_FUNC_QUALIFIER glm::uint64 bitfieldInterleave(glm::uint16 x, glm::uint16 y, glm::uint16 z)
 	{
-		glm::uint64 REG1(x);
-		glm::uint64 REG2(y);
-		glm::uint64 REG3(z);
+#		if GLM_ARCH_BMI2 && (GLM_MODEL == GLM_MODEL_64)
+			return _pdep_u64(x, 0x1249249249249249ull) | _pdep_u64(y, 0x2492492492492492ull) | _pdep_u64(z, 0x4924924924924924ull);
+#		else
+			glm::uint64 REG1(x);
+			glm::uint64 REG2(y);
+			glm::uint64 REG3(z);
 
-		REG1 = ((REG1 << 32) | REG1) & static_cast<glm::uint64>(0xFFFF00000000FFFFull);
-		REG2 = ((REG2 << 32) | REG2) & static_cast<glm::uint64>(0xFFFF00000000FFFFull);
-		REG3 = ((REG3 << 32) | REG3) & static_cast<glm::uint64>(0xFFFF00000000FFFFull);
+			REG1 = ((REG1 << 32) | REG1) & static_cast<glm::uint64>(0xFFFF00000000FFFFull);
+			REG2 = ((REG2 << 32) | REG2) & static_cast<glm::uint64>(0xFFFF00000000FFFFull);
+			REG3 = ((REG3 << 32) | REG3) & static_cast<glm::uint64>(0xFFFF00000000FFFFull);
 
-		REG1 = ((REG1 << 16) | REG1) & static_cast<glm::uint64>(0x00FF0000FF0000FFull);
-		REG2 = ((REG2 << 16) | REG2) & static_cast<glm::uint64>(0x00FF0000FF0000FFull);
-		REG3 = ((REG3 << 16) | REG3) & static_cast<glm::uint64>(0x00FF0000FF0000FFull);
+			REG1 = ((REG1 << 16) | REG1) & static_cast<glm::uint64>(0x00FF0000FF0000FFull);
+			REG2 = ((REG2 << 16) | REG2) & static_cast<glm::uint64>(0x00FF0000FF0000FFull);
+			REG3 = ((REG3 << 16) | REG3) & static_cast<glm::uint64>(0x00FF0000FF0000FFull);
 
-		REG1 = ((REG1 <<  8) | REG1) & static_cast<glm::uint64>(0xF00F00F00F00F00Full);
-		REG2 = ((REG2 <<  8) | REG2) & static_cast<glm::uint64>(0xF00F00F00F00F00Full);
-		REG3 = ((REG3 <<  8) | REG3) & static_cast<glm::uint64>(0xF00F00F00F00F00Full);
+			REG1 = ((REG1 <<  8) | REG1) & static_cast<glm::uint64>(0xF00F00F00F00F00Full);
+			REG2 = ((REG2 <<  8) | REG2) & static_cast<glm::uint64>(0xF00F00F00F00F00Full);
+			REG3 = ((REG3 <<  8) | REG3) & static_cast<glm::uint64>(0xF00F00F00F00F00Full);
 
-		REG1 = ((REG1 <<  4) | REG1) & static_cast<glm::uint64>(0x30C30C30C30C30C3ull);
-		REG2 = ((REG2 <<  4) | REG2) & static_cast<glm::uint64>(0x30C30C30C30C30C3ull);
-		REG3 = ((REG3 <<  4) | REG3) & static_cast<glm::uint64>(0x30C30C30C30C30C3ull);
+			REG1 = ((REG1 <<  4) | REG1) & static_cast<glm::uint64>(0x30C30C30C30C30C3ull);
+			REG2 = ((REG2 <<  4) | REG2) & static_cast<glm::uint64>(0x30C30C30C30C30C3ull);
+			REG3 = ((REG3 <<  4) | REG3) & static_cast<glm::uint64>(0x30C30C30C30C30C3ull);
 
-		REG1 = ((REG1 <<  2) | REG1) & static_cast<glm::uint64>(0x9249249249249249ull);
-		REG2 = ((REG2 <<  2) | REG2) & static_cast<glm::uint64>(0x9249249249249249ull);
-		REG3 = ((REG3 <<  2) | REG3) & static_cast<glm::uint64>(0x9249249249249249ull);
+			REG1 = ((REG1 <<  2) | REG1) & static_cast<glm::uint64>(0x9249249249249249ull);
+			REG2 = ((REG2 <<  2) | REG2) & static_cast<glm::uint64>(0x9249249249249249ull);
+			REG3 = ((REG3 <<  2) | REG3) & static_cast<glm::uint64>(0x9249249249249249ull);
 
-		return REG1 | (REG2 << 1) | (REG3 << 2);
+			return REG1 | (REG2 << 1) | (REG3 << 2);
+#		endif
 	}
 
 	template<>
 	GLM_FUNC_QUALIFIER glm::uint64 bitfieldInterleave(glm::uint32 x, glm::uint32 y, glm::uint32 z)
 	{
-		glm::uint64 REG1(x);
-		glm::uint64 REG2(y);
-		glm::uint64 REG3(z);
+#		if GLM_ARCH_BMI2 && (GLM_MODEL == GLM_MODEL_64)
+			// Only the 22 low bits of x and the 21 low bits of y and z fit, as the generic code
+			return _pdep_u64(x, 0x9249249249249249ull) | _pdep_u64(y, 0x2492492492492492ull) | _pdep_u64(z, 0x4924924924924924ull);
+#		else
+			glm::uint64 REG1(x);
+			glm::uint64 REG2(y);
+			glm::uint64 REG3(z);
 
-		REG1 = ((REG1 << 32) | REG1) & static_cast<glm::uint64>(0xFFFF00000000FFFFull);
-		REG2 = ((REG2 << 32) | REG2) & static_cast<glm::uint64>(0xFFFF00000000FFFFull);
-		REG3 = ((REG3 << 32) | REG3) & static_cast<glm::uint64>(0xFFFF00000000FFFFull);
+			REG1 = ((REG1 << 32) | REG1) & static_cast<glm::uint64>(0xFFFF00000000FFFFull);
+			REG2 = ((REG2 << 32) | REG2) & static_cast<glm::uint64>(0xFFFF00000000FFFFull);
+			REG3 = ((REG3 << 32) | REG3) & static_cast<glm::uint64>(0xFFFF00000000FFFFull);
 
-		REG1 = ((REG1 << 16) | REG1) & static_cast<glm::uint64>(0x00FF0000FF0000FFull);
-		REG2 = ((REG2 << 16) | REG2) & static_cast<glm::uint64>(0x00FF0000FF0000FFull);
-		REG3 = ((REG3 << 16) | REG3) & static_cast<glm::uint64>(0x00FF0000FF0000FFull);
+			REG1 = ((REG1 << 16) | REG1) & static_cast<glm::uint64>(0x00FF0000FF0000FFull);
+			REG2 = ((REG2 << 16) | REG2) & static_cast<glm::uint64>(0x00FF0000FF0000FFull);
+			REG3 = ((REG3 << 16) | REG3) & static_cast<glm::uint64>(0x00FF0000FF0000FFull);
 
-		REG1 = ((REG1 <<  8) | REG1) & static_cast<glm::uint64>(0xF00F00F00F00F00Full);
-		REG2 = ((REG2 <<  8) | REG2) & static_cast<glm::uint64>(0xF00F00F00F00F00Full);
-		REG3 = ((REG3 <<  8) | REG3) & static_cast<glm::uint64>(0xF00F00F00F00F00Full);
+			REG1 = ((REG1 <<  8) | REG1) & static_cast<glm::uint64>(0xF00F00F00F00F00Full);
+			REG2 = ((REG2 <<  8) | REG2) & static_cast<glm::uint64>(0xF00F00F00F00F00Full);
+			REG3 = ((REG3 <<  8) | REG3) & static_cast<glm::uint64>(0xF00F00F00F00F00Full);
 
-		REG1 = ((REG1 <<  4) | REG1) & static_cast<glm::uint64>(0x30C30C30C30C30C3ull);
-		REG2 = ((REG2 <<  4) | REG2) & static_cast<glm::uint64>(0x30C30C30C30C30C3ull);
-		REG3 = ((REG3 <<  4) | REG3) & static_cast<glm::uint64>(0x30C30C30C30C30C3ull);
+			REG1 = ((REG1 <<  4) | REG1) & static_cast<glm::uint64>(0x30C30C30C30C30C3ull);
+			REG2 = ((REG2 <<  4) | REG2) & static_cast<glm::uint64>(0x30C30C30C30C30C3ull);
+			REG3 = ((REG3 <<  4) | REG3) & static_cast<glm::uint64>(0x30C30C30C30C30C3ull);
 
-		REG1 = ((REG1 <<  2) | REG1) & static_cast<glm::uint64>(0x9249249249249249ull);
-		REG2 = ((REG2 <<  2) | REG2) & static_cast<glm::uint64>(0x9249249249249249ull);
-		REG3 = ((REG3 <<  2) | REG3) & static_cast<glm::uint64>(0x9249249249249249ull);
+			REG1 = ((REG1 <<  2) | REG1) & static_cast<glm::uint64>(0x9249249249249249ull);
+			REG2 = ((REG2 <<  2) | REG2) & static_cast<glm::uint64>(0x9249249249249249ull);
+			REG3 = ((REG3 <<  2) | REG3) & static_cast<glm::uint64>(0x9249249249249249ull);
 
-		return REG1 | (REG2 << 1) | (REG3 << 2);
+			return REG1 | (REG2 << 1) | (REG3 << 2);
+#		endif
 	}
 
 	template<>
 	GLM_FUNC_QUALIFIER glm::uint32 bitfieldInterleave(glm::uint8 x, glm::uint8 y, glm::uint8 z, glm::uint8 w)
 	{
-		glm::uint32 REG1(x);
-		glm::uint32 REG2(y);
-		glm::uint32 REG3(z);
-		glm::uint32 REG4(w);
+#		if GLM_ARCH_BMI2
+			return _pdep_u32(x, 0x11111111u) | _pdep_u32(y, 0x22222222u) | _pdep_u32(z, 0x44444444u) | _pdep_u32(w, 0x88888888u);
+#		else
+			glm::uint32 REG1(x);
+			glm::uint32 REG2(y);
+			glm::uint32 REG3(z);
+			glm::uint32 REG4(w);
 
-		REG1 = ((REG1 << 12) | REG1) & static_cast<glm::uint32>(0x000F000Fu);
-		REG2 = ((REG2 << 12) | REG2) & static_cast<glm::uint32>(0x000F000Fu);
-		REG3 = ((REG3 << 12) | REG3) & static_cast<glm::uint32>(0x000F000Fu);
-		REG4 = ((REG4 << 12) | REG4) & static_cast<glm::uint32>(0x000F000Fu);
+			REG1 = ((REG1 << 12) | REG1) & static_cast<glm::uint32>(0x000F000Fu);
+			REG2 = ((REG2 << 12) | REG2) & static_cast<glm::uint32>(0x000F000Fu);
+			REG3 = ((REG3 << 12) | REG3) & static_cast<glm::uint32>(0x000F000Fu);
+			REG4 = ((REG4 << 12) | REG4) & static_cast<glm::uint32>(0x000F000Fu);
 
-		REG1 = ((REG1 <<  6) | REG1) & static_cast<glm::uint32>(0x03030303u);
-		REG2 = ((REG2 <<  6) | REG2) & static_cast<glm::uint32>(0x03030303u);
-		REG3 = ((REG3 <<  6) | REG3) & static_cast<glm::uint32>(0x03030303u);
-		REG4 = ((REG4 <<  6) | REG4) & static_cast<glm::uint32>(0x03030303u);
+			REG1 = ((REG1 <<  6) | REG1) & static_cast<glm::uint32>(0x03030303u);
+			REG2 = ((REG2 <<  6) | REG2) & static_cast<glm::uint32>(0x03030303u);
+			REG3 = ((REG3 <<  6) | REG3) & static_cast<glm::uint32>(0x03030303u);
+			REG4 = ((REG4 <<  6) | REG4) & static_cast<glm::uint32>(0x03030303u);
 
-		REG1 = ((REG1 <<  3) | REG1) & static_cast<glm::uint32>(0x11111111u);
-		REG2 = ((REG2 <<  3) | REG2) & static_cast<glm::uint32>(0x11111111u);
-		REG3 = ((REG3 <<  3) | REG3) & static_cast<glm::uint32>(0x11111111u);
-		REG4 = ((REG4 <<  3) | REG4) & static_cast<glm::uint32>(0x11111111u);
+			REG1 = ((REG1 <<  3) | REG1) & static_cast<glm::uint32>(0x11111111u);
+			REG2 = ((REG2 <<  3) | REG2) & static_cast<glm::uint32>(0x11111111u);
+			REG3 = ((REG3 <<  3) | REG3) & static_cast<glm::uint32>(0x11111111u);
+			REG4 = ((REG4 <<  3) | REG4) & static_cast<glm::uint32>(0x11111111u);
 
-		return REG1 | (REG2 << 1) | (REG3 << 2) | (REG4 << 3);
+			return REG1 | (REG2 << 1) | (REG3 << 2) | (REG4 << 3);
+#		endif
 	}
 
 	template<>
 	GLM_FUNC_QUALIFIER glm::uint64 bitfieldInterleave(glm::uint16 x, glm::uint16 y, glm::uint16 z, glm::uint16 w)
 	{
-		glm::uint64 REG1(x);
-		glm::uint64 REG2(y);
-		glm::uint64 REG3(z);
-		glm::uint64 REG4(w);
+#		if GLM_ARCH_BMI2 && (GLM_MODEL == GLM_MODEL_64)
+			return _pdep_u64(x, 0x1111111111111111ull) | _pdep_u64(y, 0x2222222222222222ull) | _pdep_u64(z, 0x4444444444444444ull) | _pdep_u64(w, 0x8888888888888888ull);
+#		else
+			glm::uint64 REG1(x);
+			glm::uint64 REG2(y);
+			glm::uint64 REG3(z);
+			glm::uint64 REG4(w);
 
-		REG1 = ((REG1 << 24) | REG1) & static_cast<glm::uint64>(0x000000FF000000FFull);
-		REG2 = ((REG2 << 24) | REG2) & static_cast<glm::uint64>(0x000000FF000000FFull);
-		REG3 = ((REG3 << 24) | REG3) & static_cast<glm::uint64>(0x000000FF000000FFull);
-		REG4 = ((REG4 << 24) | REG4) & static_cast<glm::uint64>(0x000000FF000000FFull);
+			REG1 = ((REG1 << 24) | REG1) & static_cast<glm::uint64>(0x000000FF000000FFull);
+			REG2 = ((REG2 << 24) | REG2) & static_cast<glm::uint64>(0x000000FF000000FFull);
+			REG3 = ((REG3 << 24) | REG3) & static_cast<glm::uint64>(0x000000FF000000FFull);
+			REG4 = ((REG4 << 24) | REG4) & static_cast<glm::uint64>(0x000000FF000000FFull);
 
-		REG1 = ((REG1 << 12) | REG1) & static_cast<glm::uint64>(0x000F000F000F000Full);
-		REG2 = ((REG2 << 12) | REG2) & static_cast<glm::uint64>(0x000F000F000F000Full);
-		REG3 = ((REG3 << 12) | REG3) & static_cast<glm::uint64>(0x000F000F000F000Full);
-		REG4 = ((REG4 << 12) | REG4) & static_cast<glm::uint64>(0x000F000F000F000Full);
+			REG1 = ((REG1 << 12) | REG1) & static_cast<glm::uint64>(0x000F000F000F000Full);
+			REG2 = ((REG2 << 12) | REG2) & static_cast<glm::uint64>(0x000F000F000F000Full);
+			REG3 = ((REG3 << 12) | REG3) & static_cast<glm::uint64>(0x000F000F000F000Full);
+			REG4 = ((REG4 << 12) | REG4) & static_cast<glm::uint64>(0x000F000F000F000Full);
 
-		REG1 = ((REG1 <<  6) | REG1) & static_cast<glm::uint64>(0x0303030303030303ull);
-		REG2 = ((REG2 <<  6) | REG2) & static_cast<glm::uint64>(0x0303030303030303ull);
-		REG3 = ((REG3 <<  6) | REG3) & static_cast<glm::uint64>(0x0303030303030303ull);
-		REG4 = ((REG4 <<  6) | REG4) & static_cast<glm::uint64>(0x0303030303030303ull);
+			REG1 = ((REG1 <<  6) | REG1) & static_cast<glm::uint64>(0x0303030303030303ull);
+			REG2 = ((REG2 <<  6) | REG2) & static_cast<glm::uint64>(0x0303030303030303ull);
+			REG3 = ((REG3 <<  6) | REG3) & static_cast<glm::uint64>(0x0303030303030303ull);
+			REG4 = ((REG4 <<  6) | REG4) & static_cast<glm::uint64>(0x0303030303030303ull);
 
-		REG1 = ((REG1 <<  3) | REG1) & static_cast<glm::uint64>(0x1111111111111111ull);
-		REG2 = ((REG2 <<  3) | REG2) & static_cast<glm::uint64>(0x1111111111111111ull);
-		REG3 = ((REG3 <<  3) | REG3) & static_cast<glm::uint64>(0x1111111111111111ull);
-		REG4 = ((REG4 <<  3) | REG4) & static_cast<glm::uint64>(0x1111111111111111ull);
+			REG1 = ((REG1 <<  3) | REG1) & static_cast<glm::uint64>(0x1111111111111111ull);
+			REG2 = ((REG2 <<  3) | REG2) & static_cast<glm::uint64>(0x1111111111111111ull);
+			REG3 = ((REG3 <<  3) | REG3) & static_cast<glm::uint64>(0x1111111111111111ull);
+			REG4 = ((REG4 <<  3) | REG4) & static_cast<glm::uint64>(0x1111111111111111ull);
 
-		return REG1 | (REG2 << 1) | (REG3 << 2) | (REG4 << 3);
+			return REG1 | (REG2 << 1) | (REG3 << 2) | (REG4 << 3);
+#		endif
 	}
+
+	template<bool UseSimd>
+	struct compute_bitfield_array
+	{
+		GLM_FUNC_QUALIFIER static void interleave(u16vec2 const* In, uint32* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = bitfieldInterleave<uint16, uint32>(In[i].x, In[i].y);
+		}
+
+		GLM_FUNC_QUALIFIER static void interleave(u16vec3 const* In, uint64* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = bitfieldInterleave<uint16, uint64>(In[i].x, In[i].y, In[i].z);
+		}
+
+		GLM_FUNC_QUALIFIER static void deinterleave(uint32 const* In, u16vec2* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = bitfieldDeinterleave(In[i]);
+		}
+	};
 }//namespace detail
+}//namespace glm
 
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "bitfield_simd.inl"
+#endif
+
+namespace glm
+{
 	template<typename genIUType>
 	GLM_FUNC_QUALIFIER genIUType mask(genIUType Bits)
 	{
@@ -330,25 +392,29 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER u8vec2 bitfieldDeinterleave(glm::uint16 x)
 	{
-		uint16 REG1(x);
-		uint16 REG2(x >>= 1);
+#		if GLM_ARCH_BMI2
+			return u8vec2(_pext_u32(x, 0x5555u), _pext_u32(x, 0xAAAAu));
+#		else
+			uint16 REG1(x);
+			uint16 REG2(x >>= 1);
 
-		REG1 = REG1 & static_cast<uint16>(0x5555);
-		REG2 = REG2 & static_cast<uint16>(0x5555);
+			REG1 = REG1 & static_cast<uint16>(0x5555);
+			REG2 = REG2 & static_cast<uint16>(0x5555);
 
-		REG1 = ((REG1 >> 1) | REG1) & static_cast<uint16>(0x3333);
-		REG2 = ((REG2 >> 1) | REG2) & static_cast<uint16>(0x3333);
+			REG1 = ((REG1 >> 1) | REG1) & static_cast<uint16>(0x3333);
+			REG2 = ((REG2 >> 1) | REG2) & static_cast<uint16>(0x3333);
 
-		REG1 = ((REG1 >> 2) | REG1) & static_cast<uint16>(0x0F0F);
-		REG2 = ((REG2 >> 2) | REG2) & static_cast<uint16>(0x0F0F);
+			REG1 = ((REG1 >> 2) | REG1) & static_cast<uint16>(0x0F0F);
+			REG2 = ((REG2 >> 2) | REG2) & static_cast<uint16>(0x0F0F);
 
-		REG1 = ((REG1 >> 4) | REG1) & static_cast<uint16>(0x00FF);
-		REG2 = ((REG2 >> 4) | REG2) & static_cast<uint16>(0x00FF);
+			REG1 = ((REG1 >> 4) | REG1) & static_cast<uint16>(0x00FF);
+			REG2 = ((REG2 >> 4) | REG2) & static_cast<uint16>(0x00FF);
 
-		REG1 = ((REG1 >> 8) | REG1) & static_cast<uint16>(0xFFFF);
-		REG2 = ((REG2 >> 8) | REG2) & static_cast<uint16>(0xFFFF);
+			REG1 = ((REG1 >> 8) | REG1) & static_cast<uint16>(0xFFFF);
+			REG2 = ((REG2 >> 8) | REG2) & static_cast<uint16>(0xFFFF);
 
-		return glm::u8vec2(REG1, REG2);
+			return glm::u8vec2(REG1, REG2);
+#		endif
 	}
 
 	GLM_FUNC_QUALIFIER int32 bitfieldInterleave(int16 x, int16 y)
@@ -384,25 +450,29 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER glm::u16vec2 bitfieldDeinterleave(glm::uint32 x)
 	{
-		glm::uint32 REG1(x);
-		glm::uint32 REG2(x >>= 1);
+#		if GLM_ARCH_BMI2
+			return glm::u16vec2(_pext_u32(x, 0x55555555u), _pext_u32(x, 0xAAAAAAAAu));
+#		else
+			glm::uint32 REG1(x);
+			glm::uint32 REG2(x >>= 1);
 
-		REG1 = REG1 & static_cast<glm::uint32>(0x55555555);
-		REG2 = REG2 & static_cast<glm::uint32>(0x55555555);
+			REG1 = REG1 & static_cast<glm::uint32>(0x55555555);
+			REG2 = REG2 & static_cast<glm::uint32>(0x55555555);
 
-		REG1 = ((REG1 >> 1) | REG1) & static_cast<glm::uint32>(0x33333333);
-		REG2 = ((REG2 >> 1) | REG2) & static_cast<glm::uint32>(0x33333333);
+			REG1 = ((REG1 >> 1) | REG1) & static_cast<glm::uint32>(0x33333333);
+			REG2 = ((REG2 >> 1) | REG2) & static_cast<glm::uint32>(0x33333333);
 
-		REG1 = ((REG1 >> 2) | REG1) & static_cast<glm::uint32>(0x0F0F0F0F);
-		REG2 = ((REG2 >> 2) | REG2) & static_cast<glm::uint32>(0x0F0F0F0F);
+			REG1 = ((REG1 >> 2) | REG1) & static_cast<glm::uint32>(0x0F0F0F0F);
+			REG2 = ((REG2 >> 2) | REG2) & static_cast<glm::uint32>(0x0F0F0F0F);
 
-		REG1 = ((REG1 >> 4) | REG1) & static_cast<glm::uint32>(0x00FF00FF);
-		REG2 = ((REG2 >> 4) | REG2) & static_cast<glm::uint32>(0x00FF00FF);
+			REG1 = ((REG1 >> 4) | REG1) & static_cast<glm::uint32>(0x00FF00FF);
+			REG2 = ((REG2 >> 4) | REG2) & static_cast<glm::uint32>(0x00FF00FF);
 
-		REG1 = ((REG1 >> 8) | REG1) & static_cast<glm::uint32>(0x0000FFFF);
-		REG2 = ((REG2 >> 8) | REG2) & static_cast<glm::uint32>(0x0000FFFF);
+			REG1 = ((REG1 >> 8) | REG1) & static_cast<glm::uint32>(0x0000FFFF);
+			REG2 = ((REG2 >> 8) | REG2) & static_cast<glm::uint32>(0x0000FFFF);
 
-		return glm::u16vec2(REG1, REG2);
+			return glm::u16vec2(REG1, REG2);
+#		endif
 	}
 
 	GLM_FUNC_QUALIFIER int64 bitfieldInterleave(int32 x, int32 y)
@@ -438,28 +508,32 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER glm::u32vec2 bitfieldDeinterleave(glm::uint64 x)
 	{
-		glm::uint64 REG1(x);
-		glm::uint64 REG2(x >>= 1);
+#		if GLM_ARCH_BMI2 && (GLM_MODEL == GLM_MODEL_64)
+			return glm::u32vec2(_pext_u64(x, 0x5555555555555555ull), _pext_u64(x, 0xAAAAAAAAAAAAAAAAull));
+#		else
+			glm::uint64 REG1(x);
+			glm::uint64 REG2(x >>= 1);
 
-		REG1 = REG1 & static_cast<glm::uint64>(0x5555555555555555ull);
-		REG2 = REG2 & static_cast<glm::uint64>(0x5555555555555555ull);
+			REG1 = REG1 & static_cast<glm::uint64>(0x5555555555555555ull);
+			REG2 = REG2 & static_cast<glm::uint64>(0x5555555555555555ull);
 
-		REG1 = ((REG1 >> 1) | REG1) & static_cast<glm::uint64>(0x3333333333333333ull);
-		REG2 = ((REG2 >> 1) | REG2) & static_cast<glm::uint64>(0x3333333333333333ull);
+			REG1 = ((REG1 >> 1) | REG1) & static_cast<glm::uint64>(0x3333333333333333ull);
+			REG2 = ((REG2 >> 1) | REG2) & static_cast<glm::uint64>(0x3333333333333333ull);
 
-		REG1 = ((REG1 >> 2) | REG1) & static_cast<glm::uint64>(0x0F0F0F0F0F0F0F0Full);
-		REG2 = ((REG2 >> 2) | REG2) & static_cast<glm::uint64>(0x0F0F0F0F0F0F0F0Full);
+			REG1 = ((REG1 >> 2) | REG1) & static_cast<glm::uint64>(0x0F0F0F0F0F0F0F0Full);
+			REG2 = ((REG2 >> 2) | REG2) & static_cast<glm::uint64>(0x0F0F0F0F0F0F0F0Full);
 
-		REG1 = ((REG1 >> 4) | REG1) & static_cast<glm::uint64>(0x00FF00FF00FF00FFull);
-		REG2 = ((REG2 >> 4) | REG2) & static_cast<glm::uint64>(0x00FF00FF00FF00FFull);
+			REG1 = ((REG1 >> 4) | REG1) & static_cast<glm::uint64>(0x00FF00FF00FF00FFull);
+			REG2 = ((REG2 >> 4) | REG2) & static_cast<glm::uint64>(0x00FF00FF00FF00FFull);
 
-		REG1 = ((REG1 >> 8) | REG1) & static_cast<glm::uint64>(0x0000FFFF0000FFFFull);
-		REG2 = ((REG2 >> 8) | REG2) & static_cast<glm::uint64>(0x0000FFFF0000FFFFull);
+			REG1 = ((REG1 >> 8) | REG1) & static_cast<glm::uint64>(0x0000FFFF0000FFFFull);
+			REG2 = ((REG2 >> 8) | REG2) & static_cast<glm::uint64>(0x0000FFFF0000FFFFull);
 
-		REG1 = ((REG1 >> 16) | REG1) & static_cast<glm::uint64>(0x00000000FFFFFFFFull);
-		REG2 = ((REG2 >> 16) | REG2) & static_cast<glm::uint64>(0x00000000FFFFFFFFull);
+			REG1 = ((REG1 >> 16) | REG1) & static_cast<glm::uint64>(0x00000000FFFFFFFFull);
+			REG2 = ((REG2 >> 16) | REG2) & static_cast<glm::uint64>(0x00000000FFFFFFFFull);
 
-		return glm::u32vec2(REG1, REG2);
+			return glm::u32vec2(REG1, REG2);
+#		endif
 	}
 
 	GLM_FUNC_QUALIFIER int32 bitfieldInterleave(int8 x, int8 y, int8 z)
@@ -623,4 +697,19 @@ namespace detail
 	{
 		return detail::bitfieldInterleave<uint16, uint64>(v.x, v.y, v.z, v.w);
 	}
+
+	GLM_FUNC_QUALIFIER void bitfieldInterleave(u16vec2 const* In, uint32* Out, std::size_t Count)
+	{
+		detail::compute_bitfield_array<GLM_CONFIG_SIMD == GLM_ENABLE>::interleave(In, Out, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void bitfieldInterleave(u16vec3 const* In, uint64* Out, std::size_t Count)
+	{
+		detail::compute_bitfield_array<GLM_CONFIG_SIMD == GLM_ENABLE>::interleave(In, Out, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void bitfieldDeinterleave(uint32 const* In, u16vec2* Out, std::size_t Count)
+	{
+		detail::compute_bitfield_array<GLM_CONFIG_SIMD == GLM_ENABLE>::deinterleave(In, Out, Count);
+	}
 }//namespace glm
@@ -0,0 +1,48 @@
+/// @ref gtc_bitfield
+/// @file glm/gtc/bitfield_simd.inl
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	// A u16vec2 is the 32 bit lane the perfect shuffle expects: x in the low bits, y in the high bits
+	template<>
+	struct compute_bitfield_array<true>
+	{
+		GLM_FUNC_QUALIFIER static void interleave(u16vec2 const* In, uint32* Out, std::size_t Count)
+		{
+			std::size_t i = 0;
+#			if GLM_ARCH & GLM_ARCH_AVX2_BIT
+				for(; i + 8 <= Count; i += 8)
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(Out + i), glm_uvec8_interleave16(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(In + i))));
+#			endif
+			for(; i + 4 <= Count; i += 4)
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + i), glm_uvec4_interleave16(_mm_loadu_si128(reinterpret_cast<__m128i const*>(In + i))));
+
+			compute_bitfield_array<false>::interleave(In + i, Out + i, Count - i);
+		}
+
+		// 48 bit codes don't fit the 32 bit lanes, the scalar code uses BMI2 when available
+		GLM_FUNC_QUALIFIER static void interleave(u16vec3 const* In, uint64* Out, std::size_t Count)
+		{
+			compute_bitfield_array<false>::interleave(In, Out, Count);
+		}
+
+		GLM_FUNC_QUALIFIER static void deinterleave(uint32 const* In, u16vec2* Out, std::size_t Count)
+		{
+			std::size_t i = 0;
+#			if GLM_ARCH & GLM_ARCH_AVX2_BIT
+				for(; i + 8 <= Count; i += 8)
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(Out + i), glm_uvec8_deinterleave16(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(In + i))));
+#			endif
+			for(; i + 4 <= Count; i += 4)
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + i), glm_uvec4_deinterleave16(_mm_loadu_si128(reinterpret_cast<__m128i const*>(In + i))));
+
+			compute_bitfield_array<false>::deinterleave(In + i, Out + i, Count - i);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -16,9 +16,12 @@
 // Dependencies
 #include "../detail/setup.hpp"
 #include "../detail/qualifier.hpp"
+#include "../common.hpp"
 #include "../exponential.hpp"
 #include "../vec3.hpp"
 #include "../vec4.hpp"
+#include "../ext/vector_uint4_sized.hpp"
+#include <cstddef>
 #include <limits>
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
@@ -50,6 +53,21 @@ namespace glm
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_DECL vec<L, T, Q> convertSRGBToLinear(vec<L, T, Q> const& ColorSRGB, T Gamma);
 
+	/// Convert Count linear RGBA colors, such as an image row, to sRGB with the exact 1 / 2.4 gamma. Colors are clamped to [0, 1], alpha is unchanged.
+	/// The absolute error is below 2.5e-7 with or without SIMD.
+	GLM_FUNC_DECL void convertLinearToSRGB(vec4 const* In, vec4* Out, std::size_t Count);
+
+	/// Convert Count linear RGBA colors to 8 bit sRGB, alpha is stored as packUnorm1x8 would.
+	/// The result is the rounded exact sRGB value, or 1 away from it when the exact value times 255 is within 1e-5 of a rounding boundary.
+	GLM_FUNC_DECL void convertLinearToSRGB(vec4 const* In, u8vec4* Out, std::size_t Count);
+
+	/// Convert Count sRGB RGBA colors to linear with the exact 2.4 gamma. Colors are clamped to [0, 1], alpha is unchanged.
+	/// The relative error is below 1e-6 with or without SIMD.
+	GLM_FUNC_DECL void convertSRGBToLinear(vec4 const* In, vec4* Out, std::size_t Count);
+
+	/// Convert Count 8 bit sRGB RGBA colors to linear with a 256 entry lookup table of correctly rounded values, alpha is divided by 255.
+	GLM_FUNC_DECL void convertSRGBToLinear(u8vec4 const* In, vec4* Out, std::size_t Count);
+
 	/// @}
 } //namespace glm
 
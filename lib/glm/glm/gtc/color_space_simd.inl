@@ -0,0 +1,104 @@
+/// @ref gtc_color_space
+/// @file glm/gtc/color_space_simd.inl
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#include "../simd/exponential.h"
+#include "../simd/packing.h"
+
+namespace glm{
+namespace detail
+{
+	// Linear segment below 0.0031308, 1.055 * c^(1 / 2.4) - 0.055 above
+	GLM_FUNC_QUALIFIER glm_vec4 srgb_encode(glm_vec4 Linear)
+	{
+		glm_vec4 const c = _mm_min_ps(_mm_max_ps(Linear, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+		glm_vec4 const Curve = glm_vec4_fma(glm_vec4_pow(c, _mm_set1_ps(0.41666666666666666667f)), _mm_set1_ps(1.055f), _mm_set1_ps(-0.055f));
+		return glm_vec4_select(_mm_cmplt_ps(c, _mm_set1_ps(0.0031308f)), _mm_mul_ps(c, _mm_set1_ps(12.92f)), Curve);
+	}
+
+	// Linear segment up to 0.04045, ((c + 0.055) / 1.055)^2.4 above
+	GLM_FUNC_QUALIFIER glm_vec4 srgb_decode(glm_vec4 SRGB)
+	{
+		glm_vec4 const c = _mm_min_ps(_mm_max_ps(SRGB, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+		glm_vec4 const Curve = glm_vec4_pow(_mm_mul_ps(_mm_add_ps(c, _mm_set1_ps(0.055f)), _mm_set1_ps(0.94786729857819905213f)), _mm_set1_ps(2.4f));
+		return glm_vec4_select(_mm_cmple_ps(c, _mm_set1_ps(0.04045f)), _mm_mul_ps(c, _mm_set1_ps(0.07739938080495356037f)), Curve);
+	}
+
+	// glm_vec4_round_to_int without the sign handling, x must be positive
+	GLM_FUNC_QUALIFIER glm_ivec4 srgb_round(glm_vec4 x)
+	{
+		glm_ivec4 const Trunc = _mm_cvttps_epi32(x);
+		glm_ivec4 const Up = _mm_castps_si128(_mm_cmpge_ps(_mm_sub_ps(x, _mm_cvtepi32_ps(Trunc)), _mm_set1_ps(0.5f)));
+		return _mm_sub_epi32(Trunc, Up);
+	}
+
+	// Pixels are transposed 4 at a time so each register holds one channel and alpha skips the curve
+	template<>
+	struct compute_srgb_array<true>
+	{
+		GLM_FUNC_QUALIFIER static void linearToSRGB(vec4 const* In, vec4* Out, std::size_t Count)
+		{
+			float const* const Src = reinterpret_cast<float const*>(In);
+			float* const Dst = reinterpret_cast<float*>(Out);
+
+			std::size_t i = 0;
+			for(; i + 4 <= Count; i += 4)
+			{
+				glm_vec4 r, g, b, a;
+				glm_vec4_load_packed4(Src + i * 4, &r, &g, &b, &a);
+				glm_vec4_store_packed4(Dst + i * 4, srgb_encode(r), srgb_encode(g), srgb_encode(b), a);
+			}
+
+			compute_srgb_array<false>::linearToSRGB(In + i, Out + i, Count - i);
+		}
+
+		GLM_FUNC_QUALIFIER static void linearToSRGB(vec4 const* In, u8vec4* Out, std::size_t Count)
+		{
+			float const* const Src = reinterpret_cast<float const*>(In);
+			glm_vec4 const Scale = _mm_set1_ps(255.0f);
+
+			std::size_t i = 0;
+			for(; i + 4 <= Count; i += 4)
+			{
+				glm_vec4 r, g, b, a;
+				glm_vec4_load_packed4(Src + i * 4, &r, &g, &b, &a);
+				r = _mm_mul_ps(srgb_encode(r), Scale);
+				g = _mm_mul_ps(srgb_encode(g), Scale);
+				b = _mm_mul_ps(srgb_encode(b), Scale);
+				a = _mm_mul_ps(_mm_min_ps(_mm_max_ps(a, _mm_setzero_ps()), _mm_set1_ps(1.0f)), Scale);
+				_MM_TRANSPOSE4_PS(r, g, b, a);
+
+				glm_ivec4 const p01 = _mm_packs_epi32(srgb_round(r), srgb_round(g));
+				glm_ivec4 const p23 = _mm_packs_epi32(srgb_round(b), srgb_round(a));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + i), _mm_packus_epi16(p01, p23));
+			}
+
+			compute_srgb_array<false>::linearToSRGB(In + i, Out + i, Count - i);
+		}
+
+		GLM_FUNC_QUALIFIER static void srgbToLinear(vec4 const* In, vec4* Out, std::size_t Count)
+		{
+			float const* const Src = reinterpret_cast<float const*>(In);
+			float* const Dst = reinterpret_cast<float*>(Out);
+
+			std::size_t i = 0;
+			for(; i + 4 <= Count; i += 4)
+			{
+				glm_vec4 r, g, b, a;
+				glm_vec4_load_packed4(Src + i * 4, &r, &g, &b, &a);
+				glm_vec4_store_packed4(Dst + i * 4, srgb_decode(r), srgb_decode(g), srgb_decode(b), a);
+			}
+
+			compute_srgb_array<false>::srgbToLinear(In + i, Out + i, Count - i);
+		}
+
+		GLM_FUNC_QUALIFIER static void srgbToLinear(u8vec4 const* In, vec4* Out, std::size_t Count)
+		{
+			compute_srgb_array<false>::srgbToLinear(In, Out, Count);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
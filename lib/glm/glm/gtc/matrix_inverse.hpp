@@ -44,6 +44,16 @@ namespace glm
 	template<typename genType>
 	GLM_FUNC_DECL genType inverseTranspose(genType const& m);
 
+	/// Compute the inverse transpose of the upper 3x3 of a matrix, the matrix transforming the normals.
+	/// Equivalent to inverseTranspose(mat<3, 3, T, Q>(m)) without building the intermediate matrix.
+	///
+	/// @param m Input matrix which upper 3x3 is inverted and transposed.
+	/// @tparam T Floating-point scalar types: half, float or double.
+	/// @tparam Q Value from qualifier enum
+	/// @see gtc_matrix_inverse
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<3, 3, T, Q> normalMatrix(mat<4, 4, T, Q> const& m);
+
 	/// @}
 }//namespace glm
 
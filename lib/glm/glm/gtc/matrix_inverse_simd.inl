@@ -0,0 +1,135 @@
+/// @ref gtc_matrix_inverse
+/// @file glm/gtc/matrix_inverse_simd.inl
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#include "../simd/matrix.h"
+
+namespace glm{
+namespace detail
+{
+	// The upper 3x3 of a mat4 is loaded with the w of each column cleared, any alignment
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void load_mat4_upper3x3(mat<4, 4, float, Q> const& m, glm_vec4 out[3])
+	{
+		glm_vec4 const Mask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+		out[0] = _mm_and_ps(_mm_loadu_ps(&m[0][0]), Mask);
+		out[1] = _mm_and_ps(_mm_loadu_ps(&m[1][0]), Mask);
+		out[2] = _mm_and_ps(_mm_loadu_ps(&m[2][0]), Mask);
+	}
+
+	template<bool Aligned>
+	struct compute_store_mat3
+	{
+		// Packed vec3 columns are repacked to (c0.x, c0.y, c0.z, c1.x), (c1.y, c1.z, c2.x, c2.y) and c2.z
+		template<qualifier Q>
+		GLM_FUNC_QUALIFIER static void call(glm_vec4 const in[3], mat<3, 3, float, Q>& m)
+		{
+			glm_vec4 const swp0 = _mm_shuffle_ps(in[0], in[1], _MM_SHUFFLE(0, 0, 2, 2));
+			glm_vec4 const swp1 = _mm_shuffle_ps(in[0], swp0, _MM_SHUFFLE(2, 0, 1, 0));
+			glm_vec4 const swp2 = _mm_shuffle_ps(in[1], in[2], _MM_SHUFFLE(1, 0, 2, 1));
+			_mm_storeu_ps(&m[0][0], swp1);
+			_mm_storeu_ps(&m[1][1], swp2);
+			_mm_store_ss(&m[2][2], _mm_movehl_ps(in[2], in[2]));
+		}
+	};
+
+	template<>
+	struct compute_store_mat3<true>
+	{
+		template<qualifier Q>
+		GLM_FUNC_QUALIFIER static void call(glm_vec4 const in[3], mat<3, 3, float, Q>& m)
+		{
+			store_mat3(in, m);
+		}
+	};
+
+	template<qualifier Q, bool Aligned>
+	struct compute_affineInverse<4, 4, float, Q, Aligned>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, float, Q> call(mat<4, 4, float, Q> const& m)
+		{
+			glm_vec4 In[3], Inv[3];
+			load_mat4_upper3x3(m, In);
+			glm_mat3_inverse(In, Inv);
+
+			// The w of the inverse may be a negative zero
+			glm_vec4 const Mask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+			glm_vec4 const Translation = glm_mat3_mul_vec3(Inv, _mm_loadu_ps(&m[3][0]));
+			glm_vec4 const sub0 = _mm_sub_ps(_mm_setzero_ps(), Translation);
+
+			mat<4, 4, float, Q> Result;
+			_mm_storeu_ps(&Result[0][0], _mm_and_ps(Inv[0], Mask));
+			_mm_storeu_ps(&Result[1][0], _mm_and_ps(Inv[1], Mask));
+			_mm_storeu_ps(&Result[2][0], _mm_and_ps(Inv[2], Mask));
+			_mm_storeu_ps(&Result[3][0], _mm_or_ps(_mm_and_ps(sub0, Mask), _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f)));
+			return Result;
+		}
+	};
+
+	template<qualifier Q, bool Aligned>
+	struct compute_normalMatrix<float, Q, Aligned>
+	{
+		GLM_FUNC_QUALIFIER static mat<3, 3, float, Q> call(mat<4, 4, float, Q> const& m)
+		{
+			glm_vec4 In[3], Out[3];
+			load_mat4_upper3x3(m, In);
+			glm_mat3_inverse_transpose(In, Out);
+
+			mat<3, 3, float, Q> Result;
+			compute_store_mat3<Aligned>::call(Out, Result);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_inverseTranspose<3, 3, float, Q, false>
+	{
+		GLM_FUNC_QUALIFIER static mat<3, 3, float, Q> call(mat<3, 3, float, Q> const& m)
+		{
+			glm_vec4 const Mask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+			glm_vec4 const col2 = _mm_loadu_ps(&m[1][2]);
+			glm_vec4 In[3], Out[3];
+			In[0] = _mm_and_ps(_mm_loadu_ps(&m[0][0]), Mask);
+			In[1] = _mm_and_ps(_mm_loadu_ps(&m[1][0]), Mask);
+			In[2] = _mm_and_ps(_mm_shuffle_ps(col2, col2, _MM_SHUFFLE(3, 3, 2, 1)), Mask);
+			glm_mat3_inverse_transpose(In, Out);
+
+			mat<3, 3, float, Q> Result;
+			compute_store_mat3<false>::call(Out, Result);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_inverseTranspose<3, 3, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<3, 3, float, Q> call(mat<3, 3, float, Q> const& m)
+		{
+			glm_vec4 In[3], Out[3];
+			load_mat3(m, In);
+			glm_mat3_inverse_transpose(In, Out);
+
+			mat<3, 3, float, Q> Result;
+			store_mat3(Out, Result);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_inverseTranspose<4, 4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, float, Q> call(mat<4, 4, float, Q> const& m)
+		{
+			glm_vec4 Inv[4];
+			glm_mat4_inverse(&m[0].data, Inv);
+
+			mat<4, 4, float, Q> Result;
+			glm_mat4_transpose(Inv, &Result[0].data);
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -13,6 +13,13 @@
 /// https://github.com/ashima/webgl-noise
 /// Following Stefan Gustavson's paper "Simplex noise demystified":
 /// http://www.itn.liu.se/~stegu/simplexnoise/simplexnoise.pdf
+///
+/// The soa_vec overloads evaluate 2D and 3D perlin and simplex noise on W points at once.
+/// They run the operations of the vec overloads in the same order, so each lane is bit for bit
+/// equal to the vec overload as long as the compiler doesn't contract multiply-adds.
+/// GCC contracts them by default when FMA is enabled, use -ffp-contract=off to keep exact results:
+/// with contraction the vec overloads round differently and may pick another gradient near lattice boundaries.
+/// The array overloads process W = 8 floats or W = 4 doubles at a time through them.
 
 #pragma once
 
@@ -26,6 +33,8 @@
 #include "../vec2.hpp"
 #include "../vec3.hpp"
 #include "../vec4.hpp"
+#include "../ext/vector_soa.hpp"
+#include <cstddef>
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
 #	pragma message("GLM: GLM_GTC_noise extension included")
@@ -55,6 +64,104 @@ namespace glm
 	GLM_FUNC_DECL T simplex(
 		vec<L, T, Q> const& p);
 
+	/// Fractal Brownian motion: Octaves octaves of simplex noise, each one Lacunarity times the frequency
+	/// and Gain times the amplitude of the previous one, divided by the sum of the amplitudes.
+	/// @see gtc_noise
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL T simplexFbm(
+		vec<L, T, Q> const& p,
+		int Octaves,
+		T Lacunarity = static_cast<T>(2),
+		T Gain = static_cast<T>(0.5));
+
+	/// Classic perlin noise of W points at once.
+	/// @see gtc_noise
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_scalar<T, W> perlin(
+		soa_vec<2, T, W> const& p);
+
+	/// Classic perlin noise of W points at once.
+	/// @see gtc_noise
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_scalar<T, W> perlin(
+		soa_vec<3, T, W> const& p);
+
+	/// Simplex noise of W points at once.
+	/// @see gtc_noise
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_scalar<T, W> simplex(
+		soa_vec<2, T, W> const& p);
+
+	/// Simplex noise of W points at once.
+	/// @see gtc_noise
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa_scalar<T, W> simplex(
+		soa_vec<3, T, W> const& p);
+
+	/// Fractal Brownian motion of W points at once.
+	/// The octaves run back to back on the same lanes so the points are only loaded once.
+	/// @see gtc_noise
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa_scalar<T, W> simplexFbm(
+		soa_vec<L, T, W> const& p,
+		int Octaves,
+		T Lacunarity = static_cast<T>(2),
+		T Gain = static_cast<T>(0.5));
+
+	/// Classic perlin noise of Count points, written to Out.
+	/// @see gtc_noise
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void perlin(
+		vec<2, T, Q> const* p,
+		T* Out,
+		std::size_t Count);
+
+	/// Classic perlin noise of Count points, written to Out.
+	/// @see gtc_noise
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void perlin(
+		vec<3, T, Q> const* p,
+		T* Out,
+		std::size_t Count);
+
+	/// Simplex noise of Count points, written to Out.
+	/// @see gtc_noise
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void simplex(
+		vec<2, T, Q> const* p,
+		T* Out,
+		std::size_t Count);
+
+	/// Simplex noise of Count points, written to Out.
+	/// @see gtc_noise
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void simplex(
+		vec<3, T, Q> const* p,
+		T* Out,
+		std::size_t Count);
+
+	/// Fractal Brownian motion of Count points, written to Out.
+	/// @see gtc_noise
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void simplexFbm(
+		vec<2, T, Q> const* p,
+		T* Out,
+		std::size_t Count,
+		int Octaves,
+		T Lacunarity = static_cast<T>(2),
+		T Gain = static_cast<T>(0.5));
+
+	/// Fractal Brownian motion of Count points, written to Out.
+	/// @see gtc_noise
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void simplexFbm(
+		vec<3, T, Q> const* p,
+		T* Out,
+		std::size_t Count,
+		int Octaves,
+		T Lacunarity = static_cast<T>(2),
+		T Gain = static_cast<T>(0.5));
+
 	/// @}
 }//namespace glm
 
@@ -804,4 +804,384 @@ namespace gtc
 			(dot(m0 * m0, vec<3, T, Q>(dot(p0, x0), dot(p1, x1), dot(p2, x2))) +
 			dot(m1 * m1, vec<2, T, Q>(dot(p3, x3), dot(p4, x4))));
 	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER T simplexFbm(vec<L, T, Q> const& p, int Octaves, T Lacunarity, T Gain)
+	{
+		T Sum(0);
+		T Norm(0);
+		T Frequency(1);
+		T Amplitude(1);
+		for(int i = 0; i < Octaves; ++i)
+		{
+			Sum += simplex(p * Frequency) * Amplitude;
+			Norm += Amplitude;
+			Frequency *= Lacunarity;
+			Amplitude *= Gain;
+		}
+		return Sum / Norm;
+	}
+
+namespace detail
+{
+	// Unfused and in the order of compute_dot so that the lanes match the scalar versions
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W> noise_dot(soa_vec<L, T, W> const& x, soa_vec<L, T, W> const& y)
+	{
+		soa_scalar<T, W> Result(x[0] * y[0]);
+		for(length_t i = 1; i < L; ++i)
+			Result = Result + x[i] * y[i];
+		return Result;
+	}
+
+	// Gradient of a perlin 3D corner, same steps as the gx0 / gy0 / gz0 lanes of the scalar version
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<3, T, W> perlin_grad(soa_scalar<T, W> const& ixy)
+	{
+		typedef soa_scalar<T, W> soa_type;
+
+		soa_type gx = ixy * T(1.0 / 7.0);
+		soa_type gy = fract(floor(gx) * T(1.0 / 7.0)) - T(0.5);
+		gx = fract(gx);
+		soa_type gz = soa_type(T(0.5)) - abs(gx) - abs(gy);
+		soa_type sz = step(gz, soa_type(T(0)));
+		gx -= sz * (step(soa_type(T(0)), gx) - T(0.5));
+		gy -= sz * (step(soa_type(T(0)), gy) - T(0.5));
+		return soa_vec<3, T, W>(gx, gy, gz);
+	}
+
+	// Gradient of a simplex 3D corner scaled by its normalization factor
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_vec<3, T, W> simplex_grad(soa_scalar<T, W> const& p, T nsx, T nsy, T nsz)
+	{
+		typedef soa_scalar<T, W> soa_type;
+
+		soa_type j = p - T(49) * floor(p * nsz * nsz);
+		soa_type x_ = floor(j * nsz);
+		soa_type y_ = floor(j - T(7) * x_);
+
+		soa_type x = x_ * nsx + nsy;
+		soa_type y = y_ * nsx + nsy;
+		soa_type h = T(1) - abs(x) - abs(y);
+
+		soa_type sh = -step(h, soa_type(T(0)));
+		soa_vec<3, T, W> g(
+			x + (floor(x) * T(2) + T(1)) * sh,
+			y + (floor(y) * T(2) + T(1)) * sh,
+			h);
+		return g * taylorInvSqrt(noise_dot(g, g));
+	}
+
+	// The scalar versions evaluate vec<4, T, Q> dot products as (x + y) + (z + w)
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W> sum4(soa_scalar<T, W> const& a, soa_scalar<T, W> const& b, soa_scalar<T, W> const& c, soa_scalar<T, W> const& d)
+	{
+		return (a + b) + (c + d);
+	}
+
+	template<typename T>
+	struct noise_lanes
+	{
+		static length_t const value = 4;
+	};
+
+	template<>
+	struct noise_lanes<float>
+	{
+		static length_t const value = 8;
+	};
+
+	// Run Func over Count points, W at a time, the tail goes through zero padded copies
+	template<length_t L, typename T, qualifier Q, typename soaFunc>
+	GLM_FUNC_QUALIFIER void noise_array(vec<L, T, Q> const* p, T* Out, std::size_t Count, soaFunc const& Func)
+	{
+		length_t const W = noise_lanes<T>::value;
+
+		std::size_t i = 0;
+		for(; i + W <= Count; i += W)
+			Func(soa_vec<L, T, W>::load(p + i)).store(Out + i);
+
+		if(i < Count)
+		{
+			vec<L, T, Q> Tail[W];
+			T Result[W];
+			for(length_t j = 0; j < W; ++j)
+				Tail[j] = i + j < Count ? p[i + j] : vec<L, T, Q>(static_cast<T>(0));
+			Func(soa_vec<L, T, W>::load(Tail)).store(Result);
+			for(std::size_t j = 0; i + j < Count; ++j)
+				Out[i + j] = Result[j];
+		}
+	}
+
+	struct perlin_func
+	{
+		template<length_t L, typename T, length_t W>
+		GLM_FUNC_QUALIFIER soa_scalar<T, W> operator()(soa_vec<L, T, W> const& p) const
+		{
+			return perlin(p);
+		}
+	};
+
+	struct simplex_func
+	{
+		template<length_t L, typename T, length_t W>
+		GLM_FUNC_QUALIFIER soa_scalar<T, W> operator()(soa_vec<L, T, W> const& p) const
+		{
+			return simplex(p);
+		}
+	};
+
+	template<typename T>
+	struct simplex_fbm_func
+	{
+		int Octaves;
+		T Lacunarity;
+		T Gain;
+
+		template<length_t L, length_t W>
+		GLM_FUNC_QUALIFIER soa_scalar<T, W> operator()(soa_vec<L, T, W> const& p) const
+		{
+			return simplexFbm(p, Octaves, Lacunarity, Gain);
+		}
+	};
+}//namespace detail
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W> perlin(soa_vec<2, T, W> const& Position)
+	{
+		typedef soa_scalar<T, W> soa_type;
+
+		soa_type const Pi0x = mod(floor(Position.x), soa_type(T(289)));
+		soa_type const Pi0y = mod(floor(Position.y), soa_type(T(289)));
+		soa_type const Pi1x = mod(floor(Position.x) + T(1), soa_type(T(289)));
+		soa_type const Pi1y = mod(floor(Position.y) + T(1), soa_type(T(289)));
+		soa_type const Pf0x = fract(Position.x);
+		soa_type const Pf0y = fract(Position.y);
+		soa_type const Pf1x = Pf0x - T(1);
+		soa_type const Pf1y = Pf0y - T(1);
+
+		soa_type const px0 = detail::permute(Pi0x);
+		soa_type const px1 = detail::permute(Pi1x);
+
+		// Corners 00, 10, 01 and 11, the lanes of the vec<4, T, Q> of the scalar version
+		soa_type const i[4] = {
+			detail::permute(px0 + Pi0y),
+			detail::permute(px1 + Pi0y),
+			detail::permute(px0 + Pi1y),
+			detail::permute(px1 + Pi1y)};
+		soa_type const fx[4] = {Pf0x, Pf1x, Pf0x, Pf1x};
+		soa_type const fy[4] = {Pf0y, Pf0y, Pf1y, Pf1y};
+
+		soa_type n[4];
+		for(length_t c = 0; c < 4; ++c)
+		{
+			soa_type gx = static_cast<T>(2) * fract(i[c] / T(41)) - T(1);
+			soa_type const gy = abs(gx) - T(0.5);
+			soa_type const tx = floor(gx + T(0.5));
+			gx = gx - tx;
+
+			soa_vec<2, T, W> g(gx, gy);
+			g *= detail::taylorInvSqrt(detail::noise_dot(g, g));
+			n[c] = detail::noise_dot(g, soa_vec<2, T, W>(fx[c], fy[c]));
+		}
+
+		soa_type const fade_x = detail::fade(Pf0x);
+		soa_type const fade_y = detail::fade(Pf0y);
+		soa_type const n_x0 = mix(n[0], n[1], fade_x);
+		soa_type const n_x1 = mix(n[2], n[3], fade_x);
+		return T(2.3) * mix(n_x0, n_x1, fade_y);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W> perlin(soa_vec<3, T, W> const& Position)
+	{
+		typedef soa_scalar<T, W> soa_type;
+
+		soa_vec<3, T, W> const Pi = floor(Position);
+		soa_vec<3, T, W> const Pi0(detail::mod289(Pi.x), detail::mod289(Pi.y), detail::mod289(Pi.z));
+		soa_vec<3, T, W> const Pi1(detail::mod289(Pi.x + T(1)), detail::mod289(Pi.y + T(1)), detail::mod289(Pi.z + T(1)));
+		soa_vec<3, T, W> const Pf0 = fract(Position);
+		soa_vec<3, T, W> const Pf1(Pf0.x - T(1), Pf0.y - T(1), Pf0.z - T(1));
+
+		soa_type const px0 = detail::permute(Pi0.x);
+		soa_type const px1 = detail::permute(Pi1.x);
+		soa_type const ixy[4] = {
+			detail::permute(px0 + Pi0.y),
+			detail::permute(px1 + Pi0.y),
+			detail::permute(px0 + Pi1.y),
+			detail::permute(px1 + Pi1.y)};
+
+		// Corners 000, 100, 010, 110 then 001, 101, 011, 111
+		soa_type n[8];
+		for(length_t c = 0; c < 8; ++c)
+		{
+			soa_vec<3, T, W> g = detail::perlin_grad(detail::permute(ixy[c & 3] + (c < 4 ? Pi0.z : Pi1.z)));
+			g *= detail::taylorInvSqrt(detail::noise_dot(g, g));
+			n[c] = detail::noise_dot(g, soa_vec<3, T, W>(c & 1 ? Pf1.x : Pf0.x, c & 2 ? Pf1.y : Pf0.y, c & 4 ? Pf1.z : Pf0.z));
+		}
+
+		soa_type const fade_x = detail::fade(Pf0.x);
+		soa_type const fade_y = detail::fade(Pf0.y);
+		soa_type const fade_z = detail::fade(Pf0.z);
+		soa_type const n_z0 = mix(n[0], n[4], fade_z);
+		soa_type const n_z1 = mix(n[1], n[5], fade_z);
+		soa_type const n_z2 = mix(n[2], n[6], fade_z);
+		soa_type const n_z3 = mix(n[3], n[7], fade_z);
+		soa_type const n_yz0 = mix(n_z0, n_z2, fade_y);
+		soa_type const n_yz1 = mix(n_z1, n_z3, fade_y);
+		return T(2.2) * mix(n_yz0, n_yz1, fade_x);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W> simplex(soa_vec<2, T, W> const& v)
+	{
+		typedef soa_scalar<T, W> soa_type;
+
+		T const Cx = T( 0.211324865405187);
+		T const Cy = T( 0.366025403784439);
+		T const Cz = T(-0.577350269189626);
+		T const Cw = T( 0.024390243902439);
+
+		// First corner
+		soa_type const Skew = detail::noise_dot(v, soa_vec<2, T, W>(soa_type(Cy)));
+		soa_vec<2, T, W> i(floor(v.x + Skew), floor(v.y + Skew));
+		soa_type const Unskew = detail::noise_dot(i, soa_vec<2, T, W>(soa_type(Cx)));
+		soa_vec<2, T, W> const x0(v.x - i.x + Unskew, v.y - i.y + Unskew);
+
+		// Other corners, x0.x > x0.y ? (1, 0) : (0, 1)
+		soa_type const i1x = T(1) - step(x0.x, x0.y);
+		soa_type const i1y = T(1) - i1x;
+		soa_vec<2, T, W> const x1(x0.x + Cx - i1x, x0.y + Cx - i1y);
+		soa_vec<2, T, W> const x2(x0.x + Cz, x0.y + Cz);
+
+		// Permutations
+		i = soa_vec<2, T, W>(mod(i.x, soa_type(T(289))), mod(i.y, soa_type(T(289))));
+		soa_type const p[3] = {
+			detail::permute(detail::permute(i.y) + i.x),
+			detail::permute(detail::permute(i.y + i1y) + i.x + i1x),
+			detail::permute(detail::permute(i.y + T(1)) + i.x + T(1))};
+
+		soa_vec<2, T, W> const x[3] = {x0, x1, x2};
+		soa_type n[3];
+		for(length_t c = 0; c < 3; ++c)
+		{
+			soa_type m = max(T(0.5) - detail::noise_dot(x[c], x[c]), soa_type(T(0)));
+			m = m * m;
+			m = m * m;
+
+			soa_type const gx = static_cast<T>(2) * fract(p[c] * Cw) - T(1);
+			soa_type const h = abs(gx) - T(0.5);
+			soa_type const ox = floor(gx + T(0.5));
+			soa_type const a0 = gx - ox;
+
+			m *= static_cast<T>(1.79284291400159) - T(0.85373472095314) * (a0 * a0 + h * h);
+			n[c] = m * (a0 * x[c].x + h * x[c].y);
+		}
+		return T(130) * (n[0] + n[1] + n[2]);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W> simplex(soa_vec<3, T, W> const& v)
+	{
+		typedef soa_scalar<T, W> soa_type;
+
+		T const Cx = T(1.0 / 6.0);
+		T const Cy = T(1.0 / 3.0);
+
+		// First corner
+		soa_type const Skew = detail::noise_dot(v, soa_vec<3, T, W>(soa_type(Cy)));
+		soa_vec<3, T, W> i(floor(v.x + Skew), floor(v.y + Skew), floor(v.z + Skew));
+		soa_type const Unskew = detail::noise_dot(i, soa_vec<3, T, W>(soa_type(Cx)));
+		soa_vec<3, T, W> const x0(v.x - i.x + Unskew, v.y - i.y + Unskew, v.z - i.z + Unskew);
+
+		// Other corners
+		soa_vec<3, T, W> const g(step(x0.y, x0.x), step(x0.z, x0.y), step(x0.x, x0.z));
+		soa_vec<3, T, W> const l(T(1) - g.z, T(1) - g.x, T(1) - g.y);
+		soa_vec<3, T, W> const i1 = min(g, l);
+		soa_vec<3, T, W> const i2 = max(g, l);
+
+		soa_vec<3, T, W> const x[4] = {
+			x0,
+			soa_vec<3, T, W>(x0.x - i1.x + Cx, x0.y - i1.y + Cx, x0.z - i1.z + Cx),
+			soa_vec<3, T, W>(x0.x - i2.x + Cy, x0.y - i2.y + Cy, x0.z - i2.z + Cy),
+			soa_vec<3, T, W>(x0.x - T(0.5), x0.y - T(0.5), x0.z - T(0.5))};
+
+		// Permutations
+		i = soa_vec<3, T, W>(detail::mod289(i.x), detail::mod289(i.y), detail::mod289(i.z));
+		soa_type const p[4] = {
+			detail::permute(detail::permute(detail::permute(i.z) + i.y) + i.x),
+			detail::permute(detail::permute(detail::permute(i.z + i1.z) + i.y + i1.y) + i.x + i1.x),
+			detail::permute(detail::permute(detail::permute(i.z + i2.z) + i.y + i2.y) + i.x + i2.x),
+			detail::permute(detail::permute(detail::permute(i.z + T(1)) + i.y + T(1)) + i.x + T(1))};
+
+		// Gradients: 7x7 points over a square, mapped onto an octahedron
+		T const n_ = static_cast<T>(0.142857142857); // 1.0/7.0
+		T const nsx = n_ * T(2) - T(0);
+		T const nsy = n_ * T(0.5) - T(1);
+		T const nsz = n_ * T(1) - T(0);
+
+		soa_type n[4];
+		for(length_t c = 0; c < 4; ++c)
+		{
+			soa_type m = max(T(0.6) - detail::noise_dot(x[c], x[c]), soa_type(T(0)));
+			m = m * m;
+			n[c] = (m * m) * detail::noise_dot(detail::simplex_grad(p[c], nsx, nsy, nsz), x[c]);
+		}
+		return T(42) * detail::sum4(n[0], n[1], n[2], n[3]);
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa_scalar<T, W> simplexFbm(soa_vec<L, T, W> const& p, int Octaves, T Lacunarity, T Gain)
+	{
+		soa_scalar<T, W> Sum(static_cast<T>(0));
+		T Norm(0);
+		T Frequency(1);
+		T Amplitude(1);
+		for(int i = 0; i < Octaves; ++i)
+		{
+			Sum += simplex(p * soa_scalar<T, W>(Frequency)) * Amplitude;
+			Norm += Amplitude;
+			Frequency *= Lacunarity;
+			Amplitude *= Gain;
+		}
+		return Sum / Norm;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void perlin(vec<2, T, Q> const* p, T* Out, std::size_t Count)
+	{
+		detail::noise_array(p, Out, Count, detail::perlin_func());
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void perlin(vec<3, T, Q> const* p, T* Out, std::size_t Count)
+	{
+		detail::noise_array(p, Out, Count, detail::perlin_func());
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void simplex(vec<2, T, Q> const* p, T* Out, std::size_t Count)
+	{
+		detail::noise_array(p, Out, Count, detail::simplex_func());
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void simplex(vec<3, T, Q> const* p, T* Out, std::size_t Count)
+	{
+		detail::noise_array(p, Out, Count, detail::simplex_func());
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void simplexFbm(vec<2, T, Q> const* p, T* Out, std::size_t Count, int Octaves, T Lacunarity, T Gain)
+	{
+		detail::simplex_fbm_func<T> const Func = {Octaves, Lacunarity, Gain};
+		detail::noise_array(p, Out, Count, Func);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void simplexFbm(vec<3, T, Q> const* p, T* Out, std::size_t Count, int Octaves, T Lacunarity, T Gain)
+	{
+		detail::simplex_fbm_func<T> const Func = {Octaves, Lacunarity, Gain};
+		detail::noise_array(p, Out, Count, Func);
+	}
 }//namespace glm
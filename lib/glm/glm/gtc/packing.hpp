@@ -512,6 +512,108 @@ namespace glm
 	template<length_t L, qualifier Q>
 	GLM_FUNC_DECL vec<L, float, Q> unpackHalf(vec<L, uint16, Q> const& p);
 
+	/// Converts Count floating-point values from In to 16-bit floating-point values stored in Out.
+	/// Rounds to nearest even, using F16C or SSE2 when available.
+	///
+	/// @see gtc_packing
+	/// @see void unpackHalf(uint16 const* In, float* Out, std::size_t Count)
+	GLM_FUNC_DECL void packHalf(float const* In, uint16* Out, std::size_t Count);
+
+	/// Converts Count 16-bit floating-point values from In to 32-bit floating-point values stored in Out.
+	/// Uses F16C or SSE2 when available.
+	///
+	/// @see gtc_packing
+	/// @see void packHalf(float const* In, uint16* Out, std::size_t Count)
+	GLM_FUNC_DECL void unpackHalf(uint16 const* In, float* Out, std::size_t Count);
+
+	/// Converts Count normalized floating-point values from In to 8-bit unsigned integer values stored in Out.
+	/// Each value is computed as round(clamp(In[i], 0, +1) * 255.0) like packUnorm1x8, using SSE2 when available.
+	///
+	/// @see gtc_packing
+	/// @see uint8 packUnorm1x8(float const& v)
+	GLM_FUNC_DECL void packUnorm(float const* In, uint8* Out, std::size_t Count);
+
+	/// Converts Count normalized floating-point values from In to 16-bit unsigned integer values stored in Out.
+	/// Each value is computed as round(clamp(In[i], 0, +1) * 65535.0) like packUnorm1x16, using SSE2 when available.
+	///
+	/// @see gtc_packing
+	/// @see uint16 packUnorm1x16(float const& v)
+	GLM_FUNC_DECL void packUnorm(float const* In, uint16* Out, std::size_t Count);
+
+	/// Converts Count 8-bit unsigned integer values from In to normalized floating-point values stored in Out, like unpackUnorm1x8.
+	///
+	/// @see gtc_packing
+	/// @see float unpackUnorm1x8(uint8 p)
+	GLM_FUNC_DECL void unpackUnorm(uint8 const* In, float* Out, std::size_t Count);
+
+	/// Converts Count 16-bit unsigned integer values from In to normalized floating-point values stored in Out, like unpackUnorm1x16.
+	///
+	/// @see gtc_packing
+	/// @see float unpackUnorm1x16(uint16 p)
+	GLM_FUNC_DECL void unpackUnorm(uint16 const* In, float* Out, std::size_t Count);
+
+	/// Converts Count normalized floating-point values from In to 8-bit signed integer values stored in Out.
+	/// Each value is computed as round(clamp(In[i], -1, +1) * 127.0) like packSnorm1x8, using SSE2 when available.
+	///
+	/// @see gtc_packing
+	/// @see uint8 packSnorm1x8(float const& v)
+	GLM_FUNC_DECL void packSnorm(float const* In, int8* Out, std::size_t Count);
+
+	/// Converts Count normalized floating-point values from In to 16-bit signed integer values stored in Out.
+	/// Each value is computed as round(clamp(In[i], -1, +1) * 32767.0) like packSnorm1x16, using SSE2 when available.
+	///
+	/// @see gtc_packing
+	/// @see uint16 packSnorm1x16(float const& v)
+	GLM_FUNC_DECL void packSnorm(float const* In, int16* Out, std::size_t Count);
+
+	/// Converts Count 8-bit signed integer values from In to normalized floating-point values stored in Out, like unpackSnorm1x8.
+	///
+	/// @see gtc_packing
+	/// @see float unpackSnorm1x8(uint8 p)
+	GLM_FUNC_DECL void unpackSnorm(int8 const* In, float* Out, std::size_t Count);
+
+	/// Converts Count 16-bit signed integer values from In to normalized floating-point values stored in Out, like unpackSnorm1x16.
+	///
+	/// @see gtc_packing
+	/// @see float unpackSnorm1x16(uint16 p)
+	GLM_FUNC_DECL void unpackSnorm(int16 const* In, float* Out, std::size_t Count);
+
+	/// Packs Count vectors from In with packUnorm3x10_1x2, using SSE2 when available.
+	///
+	/// @see gtc_packing
+	/// @see uint32 packUnorm3x10_1x2(vec4 const& v)
+	GLM_FUNC_DECL void packUnorm3x10_1x2(vec4 const* In, uint32* Out, std::size_t Count);
+
+	/// Unpacks Count values from In with unpackUnorm3x10_1x2, using SSE2 when available.
+	///
+	/// @see gtc_packing
+	/// @see vec4 unpackUnorm3x10_1x2(uint32 const& p)
+	GLM_FUNC_DECL void unpackUnorm3x10_1x2(uint32 const* In, vec4* Out, std::size_t Count);
+
+	/// Packs Count vectors from In with packSnorm3x10_1x2, using SSE2 when available.
+	///
+	/// @see gtc_packing
+	/// @see uint32 packSnorm3x10_1x2(vec4 const& v)
+	GLM_FUNC_DECL void packSnorm3x10_1x2(vec4 const* In, uint32* Out, std::size_t Count);
+
+	/// Unpacks Count values from In with unpackSnorm3x10_1x2, using SSE2 when available.
+	///
+	/// @see gtc_packing
+	/// @see vec4 unpackSnorm3x10_1x2(uint32 const& p)
+	GLM_FUNC_DECL void unpackSnorm3x10_1x2(uint32 const* In, vec4* Out, std::size_t Count);
+
+	/// Packs Count vectors from In with packF2x11_1x10, using SSE2 when available.
+	///
+	/// @see gtc_packing
+	/// @see uint32 packF2x11_1x10(vec3 const& v)
+	GLM_FUNC_DECL void packF2x11_1x10(vec3 const* In, uint32* Out, std::size_t Count);
+
+	/// Unpacks Count values from In with unpackF2x11_1x10, using SSE2 when available.
+	///
+	/// @see gtc_packing
+	/// @see vec3 unpackF2x11_1x10(uint32 const& p)
+	GLM_FUNC_DECL void unpackF2x11_1x10(uint32 const* In, vec3* Out, std::size_t Count);
+
 	/// Convert each component of the normalized floating-point vector into unsigned integer values.
 	///
 	/// @see gtc_packing
@@ -7,6 +7,7 @@
 #include "../vec3.hpp"
 #include "../vec4.hpp"
 #include "../detail/type_half.hpp"
+#include "../packing.hpp"
 #include <cstring>
 #include <limits>
 
@@ -130,12 +131,14 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER float packed11bitToFloat(glm::uint x)
 	{
+		x &= (1 << 11) - 1;
+
 		if(x == 0)
 			return 0.0f;
-		else if(x == ((1 << 11) - 1))
-			return ~0;//NaN
+		else if((x & (0x1f << 6)) == (0x1f << 6) && (x & 0x3f) != 0)
+			return std::numeric_limits<float>::quiet_NaN();
 		else if(x == (0x1f << 6))
-			return ~0;//Inf
+			return std::numeric_limits<float>::infinity();
 
 		uint Result = packed11ToFloat(x);
 
@@ -160,12 +163,14 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER float packed10bitToFloat(glm::uint x)
 	{
+		x &= (1 << 10) - 1;
+
 		if(x == 0)
 			return 0.0f;
-		else if(x == ((1 << 10) - 1))
-			return ~0;//NaN
+		else if((x & (0x1f << 5)) == (0x1f << 5) && (x & 0x1f) != 0)
+			return std::numeric_limits<float>::quiet_NaN();
 		else if(x == (0x1f << 5))
-			return ~0;//Inf
+			return std::numeric_limits<float>::infinity();
 
 		uint Result = packed10ToFloat(x);
 
@@ -273,84 +278,118 @@ namespace detail
 
 	template<length_t L, qualifier Q>
 	struct compute_half
-	{};
-
-	template<qualifier Q>
-	struct compute_half<1, Q>
 	{
-		GLM_FUNC_QUALIFIER static vec<1, uint16, Q> pack(vec<1, float, Q> const& v)
+		GLM_FUNC_QUALIFIER static vec<L, uint16, Q> pack(vec<L, float, Q> const& v)
 		{
-			int16 const Unpack(detail::toFloat16(v.x));
-			u16vec1 Packed;
-			memcpy(&Packed, &Unpack, sizeof(Packed));
+			vec<L, uint16, Q> Packed;
+			compute_half_array<GLM_CONFIG_SIMD == GLM_ENABLE>::pack(&v.x, &Packed.x, static_cast<std::size_t>(L));
 			return Packed;
 		}
 
-		GLM_FUNC_QUALIFIER static vec<1, float, Q> unpack(vec<1, uint16, Q> const& v)
+		GLM_FUNC_QUALIFIER static vec<L, float, Q> unpack(vec<L, uint16, Q> const& v)
 		{
-			i16vec1 Unpack;
-			memcpy(&Unpack, &v, sizeof(Unpack));
-			return vec<1, float, Q>(detail::toFloat32(v.x));
+			vec<L, float, Q> Unpacked;
+			compute_half_array<GLM_CONFIG_SIMD == GLM_ENABLE>::unpack(&v.x, &Unpacked.x, static_cast<std::size_t>(L));
+			return Unpacked;
 		}
 	};
 
-	template<qualifier Q>
-	struct compute_half<2, Q>
+	template<bool UseSimd>
+	struct compute_packing_array
 	{
-		GLM_FUNC_QUALIFIER static vec<2, uint16, Q> pack(vec<2, float, Q> const& v)
+		GLM_FUNC_QUALIFIER static void packUnorm(float const* In, uint8* Out, std::size_t Count)
 		{
-			vec<2, int16, Q> const Unpack(detail::toFloat16(v.x), detail::toFloat16(v.y));
-			u16vec2 Packed;
-			memcpy(&Packed, &Unpack, sizeof(Packed));
-			return Packed;
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = packUnorm1x8(In[i]);
 		}
 
-		GLM_FUNC_QUALIFIER static vec<2, float, Q> unpack(vec<2, uint16, Q> const& v)
+		GLM_FUNC_QUALIFIER static void packUnorm(float const* In, uint16* Out, std::size_t Count)
 		{
-			i16vec2 Unpack;
-			memcpy(&Unpack, &v, sizeof(Unpack));
-			return vec<2, float, Q>(detail::toFloat32(v.x), detail::toFloat32(v.y));
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = packUnorm1x16(In[i]);
 		}
-	};
 
-	template<qualifier Q>
-	struct compute_half<3, Q>
-	{
-		GLM_FUNC_QUALIFIER static vec<3, uint16, Q> pack(vec<3, float, Q> const& v)
+		GLM_FUNC_QUALIFIER static void unpackUnorm(uint8 const* In, float* Out, std::size_t Count)
 		{
-			vec<3, int16, Q> const Unpack(detail::toFloat16(v.x), detail::toFloat16(v.y), detail::toFloat16(v.z));
-			u16vec3 Packed;
-			memcpy(&Packed, &Unpack, sizeof(Packed));
-			return Packed;
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = unpackUnorm1x8(In[i]);
 		}
 
-		GLM_FUNC_QUALIFIER static vec<3, float, Q> unpack(vec<3, uint16, Q> const& v)
+		GLM_FUNC_QUALIFIER static void unpackUnorm(uint16 const* In, float* Out, std::size_t Count)
 		{
-			i16vec3 Unpack;
-			memcpy(&Unpack, &v, sizeof(Unpack));
-			return vec<3, float, Q>(detail::toFloat32(v.x), detail::toFloat32(v.y), detail::toFloat32(v.z));
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = unpackUnorm1x16(In[i]);
 		}
-	};
 
-	template<qualifier Q>
-	struct compute_half<4, Q>
-	{
-		GLM_FUNC_QUALIFIER static vec<4, uint16, Q> pack(vec<4, float, Q> const& v)
+		GLM_FUNC_QUALIFIER static void packSnorm(float const* In, int8* Out, std::size_t Count)
 		{
-			vec<4, int16, Q> const Unpack(detail::toFloat16(v.x), detail::toFloat16(v.y), detail::toFloat16(v.z), detail::toFloat16(v.w));
-			u16vec4 Packed;
-			memcpy(&Packed, &Unpack, sizeof(Packed));
-			return Packed;
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = static_cast<int8>(round(clamp(In[i], -1.0f, 1.0f) * 127.0f));
+		}
+
+		GLM_FUNC_QUALIFIER static void packSnorm(float const* In, int16* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = static_cast<int16>(round(clamp(In[i], -1.0f, 1.0f) * 32767.0f));
+		}
+
+		GLM_FUNC_QUALIFIER static void unpackSnorm(int8 const* In, float* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = clamp(static_cast<float>(In[i]) * 0.00787401574803149606299212598425f, -1.0f, 1.0f); // 1.0f / 127.0f
+		}
+
+		GLM_FUNC_QUALIFIER static void unpackSnorm(int16 const* In, float* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = clamp(static_cast<float>(In[i]) * 3.0518509475997192297128208258309e-5f, -1.0f, 1.0f); // 1.0f / 32767.0f
+		}
+
+		GLM_FUNC_QUALIFIER static void packUnorm3x10_1x2(vec4 const* In, uint32* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = glm::packUnorm3x10_1x2(In[i]);
 		}
 
-		GLM_FUNC_QUALIFIER static vec<4, float, Q> unpack(vec<4, uint16, Q> const& v)
+		GLM_FUNC_QUALIFIER static void unpackUnorm3x10_1x2(uint32 const* In, vec4* Out, std::size_t Count)
 		{
-			i16vec4 Unpack;
-			memcpy(&Unpack, &v, sizeof(Unpack));
-			return vec<4, float, Q>(detail::toFloat32(v.x), detail::toFloat32(v.y), detail::toFloat32(v.z), detail::toFloat32(v.w));
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = glm::unpackUnorm3x10_1x2(In[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void packSnorm3x10_1x2(vec4 const* In, uint32* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = glm::packSnorm3x10_1x2(In[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void unpackSnorm3x10_1x2(uint32 const* In, vec4* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = glm::unpackSnorm3x10_1x2(In[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void packF2x11_1x10(vec3 const* In, uint32* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = glm::packF2x11_1x10(In[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void unpackF2x11_1x10(uint32 const* In, vec3* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = glm::unpackF2x11_1x10(In[i]);
 		}
 	};
 }//namespace detail
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "packing_simd.inl"
+#endif
+
+namespace glm
+{
 
 	GLM_FUNC_QUALIFIER uint8 packUnorm1x8(float v)
 	{
@@ -475,26 +514,17 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER uint16 packHalf1x16(float v)
 	{
-		int16 const Topack(detail::toFloat16(v));
-		uint16 Packed = 0;
-		memcpy(&Packed, &Topack, sizeof(Packed));
-		return Packed;
+		return detail::compute_half<1, defaultp>::pack(vec1(v)).x;
 	}
 
 	GLM_FUNC_QUALIFIER float unpackHalf1x16(uint16 v)
 	{
-		int16 Unpack = 0;
-		memcpy(&Unpack, &v, sizeof(Unpack));
-		return detail::toFloat32(Unpack);
+		return detail::compute_half<1, defaultp>::unpack(u16vec1(v)).x;
 	}
 
 	GLM_FUNC_QUALIFIER uint64 packHalf4x16(glm::vec4 const& v)
 	{
-		i16vec4 const Unpack(
-			detail::toFloat16(v.x),
-			detail::toFloat16(v.y),
-			detail::toFloat16(v.z),
-			detail::toFloat16(v.w));
+		u16vec4 const Unpack(detail::compute_half<4, defaultp>::pack(v));
 		uint64 Packed = 0;
 		memcpy(&Packed, &Unpack, sizeof(Packed));
 		return Packed;
@@ -502,13 +532,9 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER glm::vec4 unpackHalf4x16(uint64 v)
 	{
-		i16vec4 Unpack;
+		u16vec4 Unpack;
 		memcpy(&Unpack, &v, sizeof(Unpack));
-		return vec4(
-			detail::toFloat32(Unpack.x),
-			detail::toFloat32(Unpack.y),
-			detail::toFloat32(Unpack.z),
-			detail::toFloat32(Unpack.w));
+		return detail::compute_half<4, defaultp>::unpack(Unpack);
 	}
 
 	GLM_FUNC_QUALIFIER uint32 packI3x10_1x2(ivec4 const& v)
@@ -668,6 +694,86 @@ namespace detail
 		return detail::compute_half<L, Q>::unpack(v);
 	}
 
+	GLM_FUNC_QUALIFIER void packHalf(float const* In, uint16* Out, std::size_t Count)
+	{
+		detail::compute_half_array<GLM_CONFIG_SIMD == GLM_ENABLE>::pack(In, Out, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackHalf(uint16 const* In, float* Out, std::size_t Count)
+	{
+		detail::compute_half_array<GLM_CONFIG_SIMD == GLM_ENABLE>::unpack(In, Out, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packUnorm(float const* In, uint8* Out, std::size_t Count)
+	{
+		detail::compute_packing_array<GLM_CONFIG_SIMD == GLM_ENABLE>::packUnorm(In, Out, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packUnorm(float const* In, uint16* Out, std::size_t Count)
+	{
+		detail::compute_packing_array<GLM_CONFIG_SIMD == GLM_ENABLE>::packUnorm(In, Out, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm(uint8 const* In, float* Out, std::size_t Count)
+	{
+		detail::compute_packing_array<GLM_CONFIG_SIMD == GLM_ENABLE>::unpackUnorm(In, Out, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm(uint16 const* In, float* Out, std::size_t Count)
+	{
+		detail::compute_packing_array<GLM_CONFIG_SIMD == GLM_ENABLE>::unpackUnorm(In, Out, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packSnorm(float const* In, int8* Out, std::size_t Count)
+	{
+		detail::compute_packing_array<GLM_CONFIG_SIMD == GLM_ENABLE>::packSnorm(In, Out, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packSnorm(float const* In, int16* Out, std::size_t Count)
+	{
+		detail::compute_packing_array<GLM_CONFIG_SIMD == GLM_ENABLE>::packSnorm(In, Out, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSnorm(int8 const* In, float* Out, std::size_t Count)
+	{
+		detail::compute_packing_array<GLM_CONFIG_SIMD == GLM_ENABLE>::unpackSnorm(In, Out, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSnorm(int16 const* In, float* Out, std::size_t Count)
+	{
+		detail::compute_packing_array<GLM_CONFIG_SIMD == GLM_ENABLE>::unpackSnorm(In, Out, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packUnorm3x10_1x2(vec4 const* In, uint32* Out, std::size_t Count)
+	{
+		detail::compute_packing_array<GLM_CONFIG_SIMD == GLM_ENABLE>::packUnorm3x10_1x2(In, Out, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm3x10_1x2(uint32 const* In, vec4* Out, std::size_t Count)
+	{
+		detail::compute_packing_array<GLM_CONFIG_SIMD == GLM_ENABLE>::unpackUnorm3x10_1x2(In, Out, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packSnorm3x10_1x2(vec4 const* In, uint32* Out, std::size_t Count)
+	{
+		detail::compute_packing_array<GLM_CONFIG_SIMD == GLM_ENABLE>::packSnorm3x10_1x2(In, Out, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSnorm3x10_1x2(uint32 const* In, vec4* Out, std::size_t Count)
+	{
+		detail::compute_packing_array<GLM_CONFIG_SIMD == GLM_ENABLE>::unpackSnorm3x10_1x2(In, Out, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packF2x11_1x10(vec3 const* In, uint32* Out, std::size_t Count)
+	{
+		detail::compute_packing_array<GLM_CONFIG_SIMD == GLM_ENABLE>::packF2x11_1x10(In, Out, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackF2x11_1x10(uint32 const* In, vec3* Out, std::size_t Count)
+	{
+		detail::compute_packing_array<GLM_CONFIG_SIMD == GLM_ENABLE>::unpackF2x11_1x10(In, Out, Count);
+	}
+
 	template<typename uintType, length_t L, typename floatType, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, uintType, Q> packUnorm(vec<L, floatType, Q> const& v)
 	{
@@ -0,0 +1,357 @@
+/// @ref gtc_packing
+/// @file glm/gtc/packing_simd.inl
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#include "../simd/packing.h"
+
+namespace glm{
+namespace detail
+{
+	// round(clamp(v, Min, Max) * Scale) of 4 floats as 4 integers
+	GLM_FUNC_QUALIFIER glm_ivec4 pack_norm(glm_vec4 v, glm_vec4 Min, glm_vec4 Max, glm_vec4 Scale)
+	{
+		return glm_vec4_round_to_int(_mm_mul_ps(_mm_min_ps(_mm_max_ps(v, Min), Max), Scale));
+	}
+
+	// Packed eleven and ten bit floats keep 5 exponent bits and truncate the mantissa like float2packed11 and float2packed10
+	GLM_FUNC_QUALIFIER glm_ivec4 pack_small_float(glm_vec4 v, int MantissaBits)
+	{
+		int const Shift = 23 - MantissaBits;
+		int const ExponentMask = 0x1f << MantissaBits;
+		int const MantissaMask = (1 << MantissaBits) - 1;
+
+		glm_ivec4 const Bits = _mm_castps_si128(v);
+		glm_ivec4 const Exponent = _mm_srli_epi32(_mm_sub_epi32(_mm_and_si128(Bits, _mm_set1_epi32(0x7f800000)), _mm_set1_epi32(0x38000000)), Shift);
+		glm_ivec4 const Mantissa = _mm_srli_epi32(Bits, Shift);
+		glm_ivec4 const Value = _mm_or_si128(_mm_and_si128(Exponent, _mm_set1_epi32(ExponentMask)), _mm_and_si128(Mantissa, _mm_set1_epi32(MantissaMask)));
+
+		// Zero stays zero, NaN sets every bit and infinity only the exponent, ignoring the sign like floatTo11bit
+		glm_ivec4 const IsZero = _mm_castps_si128(_mm_cmpeq_ps(v, _mm_setzero_ps()));
+		glm_ivec4 const IsNaN = _mm_castps_si128(_mm_cmpunord_ps(v, v));
+		glm_ivec4 const IsInf = _mm_cmpeq_epi32(_mm_and_si128(Bits, _mm_set1_epi32(0x7fffffff)), _mm_set1_epi32(0x7f800000));
+
+		glm_ivec4 const Special = _mm_or_si128(_mm_and_si128(IsNaN, _mm_set1_epi32(ExponentMask | MantissaMask)), _mm_and_si128(IsInf, _mm_set1_epi32(ExponentMask)));
+		glm_ivec4 const Regular = _mm_andnot_si128(_mm_or_si128(IsZero, _mm_or_si128(IsNaN, IsInf)), Value);
+		return _mm_or_si128(Regular, Special);
+	}
+
+	// Inverse of pack_small_float for values already shifted to the low bits, like packed11bitToFloat and packed10bitToFloat
+	GLM_FUNC_QUALIFIER glm_vec4 unpack_small_float(glm_ivec4 p, int MantissaBits)
+	{
+		int const Shift = 23 - MantissaBits;
+		int const ExponentMask = 0x1f << MantissaBits;
+		int const MantissaMask = (1 << MantissaBits) - 1;
+
+		glm_ivec4 const Packed = _mm_and_si128(p, _mm_set1_epi32(ExponentMask | MantissaMask));
+		glm_ivec4 const Exponent = _mm_and_si128(Packed, _mm_set1_epi32(ExponentMask));
+		glm_ivec4 const Mantissa = _mm_and_si128(Packed, _mm_set1_epi32(MantissaMask));
+
+		glm_ivec4 const Value = _mm_or_si128(
+			_mm_and_si128(_mm_add_epi32(_mm_slli_epi32(Exponent, Shift), _mm_set1_epi32(0x38000000)), _mm_set1_epi32(0x7f800000)),
+			_mm_slli_epi32(Mantissa, Shift));
+
+		glm_ivec4 const IsZero = _mm_cmpeq_epi32(Packed, _mm_setzero_si128());
+		glm_ivec4 const IsSpecial = _mm_cmpeq_epi32(Exponent, _mm_set1_epi32(ExponentMask));
+		glm_ivec4 const HasMantissa = _mm_andnot_si128(_mm_cmpeq_epi32(Mantissa, _mm_setzero_si128()), _mm_set1_epi32(0x00400000));
+		glm_ivec4 const Special = _mm_or_si128(_mm_set1_epi32(0x7f800000), HasMantissa);
+
+		glm_ivec4 const Result = _mm_or_si128(_mm_andnot_si128(IsSpecial, Value), _mm_and_si128(IsSpecial, Special));
+		return _mm_castsi128_ps(_mm_andnot_si128(IsZero, Result));
+	}
+
+	template<>
+	struct compute_packing_array<true>
+	{
+		GLM_FUNC_QUALIFIER static void packUnorm(float const* In, uint8* Out, std::size_t Count)
+		{
+			glm_vec4 const Min = _mm_setzero_ps();
+			glm_vec4 const Max = _mm_set1_ps(1.0f);
+			glm_vec4 const Scale = _mm_set1_ps(255.0f);
+
+			std::size_t i = 0;
+			for(; i + 16 <= Count; i += 16)
+			{
+				glm_ivec4 const a = pack_norm(_mm_loadu_ps(In + i + 0), Min, Max, Scale);
+				glm_ivec4 const b = pack_norm(_mm_loadu_ps(In + i + 4), Min, Max, Scale);
+				glm_ivec4 const c = pack_norm(_mm_loadu_ps(In + i + 8), Min, Max, Scale);
+				glm_ivec4 const d = pack_norm(_mm_loadu_ps(In + i + 12), Min, Max, Scale);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + i), _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+			}
+
+			compute_packing_array<false>::packUnorm(In + i, Out + i, Count - i);
+		}
+
+		GLM_FUNC_QUALIFIER static void packUnorm(float const* In, uint16* Out, std::size_t Count)
+		{
+			glm_vec4 const Min = _mm_setzero_ps();
+			glm_vec4 const Max = _mm_set1_ps(1.0f);
+			glm_vec4 const Scale = _mm_set1_ps(65535.0f);
+
+			// SSE2 only has a signed saturating pack, bias the values into the int16 range and flip the top bit back
+			glm_ivec4 const Bias = _mm_set1_epi32(32768);
+			glm_ivec4 const Flip = _mm_set1_epi16(static_cast<short>(0x8000));
+
+			std::size_t i = 0;
+			for(; i + 8 <= Count; i += 8)
+			{
+				glm_ivec4 const a = _mm_sub_epi32(pack_norm(_mm_loadu_ps(In + i + 0), Min, Max, Scale), Bias);
+				glm_ivec4 const b = _mm_sub_epi32(pack_norm(_mm_loadu_ps(In + i + 4), Min, Max, Scale), Bias);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + i), _mm_xor_si128(_mm_packs_epi32(a, b), Flip));
+			}
+
+			compute_packing_array<false>::packUnorm(In + i, Out + i, Count - i);
+		}
+
+		GLM_FUNC_QUALIFIER static void unpackUnorm(uint8 const* In, float* Out, std::size_t Count)
+		{
+			glm_vec4 const Scale = _mm_set1_ps(static_cast<float>(0.0039215686274509803921568627451)); // 1 / 255
+			glm_ivec4 const Zero = _mm_setzero_si128();
+
+			std::size_t i = 0;
+			for(; i + 16 <= Count; i += 16)
+			{
+				glm_ivec4 const Bytes = _mm_loadu_si128(reinterpret_cast<__m128i const*>(In + i));
+				glm_ivec4 const Lo = _mm_unpacklo_epi8(Bytes, Zero);
+				glm_ivec4 const Hi = _mm_unpackhi_epi8(Bytes, Zero);
+				_mm_storeu_ps(Out + i + 0, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(Lo, Zero)), Scale));
+				_mm_storeu_ps(Out + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(Lo, Zero)), Scale));
+				_mm_storeu_ps(Out + i + 8, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(Hi, Zero)), Scale));
+				_mm_storeu_ps(Out + i + 12, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(Hi, Zero)), Scale));
+			}
+
+			compute_packing_array<false>::unpackUnorm(In + i, Out + i, Count - i);
+		}
+
+		GLM_FUNC_QUALIFIER static void unpackUnorm(uint16 const* In, float* Out, std::size_t Count)
+		{
+			glm_vec4 const Scale = _mm_set1_ps(1.5259021896696421759365224689097e-5f); // 1.0 / 65535.0
+			glm_ivec4 const Zero = _mm_setzero_si128();
+
+			std::size_t i = 0;
+			for(; i + 8 <= Count; i += 8)
+			{
+				glm_ivec4 const Words = _mm_loadu_si128(reinterpret_cast<__m128i const*>(In + i));
+				_mm_storeu_ps(Out + i + 0, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(Words, Zero)), Scale));
+				_mm_storeu_ps(Out + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(Words, Zero)), Scale));
+			}
+
+			compute_packing_array<false>::unpackUnorm(In + i, Out + i, Count - i);
+		}
+
+		GLM_FUNC_QUALIFIER static void packSnorm(float const* In, int8* Out, std::size_t Count)
+		{
+			glm_vec4 const Min = _mm_set1_ps(-1.0f);
+			glm_vec4 const Max = _mm_set1_ps(1.0f);
+			glm_vec4 const Scale = _mm_set1_ps(127.0f);
+
+			std::size_t i = 0;
+			for(; i + 16 <= Count; i += 16)
+			{
+				glm_ivec4 const a = pack_norm(_mm_loadu_ps(In + i + 0), Min, Max, Scale);
+				glm_ivec4 const b = pack_norm(_mm_loadu_ps(In + i + 4), Min, Max, Scale);
+				glm_ivec4 const c = pack_norm(_mm_loadu_ps(In + i + 8), Min, Max, Scale);
+				glm_ivec4 const d = pack_norm(_mm_loadu_ps(In + i + 12), Min, Max, Scale);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + i), _mm_packs_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+			}
+
+			compute_packing_array<false>::packSnorm(In + i, Out + i, Count - i);
+		}
+
+		GLM_FUNC_QUALIFIER static void packSnorm(float const* In, int16* Out, std::size_t Count)
+		{
+			glm_vec4 const Min = _mm_set1_ps(-1.0f);
+			glm_vec4 const Max = _mm_set1_ps(1.0f);
+			glm_vec4 const Scale = _mm_set1_ps(32767.0f);
+
+			std::size_t i = 0;
+			for(; i + 8 <= Count; i += 8)
+			{
+				glm_ivec4 const a = pack_norm(_mm_loadu_ps(In + i + 0), Min, Max, Scale);
+				glm_ivec4 const b = pack_norm(_mm_loadu_ps(In + i + 4), Min, Max, Scale);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + i), _mm_packs_epi32(a, b));
+			}
+
+			compute_packing_array<false>::packSnorm(In + i, Out + i, Count - i);
+		}
+
+		GLM_FUNC_QUALIFIER static void unpackSnorm(int8 const* In, float* Out, std::size_t Count)
+		{
+			glm_vec4 const Min = _mm_set1_ps(-1.0f);
+			glm_vec4 const Max = _mm_set1_ps(1.0f);
+			glm_vec4 const Scale = _mm_set1_ps(0.00787401574803149606299212598425f); // 1.0f / 127.0f
+
+			std::size_t i = 0;
+			for(; i + 16 <= Count; i += 16)
+			{
+				// Sign extend by duplicating each value into the high part and shifting it back arithmetically
+				glm_ivec4 const Bytes = _mm_loadu_si128(reinterpret_cast<__m128i const*>(In + i));
+				glm_ivec4 const Lo = _mm_srai_epi16(_mm_unpacklo_epi8(Bytes, Bytes), 8);
+				glm_ivec4 const Hi = _mm_srai_epi16(_mm_unpackhi_epi8(Bytes, Bytes), 8);
+				glm_ivec4 const Ints[4] = {
+					_mm_srai_epi32(_mm_unpacklo_epi16(Lo, Lo), 16),
+					_mm_srai_epi32(_mm_unpackhi_epi16(Lo, Lo), 16),
+					_mm_srai_epi32(_mm_unpacklo_epi16(Hi, Hi), 16),
+					_mm_srai_epi32(_mm_unpackhi_epi16(Hi, Hi), 16)};
+
+				for(std::size_t j = 0; j < 4; ++j)
+					_mm_storeu_ps(Out + i + j * 4, glm_vec4_clamp(_mm_mul_ps(_mm_cvtepi32_ps(Ints[j]), Scale), Min, Max));
+			}
+
+			compute_packing_array<false>::unpackSnorm(In + i, Out + i, Count - i);
+		}
+
+		GLM_FUNC_QUALIFIER static void unpackSnorm(int16 const* In, float* Out, std::size_t Count)
+		{
+			glm_vec4 const Min = _mm_set1_ps(-1.0f);
+			glm_vec4 const Max = _mm_set1_ps(1.0f);
+			glm_vec4 const Scale = _mm_set1_ps(3.0518509475997192297128208258309e-5f); // 1.0f / 32767.0f
+
+			std::size_t i = 0;
+			for(; i + 8 <= Count; i += 8)
+			{
+				glm_ivec4 const Words = _mm_loadu_si128(reinterpret_cast<__m128i const*>(In + i));
+				glm_ivec4 const Lo = _mm_srai_epi32(_mm_unpacklo_epi16(Words, Words), 16);
+				glm_ivec4 const Hi = _mm_srai_epi32(_mm_unpackhi_epi16(Words, Words), 16);
+				_mm_storeu_ps(Out + i + 0, glm_vec4_clamp(_mm_mul_ps(_mm_cvtepi32_ps(Lo), Scale), Min, Max));
+				_mm_storeu_ps(Out + i + 4, glm_vec4_clamp(_mm_mul_ps(_mm_cvtepi32_ps(Hi), Scale), Min, Max));
+			}
+
+			compute_packing_array<false>::unpackSnorm(In + i, Out + i, Count - i);
+		}
+
+		GLM_FUNC_QUALIFIER static void packUnorm3x10_1x2(vec4 const* In, uint32* Out, std::size_t Count)
+		{
+			glm_vec4 const Min = _mm_setzero_ps();
+			glm_vec4 const Max = _mm_set1_ps(1.0f);
+			glm_vec4 const Scale = _mm_set1_ps(1023.f);
+			glm_vec4 const ScaleW = _mm_set1_ps(3.f);
+
+			std::size_t const SimdCount = sizeof(vec4) == 4 * sizeof(float) ? Count : 0;
+
+			std::size_t i = 0;
+			for(; i + 4 <= SimdCount; i += 4)
+			{
+				glm_vec4 x, y, z, w;
+				glm_vec4_load_packed4(&In[i].x, &x, &y, &z, &w);
+
+				glm_ivec4 const Packed = _mm_or_si128(
+					_mm_or_si128(pack_norm(x, Min, Max, Scale), _mm_slli_epi32(pack_norm(y, Min, Max, Scale), 10)),
+					_mm_or_si128(_mm_slli_epi32(pack_norm(z, Min, Max, Scale), 20), _mm_slli_epi32(pack_norm(w, Min, Max, ScaleW), 30)));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + i), Packed);
+			}
+
+			compute_packing_array<false>::packUnorm3x10_1x2(In + i, Out + i, Count - i);
+		}
+
+		GLM_FUNC_QUALIFIER static void unpackUnorm3x10_1x2(uint32 const* In, vec4* Out, std::size_t Count)
+		{
+			glm_ivec4 const Mask = _mm_set1_epi32(0x3ff);
+			glm_vec4 const Scale = _mm_set1_ps(1.0f / 1023.f);
+			glm_vec4 const ScaleW = _mm_set1_ps(1.0f / 3.f);
+
+			std::size_t const SimdCount = sizeof(vec4) == 4 * sizeof(float) ? Count : 0;
+
+			std::size_t i = 0;
+			for(; i + 4 <= SimdCount; i += 4)
+			{
+				glm_ivec4 const Packed = _mm_loadu_si128(reinterpret_cast<__m128i const*>(In + i));
+				glm_vec4 const x = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(Packed, Mask)), Scale);
+				glm_vec4 const y = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(Packed, 10), Mask)), Scale);
+				glm_vec4 const z = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(Packed, 20), Mask)), Scale);
+				glm_vec4 const w = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(Packed, 30)), ScaleW);
+				glm_vec4_store_packed4(&Out[i].x, x, y, z, w);
+			}
+
+			compute_packing_array<false>::unpackUnorm3x10_1x2(In + i, Out + i, Count - i);
+		}
+
+		GLM_FUNC_QUALIFIER static void packSnorm3x10_1x2(vec4 const* In, uint32* Out, std::size_t Count)
+		{
+			glm_vec4 const Min = _mm_set1_ps(-1.0f);
+			glm_vec4 const Max = _mm_set1_ps(1.0f);
+			glm_vec4 const Scale = _mm_set1_ps(511.f);
+			glm_vec4 const ScaleW = _mm_set1_ps(1.f);
+			glm_ivec4 const Mask = _mm_set1_epi32(0x3ff);
+
+			std::size_t const SimdCount = sizeof(vec4) == 4 * sizeof(float) ? Count : 0;
+
+			std::size_t i = 0;
+			for(; i + 4 <= SimdCount; i += 4)
+			{
+				glm_vec4 x, y, z, w;
+				glm_vec4_load_packed4(&In[i].x, &x, &y, &z, &w);
+
+				glm_ivec4 const Packed = _mm_or_si128(
+					_mm_or_si128(_mm_and_si128(pack_norm(x, Min, Max, Scale), Mask), _mm_slli_epi32(_mm_and_si128(pack_norm(y, Min, Max, Scale), Mask), 10)),
+					_mm_or_si128(_mm_slli_epi32(_mm_and_si128(pack_norm(z, Min, Max, Scale), Mask), 20), _mm_slli_epi32(pack_norm(w, Min, Max, ScaleW), 30)));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + i), Packed);
+			}
+
+			compute_packing_array<false>::packSnorm3x10_1x2(In + i, Out + i, Count - i);
+		}
+
+		GLM_FUNC_QUALIFIER static void unpackSnorm3x10_1x2(uint32 const* In, vec4* Out, std::size_t Count)
+		{
+			glm_vec4 const Min = _mm_set1_ps(-1.0f);
+			glm_vec4 const Max = _mm_set1_ps(1.0f);
+			glm_vec4 const Scale = _mm_set1_ps(1.f / 511.f);
+
+			std::size_t const SimdCount = sizeof(vec4) == 4 * sizeof(float) ? Count : 0;
+
+			std::size_t i = 0;
+			for(; i + 4 <= SimdCount; i += 4)
+			{
+				// Move each field to the top bits then shift it back arithmetically to sign extend it
+				glm_ivec4 const Packed = _mm_loadu_si128(reinterpret_cast<__m128i const*>(In + i));
+				glm_vec4 const x = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(Packed, 22), 22)), Scale);
+				glm_vec4 const y = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(Packed, 12), 22)), Scale);
+				glm_vec4 const z = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(Packed, 2), 22)), Scale);
+				glm_vec4 const w = _mm_cvtepi32_ps(_mm_srai_epi32(Packed, 30));
+				glm_vec4_store_packed4(&Out[i].x, glm_vec4_clamp(x, Min, Max), glm_vec4_clamp(y, Min, Max), glm_vec4_clamp(z, Min, Max), glm_vec4_clamp(w, Min, Max));
+			}
+
+			compute_packing_array<false>::unpackSnorm3x10_1x2(In + i, Out + i, Count - i);
+		}
+
+		GLM_FUNC_QUALIFIER static void packF2x11_1x10(vec3 const* In, uint32* Out, std::size_t Count)
+		{
+			// Aligned gentypes pad vec3 to 16 bytes, these are left to the scalar path
+			std::size_t const SimdCount = sizeof(vec3) == 3 * sizeof(float) ? Count : 0;
+
+			std::size_t i = 0;
+			for(; i + 4 <= SimdCount; i += 4)
+			{
+				glm_vec4 x, y, z;
+				glm_vec4_load_packed3(&In[i].x, &x, &y, &z);
+
+				glm_ivec4 const Packed = _mm_or_si128(
+					_mm_or_si128(pack_small_float(x, 6), _mm_slli_epi32(pack_small_float(y, 6), 11)),
+					_mm_slli_epi32(pack_small_float(z, 5), 22));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + i), Packed);
+			}
+
+			compute_packing_array<false>::packF2x11_1x10(In + i, Out + i, Count - i);
+		}
+
+		GLM_FUNC_QUALIFIER static void unpackF2x11_1x10(uint32 const* In, vec3* Out, std::size_t Count)
+		{
+			std::size_t const SimdCount = sizeof(vec3) == 3 * sizeof(float) ? Count : 0;
+
+			std::size_t i = 0;
+			for(; i + 4 <= SimdCount; i += 4)
+			{
+				glm_ivec4 const Packed = _mm_loadu_si128(reinterpret_cast<__m128i const*>(In + i));
+				glm_vec4_store_packed3(&Out[i].x,
+					unpack_small_float(Packed, 6),
+					unpack_small_float(_mm_srli_epi32(Packed, 11), 6),
+					unpack_small_float(_mm_srli_epi32(Packed, 22), 5));
+			}
+
+			compute_packing_array<false>::unpackF2x11_1x10(In + i, Out + i, Count - i);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
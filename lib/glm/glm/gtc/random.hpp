@@ -10,6 +10,10 @@
 /// Include <glm/gtc/random.hpp> to use the features of this extension.
 ///
 /// Generate random number from various distribution methods.
+///
+/// Every function draws its bits from a random engine: either the one given as last argument or,
+/// without it, a xoshiro128++ generator owned by the calling thread so that worker threads never contend.
+/// std::srand doesn't seed these functions anymore, use thread_random_engine().seed(Seed) or an explicit engine.
 
 #pragma once
 
@@ -17,16 +21,66 @@
 #include "../ext/scalar_int_sized.hpp"
 #include "../ext/scalar_uint_sized.hpp"
 #include "../detail/qualifier.hpp"
+#include <cstddef>
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
 #	pragma message("GLM: GLM_GTC_random extension included")
 #endif
 
+// GLM_CONSTEXPR is disabled with SIMD but the standard distributions need constant engine bounds
+#if GLM_LANG & GLM_LANG_CXX11_FLAG
+#	define GLM_RANDOM_CONSTEXPR constexpr
+#else
+#	define GLM_RANDOM_CONSTEXPR
+#endif
+
 namespace glm
 {
 	/// @addtogroup gtc_random
 	/// @{
 
+	/// xoshiro128++ pseudo random number generator, 128 bits of state and 32 random bits per call.
+	///
+	/// It satisfies the UniformRandomBitGenerator requirements so it may also feed the standard library distributions.
+	///
+	/// @see gtc_random
+	struct xoshiro128
+	{
+		typedef uint32 result_type;
+
+		/// Seed the state with splitmix64 so that any seed, zero included, gives a valid state
+		GLM_FUNC_DECL explicit xoshiro128(uint64 Seed = 0);
+
+		GLM_FUNC_DECL void seed(uint64 Seed);
+
+		/// Advance the state by 2^64 calls, to split one seed into non-overlapping sequences for several threads
+		GLM_FUNC_DECL void jump();
+
+		GLM_FUNC_DECL uint32 operator()();
+
+		GLM_FUNC_DECL static GLM_RANDOM_CONSTEXPR uint32 min() { return 0u; }
+		GLM_FUNC_DECL static GLM_RANDOM_CONSTEXPR uint32 max() { return 0xFFFFFFFFu; }
+
+		uint32 state[4];
+	};
+
+	/// Handle on the xoshiro128++ generator of the calling thread, the engine used when none is given.
+	///
+	/// The generator is seeded on first use from the time and the thread, seed() makes the calling thread sequence reproducible.
+	///
+	/// @see gtc_random
+	struct thread_random_engine
+	{
+		typedef uint32 result_type;
+
+		GLM_FUNC_DECL void seed(uint64 Seed);
+
+		GLM_FUNC_DECL uint32 operator()();
+
+		GLM_FUNC_DECL static GLM_RANDOM_CONSTEXPR uint32 min() { return 0u; }
+		GLM_FUNC_DECL static GLM_RANDOM_CONSTEXPR uint32 max() { return 0xFFFFFFFFu; }
+	};
+
 	/// Generate random numbers in the interval [Min, Max], according a linear distribution
 	///
 	/// @param Min Minimum value included in the sampling
@@ -36,6 +90,16 @@ namespace glm
 	template<typename genType>
 	GLM_FUNC_DECL genType linearRand(genType Min, genType Max);
 
+	/// Generate random numbers in the interval [Min, Max], according a linear distribution
+	///
+	/// @param Min Minimum value included in the sampling
+	/// @param Max Maximum value included in the sampling
+	/// @param Engine Source of random bits, each call returning 32 random bits like xoshiro128 or std::mt19937
+	/// @tparam genType Value type. Currently supported: float or double scalars.
+	/// @see gtc_random
+	template<typename genType, typename engine>
+	GLM_FUNC_DECL genType linearRand(genType Min, genType Max, engine& Engine);
+
 	/// Generate random numbers in the interval [Min, Max], according a linear distribution
 	///
 	/// @param Min Minimum value included in the sampling
@@ -46,36 +110,147 @@ namespace glm
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_DECL vec<L, T, Q> linearRand(vec<L, T, Q> const& Min, vec<L, T, Q> const& Max);
 
+	/// Generate random numbers in the interval [Min, Max], according a linear distribution
+	///
+	/// @param Min Minimum value included in the sampling
+	/// @param Max Maximum value included in the sampling
+	/// @param Engine Source of random bits, each call returning 32 random bits like xoshiro128 or std::mt19937
+	/// @tparam T Value type. Currently supported: float or double.
+	///
+	/// @see gtc_random
+	template<length_t L, typename T, qualifier Q, typename engine>
+	GLM_FUNC_DECL vec<L, T, Q> linearRand(vec<L, T, Q> const& Min, vec<L, T, Q> const& Max, engine& Engine);
+
 	/// Generate random numbers in the interval [Min, Max], according a gaussian distribution
 	///
 	/// @see gtc_random
 	template<typename genType>
 	GLM_FUNC_DECL genType gaussRand(genType Mean, genType Deviation);
 
+	/// Generate random numbers in the interval [Min, Max], according a gaussian distribution
+	///
+	/// @see gtc_random
+	template<typename genType, typename engine>
+	GLM_FUNC_DECL genType gaussRand(genType Mean, genType Deviation, engine& Engine);
+
 	/// Generate a random 2D vector which coordinates are regulary distributed on a circle of a given radius
 	///
 	/// @see gtc_random
 	template<typename T>
 	GLM_FUNC_DECL vec<2, T, defaultp> circularRand(T Radius);
 
+	/// Generate a random 2D vector which coordinates are regulary distributed on a circle of a given radius
+	///
+	/// @see gtc_random
+	template<typename T, typename engine>
+	GLM_FUNC_DECL vec<2, T, defaultp> circularRand(T Radius, engine& Engine);
+
 	/// Generate a random 3D vector which coordinates are regulary distributed on a sphere of a given radius
 	///
 	/// @see gtc_random
 	template<typename T>
 	GLM_FUNC_DECL vec<3, T, defaultp> sphericalRand(T Radius);
 
+	/// Generate a random 3D vector which coordinates are regulary distributed on a sphere of a given radius
+	///
+	/// @see gtc_random
+	template<typename T, typename engine>
+	GLM_FUNC_DECL vec<3, T, defaultp> sphericalRand(T Radius, engine& Engine);
+
 	/// Generate a random 2D vector which coordinates are regulary distributed within the area of a disk of a given radius
 	///
 	/// @see gtc_random
 	template<typename T>
 	GLM_FUNC_DECL vec<2, T, defaultp> diskRand(T Radius);
 
+	/// Generate a random 2D vector which coordinates are regulary distributed within the area of a disk of a given radius
+	///
+	/// @see gtc_random
+	template<typename T, typename engine>
+	GLM_FUNC_DECL vec<2, T, defaultp> diskRand(T Radius, engine& Engine);
+
 	/// Generate a random 3D vector which coordinates are regulary distributed within the volume of a ball of a given radius
 	///
 	/// @see gtc_random
 	template<typename T>
 	GLM_FUNC_DECL vec<3, T, defaultp> ballRand(T Radius);
 
+	/// Generate a random 3D vector which coordinates are regulary distributed within the volume of a ball of a given radius
+	///
+	/// @see gtc_random
+	template<typename T, typename engine>
+	GLM_FUNC_DECL vec<3, T, defaultp> ballRand(T Radius, engine& Engine);
+
+	/// Fill Out with Count random numbers in the interval [Min, Max], according a linear distribution
+	///
+	/// Uses SSE2 to run four generators side by side when SIMD is enabled.
+	/// The batch functions seed their own generators from the engine so the values differ from repeated calls to the scalar functions.
+	///
+	/// @tparam T Value type. Currently supported: float or double.
+	/// @see gtc_random
+	template<typename T>
+	GLM_FUNC_DECL void linearRand(T Min, T Max, T* Out, std::size_t Count);
+
+	/// Fill Out with Count random numbers in the interval [Min, Max], according a linear distribution
+	///
+	/// @see gtc_random
+	template<typename T, typename engine>
+	GLM_FUNC_DECL void linearRand(T Min, T Max, T* Out, std::size_t Count, engine& Engine);
+
+	/// Fill Out with Count random numbers according a gaussian distribution, scaled like gaussRand
+	///
+	/// Box-Muller transform instead of the rejection sampling of gaussRand.
+	///
+	/// @see gtc_random
+	template<typename T>
+	GLM_FUNC_DECL void gaussRand(T Mean, T Deviation, T* Out, std::size_t Count);
+
+	/// Fill Out with Count random numbers according a gaussian distribution, scaled like gaussRand
+	///
+	/// @see gtc_random
+	template<typename T, typename engine>
+	GLM_FUNC_DECL void gaussRand(T Mean, T Deviation, T* Out, std::size_t Count, engine& Engine);
+
+	/// Fill Out with Count random 3D vectors regulary distributed on a sphere of a given radius
+	///
+	/// @see gtc_random
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void sphericalRand(T Radius, vec<3, T, Q>* Out, std::size_t Count);
+
+	/// Fill Out with Count random 3D vectors regulary distributed on a sphere of a given radius
+	///
+	/// @see gtc_random
+	template<typename T, qualifier Q, typename engine>
+	GLM_FUNC_DECL void sphericalRand(T Radius, vec<3, T, Q>* Out, std::size_t Count, engine& Engine);
+
+	/// Fill Out with Count random 2D vectors regulary distributed within the area of a disk of a given radius
+	///
+	/// Inverse transform sampling instead of the rejection sampling of diskRand.
+	///
+	/// @see gtc_random
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void diskRand(T Radius, vec<2, T, Q>* Out, std::size_t Count);
+
+	/// Fill Out with Count random 2D vectors regulary distributed within the area of a disk of a given radius
+	///
+	/// @see gtc_random
+	template<typename T, qualifier Q, typename engine>
+	GLM_FUNC_DECL void diskRand(T Radius, vec<2, T, Q>* Out, std::size_t Count, engine& Engine);
+
+	/// Fill Out with Count random 3D vectors regulary distributed within the volume of a ball of a given radius
+	///
+	/// Inverse transform sampling instead of the rejection sampling of ballRand.
+	///
+	/// @see gtc_random
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void ballRand(T Radius, vec<3, T, Q>* Out, std::size_t Count);
+
+	/// Fill Out with Count random 3D vectors regulary distributed within the volume of a ball of a given radius
+	///
+	/// @see gtc_random
+	template<typename T, qualifier Q, typename engine>
+	GLM_FUNC_DECL void ballRand(T Radius, vec<3, T, Q>* Out, std::size_t Count, engine& Engine);
+
 	/// @}
 }//namespace glm
 
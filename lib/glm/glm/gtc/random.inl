@@ -2,228 +2,427 @@
 #include "../exponential.hpp"
 #include "../trigonometric.hpp"
 #include "../detail/type_vec1.hpp"
-#include <cstdlib>
 #include <ctime>
 #include <cassert>
 #include <cmath>
 
+#if GLM_LANG & GLM_LANG_CXX11_FLAG
+#	define GLM_RANDOM_THREAD_LOCAL thread_local
+#elif GLM_COMPILER & GLM_COMPILER_VC
+#	define GLM_RANDOM_THREAD_LOCAL __declspec(thread)
+#else
+#	define GLM_RANDOM_THREAD_LOCAL __thread
+#endif
+
 namespace glm{
 namespace detail
 {
-	template <length_t L, typename T, qualifier Q>
-	struct compute_rand
+	GLM_FUNC_QUALIFIER uint64 splitmix64(uint64& x)
 	{
-		GLM_FUNC_QUALIFIER static vec<L, T, Q> call();
-	};
+		x += 0x9E3779B97F4A7C15ull;
+		uint64 z = x;
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+		return z ^ (z >> 31);
+	}
 
-	template <qualifier P>
-	struct compute_rand<1, uint8, P>
+	GLM_FUNC_QUALIFIER void xoshiro128_seed(uint32* s, uint64 Seed)
 	{
-		GLM_FUNC_QUALIFIER static vec<1, uint8, P> call()
-		{
-			return vec<1, uint8, P>(
-				std::rand() % std::numeric_limits<uint8>::max());
-		}
-	};
+		uint64 const a = splitmix64(Seed);
+		uint64 const b = splitmix64(Seed);
+		s[0] = static_cast<uint32>(a);
+		s[1] = static_cast<uint32>(a >> 32);
+		s[2] = static_cast<uint32>(b);
+		s[3] = static_cast<uint32>(b >> 32);
+
+		// The all zero state is the only one xoshiro never leaves
+		if((s[0] | s[1] | s[2] | s[3]) == 0)
+			s[0] = 1;
+	}
 
-	template <qualifier P>
-	struct compute_rand<2, uint8, P>
+	GLM_FUNC_QUALIFIER uint32 xoshiro128_rotl(uint32 x, int k)
 	{
-		GLM_FUNC_QUALIFIER static vec<2, uint8, P> call()
-		{
-			return vec<2, uint8, P>(
-				std::rand() % std::numeric_limits<uint8>::max(),
-				std::rand() % std::numeric_limits<uint8>::max());
-		}
-	};
+		return (x << k) | (x >> (32 - k));
+	}
 
-	template <qualifier P>
-	struct compute_rand<3, uint8, P>
+	GLM_FUNC_QUALIFIER uint32 xoshiro128_next(uint32* s)
 	{
-		GLM_FUNC_QUALIFIER static vec<3, uint8, P> call()
-		{
-			return vec<3, uint8, P>(
-				std::rand() % std::numeric_limits<uint8>::max(),
-				std::rand() % std::numeric_limits<uint8>::max(),
-				std::rand() % std::numeric_limits<uint8>::max());
-		}
-	};
+		uint32 const Result = xoshiro128_rotl(s[0] + s[3], 7) + s[0];
+		uint32 const t = s[1] << 9;
+
+		s[2] ^= s[0];
+		s[3] ^= s[1];
+		s[1] ^= s[2];
+		s[0] ^= s[3];
+		s[2] ^= t;
+		s[3] = xoshiro128_rotl(s[3], 11);
 
-	template <qualifier P>
-	struct compute_rand<4, uint8, P>
+		return Result;
+	}
+
+	// Zero initialized per thread, seeded on first use from the time and the address of the state which differs between threads
+	GLM_FUNC_QUALIFIER uint32* thread_random_state()
 	{
-		GLM_FUNC_QUALIFIER static vec<4, uint8, P> call()
-		{
-			return vec<4, uint8, P>(
-				std::rand() % std::numeric_limits<uint8>::max(),
-				std::rand() % std::numeric_limits<uint8>::max(),
-				std::rand() % std::numeric_limits<uint8>::max(),
-				std::rand() % std::numeric_limits<uint8>::max());
-		}
-	};
+		static GLM_RANDOM_THREAD_LOCAL uint32 State[4] = {0, 0, 0, 0};
 
-	template <length_t L, qualifier Q>
-	struct compute_rand<L, uint16, Q>
+		if((State[0] | State[1] | State[2] | State[3]) == 0)
+			xoshiro128_seed(State, static_cast<uint64>(std::time(0)) ^ (static_cast<uint64>(reinterpret_cast<std::size_t>(State)) << 16));
+
+		return State;
+	}
+
+	template<typename engine>
+	GLM_FUNC_QUALIFIER uint32 random_bits(engine& Engine)
 	{
-		GLM_FUNC_QUALIFIER static vec<L, uint16, Q> call()
-		{
-			return
-				(vec<L, uint16, Q>(compute_rand<L, uint8, Q>::call()) << static_cast<uint16>(8)) |
-				(vec<L, uint16, Q>(compute_rand<L, uint8, Q>::call()) << static_cast<uint16>(0));
-		}
-	};
+		return static_cast<uint32>(Engine());
+	}
 
-	template <length_t L, qualifier Q>
-	struct compute_rand<L, uint32, Q>
+	template <length_t L, typename T, qualifier Q>
+	struct compute_rand
 	{
-		GLM_FUNC_QUALIFIER static vec<L, uint32, Q> call()
+		// The high bits of each 32 bit draw, the best ones of most generators
+		template<typename engine>
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(engine& Engine)
 		{
-			return
-				(vec<L, uint32, Q>(compute_rand<L, uint16, Q>::call()) << static_cast<uint32>(16)) |
-				(vec<L, uint32, Q>(compute_rand<L, uint16, Q>::call()) << static_cast<uint32>(0));
+			vec<L, T, Q> Result;
+			for(length_t i = 0; i < L; ++i)
+				Result[i] = static_cast<T>(random_bits(Engine) >> (32 - sizeof(T) * 8));
+			return Result;
 		}
 	};
 
 	template <length_t L, qualifier Q>
 	struct compute_rand<L, uint64, Q>
 	{
-		GLM_FUNC_QUALIFIER static vec<L, uint64, Q> call()
+		template<typename engine>
+		GLM_FUNC_QUALIFIER static vec<L, uint64, Q> call(engine& Engine)
 		{
 			return
-				(vec<L, uint64, Q>(compute_rand<L, uint32, Q>::call()) << static_cast<uint64>(32)) |
-				(vec<L, uint64, Q>(compute_rand<L, uint32, Q>::call()) << static_cast<uint64>(0));
+				(vec<L, uint64, Q>(compute_rand<L, uint32, Q>::call(Engine)) << static_cast<uint64>(32)) |
+				(vec<L, uint64, Q>(compute_rand<L, uint32, Q>::call(Engine)) << static_cast<uint64>(0));
 		}
 	};
 
 	template <length_t L, typename T, qualifier Q>
 	struct compute_linearRand
 	{
-		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& Min, vec<L, T, Q> const& Max);
+		template<typename engine>
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& Min, vec<L, T, Q> const& Max, engine& Engine);
+	};
+
+	// The range is computed in the unsigned type where it wraps instead of overflowing,
+	// a range covering the whole type would wrap to 0 so it keeps all the bits of the draw
+	template<length_t L, typename T, typename U, qualifier Q>
+	struct compute_linearRand_integer
+	{
+		template<typename engine>
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& Min, vec<L, T, Q> const& Max, engine& Engine)
+		{
+			vec<L, U, Q> const Bits(compute_rand<L, U, Q>::call(Engine));
+			vec<L, U, Q> const Range(vec<L, U, Q>(Max) - vec<L, U, Q>(Min));
+
+			vec<L, U, Q> Result;
+			for(length_t i = 0; i < L; ++i)
+				Result[i] = Range[i] == std::numeric_limits<U>::max() ? Bits[i] : static_cast<U>(Bits[i] % static_cast<U>(Range[i] + static_cast<U>(1)));
+			return vec<L, T, Q>(Result + vec<L, U, Q>(Min));
+		}
 	};
 
 	template<length_t L, qualifier Q>
 	struct compute_linearRand<L, int8, Q>
 	{
-		GLM_FUNC_QUALIFIER static vec<L, int8, Q> call(vec<L, int8, Q> const& Min, vec<L, int8, Q> const& Max)
+		template<typename engine>
+		GLM_FUNC_QUALIFIER static vec<L, int8, Q> call(vec<L, int8, Q> const& Min, vec<L, int8, Q> const& Max, engine& Engine)
 		{
-			return (vec<L, int8, Q>(compute_rand<L, uint8, Q>::call() % vec<L, uint8, Q>(Max + static_cast<int8>(1) - Min))) + Min;
+			return compute_linearRand_integer<L, int8, uint8, Q>::call(Min, Max, Engine);
 		}
 	};
 
 	template<length_t L, qualifier Q>
 	struct compute_linearRand<L, uint8, Q>
 	{
-		GLM_FUNC_QUALIFIER static vec<L, uint8, Q> call(vec<L, uint8, Q> const& Min, vec<L, uint8, Q> const& Max)
+		template<typename engine>
+		GLM_FUNC_QUALIFIER static vec<L, uint8, Q> call(vec<L, uint8, Q> const& Min, vec<L, uint8, Q> const& Max, engine& Engine)
 		{
-			return (compute_rand<L, uint8, Q>::call() % (Max + static_cast<uint8>(1) - Min)) + Min;
+			return compute_linearRand_integer<L, uint8, uint8, Q>::call(Min, Max, Engine);
 		}
 	};
 
 	template<length_t L, qualifier Q>
 	struct compute_linearRand<L, int16, Q>
 	{
-		GLM_FUNC_QUALIFIER static vec<L, int16, Q> call(vec<L, int16, Q> const& Min, vec<L, int16, Q> const& Max)
+		template<typename engine>
+		GLM_FUNC_QUALIFIER static vec<L, int16, Q> call(vec<L, int16, Q> const& Min, vec<L, int16, Q> const& Max, engine& Engine)
 		{
-			return (vec<L, int16, Q>(compute_rand<L, uint16, Q>::call() % vec<L, uint16, Q>(Max + static_cast<int16>(1) - Min))) + Min;
+			return compute_linearRand_integer<L, int16, uint16, Q>::call(Min, Max, Engine);
 		}
 	};
 
 	template<length_t L, qualifier Q>
 	struct compute_linearRand<L, uint16, Q>
 	{
-		GLM_FUNC_QUALIFIER static vec<L, uint16, Q> call(vec<L, uint16, Q> const& Min, vec<L, uint16, Q> const& Max)
+		template<typename engine>
+		GLM_FUNC_QUALIFIER static vec<L, uint16, Q> call(vec<L, uint16, Q> const& Min, vec<L, uint16, Q> const& Max, engine& Engine)
 		{
-			return (compute_rand<L, uint16, Q>::call() % (Max + static_cast<uint16>(1) - Min)) + Min;
+			return compute_linearRand_integer<L, uint16, uint16, Q>::call(Min, Max, Engine);
 		}
 	};
 
 	template<length_t L, qualifier Q>
 	struct compute_linearRand<L, int32, Q>
 	{
-		GLM_FUNC_QUALIFIER static vec<L, int32, Q> call(vec<L, int32, Q> const& Min, vec<L, int32, Q> const& Max)
+		template<typename engine>
+		GLM_FUNC_QUALIFIER static vec<L, int32, Q> call(vec<L, int32, Q> const& Min, vec<L, int32, Q> const& Max, engine& Engine)
 		{
-			return (vec<L, int32, Q>(compute_rand<L, uint32, Q>::call() % vec<L, uint32, Q>(Max + static_cast<int32>(1) - Min))) + Min;
+			return compute_linearRand_integer<L, int32, uint32, Q>::call(Min, Max, Engine);
 		}
 	};
 
 	template<length_t L, qualifier Q>
 	struct compute_linearRand<L, uint32, Q>
 	{
-		GLM_FUNC_QUALIFIER static vec<L, uint32, Q> call(vec<L, uint32, Q> const& Min, vec<L, uint32, Q> const& Max)
+		template<typename engine>
+		GLM_FUNC_QUALIFIER static vec<L, uint32, Q> call(vec<L, uint32, Q> const& Min, vec<L, uint32, Q> const& Max, engine& Engine)
 		{
-			return (compute_rand<L, uint32, Q>::call() % (Max + static_cast<uint32>(1) - Min)) + Min;
+			return compute_linearRand_integer<L, uint32, uint32, Q>::call(Min, Max, Engine);
 		}
 	};
 
 	template<length_t L, qualifier Q>
 	struct compute_linearRand<L, int64, Q>
 	{
-		GLM_FUNC_QUALIFIER static vec<L, int64, Q> call(vec<L, int64, Q> const& Min, vec<L, int64, Q> const& Max)
+		template<typename engine>
+		GLM_FUNC_QUALIFIER static vec<L, int64, Q> call(vec<L, int64, Q> const& Min, vec<L, int64, Q> const& Max, engine& Engine)
 		{
-			return (vec<L, int64, Q>(compute_rand<L, uint64, Q>::call() % vec<L, uint64, Q>(Max + static_cast<int64>(1) - Min))) + Min;
+			return compute_linearRand_integer<L, int64, uint64, Q>::call(Min, Max, Engine);
 		}
 	};
 
 	template<length_t L, qualifier Q>
 	struct compute_linearRand<L, uint64, Q>
 	{
-		GLM_FUNC_QUALIFIER static vec<L, uint64, Q> call(vec<L, uint64, Q> const& Min, vec<L, uint64, Q> const& Max)
+		template<typename engine>
+		GLM_FUNC_QUALIFIER static vec<L, uint64, Q> call(vec<L, uint64, Q> const& Min, vec<L, uint64, Q> const& Max, engine& Engine)
 		{
-			return (compute_rand<L, uint64, Q>::call() % (Max + static_cast<uint64>(1) - Min)) + Min;
+			return compute_linearRand_integer<L, uint64, uint64, Q>::call(Min, Max, Engine);
 		}
 	};
 
 	template<length_t L, qualifier Q>
 	struct compute_linearRand<L, float, Q>
 	{
-		GLM_FUNC_QUALIFIER static vec<L, float, Q> call(vec<L, float, Q> const& Min, vec<L, float, Q> const& Max)
+		template<typename engine>
+		GLM_FUNC_QUALIFIER static vec<L, float, Q> call(vec<L, float, Q> const& Min, vec<L, float, Q> const& Max, engine& Engine)
 		{
-			return vec<L, float, Q>(compute_rand<L, uint32, Q>::call()) / static_cast<float>(std::numeric_limits<uint32>::max()) * (Max - Min) + Min;
+			return vec<L, float, Q>(compute_rand<L, uint32, Q>::call(Engine)) / static_cast<float>(std::numeric_limits<uint32>::max()) * (Max - Min) + Min;
 		}
 	};
 
 	template<length_t L, qualifier Q>
 	struct compute_linearRand<L, double, Q>
 	{
-		GLM_FUNC_QUALIFIER static vec<L, double, Q> call(vec<L, double, Q> const& Min, vec<L, double, Q> const& Max)
+		template<typename engine>
+		GLM_FUNC_QUALIFIER static vec<L, double, Q> call(vec<L, double, Q> const& Min, vec<L, double, Q> const& Max, engine& Engine)
 		{
-			return vec<L, double, Q>(compute_rand<L, uint64, Q>::call()) / static_cast<double>(std::numeric_limits<uint64>::max()) * (Max - Min) + Min;
+			return vec<L, double, Q>(compute_rand<L, uint64, Q>::call(Engine)) / static_cast<double>(std::numeric_limits<uint64>::max()) * (Max - Min) + Min;
 		}
 	};
 
 	template<length_t L, qualifier Q>
 	struct compute_linearRand<L, long double, Q>
 	{
-		GLM_FUNC_QUALIFIER static vec<L, long double, Q> call(vec<L, long double, Q> const& Min, vec<L, long double, Q> const& Max)
+		template<typename engine>
+		GLM_FUNC_QUALIFIER static vec<L, long double, Q> call(vec<L, long double, Q> const& Min, vec<L, long double, Q> const& Max, engine& Engine)
+		{
+			return vec<L, long double, Q>(compute_rand<L, uint64, Q>::call(Engine)) / static_cast<long double>(std::numeric_limits<uint64>::max()) * (Max - Min) + Min;
+		}
+	};
+
+	// Uniform in [0, 1) from the 24 high bits of a draw for float and 53 bits of two draws otherwise
+	template<typename T>
+	struct compute_random_unit
+	{
+		template<typename engine>
+		GLM_FUNC_QUALIFIER static T call(engine& Engine)
 		{
-			return vec<L, long double, Q>(compute_rand<L, uint64, Q>::call()) / static_cast<long double>(std::numeric_limits<uint64>::max()) * (Max - Min) + Min;
+			uint32 const a = random_bits(Engine) >> 5;
+			uint32 const b = random_bits(Engine) >> 6;
+			return static_cast<T>((static_cast<double>(a) * 67108864.0 + static_cast<double>(b)) * (1.0 / 9007199254740992.0));
+		}
+	};
+
+	template<>
+	struct compute_random_unit<float>
+	{
+		template<typename engine>
+		GLM_FUNC_QUALIFIER static float call(engine& Engine)
+		{
+			return static_cast<float>(random_bits(Engine) >> 8) * (1.0f / 16777216.0f);
+		}
+	};
+
+	template<typename T, bool UseSimd>
+	struct compute_random_array
+	{
+		template<typename engine>
+		GLM_FUNC_QUALIFIER static void linearRand(T Min, T Max, T* Out, std::size_t Count, engine& Engine)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = compute_random_unit<T>::call(Engine) * (Max - Min) + Min;
+		}
+
+		// Box-Muller transform, each pair of uniforms gives two values
+		template<typename engine>
+		GLM_FUNC_QUALIFIER static void gaussRand(T Mean, T Deviation, T* Out, std::size_t Count, engine& Engine)
+		{
+			for(std::size_t i = 0; i < Count; i += 2)
+			{
+				T const u = static_cast<T>(1) - compute_random_unit<T>::call(Engine);
+				T const v = compute_random_unit<T>::call(Engine);
+				T const Radius = Deviation * Deviation * sqrt(static_cast<T>(-2) * log(u));
+				T const Angle = static_cast<T>(6.283185307179586476925286766559) * v;
+
+				Out[i] = Radius * cos(Angle) + Mean;
+				if(i + 1 < Count)
+					Out[i + 1] = Radius * sin(Angle) + Mean;
+			}
+		}
+
+		template<qualifier Q, typename engine>
+		GLM_FUNC_QUALIFIER static void sphericalRand(T Radius, vec<3, T, Q>* Out, std::size_t Count, engine& Engine)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				T const z = compute_random_unit<T>::call(Engine) * static_cast<T>(2) - static_cast<T>(1);
+				T const Angle = static_cast<T>(6.283185307179586476925286766559) * compute_random_unit<T>::call(Engine);
+				T const r = sqrt(max(static_cast<T>(1) - z * z, static_cast<T>(0)));
+
+				Out[i] = vec<3, T, Q>(r * cos(Angle), r * sin(Angle), z) * Radius;
+			}
+		}
+
+		template<qualifier Q, typename engine>
+		GLM_FUNC_QUALIFIER static void diskRand(T Radius, vec<2, T, Q>* Out, std::size_t Count, engine& Engine)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				T const r = Radius * sqrt(compute_random_unit<T>::call(Engine));
+				T const Angle = static_cast<T>(6.283185307179586476925286766559) * compute_random_unit<T>::call(Engine);
+
+				Out[i] = vec<2, T, Q>(cos(Angle), sin(Angle)) * r;
+			}
+		}
+
+		// Point on the sphere scaled by the cube root of a uniform so that the density is constant within the volume
+		template<qualifier Q, typename engine>
+		GLM_FUNC_QUALIFIER static void ballRand(T Radius, vec<3, T, Q>* Out, std::size_t Count, engine& Engine)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				T const z = compute_random_unit<T>::call(Engine) * static_cast<T>(2) - static_cast<T>(1);
+				T const Angle = static_cast<T>(6.283185307179586476925286766559) * compute_random_unit<T>::call(Engine);
+				T const r = sqrt(max(static_cast<T>(1) - z * z, static_cast<T>(0)));
+				T const Scale = Radius * pow(static_cast<T>(1) - compute_random_unit<T>::call(Engine), static_cast<T>(1) / static_cast<T>(3));
+
+				Out[i] = vec<3, T, Q>(r * cos(Angle), r * sin(Angle), z) * Scale;
+			}
 		}
 	};
 }//namespace detail
+}//namespace glm
 
-	template<typename genType>
-	GLM_FUNC_QUALIFIER genType linearRand(genType Min, genType Max)
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "random_simd.inl"
+#endif
+
+namespace glm
+{
+	GLM_FUNC_QUALIFIER xoshiro128::xoshiro128(uint64 Seed)
+	{
+		detail::xoshiro128_seed(state, Seed);
+	}
+
+	GLM_FUNC_QUALIFIER void xoshiro128::seed(uint64 Seed)
+	{
+		detail::xoshiro128_seed(state, Seed);
+	}
+
+	GLM_FUNC_QUALIFIER void xoshiro128::jump()
+	{
+		uint32 const Jump[4] = {0x8764000bu, 0xf542d2d3u, 0x6fa035c3u, 0x77f2db5bu};
+
+		uint32 Result[4] = {0, 0, 0, 0};
+		for(int i = 0; i < 4; ++i)
+		for(int b = 0; b < 32; ++b)
+		{
+			if(Jump[i] & (1u << b))
+			{
+				Result[0] ^= state[0];
+				Result[1] ^= state[1];
+				Result[2] ^= state[2];
+				Result[3] ^= state[3];
+			}
+			detail::xoshiro128_next(state);
+		}
+
+		state[0] = Result[0];
+		state[1] = Result[1];
+		state[2] = Result[2];
+		state[3] = Result[3];
+	}
+
+	GLM_FUNC_QUALIFIER uint32 xoshiro128::operator()()
+	{
+		return detail::xoshiro128_next(state);
+	}
+
+	GLM_FUNC_QUALIFIER void thread_random_engine::seed(uint64 Seed)
+	{
+		detail::xoshiro128_seed(detail::thread_random_state(), Seed);
+	}
+
+	GLM_FUNC_QUALIFIER uint32 thread_random_engine::operator()()
+	{
+		return detail::xoshiro128_next(detail::thread_random_state());
+	}
+
+	template<typename genType, typename engine>
+	GLM_FUNC_QUALIFIER genType linearRand(genType Min, genType Max, engine& Engine)
 	{
 		return detail::compute_linearRand<1, genType, highp>::call(
 			vec<1, genType, highp>(Min),
-			vec<1, genType, highp>(Max)).x;
+			vec<1, genType, highp>(Max), Engine).x;
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER genType linearRand(genType Min, genType Max)
+	{
+		thread_random_engine Engine;
+		return linearRand(Min, Max, Engine);
+	}
+
+	template<length_t L, typename T, qualifier Q, typename engine>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> linearRand(vec<L, T, Q> const& Min, vec<L, T, Q> const& Max, engine& Engine)
+	{
+		return detail::compute_linearRand<L, T, Q>::call(Min, Max, Engine);
 	}
 
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> linearRand(vec<L, T, Q> const& Min, vec<L, T, Q> const& Max)
 	{
-		return detail::compute_linearRand<L, T, Q>::call(Min, Max);
+		thread_random_engine Engine;
+		return detail::compute_linearRand<L, T, Q>::call(Min, Max, Engine);
 	}
 
-	template<typename genType>
-	GLM_FUNC_QUALIFIER genType gaussRand(genType Mean, genType Deviation)
+	template<typename genType, typename engine>
+	GLM_FUNC_QUALIFIER genType gaussRand(genType Mean, genType Deviation, engine& Engine)
 	{
 		genType w, x1, x2;
 
 		do
 		{
-			x1 = linearRand(genType(-1), genType(1));
-			x2 = linearRand(genType(-1), genType(1));
+			x1 = linearRand(genType(-1), genType(1), Engine);
+			x2 = linearRand(genType(-1), genType(1), Engine);
 
 			w = x1 * x1 + x2 * x2;
 		} while(w > genType(1));
@@ -231,14 +430,31 @@ namespace detail
 		return static_cast<genType>(x2 * Deviation * Deviation * sqrt((genType(-2) * log(w)) / w) + Mean);
 	}
 
+	template<typename genType>
+	GLM_FUNC_QUALIFIER genType gaussRand(genType Mean, genType Deviation)
+	{
+		thread_random_engine Engine;
+		return gaussRand(Mean, Deviation, Engine);
+	}
+
+	template<length_t L, typename T, qualifier Q, typename engine>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> gaussRand(vec<L, T, Q> const& Mean, vec<L, T, Q> const& Deviation, engine& Engine)
+	{
+		vec<L, T, Q> Result;
+		for(length_t i = 0; i < L; ++i)
+			Result[i] = gaussRand(Mean[i], Deviation[i], Engine);
+		return Result;
+	}
+
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> gaussRand(vec<L, T, Q> const& Mean, vec<L, T, Q> const& Deviation)
 	{
-		return detail::functor2<vec, L, T, Q>::call(gaussRand, Mean, Deviation);
+		thread_random_engine Engine;
+		return gaussRand(Mean, Deviation, Engine);
 	}
 
-	template<typename T>
-	GLM_FUNC_QUALIFIER vec<2, T, defaultp> diskRand(T Radius)
+	template<typename T, typename engine>
+	GLM_FUNC_QUALIFIER vec<2, T, defaultp> diskRand(T Radius, engine& Engine)
 	{
 		assert(Radius > static_cast<T>(0));
 
@@ -249,7 +465,7 @@ namespace detail
 		{
 			Result = linearRand(
 				vec<2, T, defaultp>(-Radius),
-				vec<2, T, defaultp>(Radius));
+				vec<2, T, defaultp>(Radius), Engine);
 			LenRadius = length(Result);
 		}
 		while(LenRadius > Radius);
@@ -258,7 +474,14 @@ namespace detail
 	}
 
 	template<typename T>
-	GLM_FUNC_QUALIFIER vec<3, T, defaultp> ballRand(T Radius)
+	GLM_FUNC_QUALIFIER vec<2, T, defaultp> diskRand(T Radius)
+	{
+		thread_random_engine Engine;
+		return diskRand(Radius, Engine);
+	}
+
+	template<typename T, typename engine>
+	GLM_FUNC_QUALIFIER vec<3, T, defaultp> ballRand(T Radius, engine& Engine)
 	{
 		assert(Radius > static_cast<T>(0));
 
@@ -269,7 +492,7 @@ namespace detail
 		{
 			Result = linearRand(
 				vec<3, T, defaultp>(-Radius),
-				vec<3, T, defaultp>(Radius));
+				vec<3, T, defaultp>(Radius), Engine);
 			LenRadius = length(Result);
 		}
 		while(LenRadius > Radius);
@@ -278,21 +501,35 @@ namespace detail
 	}
 
 	template<typename T>
-	GLM_FUNC_QUALIFIER vec<2, T, defaultp> circularRand(T Radius)
+	GLM_FUNC_QUALIFIER vec<3, T, defaultp> ballRand(T Radius)
+	{
+		thread_random_engine Engine;
+		return ballRand(Radius, Engine);
+	}
+
+	template<typename T, typename engine>
+	GLM_FUNC_QUALIFIER vec<2, T, defaultp> circularRand(T Radius, engine& Engine)
 	{
 		assert(Radius > static_cast<T>(0));
 
-		T a = linearRand(T(0), static_cast<T>(6.283185307179586476925286766559));
+		T a = linearRand(T(0), static_cast<T>(6.283185307179586476925286766559), Engine);
 		return vec<2, T, defaultp>(glm::cos(a), glm::sin(a)) * Radius;
 	}
 
 	template<typename T>
-	GLM_FUNC_QUALIFIER vec<3, T, defaultp> sphericalRand(T Radius)
+	GLM_FUNC_QUALIFIER vec<2, T, defaultp> circularRand(T Radius)
+	{
+		thread_random_engine Engine;
+		return circularRand(Radius, Engine);
+	}
+
+	template<typename T, typename engine>
+	GLM_FUNC_QUALIFIER vec<3, T, defaultp> sphericalRand(T Radius, engine& Engine)
 	{
 		assert(Radius > static_cast<T>(0));
 
-		T theta = linearRand(T(0), T(6.283185307179586476925286766559f));
-		T phi = std::acos(linearRand(T(-1.0f), T(1.0f)));
+		T theta = linearRand(T(0), T(6.283185307179586476925286766559f), Engine);
+		T phi = std::acos(linearRand(T(-1.0f), T(1.0f), Engine));
 
 		T x = std::sin(phi) * std::cos(theta);
 		T y = std::sin(phi) * std::sin(theta);
@@ -300,4 +537,76 @@ namespace detail
 
 		return vec<3, T, defaultp>(x, y, z) * Radius;
 	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER vec<3, T, defaultp> sphericalRand(T Radius)
+	{
+		thread_random_engine Engine;
+		return sphericalRand(Radius, Engine);
+	}
+
+	template<typename T, typename engine>
+	GLM_FUNC_QUALIFIER void linearRand(T Min, T Max, T* Out, std::size_t Count, engine& Engine)
+	{
+		detail::compute_random_array<T, GLM_CONFIG_SIMD == GLM_ENABLE>::linearRand(Min, Max, Out, Count, Engine);
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER void linearRand(T Min, T Max, T* Out, std::size_t Count)
+	{
+		thread_random_engine Engine;
+		linearRand(Min, Max, Out, Count, Engine);
+	}
+
+	template<typename T, typename engine>
+	GLM_FUNC_QUALIFIER void gaussRand(T Mean, T Deviation, T* Out, std::size_t Count, engine& Engine)
+	{
+		detail::compute_random_array<T, GLM_CONFIG_SIMD == GLM_ENABLE>::gaussRand(Mean, Deviation, Out, Count, Engine);
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER void gaussRand(T Mean, T Deviation, T* Out, std::size_t Count)
+	{
+		thread_random_engine Engine;
+		gaussRand(Mean, Deviation, Out, Count, Engine);
+	}
+
+	template<typename T, qualifier Q, typename engine>
+	GLM_FUNC_QUALIFIER void sphericalRand(T Radius, vec<3, T, Q>* Out, std::size_t Count, engine& Engine)
+	{
+		detail::compute_random_array<T, GLM_CONFIG_SIMD == GLM_ENABLE>::sphericalRand(Radius, Out, Count, Engine);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void sphericalRand(T Radius, vec<3, T, Q>* Out, std::size_t Count)
+	{
+		thread_random_engine Engine;
+		sphericalRand(Radius, Out, Count, Engine);
+	}
+
+	template<typename T, qualifier Q, typename engine>
+	GLM_FUNC_QUALIFIER void diskRand(T Radius, vec<2, T, Q>* Out, std::size_t Count, engine& Engine)
+	{
+		detail::compute_random_array<T, GLM_CONFIG_SIMD == GLM_ENABLE>::diskRand(Radius, Out, Count, Engine);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void diskRand(T Radius, vec<2, T, Q>* Out, std::size_t Count)
+	{
+		thread_random_engine Engine;
+		diskRand(Radius, Out, Count, Engine);
+	}
+
+	template<typename T, qualifier Q, typename engine>
+	GLM_FUNC_QUALIFIER void ballRand(T Radius, vec<3, T, Q>* Out, std::size_t Count, engine& Engine)
+	{
+		detail::compute_random_array<T, GLM_CONFIG_SIMD == GLM_ENABLE>::ballRand(Radius, Out, Count, Engine);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void ballRand(T Radius, vec<3, T, Q>* Out, std::size_t Count)
+	{
+		thread_random_engine Engine;
+		ballRand(Radius, Out, Count, Engine);
+	}
 }//namespace glm
@@ -0,0 +1,176 @@
+/// @ref gtc_random
+/// @file glm/gtc/random_simd.inl
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#include "../simd/exponential.h"
+#include "../simd/trigonometric.h"
+
+namespace glm{
+namespace detail
+{
+	// Four xoshiro128++ generators, one per lane, seeded from 16 draws of the engine
+	struct xoshiro128x4
+	{
+		template<typename engine>
+		GLM_FUNC_QUALIFIER explicit xoshiro128x4(engine& Engine)
+		{
+			uint32 Seed[4][4];
+			for(int Lane = 0; Lane < 4; ++Lane)
+			{
+				for(int Word = 0; Word < 4; ++Word)
+					Seed[Word][Lane] = random_bits(Engine);
+				if((Seed[0][Lane] | Seed[1][Lane] | Seed[2][Lane] | Seed[3][Lane]) == 0)
+					Seed[0][Lane] = 1;
+			}
+
+			s0 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Seed[0]));
+			s1 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Seed[1]));
+			s2 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Seed[2]));
+			s3 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Seed[3]));
+		}
+
+		GLM_FUNC_QUALIFIER glm_uvec4 next()
+		{
+			glm_uvec4 const sum0 = _mm_add_epi32(s0, s3);
+			glm_uvec4 const rot0 = _mm_or_si128(_mm_slli_epi32(sum0, 7), _mm_srli_epi32(sum0, 25));
+			glm_uvec4 const Result = _mm_add_epi32(rot0, s0);
+			glm_uvec4 const t = _mm_slli_epi32(s1, 9);
+
+			s2 = _mm_xor_si128(s2, s0);
+			s3 = _mm_xor_si128(s3, s1);
+			s1 = _mm_xor_si128(s1, s2);
+			s0 = _mm_xor_si128(s0, s3);
+			s2 = _mm_xor_si128(s2, t);
+			s3 = _mm_or_si128(_mm_slli_epi32(s3, 11), _mm_srli_epi32(s3, 21));
+
+			return Result;
+		}
+
+		// Uniform in [0, 1) from the 24 high bits like compute_random_unit<float>
+		GLM_FUNC_QUALIFIER glm_vec4 unit()
+		{
+			return _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(next(), 8)), _mm_set1_ps(1.0f / 16777216.0f));
+		}
+
+		glm_uvec4 s0, s1, s2, s3;
+	};
+
+	template<>
+	struct compute_random_array<float, true>
+	{
+		template<typename engine>
+		GLM_FUNC_QUALIFIER static void linearRand(float Min, float Max, float* Out, std::size_t Count, engine& Engine)
+		{
+			xoshiro128x4 Lanes(Engine);
+			glm_vec4 const Scale = _mm_set1_ps(Max - Min);
+			glm_vec4 const Offset = _mm_set1_ps(Min);
+
+			std::size_t i = 0;
+			for(; i + 4 <= Count; i += 4)
+				_mm_storeu_ps(Out + i, _mm_add_ps(_mm_mul_ps(Lanes.unit(), Scale), Offset));
+
+			compute_random_array<float, false>::linearRand(Min, Max, Out + i, Count - i, Engine);
+		}
+
+		template<typename engine>
+		GLM_FUNC_QUALIFIER static void gaussRand(float Mean, float Deviation, float* Out, std::size_t Count, engine& Engine)
+		{
+			xoshiro128x4 Lanes(Engine);
+			glm_vec4 const Scale = _mm_set1_ps(Deviation * Deviation);
+			glm_vec4 const Offset = _mm_set1_ps(Mean);
+
+			std::size_t i = 0;
+			for(; i + 8 <= Count; i += 8)
+			{
+				glm_vec4 const u = _mm_sub_ps(_mm_set1_ps(1.0f), Lanes.unit());
+				glm_vec4 const Angle = _mm_mul_ps(Lanes.unit(), _mm_set1_ps(6.283185307179586476925286766559f));
+				glm_vec4 const Radius = _mm_mul_ps(Scale, _mm_sqrt_ps(_mm_mul_ps(_mm_set1_ps(-2.0f), glm_vec4_log(u))));
+
+				_mm_storeu_ps(Out + i, _mm_add_ps(_mm_mul_ps(Radius, glm_vec4_cos(Angle)), Offset));
+				_mm_storeu_ps(Out + i + 4, _mm_add_ps(_mm_mul_ps(Radius, glm_vec4_sin(Angle)), Offset));
+			}
+
+			compute_random_array<float, false>::gaussRand(Mean, Deviation, Out + i, Count - i, Engine);
+		}
+
+		template<qualifier Q, typename engine>
+		GLM_FUNC_QUALIFIER static void sphericalRand(float Radius, vec<3, float, Q>* Out, std::size_t Count, engine& Engine)
+		{
+			xoshiro128x4 Lanes(Engine);
+			glm_vec4 const Scale = _mm_set1_ps(Radius);
+
+			std::size_t i = 0;
+			for(; i + 4 <= Count; i += 4)
+			{
+				glm_vec4 const h = Lanes.unit();
+				glm_vec4 const z = _mm_sub_ps(_mm_add_ps(h, h), _mm_set1_ps(1.0f));
+				glm_vec4 const Angle = _mm_mul_ps(Lanes.unit(), _mm_set1_ps(6.283185307179586476925286766559f));
+				glm_vec4 const r = _mm_mul_ps(Scale, _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(z, z)), _mm_setzero_ps())));
+
+				float x[4], y[4], w[4];
+				_mm_storeu_ps(x, _mm_mul_ps(r, glm_vec4_cos(Angle)));
+				_mm_storeu_ps(y, _mm_mul_ps(r, glm_vec4_sin(Angle)));
+				_mm_storeu_ps(w, _mm_mul_ps(Scale, z));
+				for(std::size_t j = 0; j < 4; ++j)
+					Out[i + j] = vec<3, float, Q>(x[j], y[j], w[j]);
+			}
+
+			compute_random_array<float, false>::sphericalRand(Radius, Out + i, Count - i, Engine);
+		}
+
+		template<qualifier Q, typename engine>
+		GLM_FUNC_QUALIFIER static void diskRand(float Radius, vec<2, float, Q>* Out, std::size_t Count, engine& Engine)
+		{
+			xoshiro128x4 Lanes(Engine);
+			glm_vec4 const Scale = _mm_set1_ps(Radius);
+
+			std::size_t i = 0;
+			for(; i + 4 <= Count; i += 4)
+			{
+				glm_vec4 const r = _mm_mul_ps(Scale, _mm_sqrt_ps(Lanes.unit()));
+				glm_vec4 const Angle = _mm_mul_ps(Lanes.unit(), _mm_set1_ps(6.283185307179586476925286766559f));
+
+				float x[4], y[4];
+				_mm_storeu_ps(x, _mm_mul_ps(r, glm_vec4_cos(Angle)));
+				_mm_storeu_ps(y, _mm_mul_ps(r, glm_vec4_sin(Angle)));
+				for(std::size_t j = 0; j < 4; ++j)
+					Out[i + j] = vec<2, float, Q>(x[j], y[j]);
+			}
+
+			compute_random_array<float, false>::diskRand(Radius, Out + i, Count - i, Engine);
+		}
+
+		// The cube root is exp(log(u) / 3), u in (0, 1], clamped to 1 so that rounding never leaves the ball
+		template<qualifier Q, typename engine>
+		GLM_FUNC_QUALIFIER static void ballRand(float Radius, vec<3, float, Q>* Out, std::size_t Count, engine& Engine)
+		{
+			xoshiro128x4 Lanes(Engine);
+			glm_vec4 const Scale = _mm_set1_ps(Radius);
+
+			std::size_t i = 0;
+			for(; i + 4 <= Count; i += 4)
+			{
+				glm_vec4 const h = Lanes.unit();
+				glm_vec4 const z = _mm_sub_ps(_mm_add_ps(h, h), _mm_set1_ps(1.0f));
+				glm_vec4 const Angle = _mm_mul_ps(Lanes.unit(), _mm_set1_ps(6.283185307179586476925286766559f));
+				glm_vec4 const u = _mm_sub_ps(_mm_set1_ps(1.0f), Lanes.unit());
+				glm_vec4 const Cbrt = _mm_min_ps(glm_vec4_exp(_mm_mul_ps(glm_vec4_log(u), _mm_set1_ps(1.0f / 3.0f))), _mm_set1_ps(1.0f));
+				glm_vec4 const Length = _mm_mul_ps(Scale, Cbrt);
+				glm_vec4 const r = _mm_mul_ps(Length, _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(z, z)), _mm_setzero_ps())));
+
+				float x[4], y[4], w[4];
+				_mm_storeu_ps(x, _mm_mul_ps(r, glm_vec4_cos(Angle)));
+				_mm_storeu_ps(y, _mm_mul_ps(r, glm_vec4_sin(Angle)));
+				_mm_storeu_ps(w, _mm_mul_ps(Length, z));
+				for(std::size_t j = 0; j < 4; ++j)
+					Out[i + j] = vec<3, float, Q>(x[j], y[j], w[j]);
+			}
+
+			compute_random_array<float, false>::ballRand(Radius, Out + i, Count - i, Engine);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
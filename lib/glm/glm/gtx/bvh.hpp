@@ -0,0 +1,134 @@
+/// @ref gtx_bvh
+/// @file glm/gtx/bvh.hpp
+///
+/// @see core (dependence)
+/// @see gtx_intersect (dependence)
+///
+/// @defgroup gtx_bvh GLM_GTX_bvh
+/// @ingroup gtx
+///
+/// Include <glm/gtx/bvh.hpp> to use the features of this extension.
+///
+/// Bounding volume hierarchy over triangle meshes to accelerate ray casts and overlap queries.
+///
+/// The hierarchy is built top down with a binned surface area heuristic (SAH). When the C++11 standard
+/// library is available, the subtrees of the first levels are built by several threads.
+/// Nodes are stored depth first in a single array: the left child of an inner node follows it and
+/// the right child is at Offset. The triangles are copied in leaf order so that a leaf reads
+/// contiguous vertices.
+///
+/// A built tbvh is read only, it may be queried by several threads at once.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../ext/scalar_uint_sized.hpp"
+#include "intersect.hpp"
+#include <cstddef>
+#include <vector>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_bvh is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	else
+#		pragma message("GLM: GLM_GTX_bvh extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_bvh
+	/// @{
+
+	/// Bounding volume hierarchy of a triangle mesh.
+	///
+	/// @tparam T Floating-point scalar type
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q = defaultp>
+	struct tbvh
+	{
+		/// 32 bytes node with float values: a leaf when Count is not 0.
+		struct node
+		{
+			vec<3, T, Q> Min;
+			/// Right child of an inner node or first triangle of a leaf.
+			uint32 Offset;
+			vec<3, T, Q> Max;
+			/// Number of triangles of a leaf, 0 for an inner node.
+			uint32 Count;
+		};
+
+		/// Nodes in depth first order, the root is the first node.
+		std::vector<node> Nodes;
+
+		/// Triangle vertices in leaf order, 3 per triangle.
+		std::vector<vec<3, T, Q> > Vertices;
+
+		/// Index of the triangles in the mesh given to buildBVH, in leaf order.
+		std::vector<uint32> Triangles;
+	};
+
+	/// Build the hierarchy of a triangle mesh, replacing the content of Bvh.
+	///
+	/// @param Bvh Hierarchy to build.
+	/// @param Positions Array of vertex positions.
+	/// @param Indices Array of TriangleCount * 3 vertex indices or a null pointer when Positions holds TriangleCount * 3 vertices.
+	/// @param TriangleCount Number of triangles.
+	/// @param ThreadCount Maximum number of threads building the hierarchy, 0 to use the number of hardware threads.
+	///
+	/// @see gtx_bvh
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void buildBVH(tbvh<T, Q>& Bvh,
+		vec<3, T, Q> const* Positions, uint32 const* Indices, std::size_t TriangleCount,
+		unsigned ThreadCount = 1);
+
+	/// Find the closest triangle intersected by a ray at a distance in [tMin, tMax].
+	///
+	/// @param Triangle Index of the intersected triangle in the mesh given to buildBVH.
+	/// @param baryPosition Barycentric coordinates of the intersection, as computed by intersectRayTriangle.
+	/// @param distance Distance of the intersection in units of dir.
+	/// @return true when a triangle is intersected, the output parameters are left unchanged otherwise.
+	///
+	/// @see gtx_bvh
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool intersectRayBVH(tbvh<T, Q> const& Bvh,
+		vec<3, T, Q> const& orig, vec<3, T, Q> const& dir, T tMin, T tMax,
+		uint32& Triangle, vec<2, T, Q>& baryPosition, T& distance);
+
+	/// Returns true when a ray intersects any triangle at a distance in [tMin, tMax], such as for shadow rays.
+	/// The traversal stops at the first intersection found.
+	///
+	/// @see gtx_bvh
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool intersectRayBVHAny(tbvh<T, Q> const& Bvh,
+		vec<3, T, Q> const& orig, vec<3, T, Q> const& dir, T tMin, T tMax);
+
+	/// Append the index of the triangles overlapping an axis aligned box to Triangles.
+	/// Triangles are tested exactly with the separating axis theorem.
+	///
+	/// @return The number of triangles appended.
+	///
+	/// @see gtx_bvh
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL std::size_t overlapBVHAABB(tbvh<T, Q> const& Bvh,
+		vec<3, T, Q> const& aabbMin, vec<3, T, Q> const& aabbMax,
+		std::vector<uint32>& Triangles);
+
+	/// Append the index of the triangles overlapping a sphere to Triangles.
+	///
+	/// @return The number of triangles appended.
+	///
+	/// @see gtx_bvh
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL std::size_t overlapBVHSphere(tbvh<T, Q> const& Bvh,
+		vec<3, T, Q> const& center, T radius,
+		std::vector<uint32>& Triangles);
+
+	typedef tbvh<float, defaultp> bvh;
+	typedef tbvh<double, defaultp> dbvh;
+
+	/// @}
+}//namespace glm
+
+#include "bvh.inl"
@@ -0,0 +1,568 @@
+/// @ref gtx_bvh
+
+#include <algorithm>
+#include <limits>
+#if GLM_HAS_CXX11_STL
+#	include <thread>
+#	include <functional>
+#endif
+
+namespace glm{
+namespace detail
+{
+	// Size of the traversal stacks, the build doesn't split nodes deeper than this
+	static length_t const bvh_max_depth = 64;
+	static int const bvh_bin_count = 16;
+	static std::size_t const bvh_max_leaf_size = 8;
+	// Smaller subtrees are built by the thread of their parent
+	static std::size_t const bvh_min_thread_size = 4096;
+
+	template<typename T, qualifier Q>
+	struct bvh_builder
+	{
+		std::vector<vec<3, T, Q> > Min;
+		std::vector<vec<3, T, Q> > Max;
+		std::vector<vec<3, T, Q> > Centroid;
+		std::vector<uint32> Indices;
+	};
+
+	template<typename T, qualifier Q>
+	struct bvh_bin
+	{
+		vec<3, T, Q> Min;
+		vec<3, T, Q> Max;
+		std::size_t Count;
+	};
+
+	template<typename T>
+	struct bvh_stack_entry
+	{
+		uint32 Index;
+		T Distance;
+	};
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER T bvh_area(vec<3, T, Q> const& Min, vec<3, T, Q> const& Max)
+	{
+		vec<3, T, Q> const Size = Max - Min;
+		return Size.x * Size.y + Size.y * Size.z + Size.z * Size.x;
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER int bvh_bin_index(T Centroid, T CentroidMin, T Scale)
+	{
+		return glm::min(static_cast<int>((Centroid - CentroidMin) * Scale), bvh_bin_count - 1);
+	}
+
+	template<typename T, qualifier Q>
+	struct bvh_in_left_bins
+	{
+		vec<3, T, Q> const* Centroid;
+		length_t Axis;
+		T CentroidMin;
+		T Scale;
+		int Bin;
+
+		bool operator()(uint32 Index) const
+		{
+			return bvh_bin_index(Centroid[Index][Axis], CentroidMin, Scale) <= Bin;
+		}
+	};
+
+	// Binned SAH split of the triangles [Begin, End), returns the first triangle of the right child or End for a leaf
+	template<typename T, qualifier Q>
+	inline std::size_t bvh_partition(bvh_builder<T, Q>& Builder, std::size_t Begin, std::size_t End,
+		vec<3, T, Q> const& Min, vec<3, T, Q> const& Max, vec<3, T, Q> const& CentroidMin, vec<3, T, Q> const& CentroidMax)
+	{
+		std::size_t const Count = End - Begin;
+		if(Count <= 2)
+			return End;
+
+		T BestCost = std::numeric_limits<T>::max();
+		int BestAxis = -1;
+		int BestBin = 0;
+
+		for(length_t Axis = 0; Axis < 3; ++Axis)
+		{
+			T const Extent = CentroidMax[Axis] - CentroidMin[Axis];
+			if(Extent <= static_cast<T>(0))
+				continue;
+			T const Scale = static_cast<T>(bvh_bin_count) / Extent;
+
+			bvh_bin<T, Q> Bins[bvh_bin_count];
+			for(int b = 0; b < bvh_bin_count; ++b)
+			{
+				Bins[b].Min = vec<3, T, Q>(std::numeric_limits<T>::max());
+				Bins[b].Max = vec<3, T, Q>(-std::numeric_limits<T>::max());
+				Bins[b].Count = 0;
+			}
+
+			for(std::size_t i = Begin; i < End; ++i)
+			{
+				uint32 const Index = Builder.Indices[i];
+				bvh_bin<T, Q>& Bin = Bins[bvh_bin_index(Builder.Centroid[Index][Axis], CentroidMin[Axis], Scale)];
+				Bin.Min = glm::min(Bin.Min, Builder.Min[Index]);
+				Bin.Max = glm::max(Bin.Max, Builder.Max[Index]);
+				++Bin.Count;
+			}
+
+			// Area and count of the right side of each split plane, the plane b is after the bin b
+			T RightArea[bvh_bin_count - 1];
+			std::size_t RightCount[bvh_bin_count - 1];
+			bvh_bin<T, Q> Right = Bins[bvh_bin_count - 1];
+			for(int b = bvh_bin_count - 2; b >= 0; --b)
+			{
+				RightArea[b] = bvh_area(Right.Min, Right.Max);
+				RightCount[b] = Right.Count;
+				Right.Min = glm::min(Right.Min, Bins[b].Min);
+				Right.Max = glm::max(Right.Max, Bins[b].Max);
+				Right.Count += Bins[b].Count;
+			}
+
+			bvh_bin<T, Q> Left = Bins[0];
+			for(int b = 0; b < bvh_bin_count - 1; ++b)
+			{
+				if(b > 0)
+				{
+					Left.Min = glm::min(Left.Min, Bins[b].Min);
+					Left.Max = glm::max(Left.Max, Bins[b].Max);
+					Left.Count += Bins[b].Count;
+				}
+				if(Left.Count == 0 || RightCount[b] == 0)
+					continue;
+
+				T const Cost = static_cast<T>(Left.Count) * bvh_area(Left.Min, Left.Max) + static_cast<T>(RightCount[b]) * RightArea[b];
+				if(Cost < BestCost)
+				{
+					BestCost = Cost;
+					BestAxis = static_cast<int>(Axis);
+					BestBin = b;
+				}
+			}
+		}
+
+		// All the centroids are at the same position, SAH can't separate the triangles
+		if(BestAxis < 0)
+			return Count <= bvh_max_leaf_size ? End : Begin + Count / 2;
+
+		// With a traversal cost equal to a triangle test, a leaf costs Count * Area
+		T const Area = bvh_area(Min, Max);
+		if(Area + BestCost >= static_cast<T>(Count) * Area && Count <= bvh_max_leaf_size)
+			return End;
+
+		bvh_in_left_bins<T, Q> Predicate;
+		Predicate.Centroid = &Builder.Centroid[0];
+		Predicate.Axis = static_cast<length_t>(BestAxis);
+		Predicate.CentroidMin = CentroidMin[BestAxis];
+		Predicate.Scale = static_cast<T>(bvh_bin_count) / (CentroidMax[BestAxis] - CentroidMin[BestAxis]);
+		Predicate.Bin = BestBin;
+
+		std::vector<uint32>::iterator const First = Builder.Indices.begin();
+		return static_cast<std::size_t>(std::partition(First + static_cast<std::ptrdiff_t>(Begin), First + static_cast<std::ptrdiff_t>(End), Predicate) - First);
+	}
+
+	// Append the subtree of the triangles [Begin, End) to Nodes in depth first order.
+	// The Offset of inner nodes is relative to the node so that subtrees built by other threads are appended as is
+	template<typename T, qualifier Q>
+	inline void bvh_build(bvh_builder<T, Q>& Builder, std::size_t Begin, std::size_t End, length_t Depth, length_t ThreadDepth,
+		std::vector<typename tbvh<T, Q>::node>& Nodes)
+	{
+		typedef typename tbvh<T, Q>::node node;
+
+		vec<3, T, Q> Min(std::numeric_limits<T>::max());
+		vec<3, T, Q> Max(-std::numeric_limits<T>::max());
+		vec<3, T, Q> CentroidMin(std::numeric_limits<T>::max());
+		vec<3, T, Q> CentroidMax(-std::numeric_limits<T>::max());
+		for(std::size_t i = Begin; i < End; ++i)
+		{
+			uint32 const Index = Builder.Indices[i];
+			Min = glm::min(Min, Builder.Min[Index]);
+			Max = glm::max(Max, Builder.Max[Index]);
+			CentroidMin = glm::min(CentroidMin, Builder.Centroid[Index]);
+			CentroidMax = glm::max(CentroidMax, Builder.Centroid[Index]);
+		}
+
+		std::size_t const NodeIndex = Nodes.size();
+		node Node;
+		Node.Min = Min;
+		Node.Max = Max;
+		Node.Offset = static_cast<uint32>(Begin);
+		Node.Count = static_cast<uint32>(End - Begin);
+		Nodes.push_back(Node);
+
+		std::size_t const Middle = Depth + 1 < bvh_max_depth ? bvh_partition(Builder, Begin, End, Min, Max, CentroidMin, CentroidMax) : End;
+		if(Middle == End)
+			return;
+		Nodes[NodeIndex].Count = 0;
+
+#		if GLM_HAS_CXX11_STL
+			// The threads partition disjoint ranges of Builder.Indices
+			if(ThreadDepth > 0 && End - Begin >= bvh_min_thread_size)
+			{
+				std::vector<node> Right;
+				std::thread Thread(bvh_build<T, Q>, std::ref(Builder), Middle, End, Depth + 1, ThreadDepth - 1, std::ref(Right));
+				bvh_build(Builder, Begin, Middle, Depth + 1, ThreadDepth - 1, Nodes);
+				Thread.join();
+
+				Nodes[NodeIndex].Offset = static_cast<uint32>(Nodes.size() - NodeIndex);
+				Nodes.insert(Nodes.end(), Right.begin(), Right.end());
+				return;
+			}
+#		endif
+
+		bvh_build(Builder, Begin, Middle, Depth + 1, ThreadDepth > 0 ? ThreadDepth - 1 : 0, Nodes);
+		Nodes[NodeIndex].Offset = static_cast<uint32>(Nodes.size() - NodeIndex);
+		bvh_build(Builder, Middle, End, Depth + 1, ThreadDepth > 0 ? ThreadDepth - 1 : 0, Nodes);
+	}
+
+	// Offsets of inner nodes are made absolute once the whole tree is built
+	template<typename T, qualifier Q>
+	inline void bvh_relocate(std::vector<typename tbvh<T, Q>::node>& Nodes)
+	{
+		for(std::size_t i = 0; i < Nodes.size(); ++i)
+			if(Nodes[i].Count == 0)
+				Nodes[i].Offset += static_cast<uint32>(i);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<3, T, Q> const& bvh_vertex(vec<3, T, Q> const* Positions, uint32 const* Indices, std::size_t Triangle, std::size_t Corner)
+	{
+		std::size_t const Index = Triangle * 3 + Corner;
+		return Positions[Indices ? static_cast<std::size_t>(Indices[Index]) : Index];
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool bvh_overlap_aabbs(vec<3, T, Q> const& MinA, vec<3, T, Q> const& MaxA, vec<3, T, Q> const& MinB, vec<3, T, Q> const& MaxB)
+	{
+		return all(lessThanEqual(MinA, MaxB)) && all(lessThanEqual(MinB, MaxA));
+	}
+
+	// Separating axis test of Tomas Akenine-Moller, the box axes, the triangle normal and the 9 edge cross products
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool bvh_overlap_triangle_aabb(vec<3, T, Q> const* Triangle, vec<3, T, Q> const& Center, vec<3, T, Q> const& Extent)
+	{
+		vec<3, T, Q> const v0 = Triangle[0] - Center;
+		vec<3, T, Q> const v1 = Triangle[1] - Center;
+		vec<3, T, Q> const v2 = Triangle[2] - Center;
+
+		if(any(greaterThan(glm::min(glm::min(v0, v1), v2), Extent)) || any(lessThan(glm::max(glm::max(v0, v1), v2), -Extent)))
+			return false;
+
+		vec<3, T, Q> const Edges[3] = {v1 - v0, v2 - v1, v0 - v2};
+
+		vec<3, T, Q> const Normal = cross(Edges[0], Edges[1]);
+		if(abs(dot(Normal, v0)) > dot(Extent, abs(Normal)))
+			return false;
+
+		for(length_t e = 0; e < 3; ++e)
+		for(length_t a = 0; a < 3; ++a)
+		{
+			vec<3, T, Q> Unit(static_cast<T>(0));
+			Unit[a] = static_cast<T>(1);
+			vec<3, T, Q> const Axis = cross(Unit, Edges[e]);
+
+			T const p0 = dot(v0, Axis);
+			T const p1 = dot(v1, Axis);
+			T const p2 = dot(v2, Axis);
+			T const Radius = dot(Extent, abs(Axis));
+			if(glm::min(glm::min(p0, p1), p2) > Radius || glm::max(glm::max(p0, p1), p2) < -Radius)
+				return false;
+		}
+
+		return true;
+	}
+
+	// Closest point of a triangle to p by Voronoi regions, from Real-Time Collision Detection by Christer Ericson
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<3, T, Q> bvh_closest_point_triangle(vec<3, T, Q> const& p, vec<3, T, Q> const* Triangle)
+	{
+		vec<3, T, Q> const& a = Triangle[0];
+		vec<3, T, Q> const& b = Triangle[1];
+		vec<3, T, Q> const& c = Triangle[2];
+
+		vec<3, T, Q> const ab = b - a;
+		vec<3, T, Q> const ac = c - a;
+		vec<3, T, Q> const ap = p - a;
+		T const d1 = dot(ab, ap);
+		T const d2 = dot(ac, ap);
+		if(d1 <= static_cast<T>(0) && d2 <= static_cast<T>(0))
+			return a;
+
+		vec<3, T, Q> const bp = p - b;
+		T const d3 = dot(ab, bp);
+		T const d4 = dot(ac, bp);
+		if(d3 >= static_cast<T>(0) && d4 <= d3)
+			return b;
+
+		T const vc = d1 * d4 - d3 * d2;
+		if(vc <= static_cast<T>(0) && d1 >= static_cast<T>(0) && d3 <= static_cast<T>(0))
+			return a + ab * (d1 / (d1 - d3));
+
+		vec<3, T, Q> const cp = p - c;
+		T const d5 = dot(ab, cp);
+		T const d6 = dot(ac, cp);
+		if(d6 >= static_cast<T>(0) && d5 <= d6)
+			return c;
+
+		T const vb = d5 * d2 - d1 * d6;
+		if(vb <= static_cast<T>(0) && d2 >= static_cast<T>(0) && d6 <= static_cast<T>(0))
+			return a + ac * (d2 / (d2 - d6));
+
+		T const va = d3 * d6 - d5 * d4;
+		if(va <= static_cast<T>(0) && (d4 - d3) >= static_cast<T>(0) && (d5 - d6) >= static_cast<T>(0))
+			return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+
+		T const Denom = static_cast<T>(1) / (va + vb + vc);
+		return a + ab * (vb * Denom) + ac * (vc * Denom);
+	}
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void buildBVH(tbvh<T, Q>& Bvh,
+		vec<3, T, Q> const* Positions, uint32 const* Indices, std::size_t TriangleCount,
+		unsigned ThreadCount)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'buildBVH' only accept floating-point inputs");
+
+		Bvh.Nodes.clear();
+		Bvh.Vertices.clear();
+		Bvh.Triangles.clear();
+		if(TriangleCount == 0)
+			return;
+
+		detail::bvh_builder<T, Q> Builder;
+		Builder.Min.resize(TriangleCount);
+		Builder.Max.resize(TriangleCount);
+		Builder.Centroid.resize(TriangleCount);
+		Builder.Indices.resize(TriangleCount);
+		for(std::size_t i = 0; i < TriangleCount; ++i)
+		{
+			vec<3, T, Q> const& v0 = detail::bvh_vertex(Positions, Indices, i, 0);
+			vec<3, T, Q> const& v1 = detail::bvh_vertex(Positions, Indices, i, 1);
+			vec<3, T, Q> const& v2 = detail::bvh_vertex(Positions, Indices, i, 2);
+
+			Builder.Min[i] = glm::min(glm::min(v0, v1), v2);
+			Builder.Max[i] = glm::max(glm::max(v0, v1), v2);
+			Builder.Centroid[i] = (Builder.Min[i] + Builder.Max[i]) * static_cast<T>(0.5);
+			Builder.Indices[i] = static_cast<uint32>(i);
+		}
+
+		length_t ThreadDepth = 0;
+#		if GLM_HAS_CXX11_STL
+			if(ThreadCount == 0)
+				ThreadCount = std::thread::hardware_concurrency();
+			while((1u << ThreadDepth) < ThreadCount)
+				++ThreadDepth;
+#		else
+			static_cast<void>(ThreadCount);
+#		endif
+
+		Bvh.Nodes.reserve(TriangleCount / 2);
+		detail::bvh_build(Builder, 0, TriangleCount, 0, ThreadDepth, Bvh.Nodes);
+		detail::bvh_relocate<T, Q>(Bvh.Nodes);
+
+		Bvh.Triangles.swap(Builder.Indices);
+		Bvh.Vertices.resize(TriangleCount * 3);
+		for(std::size_t i = 0; i < TriangleCount; ++i)
+		for(std::size_t Corner = 0; Corner < 3; ++Corner)
+			Bvh.Vertices[i * 3 + Corner] = detail::bvh_vertex(Positions, Indices, Bvh.Triangles[i], Corner);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool intersectRayBVH(tbvh<T, Q> const& Bvh,
+		vec<3, T, Q> const& orig, vec<3, T, Q> const& dir, T tMin, T tMax,
+		uint32& Triangle, vec<2, T, Q>& baryPosition, T& distance)
+	{
+		typedef typename tbvh<T, Q>::node node;
+
+		vec<3, T, Q> const InvDir = static_cast<T>(1) / dir;
+
+		T Entry;
+		if(Bvh.Nodes.empty() || !intersectRayAABB(orig, InvDir, Bvh.Nodes[0].Min, Bvh.Nodes[0].Max, tMin, tMax, Entry))
+			return false;
+
+		detail::bvh_stack_entry<T> Stack[detail::bvh_max_depth];
+		length_t StackSize = 0;
+
+		bool Hit = false;
+		T Closest = tMax;
+		uint32 Index = 0;
+		for(;;)
+		{
+			node const& Node = Bvh.Nodes[Index];
+			if(Node.Count > 0)
+			{
+				for(uint32 i = Node.Offset, n = Node.Offset + Node.Count; i < n; ++i)
+				{
+					vec<3, T, Q> const* v = &Bvh.Vertices[i * 3];
+					vec<2, T, Q> Bary;
+					T Distance;
+					if(intersectRayTriangle(orig, dir, v[0], v[1], v[2], Bary, Distance) && Distance >= tMin && Distance <= Closest)
+					{
+						Hit = true;
+						Closest = Distance;
+						Triangle = Bvh.Triangles[i];
+						baryPosition = Bary;
+					}
+				}
+			}
+			else
+			{
+				// Visit the nearest child first, the other one is skipped if a closer triangle is found meanwhile
+				uint32 const Left = Index + 1;
+				uint32 const Right = Node.Offset;
+				T LeftEntry, RightEntry;
+				bool const LeftHit = intersectRayAABB(orig, InvDir, Bvh.Nodes[Left].Min, Bvh.Nodes[Left].Max, tMin, Closest, LeftEntry);
+				bool const RightHit = intersectRayAABB(orig, InvDir, Bvh.Nodes[Right].Min, Bvh.Nodes[Right].Max, tMin, Closest, RightEntry);
+
+				if(LeftHit && RightHit)
+				{
+					bool const LeftFirst = LeftEntry <= RightEntry;
+					Stack[StackSize].Index = LeftFirst ? Right : Left;
+					Stack[StackSize].Distance = LeftFirst ? RightEntry : LeftEntry;
+					++StackSize;
+					Index = LeftFirst ? Left : Right;
+					continue;
+				}
+				if(LeftHit || RightHit)
+				{
+					Index = LeftHit ? Left : Right;
+					continue;
+				}
+			}
+
+			while(StackSize > 0 && Stack[StackSize - 1].Distance > Closest)
+				--StackSize;
+			if(StackSize == 0)
+				break;
+			Index = Stack[--StackSize].Index;
+		}
+
+		if(Hit)
+			distance = Closest;
+		return Hit;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool intersectRayBVHAny(tbvh<T, Q> const& Bvh,
+		vec<3, T, Q> const& orig, vec<3, T, Q> const& dir, T tMin, T tMax)
+	{
+		typedef typename tbvh<T, Q>::node node;
+
+		vec<3, T, Q> const InvDir = static_cast<T>(1) / dir;
+
+		uint32 Stack[detail::bvh_max_depth];
+		length_t StackSize = 0;
+		if(!Bvh.Nodes.empty())
+			Stack[StackSize++] = 0;
+
+		while(StackSize > 0)
+		{
+			uint32 const Index = Stack[--StackSize];
+			node const& Node = Bvh.Nodes[Index];
+
+			T Entry;
+			if(!intersectRayAABB(orig, InvDir, Node.Min, Node.Max, tMin, tMax, Entry))
+				continue;
+
+			if(Node.Count == 0)
+			{
+				Stack[StackSize++] = Node.Offset;
+				Stack[StackSize++] = Index + 1;
+				continue;
+			}
+
+			for(uint32 i = Node.Offset, n = Node.Offset + Node.Count; i < n; ++i)
+			{
+				vec<3, T, Q> const* v = &Bvh.Vertices[i * 3];
+				vec<2, T, Q> Bary;
+				T Distance;
+				if(intersectRayTriangle(orig, dir, v[0], v[1], v[2], Bary, Distance) && Distance >= tMin && Distance <= tMax)
+					return true;
+			}
+		}
+
+		return false;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t overlapBVHAABB(tbvh<T, Q> const& Bvh,
+		vec<3, T, Q> const& aabbMin, vec<3, T, Q> const& aabbMax,
+		std::vector<uint32>& Triangles)
+	{
+		typedef typename tbvh<T, Q>::node node;
+
+		vec<3, T, Q> const Center = (aabbMin + aabbMax) * static_cast<T>(0.5);
+		vec<3, T, Q> const Extent = (aabbMax - aabbMin) * static_cast<T>(0.5);
+
+		std::size_t const Size = Triangles.size();
+
+		uint32 Stack[detail::bvh_max_depth];
+		length_t StackSize = 0;
+		if(!Bvh.Nodes.empty())
+			Stack[StackSize++] = 0;
+
+		while(StackSize > 0)
+		{
+			uint32 const Index = Stack[--StackSize];
+			node const& Node = Bvh.Nodes[Index];
+			if(!detail::bvh_overlap_aabbs(Node.Min, Node.Max, aabbMin, aabbMax))
+				continue;
+
+			if(Node.Count == 0)
+			{
+				Stack[StackSize++] = Node.Offset;
+				Stack[StackSize++] = Index + 1;
+				continue;
+			}
+
+			for(uint32 i = Node.Offset, n = Node.Offset + Node.Count; i < n; ++i)
+				if(detail::bvh_overlap_triangle_aabb(&Bvh.Vertices[i * 3], Center, Extent))
+					Triangles.push_back(Bvh.Triangles[i]);
+		}
+
+		return Triangles.size() - Size;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t overlapBVHSphere(tbvh<T, Q> const& Bvh,
+		vec<3, T, Q> const& center, T radius,
+		std::vector<uint32>& Triangles)
+	{
+		typedef typename tbvh<T, Q>::node node;
+
+		T const RadiusSquared = radius * radius;
+
+		std::size_t const Size = Triangles.size();
+
+		uint32 Stack[detail::bvh_max_depth];
+		length_t StackSize = 0;
+		if(!Bvh.Nodes.empty())
+			Stack[StackSize++] = 0;
+
+		while(StackSize > 0)
+		{
+			uint32 const Index = Stack[--StackSize];
+			node const& Node = Bvh.Nodes[Index];
+			vec<3, T, Q> const Outside = center - clamp(center, Node.Min, Node.Max);
+			if(dot(Outside, Outside) > RadiusSquared)
+				continue;
+
+			if(Node.Count == 0)
+			{
+				Stack[StackSize++] = Node.Offset;
+				Stack[StackSize++] = Index + 1;
+				continue;
+			}
+
+			for(uint32 i = Node.Offset, n = Node.Offset + Node.Count; i < n; ++i)
+			{
+				vec<3, T, Q> const Distance = center - detail::bvh_closest_point_triangle(center, &Bvh.Vertices[i * 3]);
+				if(dot(Distance, Distance) <= RadiusSquared)
+					Triangles.push_back(Bvh.Triangles[i]);
+			}
+		}
+
+		return Triangles.size() - Size;
+	}
+}//namespace glm
@@ -20,6 +20,7 @@
 #include "../geometric.hpp"
 #include "../gtx/closest_point.hpp"
 #include "../gtx/vector_query.hpp"
+#include "../ext/vector_soa.hpp"
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
 #	ifndef GLM_ENABLE_EXPERIMENTAL
@@ -86,6 +87,56 @@ namespace glm
 		genType & intersectionPosition1, genType & intersectionNormal1,
 		genType & intersectionPosition2 = genType(), genType & intersectionNormal2 = genType());
 
+	//! Compute the intersection of a ray and W triangles, one per lane.
+	//! Returns a bitmask with bit i set when the ray intersects the triangle of lane i.
+	//! Like intersectRayTriangle, the sign of the distance isn't tested.
+	//! baryPosition and distance are only meaningful for the lanes of the bitmask.
+	//! From GLM_GTX_intersect extension.
+	template<typename T, qualifier Q, length_t W>
+	GLM_FUNC_DECL int intersectRayTriangle(
+		vec<3, T, Q> const& orig, vec<3, T, Q> const& dir,
+		soa_vec<3, T, W> const& vert0, soa_vec<3, T, W> const& vert1, soa_vec<3, T, W> const& vert2,
+		soa_vec<2, T, W>& baryPosition, soa_scalar<T, W>& distance);
+
+	//! Compute the intersection of W rays, one per lane, and a triangle.
+	//! Returns a bitmask with bit i set when the ray of lane i intersects the triangle.
+	//! Like intersectRayTriangle, the sign of the distance isn't tested.
+	//! baryPosition and distance are only meaningful for the lanes of the bitmask.
+	//! From GLM_GTX_intersect extension.
+	template<typename T, qualifier Q, length_t W>
+	GLM_FUNC_DECL int intersectRayTriangle(
+		soa_vec<3, T, W> const& orig, soa_vec<3, T, W> const& dir,
+		vec<3, T, Q> const& vert0, vec<3, T, Q> const& vert1, vec<3, T, Q> const& vert2,
+		soa_vec<2, T, W>& baryPosition, soa_scalar<T, W>& distance);
+
+	//! Compute the intersection of a ray and an axis aligned box with the slab method.
+	//! invDir is the inverse of the ray direction, 1 / dir, computed once per ray.
+	//! Only the part of the ray between tMin and tMax is tested and distance is the entry distance in [tMin, tMax].
+	//! From GLM_GTX_intersect extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool intersectRayAABB(
+		vec<3, T, Q> const& orig, vec<3, T, Q> const& invDir,
+		vec<3, T, Q> const& aabbMin, vec<3, T, Q> const& aabbMax,
+		T tMin, T tMax, T& distance);
+
+	//! Compute the intersection of a ray and W axis aligned boxes, one per lane, with the slab method.
+	//! Returns a bitmask with bit i set when the ray intersects the box of lane i between tMin and tMax.
+	//! From GLM_GTX_intersect extension.
+	template<typename T, qualifier Q, length_t W>
+	GLM_FUNC_DECL int intersectRayAABB(
+		vec<3, T, Q> const& orig, vec<3, T, Q> const& invDir,
+		soa_vec<3, T, W> const& aabbMin, soa_vec<3, T, W> const& aabbMax,
+		T tMin, T tMax, soa_scalar<T, W>& distance);
+
+	//! Compute the intersection of W rays, one per lane, and an axis aligned box with the slab method.
+	//! Returns a bitmask with bit i set when the ray of lane i intersects the box between tMin and tMax of the lane.
+	//! From GLM_GTX_intersect extension.
+	template<typename T, qualifier Q, length_t W>
+	GLM_FUNC_DECL int intersectRayAABB(
+		soa_vec<3, T, W> const& orig, soa_vec<3, T, W> const& invDir,
+		vec<3, T, Q> const& aabbMin, vec<3, T, Q> const& aabbMax,
+		soa_scalar<T, W> const& tMin, soa_scalar<T, W> const& tMax, soa_scalar<T, W>& distance);
+
 	/// @}
 }//namespace glm
 
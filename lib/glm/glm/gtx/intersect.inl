@@ -93,6 +93,120 @@ namespace glm
 		return true;
 	}
 
+namespace detail
+{
+	// Branch free Moller-Trumbore, the lanes are tested with the barycentric coordinates divided by the determinant
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER int intersect_ray_triangle(
+		soa_vec<3, T, W> const& orig, soa_vec<3, T, W> const& dir,
+		soa_vec<3, T, W> const& vert0, soa_vec<3, T, W> const& vert1, soa_vec<3, T, W> const& vert2,
+		soa_vec<2, T, W>& baryPosition, soa_scalar<T, W>& distance)
+	{
+		soa_vec<3, T, W> const edge1 = vert1 - vert0;
+		soa_vec<3, T, W> const edge2 = vert2 - vert0;
+
+		soa_vec<3, T, W> const p = cross(dir, edge2);
+		soa_scalar<T, W> const det = dot(edge1, p);
+		soa_scalar<T, W> const inv_det = soa_scalar<T, W>(static_cast<T>(1)) / det;
+
+		soa_vec<3, T, W> const dist = orig - vert0;
+		soa_vec<3, T, W> const Perpendicular = cross(dist, edge1);
+
+		baryPosition.x = dot(dist, p) * inv_det;
+		baryPosition.y = dot(dir, Perpendicular) * inv_det;
+		distance = dot(edge2, Perpendicular) * inv_det;
+
+		soa_scalar<T, W> const Zero(static_cast<T>(0));
+		return greaterThanMask(abs(det), soa_scalar<T, W>(std::numeric_limits<T>::epsilon()))
+			& greaterThanEqualMask(baryPosition.x, Zero)
+			& greaterThanEqualMask(baryPosition.y, Zero)
+			& lessThanEqualMask(baryPosition.x + baryPosition.y, soa_scalar<T, W>(static_cast<T>(1)));
+	}
+
+	// Returns the mask of the lanes where the slabs overlap between tMin and tMax, distance is the entry distance
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER int intersect_ray_aabb(
+		soa_vec<3, T, W> const& orig, soa_vec<3, T, W> const& invDir,
+		soa_vec<3, T, W> const& aabbMin, soa_vec<3, T, W> const& aabbMax,
+		soa_scalar<T, W> const& tMin, soa_scalar<T, W> const& tMax, soa_scalar<T, W>& distance)
+	{
+		soa_vec<3, T, W> const t0 = (aabbMin - orig) * invDir;
+		soa_vec<3, T, W> const t1 = (aabbMax - orig) * invDir;
+		soa_vec<3, T, W> const tNear = min(t0, t1);
+		soa_vec<3, T, W> const tFar = max(t0, t1);
+
+		distance = max(max(tNear.x, tNear.y), max(tNear.z, tMin));
+		soa_scalar<T, W> const Exit = min(min(tFar.x, tFar.y), min(tFar.z, tMax));
+		return lessThanEqualMask(distance, Exit);
+	}
+}//namespace detail
+
+	template<typename T, qualifier Q, length_t W>
+	GLM_FUNC_QUALIFIER int intersectRayTriangle
+	(
+		vec<3, T, Q> const& orig, vec<3, T, Q> const& dir,
+		soa_vec<3, T, W> const& vert0, soa_vec<3, T, W> const& vert1, soa_vec<3, T, W> const& vert2,
+		soa_vec<2, T, W>& baryPosition, soa_scalar<T, W>& distance
+	)
+	{
+		return detail::intersect_ray_triangle(soa_vec<3, T, W>(orig), soa_vec<3, T, W>(dir), vert0, vert1, vert2, baryPosition, distance);
+	}
+
+	template<typename T, qualifier Q, length_t W>
+	GLM_FUNC_QUALIFIER int intersectRayTriangle
+	(
+		soa_vec<3, T, W> const& orig, soa_vec<3, T, W> const& dir,
+		vec<3, T, Q> const& vert0, vec<3, T, Q> const& vert1, vec<3, T, Q> const& vert2,
+		soa_vec<2, T, W>& baryPosition, soa_scalar<T, W>& distance
+	)
+	{
+		return detail::intersect_ray_triangle(orig, dir, soa_vec<3, T, W>(vert0), soa_vec<3, T, W>(vert1), soa_vec<3, T, W>(vert2), baryPosition, distance);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool intersectRayAABB
+	(
+		vec<3, T, Q> const& orig, vec<3, T, Q> const& invDir,
+		vec<3, T, Q> const& aabbMin, vec<3, T, Q> const& aabbMax,
+		T tMin, T tMax, T& distance
+	)
+	{
+		vec<3, T, Q> const t0 = (aabbMin - orig) * invDir;
+		vec<3, T, Q> const t1 = (aabbMax - orig) * invDir;
+		vec<3, T, Q> const tNear = glm::min(t0, t1);
+		vec<3, T, Q> const tFar = glm::max(t0, t1);
+
+		T const Entry = glm::max(glm::max(tNear.x, tNear.y), glm::max(tNear.z, tMin));
+		T const Exit = glm::min(glm::min(tFar.x, tFar.y), glm::min(tFar.z, tMax));
+		if(Entry > Exit)
+			return false;
+
+		distance = Entry;
+		return true;
+	}
+
+	template<typename T, qualifier Q, length_t W>
+	GLM_FUNC_QUALIFIER int intersectRayAABB
+	(
+		vec<3, T, Q> const& orig, vec<3, T, Q> const& invDir,
+		soa_vec<3, T, W> const& aabbMin, soa_vec<3, T, W> const& aabbMax,
+		T tMin, T tMax, soa_scalar<T, W>& distance
+	)
+	{
+		return detail::intersect_ray_aabb(soa_vec<3, T, W>(orig), soa_vec<3, T, W>(invDir), aabbMin, aabbMax, soa_scalar<T, W>(tMin), soa_scalar<T, W>(tMax), distance);
+	}
+
+	template<typename T, qualifier Q, length_t W>
+	GLM_FUNC_QUALIFIER int intersectRayAABB
+	(
+		soa_vec<3, T, W> const& orig, soa_vec<3, T, W> const& invDir,
+		vec<3, T, Q> const& aabbMin, vec<3, T, Q> const& aabbMax,
+		soa_scalar<T, W> const& tMin, soa_scalar<T, W> const& tMax, soa_scalar<T, W>& distance
+	)
+	{
+		return detail::intersect_ray_aabb(orig, invDir, soa_vec<3, T, W>(aabbMin), soa_vec<3, T, W>(aabbMax), tMin, tMax, distance);
+	}
+
 	template<typename genType>
 	GLM_FUNC_QUALIFIER bool intersectLineTriangle
 	(
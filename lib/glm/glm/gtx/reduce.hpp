@@ -0,0 +1,96 @@
+/// @ref gtx_reduce
+/// @file glm/gtx/reduce.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_reduce GLM_GTX_reduce
+/// @ingroup gtx
+///
+/// Include <glm/gtx/reduce.hpp> to use the features of this extension.
+///
+/// Reductions of vector arrays: bounds, minimum, maximum, sum, mean, accumulated dot products and maximum squared length,
+/// such as the bounding box or the centroid of a point cloud.
+///
+/// Arrays are reduced by blocks of 8192 vectors then the results of the blocks are combined in order. When the C++11
+/// standard library is available, the blocks may be split between several threads. The blocks don't depend on the
+/// number of threads so the results are the same whatever ThreadCount.
+///
+/// For float vec3 and vec4 arrays and when SIMD is enabled, the blocks are read as float streams with SSE2 or AVX lanes.
+/// Sums then depend on the instruction set but not on ThreadCount.
+///
+/// @see gtx_component_wise
+/// @see gtx_extended_min_max
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include <cstddef>
+#include <vector>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_reduce is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	else
+#		pragma message("GLM: GLM_GTX_reduce extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_reduce
+	/// @{
+
+	/// Compute the axis aligned bounding box of an array of points.
+	/// When Count is 0, Min is the largest value and Max the lowest value of T.
+	///
+	/// @param Points Array of Count points.
+	/// @param Count Number of points.
+	/// @param Min, Max Corners of the bounding box.
+	/// @param ThreadCount Maximum number of threads, 0 to use the number of hardware threads.
+	///
+	/// @see gtx_reduce
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL void reduceBounds(vec<L, T, Q> const* Points, std::size_t Count, vec<L, T, Q>& Min, vec<L, T, Q>& Max, unsigned ThreadCount = 1);
+
+	/// Returns the component-wise minimum of an array of vectors, the largest value of T when Count is 0.
+	///
+	/// @see gtx_reduce
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> reduceMin(vec<L, T, Q> const* Values, std::size_t Count, unsigned ThreadCount = 1);
+
+	/// Returns the component-wise maximum of an array of vectors, the lowest value of T when Count is 0.
+	///
+	/// @see gtx_reduce
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> reduceMax(vec<L, T, Q> const* Values, std::size_t Count, unsigned ThreadCount = 1);
+
+	/// Returns the sum of an array of vectors.
+	///
+	/// @see gtx_reduce
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> reduceSum(vec<L, T, Q> const* Values, std::size_t Count, unsigned ThreadCount = 1);
+
+	/// Returns the mean of an array of vectors, such as the centroid of points, 0 when Count is 0.
+	///
+	/// @see gtx_reduce
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> reduceMean(vec<L, T, Q> const* Values, std::size_t Count, unsigned ThreadCount = 1);
+
+	/// Returns the sum of dot(x[i], y[i]).
+	///
+	/// @see gtx_reduce
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL T reduceDot(vec<L, T, Q> const* x, vec<L, T, Q> const* y, std::size_t Count, unsigned ThreadCount = 1);
+
+	/// Returns the largest squared length of an array of vectors, 0 when Count is 0.
+	/// Its square root is the radius of the bounding sphere of points centered on the origin.
+	///
+	/// @see gtx_reduce
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL T reduceMaxLength2(vec<L, T, Q> const* Values, std::size_t Count, unsigned ThreadCount = 1);
+
+	/// @}
+}//namespace glm
+
+#include "reduce.inl"
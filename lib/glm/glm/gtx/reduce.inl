@@ -0,0 +1,310 @@
+/// @ref gtx_reduce
+
+#include <limits>
+#if GLM_HAS_CXX11_STL
+#	include <thread>
+#endif
+
+namespace glm{
+namespace detail
+{
+	// Number of vectors reduced into one partial result
+	static std::size_t const reduce_block_size = 8192;
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER T reduce_lowest()
+	{
+		return std::numeric_limits<T>::is_iec559 ? -std::numeric_limits<T>::max() : std::numeric_limits<T>::min();
+	}
+
+	// Min and Max are the initial values of bounds, minimum and maximum
+	template<length_t L, typename T, qualifier Q, bool Packed>
+	struct compute_reduce
+	{
+		GLM_FUNC_QUALIFIER static void bounds(vec<L, T, Q> const* p, std::size_t Count, vec<L, T, Q>& Min, vec<L, T, Q>& Max)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				Min = min(Min, p[i]);
+				Max = max(Max, p[i]);
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void minimum(vec<L, T, Q> const* p, std::size_t Count, vec<L, T, Q>& Min)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Min = min(Min, p[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void maximum(vec<L, T, Q> const* p, std::size_t Count, vec<L, T, Q>& Max)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Max = max(Max, p[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> sum(vec<L, T, Q> const* p, std::size_t Count)
+		{
+			vec<L, T, Q> Result(static_cast<T>(0));
+			for(std::size_t i = 0; i < Count; ++i)
+				Result += p[i];
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static T dot(vec<L, T, Q> const* x, vec<L, T, Q> const* y, std::size_t Count)
+		{
+			T Result(0);
+			for(std::size_t i = 0; i < Count; ++i)
+				Result += glm::dot(x[i], y[i]);
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static T maxLength2(vec<L, T, Q> const* p, std::size_t Count)
+		{
+			T Result(0);
+			for(std::size_t i = 0; i < Count; ++i)
+				Result = max(Result, glm::dot(p[i], p[i]));
+			return Result;
+		}
+	};
+
+	// The SIMD paths read the components of packed vectors as a contiguous float stream
+	template<length_t L, typename T, qualifier Q>
+	struct reduce_compute
+	{
+		typedef compute_reduce<L, T, Q, sizeof(vec<L, T, Q>) == sizeof(T) * L> type;
+	};
+
+	// An operation reduces a block of vectors to a result then combines the block results in order
+	template<length_t L, typename T, qualifier Q>
+	struct reduce_bounds_op
+	{
+		typedef vec<L, T, Q> value_type;
+		struct result_type
+		{
+			vec<L, T, Q> Min;
+			vec<L, T, Q> Max;
+		};
+
+		static result_type reduce(vec<L, T, Q> const* x, vec<L, T, Q> const*, std::size_t Count)
+		{
+			result_type Result;
+			Result.Min = vec<L, T, Q>(std::numeric_limits<T>::max());
+			Result.Max = vec<L, T, Q>(reduce_lowest<T>());
+			reduce_compute<L, T, Q>::type::bounds(x, Count, Result.Min, Result.Max);
+			return Result;
+		}
+
+		static void combine(result_type& Result, result_type const& Block)
+		{
+			Result.Min = min(Result.Min, Block.Min);
+			Result.Max = max(Result.Max, Block.Max);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q>
+	struct reduce_min_op
+	{
+		typedef vec<L, T, Q> value_type;
+		typedef vec<L, T, Q> result_type;
+
+		static result_type reduce(vec<L, T, Q> const* x, vec<L, T, Q> const*, std::size_t Count)
+		{
+			result_type Result(std::numeric_limits<T>::max());
+			reduce_compute<L, T, Q>::type::minimum(x, Count, Result);
+			return Result;
+		}
+
+		static void combine(result_type& Result, result_type const& Block)
+		{
+			Result = min(Result, Block);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q>
+	struct reduce_max_op
+	{
+		typedef vec<L, T, Q> value_type;
+		typedef vec<L, T, Q> result_type;
+
+		static result_type reduce(vec<L, T, Q> const* x, vec<L, T, Q> const*, std::size_t Count)
+		{
+			result_type Result(reduce_lowest<T>());
+			reduce_compute<L, T, Q>::type::maximum(x, Count, Result);
+			return Result;
+		}
+
+		static void combine(result_type& Result, result_type const& Block)
+		{
+			Result = max(Result, Block);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q>
+	struct reduce_sum_op
+	{
+		typedef vec<L, T, Q> value_type;
+		typedef vec<L, T, Q> result_type;
+
+		static result_type reduce(vec<L, T, Q> const* x, vec<L, T, Q> const*, std::size_t Count)
+		{
+			return reduce_compute<L, T, Q>::type::sum(x, Count);
+		}
+
+		static void combine(result_type& Result, result_type const& Block)
+		{
+			Result += Block;
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q>
+	struct reduce_dot_op
+	{
+		typedef vec<L, T, Q> value_type;
+		typedef T result_type;
+
+		static result_type reduce(vec<L, T, Q> const* x, vec<L, T, Q> const* y, std::size_t Count)
+		{
+			return reduce_compute<L, T, Q>::type::dot(x, y, Count);
+		}
+
+		static void combine(result_type& Result, result_type const& Block)
+		{
+			Result += Block;
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q>
+	struct reduce_length2_op
+	{
+		typedef vec<L, T, Q> value_type;
+		typedef T result_type;
+
+		static result_type reduce(vec<L, T, Q> const* x, vec<L, T, Q> const*, std::size_t Count)
+		{
+			return reduce_compute<L, T, Q>::type::maxLength2(x, Count);
+		}
+
+		static void combine(result_type& Result, result_type const& Block)
+		{
+			Result = max(Result, Block);
+		}
+	};
+
+	template<typename op>
+	struct reduce_blocks
+	{
+		typename op::value_type const* x;
+		typename op::value_type const* y;
+		std::size_t Count;
+		std::vector<typename op::result_type> Results;
+
+		void reduce(std::size_t FirstBlock, std::size_t LastBlock)
+		{
+			for(std::size_t Block = FirstBlock; Block < LastBlock; ++Block)
+			{
+				std::size_t const Begin = Block * reduce_block_size;
+				std::size_t const Size = Count - Begin < reduce_block_size ? Count - Begin : reduce_block_size;
+				Results[Block] = op::reduce(x + Begin, y ? y + Begin : y, Size);
+			}
+		}
+	};
+
+	template<typename op>
+	inline void reduce_block_range(reduce_blocks<op>* Blocks, std::size_t FirstBlock, std::size_t LastBlock)
+	{
+		Blocks->reduce(FirstBlock, LastBlock);
+	}
+
+	// Threads reduce contiguous ranges of blocks, the block results are then combined in order
+	template<typename op>
+	inline typename op::result_type reduce_array(typename op::value_type const* x, typename op::value_type const* y, std::size_t Count, unsigned ThreadCount)
+	{
+		std::size_t const BlockCount = (Count + reduce_block_size - 1) / reduce_block_size;
+		if(BlockCount <= 1)
+			return op::reduce(x, y, Count);
+
+		reduce_blocks<op> Blocks;
+		Blocks.x = x;
+		Blocks.y = y;
+		Blocks.Count = Count;
+		Blocks.Results.resize(BlockCount);
+
+#		if GLM_HAS_CXX11_STL
+			if(ThreadCount == 0)
+				ThreadCount = std::thread::hardware_concurrency();
+
+			std::size_t const Split = ThreadCount < BlockCount ? ThreadCount : BlockCount;
+			if(Split > 1)
+			{
+				std::vector<std::thread> Threads;
+				for(std::size_t Thread = 1; Thread < Split; ++Thread)
+					Threads.push_back(std::thread(reduce_block_range<op>, &Blocks, BlockCount * Thread / Split, BlockCount * (Thread + 1) / Split));
+				Blocks.reduce(0, BlockCount / Split);
+
+				for(std::size_t Thread = 0; Thread < Threads.size(); ++Thread)
+					Threads[Thread].join();
+			}
+			else
+				Blocks.reduce(0, BlockCount);
+#		else
+			static_cast<void>(ThreadCount);
+			Blocks.reduce(0, BlockCount);
+#		endif
+
+		typename op::result_type Result = Blocks.Results[0];
+		for(std::size_t Block = 1; Block < BlockCount; ++Block)
+			op::combine(Result, Blocks.Results[Block]);
+		return Result;
+	}
+}//namespace detail
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void reduceBounds(vec<L, T, Q> const* Points, std::size_t Count, vec<L, T, Q>& Min, vec<L, T, Q>& Max, unsigned ThreadCount)
+	{
+		typename detail::reduce_bounds_op<L, T, Q>::result_type const Result = detail::reduce_array<detail::reduce_bounds_op<L, T, Q> >(Points, 0, Count, ThreadCount);
+		Min = Result.Min;
+		Max = Result.Max;
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> reduceMin(vec<L, T, Q> const* Values, std::size_t Count, unsigned ThreadCount)
+	{
+		return detail::reduce_array<detail::reduce_min_op<L, T, Q> >(Values, 0, Count, ThreadCount);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> reduceMax(vec<L, T, Q> const* Values, std::size_t Count, unsigned ThreadCount)
+	{
+		return detail::reduce_array<detail::reduce_max_op<L, T, Q> >(Values, 0, Count, ThreadCount);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> reduceSum(vec<L, T, Q> const* Values, std::size_t Count, unsigned ThreadCount)
+	{
+		return detail::reduce_array<detail::reduce_sum_op<L, T, Q> >(Values, 0, Count, ThreadCount);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> reduceMean(vec<L, T, Q> const* Values, std::size_t Count, unsigned ThreadCount)
+	{
+		if(Count == 0)
+			return vec<L, T, Q>(static_cast<T>(0));
+		return reduceSum(Values, Count, ThreadCount) / static_cast<T>(Count);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER T reduceDot(vec<L, T, Q> const* x, vec<L, T, Q> const* y, std::size_t Count, unsigned ThreadCount)
+	{
+		return detail::reduce_array<detail::reduce_dot_op<L, T, Q> >(x, y, Count, ThreadCount);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER T reduceMaxLength2(vec<L, T, Q> const* Values, std::size_t Count, unsigned ThreadCount)
+	{
+		return detail::reduce_array<detail::reduce_length2_op<L, T, Q> >(Values, 0, Count, ThreadCount);
+	}
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "reduce_simd.inl"
+#endif
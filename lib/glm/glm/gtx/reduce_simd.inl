@@ -0,0 +1,287 @@
+/// @ref gtx_reduce
+/// @file glm/gtx/reduce_simd.inl
+
+#include "../simd/packing.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	struct reduce_lanes_sse
+	{
+		typedef glm_vec4 type;
+		static length_t const size = 4;
+
+		GLM_FUNC_QUALIFIER static type load(float const* p){return _mm_loadu_ps(p);}
+		GLM_FUNC_QUALIFIER static void store(float* p, type v){_mm_storeu_ps(p, v);}
+		GLM_FUNC_QUALIFIER static type zero(){return _mm_setzero_ps();}
+		GLM_FUNC_QUALIFIER static type add(type a, type b){return _mm_add_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type min(type a, type b){return _mm_min_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type max(type a, type b){return _mm_max_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type fma(type a, type b, type c){return glm_vec4_fma(a, b, c);}
+
+		GLM_FUNC_QUALIFIER static type length2(float const* p, vec<1, float, defaultp> const*)
+		{
+			type const x = _mm_loadu_ps(p);
+			return _mm_mul_ps(x, x);
+		}
+
+		GLM_FUNC_QUALIFIER static type length2(float const* p, vec<2, float, defaultp> const*)
+		{
+			type x, y;
+			glm_vec4_load_packed2(p, &x, &y);
+			return glm_vec4_fma(y, y, _mm_mul_ps(x, x));
+		}
+
+		GLM_FUNC_QUALIFIER static type length2(float const* p, vec<3, float, defaultp> const*)
+		{
+			type x, y, z;
+			glm_vec4_load_packed3(p, &x, &y, &z);
+			return glm_vec4_fma(z, z, glm_vec4_fma(y, y, _mm_mul_ps(x, x)));
+		}
+
+		GLM_FUNC_QUALIFIER static type length2(float const* p, vec<4, float, defaultp> const*)
+		{
+			type x, y, z, w;
+			glm_vec4_load_packed4(p, &x, &y, &z, &w);
+			return glm_vec4_fma(w, w, glm_vec4_fma(z, z, glm_vec4_fma(y, y, _mm_mul_ps(x, x))));
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	struct reduce_lanes_avx
+	{
+		typedef glm_vec8 type;
+		static length_t const size = 8;
+
+		GLM_FUNC_QUALIFIER static type load(float const* p){return _mm256_loadu_ps(p);}
+		GLM_FUNC_QUALIFIER static void store(float* p, type v){_mm256_storeu_ps(p, v);}
+		GLM_FUNC_QUALIFIER static type zero(){return _mm256_setzero_ps();}
+		GLM_FUNC_QUALIFIER static type add(type a, type b){return _mm256_add_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type min(type a, type b){return _mm256_min_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type max(type a, type b){return _mm256_max_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type fma(type a, type b, type c){return glm_vec8_fma(a, b, c);}
+
+		GLM_FUNC_QUALIFIER static type length2(float const* p, vec<1, float, defaultp> const*)
+		{
+			type const x = _mm256_loadu_ps(p);
+			return _mm256_mul_ps(x, x);
+		}
+
+		GLM_FUNC_QUALIFIER static type length2(float const* p, vec<2, float, defaultp> const*)
+		{
+			type x, y;
+			glm_vec8_load_packed2(p, &x, &y);
+			return glm_vec8_fma(y, y, _mm256_mul_ps(x, x));
+		}
+
+		GLM_FUNC_QUALIFIER static type length2(float const* p, vec<3, float, defaultp> const*)
+		{
+			type x, y, z;
+			glm_vec8_load_packed3(p, &x, &y, &z);
+			return glm_vec8_fma(z, z, glm_vec8_fma(y, y, _mm256_mul_ps(x, x)));
+		}
+
+		GLM_FUNC_QUALIFIER static type length2(float const* p, vec<4, float, defaultp> const*)
+		{
+			type x, y, z, w;
+			glm_vec8_load_packed4(p, &x, &y, &z, &w);
+			return glm_vec8_fma(w, w, glm_vec8_fma(z, z, glm_vec8_fma(y, y, _mm256_mul_ps(x, x))));
+		}
+	};
+
+	typedef reduce_lanes_avx reduce_lanes;
+#	else
+	typedef reduce_lanes_sse reduce_lanes;
+#	endif
+
+	// Packed float vectors are read as a float stream, size points at a time with L registers:
+	// lane j of register r always reads the component (r * size + j) % L.
+	// The registers are then folded into the result in lane order, followed by the remaining points.
+	template<length_t L, qualifier Q>
+	struct compute_reduce<L, float, Q, true>
+	{
+		typedef reduce_lanes lanes;
+		typedef reduce_lanes::type lane_type;
+		static length_t const Size = reduce_lanes::size;
+
+		GLM_FUNC_QUALIFIER static void bounds(vec<L, float, Q> const* p, std::size_t Count, vec<L, float, Q>& Min, vec<L, float, Q>& Max)
+		{
+			float const* const In = reinterpret_cast<float const*>(p);
+
+			float TmpMin[L * Size];
+			float TmpMax[L * Size];
+			for(length_t k = 0; k < L * Size; ++k)
+			{
+				TmpMin[k] = Min[k % L];
+				TmpMax[k] = Max[k % L];
+			}
+
+			lane_type RegMin[L];
+			lane_type RegMax[L];
+			for(length_t r = 0; r < L; ++r)
+			{
+				RegMin[r] = lanes::load(TmpMin + r * Size);
+				RegMax[r] = lanes::load(TmpMax + r * Size);
+			}
+
+			std::size_t i = 0;
+			for(; i + Size <= Count; i += Size)
+			for(length_t r = 0; r < L; ++r)
+			{
+				lane_type const v = lanes::load(In + i * L + r * Size);
+				RegMin[r] = lanes::min(RegMin[r], v);
+				RegMax[r] = lanes::max(RegMax[r], v);
+			}
+
+			for(length_t r = 0; r < L; ++r)
+			{
+				lanes::store(TmpMin + r * Size, RegMin[r]);
+				lanes::store(TmpMax + r * Size, RegMax[r]);
+			}
+			for(length_t k = 0; k < L * Size; ++k)
+			{
+				Min[k % L] = glm::min(Min[k % L], TmpMin[k]);
+				Max[k % L] = glm::max(Max[k % L], TmpMax[k]);
+			}
+
+			for(; i < Count; ++i)
+			{
+				Min = glm::min(Min, p[i]);
+				Max = glm::max(Max, p[i]);
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void minimum(vec<L, float, Q> const* p, std::size_t Count, vec<L, float, Q>& Min)
+		{
+			float const* const In = reinterpret_cast<float const*>(p);
+
+			float Tmp[L * Size];
+			for(length_t k = 0; k < L * Size; ++k)
+				Tmp[k] = Min[k % L];
+
+			lane_type Reg[L];
+			for(length_t r = 0; r < L; ++r)
+				Reg[r] = lanes::load(Tmp + r * Size);
+
+			std::size_t i = 0;
+			for(; i + Size <= Count; i += Size)
+			for(length_t r = 0; r < L; ++r)
+				Reg[r] = lanes::min(Reg[r], lanes::load(In + i * L + r * Size));
+
+			for(length_t r = 0; r < L; ++r)
+				lanes::store(Tmp + r * Size, Reg[r]);
+			for(length_t k = 0; k < L * Size; ++k)
+				Min[k % L] = glm::min(Min[k % L], Tmp[k]);
+
+			for(; i < Count; ++i)
+				Min = glm::min(Min, p[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void maximum(vec<L, float, Q> const* p, std::size_t Count, vec<L, float, Q>& Max)
+		{
+			float const* const In = reinterpret_cast<float const*>(p);
+
+			float Tmp[L * Size];
+			for(length_t k = 0; k < L * Size; ++k)
+				Tmp[k] = Max[k % L];
+
+			lane_type Reg[L];
+			for(length_t r = 0; r < L; ++r)
+				Reg[r] = lanes::load(Tmp + r * Size);
+
+			std::size_t i = 0;
+			for(; i + Size <= Count; i += Size)
+			for(length_t r = 0; r < L; ++r)
+				Reg[r] = lanes::max(Reg[r], lanes::load(In + i * L + r * Size));
+
+			for(length_t r = 0; r < L; ++r)
+				lanes::store(Tmp + r * Size, Reg[r]);
+			for(length_t k = 0; k < L * Size; ++k)
+				Max[k % L] = glm::max(Max[k % L], Tmp[k]);
+
+			for(; i < Count; ++i)
+				Max = glm::max(Max, p[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static vec<L, float, Q> sum(vec<L, float, Q> const* p, std::size_t Count)
+		{
+			float const* const In = reinterpret_cast<float const*>(p);
+
+			lane_type Reg[L];
+			for(length_t r = 0; r < L; ++r)
+				Reg[r] = lanes::zero();
+
+			std::size_t i = 0;
+			for(; i + Size <= Count; i += Size)
+			for(length_t r = 0; r < L; ++r)
+				Reg[r] = lanes::add(Reg[r], lanes::load(In + i * L + r * Size));
+
+			float Tmp[L * Size];
+			for(length_t r = 0; r < L; ++r)
+				lanes::store(Tmp + r * Size, Reg[r]);
+
+			vec<L, float, Q> Result(0.0f);
+			for(length_t k = 0; k < L * Size; ++k)
+				Result[k % L] += Tmp[k];
+
+			for(; i < Count; ++i)
+				Result += p[i];
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static float dot(vec<L, float, Q> const* x, vec<L, float, Q> const* y, std::size_t Count)
+		{
+			float const* const InX = reinterpret_cast<float const*>(x);
+			float const* const InY = reinterpret_cast<float const*>(y);
+
+			lane_type Reg[L];
+			for(length_t r = 0; r < L; ++r)
+				Reg[r] = lanes::zero();
+
+			std::size_t i = 0;
+			for(; i + Size <= Count; i += Size)
+			for(length_t r = 0; r < L; ++r)
+				Reg[r] = lanes::fma(lanes::load(InX + i * L + r * Size), lanes::load(InY + i * L + r * Size), Reg[r]);
+
+			float Tmp[L * Size];
+			for(length_t r = 0; r < L; ++r)
+				lanes::store(Tmp + r * Size, Reg[r]);
+
+			float Result(0.0f);
+			for(length_t k = 0; k < L * Size; ++k)
+				Result += Tmp[k];
+
+			for(; i < Count; ++i)
+				Result += glm::dot(x[i], y[i]);
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static float maxLength2(vec<L, float, Q> const* p, std::size_t Count)
+		{
+			float const* const In = reinterpret_cast<float const*>(p);
+			vec<L, float, defaultp> const* const Tag = 0;
+
+			lane_type Reg = lanes::zero();
+
+			std::size_t i = 0;
+			for(; i + Size <= Count; i += Size)
+				Reg = lanes::max(Reg, lanes::length2(In + i * L, Tag));
+
+			float Tmp[Size];
+			lanes::store(Tmp, Reg);
+
+			float Result(0.0f);
+			for(length_t k = 0; k < Size; ++k)
+				Result = glm::max(Result, Tmp[k]);
+
+			for(; i < Count; ++i)
+				Result = glm::max(Result, glm::dot(p[i], p[i]));
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
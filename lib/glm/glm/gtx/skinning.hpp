@@ -0,0 +1,96 @@
+/// @ref gtx_skinning
+/// @file glm/gtx/skinning.hpp
+///
+/// @see core (dependence)
+/// @see gtx_dual_quaternion (dependence)
+/// @see ext_quaternion_soa (dependence)
+///
+/// @defgroup gtx_skinning GLM_GTX_skinning
+/// @ingroup gtx
+///
+/// Include <glm/gtx/skinning.hpp> to use the features of this extension.
+///
+/// Skin arrays of vertices with up to 4 bone influences by a palette of dual quaternions
+/// (dual quaternion linear blending) or of 3x4 matrices (linear blend skinning).
+///
+/// Vertices are processed 8 floats or 4 doubles at a time with the GLM_EXT_vector_soa types.
+/// The functions have no shared state so disjoint ranges of vertices may be skinned by several
+/// threads at once by offsetting the input and output pointers.
+///
+/// Arrays don't need to be aligned. Output arrays may be the same as their matching input arrays
+/// but must not partially overlap any input array.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../ext/quaternion_soa.hpp"
+#include "dual_quaternion.hpp"
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_skinning is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	else
+#		pragma message("GLM: GLM_GTX_skinning extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_skinning
+	/// @{
+
+	/// Dual quaternion skinning of Count vertices.
+	///
+	/// Each vertex blends the unit dual quaternions Palette[Indices[i][k]] by Weights[i][k], flipping the
+	/// influences whose rotation is in the opposite hemisphere of the first one, and normalizes the blend.
+	/// OutPositions[i] = Blend * Positions[i] and OutNormals[i] = Blend.real * Normals[i].
+	///
+	/// @param Palette Array of unit dual quaternions, one per bone.
+	/// @param Indices Array of Count bone indices, 4 per vertex.
+	/// @param Weights Array of Count bone weights, 4 per vertex. Unused influences have a weight of 0.
+	/// @param Positions Array of Count positions.
+	/// @param Normals Array of Count normals or a null pointer to skip normals.
+	/// @param OutPositions Array of Count skinned positions.
+	/// @param OutNormals Array of Count skinned normals, ignored if Normals is a null pointer.
+	/// @param Count Number of vertices.
+	///
+	/// @tparam T Floating-point scalar type
+	/// @tparam I Integer scalar type of the bone indices
+	/// @tparam Q A value from qualifier enum
+	template<typename T, typename I, qualifier Q>
+	GLM_FUNC_DECL void skinDualQuat(tdualquat<T, Q> const* Palette,
+		vec<4, I, Q> const* Indices, vec<4, T, Q> const* Weights,
+		vec<3, T, Q> const* Positions, vec<3, T, Q> const* Normals,
+		vec<3, T, Q>* OutPositions, vec<3, T, Q>* OutNormals, std::size_t Count);
+
+	/// Linear blend skinning of Count vertices.
+	///
+	/// Each vertex sums the affine matrices Palette[Indices[i][k]] by Weights[i][k].
+	/// Palette matrices store rows like mat3x4_cast(tdualquat): Palette[b][r] = vec4(row r, translation[r]).
+	/// OutPositions[i] is the blended matrix applied to the point Positions[i] and OutNormals[i] the normalized
+	/// result of the blended 3x3 part applied to Normals[i].
+	///
+	/// @param Palette Array of 3x4 matrices, one per bone.
+	/// @param Indices Array of Count bone indices, 4 per vertex.
+	/// @param Weights Array of Count bone weights, 4 per vertex. Unused influences have a weight of 0.
+	/// @param Positions Array of Count positions.
+	/// @param Normals Array of Count normals or a null pointer to skip normals.
+	/// @param OutPositions Array of Count skinned positions.
+	/// @param OutNormals Array of Count skinned normals, ignored if Normals is a null pointer.
+	/// @param Count Number of vertices.
+	///
+	/// @tparam T Floating-point scalar type
+	/// @tparam I Integer scalar type of the bone indices
+	/// @tparam Q A value from qualifier enum
+	template<typename T, typename I, qualifier Q>
+	GLM_FUNC_DECL void skinLinearBlend(mat<3, 4, T, Q> const* Palette,
+		vec<4, I, Q> const* Indices, vec<4, T, Q> const* Weights,
+		vec<3, T, Q> const* Positions, vec<3, T, Q> const* Normals,
+		vec<3, T, Q>* OutPositions, vec<3, T, Q>* OutNormals, std::size_t Count);
+
+	/// @}
+}//namespace glm
+
+#include "skinning.inl"
@@ -0,0 +1,164 @@
+/// @ref gtx_skinning
+
+namespace glm{
+namespace detail
+{
+	template<typename T>
+	struct skinning_lanes
+	{
+		static length_t const value = 4;
+	};
+
+	template<>
+	struct skinning_lanes<float>
+	{
+		static length_t const value = 8;
+	};
+
+	// Load the n <= W first vectors of p, the other lanes repeat the first vector
+	template<length_t W, length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER soa_vec<L, T, W> skinning_load(vec<L, T, Q> const* p, std::size_t n)
+	{
+		if(n == static_cast<std::size_t>(W))
+			return soa_vec<L, T, W>::load(p);
+
+		vec<L, T, Q> Tail[W];
+		for(length_t j = 0; j < W; ++j)
+			Tail[j] = p[static_cast<std::size_t>(j) < n ? j : 0];
+		return soa_vec<L, T, W>::load(Tail);
+	}
+
+	template<length_t W, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void skinning_store(soa_vec<3, T, W> const& v, vec<3, T, Q>* p, std::size_t n)
+	{
+		if(n == static_cast<std::size_t>(W))
+		{
+			v.store(p);
+			return;
+		}
+
+		vec<3, T, Q> Tail[W];
+		v.store(Tail);
+		for(std::size_t j = 0; j < n; ++j)
+			p[j] = Tail[j];
+	}
+
+	// Blend the bones of the n <= W first vertices, the other lanes repeat the first vertex.
+	// Each vertex is blended in place before a single transposition to SoA.
+	template<typename T, length_t W, typename I, qualifier Q>
+	GLM_FUNC_QUALIFIER void skinning_blend(tdualquat<T, Q> const* Palette, vec<4, I, Q> const* Indices, vec<4, T, Q> const* Weights, std::size_t n, soa_qua<T, W>& Real, soa_qua<T, W>& Dual)
+	{
+		qua<T, Q> RealData[W];
+		qua<T, Q> DualData[W];
+		for(length_t j = 0; j < W; ++j)
+		{
+			std::size_t const v = static_cast<std::size_t>(j) < n ? static_cast<std::size_t>(j) : 0;
+			vec<4, I, Q> const& Index = Indices[v];
+			vec<4, T, Q> const& Weight = Weights[v];
+
+			tdualquat<T, Q> const& First = Palette[Index.x];
+			qua<T, Q> BlendReal = First.real * Weight.x;
+			qua<T, Q> BlendDual = First.dual * Weight.x;
+			for(length_t k = 1; k < 4; ++k)
+			{
+				tdualquat<T, Q> const& Bone = Palette[Index[k]];
+				T const Scale = dot(Bone.real, First.real) < static_cast<T>(0) ? -Weight[k] : Weight[k];
+				BlendReal = BlendReal + Bone.real * Scale;
+				BlendDual = BlendDual + Bone.dual * Scale;
+			}
+			RealData[j] = BlendReal;
+			DualData[j] = BlendDual;
+		}
+		Real = soa_qua<T, W>::load(RealData);
+		Dual = soa_qua<T, W>::load(DualData);
+	}
+
+	template<typename T, length_t W, typename I, qualifier Q>
+	GLM_FUNC_QUALIFIER void skinning_blend(mat<3, 4, T, Q> const* Palette, vec<4, I, Q> const* Indices, vec<4, T, Q> const* Weights, std::size_t n, soa_vec<4, T, W> Rows[3])
+	{
+		vec<4, T, Q> Data[3][W];
+		for(length_t j = 0; j < W; ++j)
+		{
+			std::size_t const v = static_cast<std::size_t>(j) < n ? static_cast<std::size_t>(j) : 0;
+			vec<4, I, Q> const& Index = Indices[v];
+			vec<4, T, Q> const& Weight = Weights[v];
+
+			mat<3, 4, T, Q> Blend = Palette[Index.x] * Weight.x;
+			for(length_t k = 1; k < 4; ++k)
+				Blend += Palette[Index[k]] * Weight[k];
+			Data[0][j] = Blend[0];
+			Data[1][j] = Blend[1];
+			Data[2][j] = Blend[2];
+		}
+		for(length_t r = 0; r < 3; ++r)
+			Rows[r] = soa_vec<4, T, W>::load(Data[r]);
+	}
+}//namespace detail
+
+	template<typename T, typename I, qualifier Q>
+	GLM_FUNC_QUALIFIER void skinDualQuat(tdualquat<T, Q> const* Palette,
+		vec<4, I, Q> const* Indices, vec<4, T, Q> const* Weights,
+		vec<3, T, Q> const* Positions, vec<3, T, Q> const* Normals,
+		vec<3, T, Q>* OutPositions, vec<3, T, Q>* OutNormals, std::size_t Count)
+	{
+		length_t const W = detail::skinning_lanes<T>::value;
+		soa_scalar<T, W> const Two(static_cast<T>(2));
+
+		for(std::size_t i = 0; i < Count; i += W)
+		{
+			std::size_t const n = glm::min(Count - i, static_cast<std::size_t>(W));
+
+			// Dual quaternion linear blending, each influence on the side of the first one
+			soa_qua<T, W> Real, Dual;
+			detail::skinning_blend(Palette, Indices + i, Weights + i, n, Real, Dual);
+
+			soa_scalar<T, W> const InvLength = inversesqrt(dot(Real, Real));
+			Real = Real * InvLength;
+			Dual = Dual * InvLength;
+
+			soa_vec<3, T, W> const r(Real.x, Real.y, Real.z);
+			soa_vec<3, T, W> const d(Dual.x, Dual.y, Dual.z);
+
+			soa_vec<3, T, W> const p = detail::skinning_load<W>(Positions + i, n);
+			detail::skinning_store((cross(r, cross(r, p) + p * Real.w + d) + d * Real.w - r * Dual.w) * Two + p, OutPositions + i, n);
+
+			if(Normals == GLM_NULLPTR)
+				continue;
+
+			soa_vec<3, T, W> const v = detail::skinning_load<W>(Normals + i, n);
+			detail::skinning_store(cross(r, cross(r, v) + v * Real.w) * Two + v, OutNormals + i, n);
+		}
+	}
+
+	template<typename T, typename I, qualifier Q>
+	GLM_FUNC_QUALIFIER void skinLinearBlend(mat<3, 4, T, Q> const* Palette,
+		vec<4, I, Q> const* Indices, vec<4, T, Q> const* Weights,
+		vec<3, T, Q> const* Positions, vec<3, T, Q> const* Normals,
+		vec<3, T, Q>* OutPositions, vec<3, T, Q>* OutNormals, std::size_t Count)
+	{
+		length_t const W = detail::skinning_lanes<T>::value;
+
+		for(std::size_t i = 0; i < Count; i += W)
+		{
+			std::size_t const n = glm::min(Count - i, static_cast<std::size_t>(W));
+
+			soa_vec<4, T, W> Rows[3];
+			detail::skinning_blend(Palette, Indices + i, Weights + i, n, Rows);
+
+			soa_vec<3, T, W> const p = detail::skinning_load<W>(Positions + i, n);
+			detail::skinning_store(soa_vec<3, T, W>(
+				Rows[0].x * p.x + Rows[0].y * p.y + Rows[0].z * p.z + Rows[0].w,
+				Rows[1].x * p.x + Rows[1].y * p.y + Rows[1].z * p.z + Rows[1].w,
+				Rows[2].x * p.x + Rows[2].y * p.y + Rows[2].z * p.z + Rows[2].w), OutPositions + i, n);
+
+			if(Normals == GLM_NULLPTR)
+				continue;
+
+			soa_vec<3, T, W> const v = detail::skinning_load<W>(Normals + i, n);
+			detail::skinning_store(normalize(soa_vec<3, T, W>(
+				Rows[0].x * v.x + Rows[0].y * v.y + Rows[0].z * v.z,
+				Rows[1].x * v.x + Rows[1].y * v.y + Rows[1].z * v.z,
+				Rows[2].x * v.x + Rows[2].y * v.y + Rows[2].z * v.z)), OutNormals + i, n);
+		}
+	}
+}//namespace glm
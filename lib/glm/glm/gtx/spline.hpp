@@ -9,12 +9,18 @@
 /// Include <glm/gtx/spline.hpp> to use the features of this extension.
 ///
 /// Spline functions
+///
+/// tspline stores the polynomial coefficients of each segment of a curve so that arrays of parameters
+/// are evaluated with 3 multiply-adds per point, 4 floats at a time with SSE2 for float curves when SIMD is enabled.
+/// An arc length table maps uniformly spaced distances along the curve to parameters for constant speed playback.
 
 #pragma once
 
 // Dependency:
 #include "../glm.hpp"
 #include "../gtx/optimum_pow.hpp"
+#include <cstddef>
+#include <vector>
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
 #	ifndef GLM_ENABLE_EXPERIMENTAL
@@ -59,6 +65,89 @@ namespace glm
 		genType const& v4,
 		typename genType::value_type const& s);
 
+	/// Curve made of cubic segments of equal parameter range.
+	///
+	/// @tparam L Number of components of the points, from 1 to 4
+	/// @tparam T Floating-point scalar type
+	/// @tparam Q Value from qualifier enum
+	template<length_t L, typename T, qualifier Q = defaultp>
+	struct tspline
+	{
+		/// Polynomial coefficients of each segment from the cubic to the constant term, padded with zeros to 4 components.
+		/// The point of segment i at s in [0, 1] is ((Coefficients[i * 4] * s + Coefficients[i * 4 + 1]) * s + Coefficients[i * 4 + 2]) * s + Coefficients[i * 4 + 3].
+		std::vector<vec<4, T, Q> > Coefficients;
+
+		/// Parameters at uniformly spaced distances along the curve, from 0 to 1, empty until buildArcLengthTable is called.
+		std::vector<T> ArcParameters;
+
+		/// Length of the curve as computed by buildArcLengthTable.
+		T Length;
+
+		tspline() : Length(static_cast<T>(0))
+		{}
+	};
+
+	/// Build a Catmull-Rom curve through Count points, Count - 1 segments, such as catmullRom(Points[i - 1], Points[i], Points[i + 1], Points[i + 2], s).
+	/// The first and last points are repeated for the end segments. Replaces the content of Spline.
+	///
+	/// @see gtx_spline extension.
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL void buildCatmullRomSpline(tspline<L, T, Q>& Spline, vec<L, T, Q> const* Points, std::size_t Count);
+
+	/// Build a hermite curve through Count points with their tangents, Count - 1 segments, such as hermite(Points[i], Tangents[i], Points[i + 1], Tangents[i + 1], s).
+	/// Replaces the content of Spline.
+	///
+	/// @see gtx_spline extension.
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL void buildHermiteSpline(tspline<L, T, Q>& Spline, vec<L, T, Q> const* Points, vec<L, T, Q> const* Tangents, std::size_t Count);
+
+	/// Return the point of a curve at t, from 0 at the start to 1 at the end of the curve. t is clamped to [0, 1].
+	///
+	/// @see gtx_spline extension.
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> evaluateSpline(tspline<L, T, Q> const& Spline, T t);
+
+	/// Compute the points of a curve at Count parameters.
+	///
+	/// @see gtx_spline extension.
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL void evaluateSpline(tspline<L, T, Q> const& Spline, T const* t, std::size_t Count, vec<L, T, Q>* Points);
+
+	/// Build the arc length table of a curve by summing the distances between SamplesPerSegment points per segment,
+	/// then inverting the lengths into parameters at as many uniformly spaced distances. Must be called again when the curve is rebuilt.
+	/// The error of constant speed playback is largest where the speed of the curve varies quickly, more samples reduce it quadratically.
+	///
+	/// @see gtx_spline extension.
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL void buildArcLengthTable(tspline<L, T, Q>& Spline, std::size_t SamplesPerSegment = 16);
+
+	/// Return the length of a curve as computed by buildArcLengthTable.
+	///
+	/// @see gtx_spline extension.
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL T splineLength(tspline<L, T, Q> const& Spline);
+
+	/// Return the parameter of a curve at a distance from its start, given as a fraction of its length clamped to [0, 1].
+	/// The parameter is linearly interpolated between the two nearest entries of the arc length table, without search.
+	///
+	/// @see gtx_spline extension.
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL T splineParameter(tspline<L, T, Q> const& Spline, T Distance);
+
+	/// Compute the points of a curve at Count distances from its start, given as fractions of its length,
+	/// such that evenly spaced distances give evenly spaced points along the curve.
+	///
+	/// @see gtx_spline extension.
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL void evaluateSplineConstantSpeed(tspline<L, T, Q> const& Spline, T const* Distances, std::size_t Count, vec<L, T, Q>* Points);
+
+	typedef tspline<2, float, defaultp> spline2;
+	typedef tspline<3, float, defaultp> spline3;
+	typedef tspline<4, float, defaultp> spline4;
+	typedef tspline<2, double, defaultp> dspline2;
+	typedef tspline<3, double, defaultp> dspline3;
+	typedef tspline<4, double, defaultp> dspline4;
+
 	/// @}
 }//namespace glm
 
@@ -1,7 +1,44 @@
 /// @ref gtx_spline
 
-namespace glm
+#include <limits>
+
+namespace glm{
+namespace detail
 {
+	// Clamp a curve parameter to [0, 1], returns its segment and the parameter within the segment
+	template<typename T>
+	GLM_FUNC_QUALIFIER T spline_segment(T t, std::size_t SegmentCount, std::size_t& Segment)
+	{
+		T const u = clamp(t, static_cast<T>(0), static_cast<T>(1)) * static_cast<T>(SegmentCount);
+		Segment = min(static_cast<std::size_t>(u), SegmentCount - 1);
+		return u - static_cast<T>(Segment);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<4, T, Q> spline_coefficient(vec<L, T, Q> const& v)
+	{
+		vec<4, T, Q> Result(static_cast<T>(0));
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = v[c];
+		return Result;
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	struct compute_spline
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<4, T, Q> const* Coefficients, std::size_t SegmentCount, T const* t, std::size_t Count, vec<L, T, Q>* Points)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				std::size_t Segment;
+				T const s = spline_segment(t[i], SegmentCount, Segment);
+				vec<4, T, Q> const* const c = Coefficients + Segment * 4;
+				Points[i] = vec<L, T, Q>(((c[0] * s + c[1]) * s + c[2]) * s + c[3]);
+			}
+		}
+	};
+}//namespace detail
+
 	template<typename genType>
 	GLM_FUNC_QUALIFIER genType catmullRom
 	(
@@ -57,4 +94,141 @@ namespace glm
 	{
 		return ((v1 * s + v2) * s + v3) * s + v4;
 	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void buildCatmullRomSpline(tspline<L, T, Q>& Spline, vec<L, T, Q> const* Points, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'buildCatmullRomSpline' only accept floating-point inputs");
+
+		std::size_t const SegmentCount = Count > 1 ? Count - 1 : Count;
+		Spline.Coefficients.resize(SegmentCount * 4);
+		Spline.ArcParameters.clear();
+		Spline.Length = static_cast<T>(0);
+
+		T const Half(0.5);
+		for(std::size_t i = 0; i < SegmentCount; ++i)
+		{
+			vec<L, T, Q> const& v1 = Points[i > 0 ? i - 1 : 0];
+			vec<L, T, Q> const& v2 = Points[i];
+			vec<L, T, Q> const& v3 = Points[min(i + 1, Count - 1)];
+			vec<L, T, Q> const& v4 = Points[min(i + 2, Count - 1)];
+
+			Spline.Coefficients[i * 4 + 0] = detail::spline_coefficient((v4 - v1 + static_cast<T>(3) * (v2 - v3)) * Half);
+			Spline.Coefficients[i * 4 + 1] = detail::spline_coefficient((static_cast<T>(2) * v1 - static_cast<T>(5) * v2 + static_cast<T>(4) * v3 - v4) * Half);
+			Spline.Coefficients[i * 4 + 2] = detail::spline_coefficient((v3 - v1) * Half);
+			Spline.Coefficients[i * 4 + 3] = detail::spline_coefficient(v2);
+		}
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void buildHermiteSpline(tspline<L, T, Q>& Spline, vec<L, T, Q> const* Points, vec<L, T, Q> const* Tangents, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'buildHermiteSpline' only accept floating-point inputs");
+
+		std::size_t const SegmentCount = Count > 1 ? Count - 1 : Count;
+		Spline.Coefficients.resize(SegmentCount * 4);
+		Spline.ArcParameters.clear();
+		Spline.Length = static_cast<T>(0);
+
+		for(std::size_t i = 0; i < SegmentCount; ++i)
+		{
+			std::size_t const j = min(i + 1, Count - 1);
+			vec<L, T, Q> const& v1 = Points[i];
+			vec<L, T, Q> const& t1 = Tangents[i];
+			vec<L, T, Q> const& v2 = Points[j];
+			vec<L, T, Q> const& t2 = Tangents[j];
+
+			Spline.Coefficients[i * 4 + 0] = detail::spline_coefficient(static_cast<T>(2) * (v1 - v2) + t1 + t2);
+			Spline.Coefficients[i * 4 + 1] = detail::spline_coefficient(static_cast<T>(3) * (v2 - v1) - static_cast<T>(2) * t1 - t2);
+			Spline.Coefficients[i * 4 + 2] = detail::spline_coefficient(t1);
+			Spline.Coefficients[i * 4 + 3] = detail::spline_coefficient(v1);
+		}
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> evaluateSpline(tspline<L, T, Q> const& Spline, T t)
+	{
+		vec<L, T, Q> Result;
+		evaluateSpline(Spline, &t, 1, &Result);
+		return Result;
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void evaluateSpline(tspline<L, T, Q> const& Spline, T const* t, std::size_t Count, vec<L, T, Q>* Points)
+	{
+		assert(!Spline.Coefficients.empty());
+		detail::compute_spline<L, T, Q>::call(&Spline.Coefficients[0], Spline.Coefficients.size() / 4, t, Count, Points);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void buildArcLengthTable(tspline<L, T, Q>& Spline, std::size_t SamplesPerSegment)
+	{
+		assert(!Spline.Coefficients.empty() && SamplesPerSegment > 0);
+
+		std::size_t const Intervals = Spline.Coefficients.size() / 4 * SamplesPerSegment;
+		std::vector<T> Parameters(Intervals + 1);
+		for(std::size_t i = 0; i <= Intervals; ++i)
+			Parameters[i] = static_cast<T>(i) / static_cast<T>(Intervals);
+
+		std::vector<vec<L, T, Q> > Points(Intervals + 1);
+		evaluateSpline(Spline, &Parameters[0], Parameters.size(), &Points[0]);
+
+		// Length of the curve at each parameter
+		std::vector<T> Lengths(Intervals + 1);
+		Lengths[0] = static_cast<T>(0);
+		for(std::size_t i = 1; i <= Intervals; ++i)
+			Lengths[i] = Lengths[i - 1] + distance(Points[i - 1], Points[i]);
+		Spline.Length = Lengths[Intervals];
+
+		// Both the distances and the lengths increase so the intervals are found in a single pass
+		Spline.ArcParameters.resize(Intervals + 1);
+		std::size_t k = 0;
+		for(std::size_t i = 0; i <= Intervals; ++i)
+		{
+			T const Length = Spline.Length * static_cast<T>(i) / static_cast<T>(Intervals);
+			while(k + 1 < Intervals && Lengths[k + 1] < Length)
+				++k;
+
+			T const Interval = Lengths[k + 1] - Lengths[k];
+			T const f = Interval > static_cast<T>(0) ? clamp((Length - Lengths[k]) / Interval, static_cast<T>(0), static_cast<T>(1)) : static_cast<T>(0);
+			Spline.ArcParameters[i] = (static_cast<T>(k) + f) / static_cast<T>(Intervals);
+		}
+		Spline.ArcParameters[0] = static_cast<T>(0);
+		Spline.ArcParameters[Intervals] = static_cast<T>(1);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER T splineLength(tspline<L, T, Q> const& Spline)
+	{
+		return Spline.Length;
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER T splineParameter(tspline<L, T, Q> const& Spline, T Distance)
+	{
+		assert(Spline.ArcParameters.size() > 1);
+
+		std::size_t const Intervals = Spline.ArcParameters.size() - 1;
+		T const u = clamp(Distance, static_cast<T>(0), static_cast<T>(1)) * static_cast<T>(Intervals);
+		std::size_t const i = min(static_cast<std::size_t>(u), Intervals - 1);
+		return mix(Spline.ArcParameters[i], Spline.ArcParameters[i + 1], u - static_cast<T>(i));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void evaluateSplineConstantSpeed(tspline<L, T, Q> const& Spline, T const* Distances, std::size_t Count, vec<L, T, Q>* Points)
+	{
+		// Parameters are evaluated by chunks
+		T Parameters[256];
+		for(std::size_t Begin = 0; Begin < Count; Begin += 256)
+		{
+			std::size_t const Size = min<std::size_t>(Count - Begin, 256);
+			for(std::size_t i = 0; i < Size; ++i)
+				Parameters[i] = splineParameter(Spline, Distances[Begin + i]);
+			evaluateSpline(Spline, Parameters, Size, Points + Begin);
+		}
+	}
 }//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "spline_simd.inl"
+#endif
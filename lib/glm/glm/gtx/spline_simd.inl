@@ -0,0 +1,84 @@
+/// @ref gtx_spline
+/// @file glm/gtx/spline_simd.inl
+
+#include "../simd/common.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void spline_store(vec<1, float, Q>* p, glm_vec4 v)
+	{
+		_mm_store_ss(reinterpret_cast<float*>(p), v);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void spline_store(vec<2, float, Q>* p, glm_vec4 v)
+	{
+		_mm_storel_pi(reinterpret_cast<__m64*>(p), v);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void spline_store(vec<3, float, Q>* p, glm_vec4 v)
+	{
+		_mm_storel_pi(reinterpret_cast<__m64*>(p), v);
+		_mm_store_ss(reinterpret_cast<float*>(p) + 2, _mm_movehl_ps(v, v));
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void spline_store(vec<4, float, Q>* p, glm_vec4 v)
+	{
+		_mm_storeu_ps(reinterpret_cast<float*>(p), v);
+	}
+
+	// Segments and segment parameters are computed 4 parameters at a time,
+	// then each point is the Horner evaluation of its segment coefficients as one register
+	template<length_t L, qualifier Q>
+	struct compute_spline<L, float, Q>
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<4, float, Q> const* Coefficients, std::size_t SegmentCount, float const* t, std::size_t Count, vec<L, float, Q>* Points)
+		{
+			float const* const c = reinterpret_cast<float const*>(Coefficients);
+			glm_vec4 const Segments = _mm_set1_ps(static_cast<float>(SegmentCount));
+			glm_vec4 const LastSegment = _mm_set1_ps(static_cast<float>(SegmentCount - 1));
+
+			std::size_t i = 0;
+			for(; i + 4 <= Count; i += 4)
+			{
+				glm_vec4 const u = _mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(t + i), _mm_setzero_ps()), _mm_set1_ps(1.0f)), Segments);
+				glm_vec4 const Segment = _mm_min_ps(_mm_cvtepi32_ps(_mm_cvttps_epi32(u)), LastSegment);
+
+				int Index[4];
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Index), _mm_cvttps_epi32(Segment));
+				glm_vec4 const s = _mm_sub_ps(u, Segment);
+
+				glm_vec4 const s0 = _mm_shuffle_ps(s, s, _MM_SHUFFLE(0, 0, 0, 0));
+				glm_vec4 const s1 = _mm_shuffle_ps(s, s, _MM_SHUFFLE(1, 1, 1, 1));
+				glm_vec4 const s2 = _mm_shuffle_ps(s, s, _MM_SHUFFLE(2, 2, 2, 2));
+				glm_vec4 const s3 = _mm_shuffle_ps(s, s, _MM_SHUFFLE(3, 3, 3, 3));
+
+				spline_store(Points + i + 0, horner(c + Index[0] * 16, s0));
+				spline_store(Points + i + 1, horner(c + Index[1] * 16, s1));
+				spline_store(Points + i + 2, horner(c + Index[2] * 16, s2));
+				spline_store(Points + i + 3, horner(c + Index[3] * 16, s3));
+			}
+
+			for(; i < Count; ++i)
+			{
+				std::size_t Segment;
+				float const s = spline_segment(t[i], SegmentCount, Segment);
+				spline_store(Points + i, horner(c + Segment * 16, _mm_set1_ps(s)));
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static glm_vec4 horner(float const* c, glm_vec4 s)
+		{
+			return glm_vec4_fma(glm_vec4_fma(glm_vec4_fma(_mm_loadu_ps(c), s, _mm_loadu_ps(c + 4)), s, _mm_loadu_ps(c + 8)), s, _mm_loadu_ps(c + 12));
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
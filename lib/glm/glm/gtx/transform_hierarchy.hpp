@@ -0,0 +1,126 @@
+/// @ref gtx_transform_hierarchy
+/// @file glm/gtx/transform_hierarchy.hpp
+///
+/// @see core (dependence)
+/// @see gtc_quaternion (dependence)
+/// @see ext_matrix_affine (dependence)
+///
+/// @defgroup gtx_transform_hierarchy GLM_GTX_transform_hierarchy
+/// @ingroup gtx
+///
+/// Include <glm/gtx/transform_hierarchy.hpp> to use the features of this extension.
+///
+/// Hierarchy of transforms, such as the nodes of a scene graph, computing the world transform of each node
+/// from its local translation, rotation and scale and from the world transform of its parent.
+///
+/// Nodes are stored by depth in structure of arrays: the roots first, then their children and so on, so that
+/// the parents of a level are all updated before it. Within a level, nodes keep the order of their identifiers.
+/// Only the nodes whose local transform changed since the last update and their descendants are updated.
+/// When the C++11 standard library is available, the large levels are split between several threads.
+///
+/// World transforms are affine 3x4 matrices composed with affineCompose from GLM_EXT_matrix_affine,
+/// use mat4_cast to get a mat4.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../ext/scalar_uint_sized.hpp"
+#include "../ext/matrix_affine.hpp"
+#include "../gtc/quaternion.hpp"
+#include <cstddef>
+#include <vector>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_transform_hierarchy is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	else
+#		pragma message("GLM: GLM_GTX_transform_hierarchy extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_transform_hierarchy
+	/// @{
+
+	/// Hierarchy of transforms in depth order.
+	///
+	/// Nodes are referred to by the identifiers given to buildTransformHierarchy, Slots maps them to their
+	/// position in the arrays.
+	///
+	/// @tparam T Floating-point scalar type
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q = defaultp>
+	struct ttransform_hierarchy
+	{
+		/// Parent identifier of the root nodes.
+		static uint32 const root = 0xFFFFFFFFu;
+
+		/// Position of the parent of each node, root for the root nodes.
+		std::vector<uint32> Parents;
+
+		/// Local translation of each node.
+		std::vector<vec<3, T, Q> > Translations;
+
+		/// Local rotation of each node.
+		std::vector<qua<T, Q> > Rotations;
+
+		/// Local scale of each node.
+		std::vector<vec<3, T, Q> > Scales;
+
+		/// World transform of each node as computed by the last update.
+		std::vector<mat<3, 4, T, Q> > Worlds;
+
+		/// Non zero when the local transform of a node changed since the last update.
+		std::vector<uint8> Dirty;
+
+		/// First position of each depth, the last value is the number of nodes.
+		std::vector<uint32> Levels;
+
+		/// Position of each node identifier.
+		std::vector<uint32> Slots;
+	};
+
+	/// Build a hierarchy from the parent of each node, replacing the content of Hierarchy.
+	/// Local transforms are set to identity and all nodes are dirty.
+	///
+	/// @param Hierarchy Hierarchy to build.
+	/// @param Parents Array of NodeCount parent identifiers, ttransform_hierarchy<T, Q>::root for the root nodes.
+	/// Parents may be given in any order but must not form cycles.
+	/// @param NodeCount Number of nodes.
+	///
+	/// @see gtx_transform_hierarchy
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void buildTransformHierarchy(ttransform_hierarchy<T, Q>& Hierarchy, uint32 const* Parents, std::size_t NodeCount);
+
+	/// Set the local transform of a node, the node and its descendants are updated by the next update.
+	///
+	/// @see gtx_transform_hierarchy
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void setLocalTransform(ttransform_hierarchy<T, Q>& Hierarchy, uint32 Node,
+		vec<3, T, Q> const& Translation, qua<T, Q> const& Rotation, vec<3, T, Q> const& Scale);
+
+	/// Compute the world transform of the dirty nodes and of their descendants, level by level, then clear the dirty flags.
+	///
+	/// @param Hierarchy Hierarchy to update.
+	/// @param ThreadCount Maximum number of threads updating a level, 0 to use the number of hardware threads.
+	/// @return The number of updated nodes.
+	///
+	/// @see gtx_transform_hierarchy
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL std::size_t updateTransformHierarchy(ttransform_hierarchy<T, Q>& Hierarchy, unsigned ThreadCount = 1);
+
+	/// Returns the world transform of a node as computed by the last update.
+	///
+	/// @see gtx_transform_hierarchy
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<3, 4, T, Q> const& worldTransform(ttransform_hierarchy<T, Q> const& Hierarchy, uint32 Node);
+
+	typedef ttransform_hierarchy<float, defaultp> transform_hierarchy;
+	typedef ttransform_hierarchy<double, defaultp> dtransform_hierarchy;
+
+	/// @}
+}//namespace glm
+
+#include "transform_hierarchy.inl"
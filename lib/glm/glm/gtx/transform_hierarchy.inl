@@ -0,0 +1,181 @@
+/// @ref gtx_transform_hierarchy
+
+#include <algorithm>
+#include <limits>
+#if GLM_HAS_CXX11_STL
+#	include <thread>
+#	include <functional>
+#endif
+
+namespace glm{
+namespace detail
+{
+	// Smaller levels, or level chunks, are updated by the calling thread
+	static std::size_t const transform_hierarchy_min_thread_size = 8192;
+
+	// Rows of the affine transform scaling, rotating then translating
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 4, T, Q> transform_hierarchy_local(vec<3, T, Q> const& Translation, qua<T, Q> const& Rotation, vec<3, T, Q> const& Scale)
+	{
+		mat<3, 3, T, Q> const Linear(mat3_cast(Rotation));
+
+		mat<3, 4, T, Q> Result;
+		for(length_t r = 0; r < 3; ++r)
+			Result[r] = vec<4, T, Q>(Linear[0][r] * Scale.x, Linear[1][r] * Scale.y, Linear[2][r] * Scale.z, Translation[r]);
+		return Result;
+	}
+
+	// A node is updated when it is dirty or when its parent was updated, its flag is then set for its children.
+	// When no node of the previous level was updated, only the dirty flags of the level are read.
+	template<typename T, qualifier Q>
+	inline void transform_hierarchy_update(ttransform_hierarchy<T, Q>& Hierarchy, std::size_t Begin, std::size_t End, bool ParentsUpdated, std::size_t& Count)
+	{
+		uint32 const Root = ttransform_hierarchy<T, Q>::root;
+		uint8 const* const Dirty = &Hierarchy.Dirty[0];
+
+		std::size_t Updated = 0;
+		for(std::size_t i = Begin; i < End; ++i)
+		{
+			if(Dirty[i] == 0 && !ParentsUpdated)
+				continue;
+
+			uint32 const Parent = Hierarchy.Parents[i];
+			if(Dirty[i] == 0 && (Parent == Root || Dirty[Parent] == 0))
+				continue;
+
+			mat<3, 4, T, Q> const Local = transform_hierarchy_local(Hierarchy.Translations[i], Hierarchy.Rotations[i], Hierarchy.Scales[i]);
+			Hierarchy.Worlds[i] = Parent == Root ? Local : affineCompose(Hierarchy.Worlds[Parent], Local);
+			Hierarchy.Dirty[i] = 1;
+			++Updated;
+		}
+		Count = Updated;
+	}
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	uint32 const ttransform_hierarchy<T, Q>::root;
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void buildTransformHierarchy(ttransform_hierarchy<T, Q>& Hierarchy, uint32 const* Parents, std::size_t NodeCount)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'buildTransformHierarchy' only accept floating-point inputs");
+
+		uint32 const Root = ttransform_hierarchy<T, Q>::root;
+
+		// Depth of each node, the ancestors with an unknown depth are stacked then resolved top down
+		std::vector<uint32> Depths(NodeCount, Root);
+		std::vector<uint32> Stack;
+		uint32 MaxDepth = 0;
+		for(std::size_t i = 0; i < NodeCount; ++i)
+		{
+			uint32 Node = static_cast<uint32>(i);
+			while(Depths[Node] == Root)
+			{
+				assert(Stack.size() < NodeCount);
+				Stack.push_back(Node);
+				if(Parents[Node] == Root)
+					break;
+				Node = Parents[Node];
+			}
+
+			while(!Stack.empty())
+			{
+				uint32 const Child = Stack.back();
+				Stack.pop_back();
+				Depths[Child] = Parents[Child] == Root ? 0 : Depths[Parents[Child]] + 1;
+				MaxDepth = max(MaxDepth, Depths[Child]);
+			}
+		}
+
+		// Counting sort by depth, keeping the order of the identifiers within a level
+		Hierarchy.Levels.assign(NodeCount > 0 ? MaxDepth + 2 : 1, 0);
+		for(std::size_t i = 0; i < NodeCount; ++i)
+			++Hierarchy.Levels[Depths[i] + 1];
+		for(std::size_t Level = 1; Level < Hierarchy.Levels.size(); ++Level)
+			Hierarchy.Levels[Level] += Hierarchy.Levels[Level - 1];
+
+		std::vector<uint32> Cursors(Hierarchy.Levels.begin(), Hierarchy.Levels.end());
+		Hierarchy.Slots.resize(NodeCount);
+		for(std::size_t i = 0; i < NodeCount; ++i)
+			Hierarchy.Slots[i] = Cursors[Depths[i]]++;
+
+		Hierarchy.Parents.resize(NodeCount);
+		for(std::size_t i = 0; i < NodeCount; ++i)
+			Hierarchy.Parents[Hierarchy.Slots[i]] = Parents[i] == Root ? Root : Hierarchy.Slots[Parents[i]];
+
+		Hierarchy.Translations.assign(NodeCount, vec<3, T, Q>(static_cast<T>(0)));
+		Hierarchy.Rotations.assign(NodeCount, qua<T, Q>(static_cast<T>(1), vec<3, T, Q>(static_cast<T>(0))));
+		Hierarchy.Scales.assign(NodeCount, vec<3, T, Q>(static_cast<T>(1)));
+		Hierarchy.Worlds.assign(NodeCount, mat<3, 4, T, Q>(static_cast<T>(1)));
+		Hierarchy.Dirty.assign(NodeCount, 1);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void setLocalTransform(ttransform_hierarchy<T, Q>& Hierarchy, uint32 Node,
+		vec<3, T, Q> const& Translation, qua<T, Q> const& Rotation, vec<3, T, Q> const& Scale)
+	{
+		uint32 const Slot = Hierarchy.Slots[Node];
+		Hierarchy.Translations[Slot] = Translation;
+		Hierarchy.Rotations[Slot] = Rotation;
+		Hierarchy.Scales[Slot] = Scale;
+		Hierarchy.Dirty[Slot] = 1;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t updateTransformHierarchy(ttransform_hierarchy<T, Q>& Hierarchy, unsigned ThreadCount)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'updateTransformHierarchy' only accept floating-point inputs");
+
+#		if GLM_HAS_CXX11_STL
+			if(ThreadCount == 0)
+				ThreadCount = std::thread::hardware_concurrency();
+			std::vector<std::thread> Threads;
+			std::vector<std::size_t> Counts(std::max(ThreadCount, 1u));
+#		else
+			static_cast<void>(ThreadCount);
+#		endif
+
+		// The parents of a level are in the previous levels so the threads of a level write disjoint ranges
+		std::size_t Updated = 0;
+		std::size_t LevelUpdated = 0;
+		for(std::size_t Level = 0; Level + 1 < Hierarchy.Levels.size(); ++Level)
+		{
+			std::size_t const Begin = Hierarchy.Levels[Level];
+			std::size_t const End = Hierarchy.Levels[Level + 1];
+			bool const ParentsUpdated = LevelUpdated > 0;
+			LevelUpdated = 0;
+
+#			if GLM_HAS_CXX11_STL
+				std::size_t const Split = std::min<std::size_t>(ThreadCount, (End - Begin) / detail::transform_hierarchy_min_thread_size);
+				if(Split > 1)
+				{
+					for(std::size_t Thread = 1; Thread < Split; ++Thread)
+						Threads.push_back(std::thread(detail::transform_hierarchy_update<T, Q>, std::ref(Hierarchy),
+							Begin + (End - Begin) * Thread / Split, Begin + (End - Begin) * (Thread + 1) / Split, ParentsUpdated, std::ref(Counts[Thread])));
+					detail::transform_hierarchy_update(Hierarchy, Begin, Begin + (End - Begin) / Split, ParentsUpdated, Counts[0]);
+
+					for(std::size_t Thread = 0; Thread < Threads.size(); ++Thread)
+						Threads[Thread].join();
+					Threads.clear();
+
+					for(std::size_t Thread = 0; Thread < Split; ++Thread)
+						LevelUpdated += Counts[Thread];
+					Updated += LevelUpdated;
+					continue;
+				}
+#			endif
+
+			detail::transform_hierarchy_update(Hierarchy, Begin, End, ParentsUpdated, LevelUpdated);
+			Updated += LevelUpdated;
+		}
+
+		std::fill(Hierarchy.Dirty.begin(), Hierarchy.Dirty.end(), static_cast<uint8>(0));
+		return Updated;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 4, T, Q> const& worldTransform(ttransform_hierarchy<T, Q> const& Hierarchy, uint32 Node)
+	{
+		return Hierarchy.Worlds[Hierarchy.Slots[Node]];
+	}
+}//namespace glm
@@ -1,20 +1,284 @@
 /// @ref simd
-/// @file glm/simd/experimental.h
+/// @file glm/simd/exponential.h
+///
+/// Cephes style range reduced approximations of the single precision exponential functions.
+/// Maximum errors measured against the double precision C library:
+/// - glm_vec4_exp, glm_vec4_exp2: 1 ULP, denormal results included
+/// - glm_vec4_log, glm_vec4_log2: 1 ULP, denormal inputs included
+/// - glm_vec4_pow: 4 ULP for |y| <= 8, the error grows linearly with |y| beyond
+/// The _lowp and _mediump functions implement the approximations of the lowp and mediump qualifiers, see detail/compute_approximation.hpp.
 
 #pragma once
 
-#include "platform.h"
+#include "common.h"
 
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
+// log(0) = -inf, log(+inf) = +inf, log(x < 0) = log(NaN) = NaN
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_log_special(glm_vec4 x, glm_vec4 r)
+{
+	glm_vec4 const inf0 = _mm_castsi128_ps(_mm_set1_epi32(0x7F800000));
+	glm_vec4 const zro0 = _mm_cmpeq_ps(x, _mm_setzero_ps());
+	glm_vec4 const nan0 = _mm_cmpnge_ps(x, _mm_setzero_ps());
+	glm_vec4 const pin0 = _mm_cmpeq_ps(x, inf0);
+	glm_vec4 const sel0 = glm_vec4_select(pin0, inf0, r);
+	glm_vec4 const sel1 = glm_vec4_select(zro0, _mm_xor_ps(inf0, _mm_set1_ps(-0.0f)), sel0);
+	return _mm_or_ps(sel1, nan0);
+}
+
+// sqrt(+inf) = +inf, sqrt(-0) = -0, sqrt(x < 0) = sqrt(NaN) = NaN, the result of positive finite lanes is r
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_sqrt_special(glm_vec4 x, glm_vec4 r)
+{
+	glm_vec4 const fin0 = _mm_and_ps(_mm_cmpgt_ps(x, _mm_setzero_ps()), _mm_cmplt_ps(x, _mm_castsi128_ps(_mm_set1_epi32(0x7F800000))));
+	return glm_vec4_select(fin0, r, _mm_or_ps(x, _mm_cmplt_ps(x, _mm_setzero_ps())));
+}
+
 GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec1_sqrt_lowp(glm_f32vec4 x)
 {
 	return _mm_mul_ss(_mm_rsqrt_ss(x), x);
 }
 
+// The reciprocal square root of 0 is infinite and the one of +inf is 0, both are special cases
 GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_sqrt_lowp(glm_f32vec4 x)
 {
-	return _mm_mul_ps(_mm_rsqrt_ps(x), x);
+	return glm_vec4_sqrt_special(x, _mm_mul_ps(_mm_rsqrt_ps(x), x));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_inversesqrt_lowp(glm_vec4 x)
+{
+	return _mm_rsqrt_ps(x);
+}
+
+// 1 / sqrt(x) refined by one Newton-Raphson step
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_inversesqrt_mediump(glm_vec4 x)
+{
+	glm_vec4 const rsq0 = _mm_rsqrt_ps(x);
+	glm_vec4 const hlf0 = glm_vec4_mul(x, _mm_set1_ps(0.5f));
+	glm_vec4 const mul0 = glm_vec4_mul(glm_vec4_mul(hlf0, rsq0), rsq0);
+	return glm_vec4_mul(rsq0, glm_vec4_sub(_mm_set1_ps(1.5f), mul0));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_sqrt_mediump(glm_vec4 x)
+{
+	return glm_vec4_sqrt_special(x, glm_vec4_mul(glm_vec4_inversesqrt_mediump(x), x));
+}
+
+// 2^n for integer n in [-252, 254], split in two factors so that denormal and infinite results are rounded by the multiplications
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_ldexp_poly(glm_vec4 p, glm_ivec4 n)
+{
+	glm_ivec4 const hlf0 = _mm_srai_epi32(n, 1);
+	glm_ivec4 const hlf1 = _mm_sub_epi32(n, hlf0);
+	glm_vec4 const pow0 = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(hlf0, _mm_set1_epi32(127)), 23));
+	glm_vec4 const pow1 = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(hlf1, _mm_set1_epi32(127)), 23));
+	return glm_vec4_mul(glm_vec4_mul(p, pow0), pow1);
+}
+
+// Split x in [-151, 129] as n + f with f in [-0.5, 0.5], 2^-151 rounds to 0 and 2^129 overflows to +inf
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_exp2_approx_reduce(glm_vec4 x, glm_ivec4& n)
+{
+	// max and min return their second operand when one is NaN so that NaN is propagated
+	glm_vec4 const clp0 = _mm_min_ps(_mm_set1_ps(129.0f), _mm_max_ps(_mm_set1_ps(-151.0f), x));
+	n = _mm_cvtps_epi32(clp0);
+	return glm_vec4_sub(clp0, _mm_cvtepi32_ps(n));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_exp2_lowp(glm_vec4 x)
+{
+	glm_ivec4 n;
+	glm_vec4 const frc0 = glm_vec4_exp2_approx_reduce(x, n);
+	glm_vec4 const pol0 = glm_vec4_fma(_mm_set1_ps(0.0551716685f), frc0, _mm_set1_ps(0.24261114f));
+	glm_vec4 const pol1 = glm_vec4_fma(pol0, frc0, _mm_set1_ps(0.693260968f));
+	glm_vec4 const pol2 = glm_vec4_fma(pol1, frc0, _mm_set1_ps(0.999928057f));
+	return glm_vec4_ldexp_poly(pol2, n);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_exp2_mediump(glm_vec4 x)
+{
+	glm_ivec4 n;
+	glm_vec4 const frc0 = glm_vec4_exp2_approx_reduce(x, n);
+	glm_vec4 const pol0 = glm_vec4_fma(_mm_set1_ps(0.00957010221f), frc0, _mm_set1_ps(0.0559178628f));
+	glm_vec4 const pol1 = glm_vec4_fma(pol0, frc0, _mm_set1_ps(0.240247443f));
+	glm_vec4 const pol2 = glm_vec4_fma(pol1, frc0, _mm_set1_ps(0.693121791f));
+	glm_vec4 const pol3 = glm_vec4_fma(pol2, frc0, _mm_set1_ps(0.999999285f));
+	return glm_vec4_ldexp_poly(pol3, n);
+}
+
+// Split a positive normal x as 2^e * (1 + u) with 1 + u in [sqrt(2) / 2, sqrt(2)), 0x3f3504f3 are the bits of sqrt(2) / 2
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_log2_approx_reduce(glm_vec4 x, glm_vec4& e)
+{
+	glm_ivec4 const bit0 = _mm_sub_epi32(_mm_castps_si128(x), _mm_set1_epi32(0x3f3504f3));
+	e = _mm_cvtepi32_ps(_mm_srai_epi32(bit0, 23));
+	glm_ivec4 const man0 = _mm_add_epi32(_mm_and_si128(bit0, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3f3504f3));
+	return glm_vec4_sub(_mm_castsi128_ps(man0), _mm_set1_ps(1.0f));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_log2_lowp(glm_vec4 x)
+{
+	glm_vec4 e;
+	glm_vec4 const man0 = glm_vec4_log2_approx_reduce(x, e);
+	glm_vec4 const pol0 = glm_vec4_fma(_mm_set1_ps(0.252660364f), man0, _mm_set1_ps(-0.394575506f));
+	glm_vec4 const pol1 = glm_vec4_fma(pol0, man0, _mm_set1_ps(0.48668617f));
+	glm_vec4 const pol2 = glm_vec4_fma(pol1, man0, _mm_set1_ps(-0.720241785f));
+	glm_vec4 const pol3 = glm_vec4_fma(pol2, man0, _mm_set1_ps(1.44257796f));
+	return glm_vec4_log_special(x, glm_vec4_fma(pol3, man0, e));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_log2_mediump(glm_vec4 x)
+{
+	glm_vec4 e;
+	glm_vec4 const man0 = glm_vec4_log2_approx_reduce(x, e);
+	glm_vec4 const pol0 = glm_vec4_fma(_mm_set1_ps(0.170634538f), man0, _mm_set1_ps(-0.272698045f));
+	glm_vec4 const pol1 = glm_vec4_fma(pol0, man0, _mm_set1_ps(0.297262609f));
+	glm_vec4 const pol2 = glm_vec4_fma(pol1, man0, _mm_set1_ps(-0.35896185f));
+	glm_vec4 const pol3 = glm_vec4_fma(pol2, man0, _mm_set1_ps(0.480465025f));
+	glm_vec4 const pol4 = glm_vec4_fma(pol3, man0, _mm_set1_ps(-0.721375883f));
+	glm_vec4 const pol5 = glm_vec4_fma(pol4, man0, _mm_set1_ps(1.44269967f));
+	return glm_vec4_log_special(x, glm_vec4_fma(pol5, man0, e));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_exp_lowp(glm_vec4 x)
+{
+	return glm_vec4_exp2_lowp(glm_vec4_mul(x, _mm_set1_ps(1.44269504f)));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_exp_mediump(glm_vec4 x)
+{
+	return glm_vec4_exp2_mediump(glm_vec4_mul(x, _mm_set1_ps(1.44269504f)));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_log_lowp(glm_vec4 x)
+{
+	return glm_vec4_mul(glm_vec4_log2_lowp(x), _mm_set1_ps(0.693147181f));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_log_mediump(glm_vec4 x)
+{
+	return glm_vec4_mul(glm_vec4_log2_mediump(x), _mm_set1_ps(0.693147181f));
+}
+
+// 2^x for x in [-0.5, 0.5]
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_exp2_poly(glm_vec4 x)
+{
+	glm_vec4 const pol0 = glm_vec4_fma(_mm_set1_ps(1.535336188319500e-4f), x, _mm_set1_ps(1.339887440266574e-3f));
+	glm_vec4 const pol1 = glm_vec4_fma(pol0, x, _mm_set1_ps(9.618437357674640e-3f));
+	glm_vec4 const pol2 = glm_vec4_fma(pol1, x, _mm_set1_ps(5.550332471162809e-2f));
+	glm_vec4 const pol3 = glm_vec4_fma(pol2, x, _mm_set1_ps(2.402264791363012e-1f));
+	glm_vec4 const pol4 = glm_vec4_fma(pol3, x, _mm_set1_ps(6.931472028550421e-1f));
+	return glm_vec4_fma(pol4, x, _mm_set1_ps(1.0f));
+}
+
+// e^x for x in [-ln(2) / 2, ln(2) / 2]
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_exp_poly(glm_vec4 x)
+{
+	glm_vec4 const pol0 = glm_vec4_fma(_mm_set1_ps(1.9875691500e-4f), x, _mm_set1_ps(1.3981999507e-3f));
+	glm_vec4 const pol1 = glm_vec4_fma(pol0, x, _mm_set1_ps(8.3334519073e-3f));
+	glm_vec4 const pol2 = glm_vec4_fma(pol1, x, _mm_set1_ps(4.1665795894e-2f));
+	glm_vec4 const pol3 = glm_vec4_fma(pol2, x, _mm_set1_ps(1.6666665459e-1f));
+	glm_vec4 const pol4 = glm_vec4_fma(pol3, x, _mm_set1_ps(5.0000001201e-1f));
+	glm_vec4 const mad0 = glm_vec4_fma(glm_vec4_mul(pol4, x), x, x);
+	return glm_vec4_add(mad0, _mm_set1_ps(1.0f));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_exp2(glm_vec4 x)
+{
+	// max and min return their second operand when one is NaN so that NaN is propagated
+	glm_vec4 const clp0 = _mm_min_ps(_mm_set1_ps(129.0f), _mm_max_ps(_mm_set1_ps(-151.0f), x));
+	glm_ivec4 const int0 = _mm_cvtps_epi32(clp0);
+	glm_vec4 const frc0 = glm_vec4_sub(clp0, _mm_cvtepi32_ps(int0));
+	return glm_vec4_ldexp_poly(glm_vec4_exp2_poly(frc0), int0);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_exp(glm_vec4 x)
+{
+	glm_vec4 const clp0 = _mm_min_ps(_mm_set1_ps(89.0f), _mm_max_ps(_mm_set1_ps(-104.0f), x));
+	glm_ivec4 const int0 = _mm_cvtps_epi32(glm_vec4_mul(clp0, _mm_set1_ps(1.44269504088896341f)));
+	glm_vec4 const int1 = _mm_cvtepi32_ps(int0);
+
+	// Two-part Cody-Waite reduction by n * ln(2)
+	glm_vec4 const red0 = glm_vec4_fma(int1, _mm_set1_ps(-0.693359375f), clp0);
+	glm_vec4 const red1 = glm_vec4_fma(int1, _mm_set1_ps(2.12194440e-4f), red0);
+	return glm_vec4_ldexp_poly(glm_vec4_exp_poly(red1), int0);
+}
+
+// Split x > 0 as 2^e * (1 + m) with 1 + m in [sqrt(2) / 2, sqrt(2)), denormals included, and return m and log(1 + m) - m
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_log_core(glm_vec4 x, glm_vec4& e, glm_vec4& m)
+{
+	glm_vec4 const dnm0 = _mm_cmplt_ps(x, _mm_set1_ps(1.17549435e-38f));
+	glm_vec4 const nrm0 = glm_vec4_select(dnm0, glm_vec4_mul(x, _mm_set1_ps(8388608.0f)), x);
+	glm_ivec4 const bia0 = _mm_add_epi32(_mm_set1_epi32(126), _mm_and_si128(_mm_castps_si128(dnm0), _mm_set1_epi32(23)));
+
+	glm_ivec4 const bit0 = _mm_castps_si128(nrm0);
+	glm_ivec4 const exp0 = _mm_sub_epi32(_mm_srli_epi32(bit0, 23), bia0);
+	glm_vec4 const man0 = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bit0, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3F000000)));
+
+	// Mantissa in [0.5, 1): below sqrt(2) / 2 use 2 * man0 - 1 with e - 1, otherwise man0 - 1 with e
+	glm_vec4 const sml0 = _mm_cmplt_ps(man0, _mm_set1_ps(0.707106781186547524f));
+	e = glm_vec4_sub(_mm_cvtepi32_ps(exp0), _mm_and_ps(sml0, _mm_set1_ps(1.0f)));
+	m = glm_vec4_add(glm_vec4_sub(man0, _mm_set1_ps(1.0f)), _mm_and_ps(sml0, man0));
+
+	glm_vec4 const sqr0 = glm_vec4_mul(m, m);
+	glm_vec4 const pol0 = glm_vec4_fma(_mm_set1_ps(7.0376836292e-2f), m, _mm_set1_ps(-1.1514610310e-1f));
+	glm_vec4 const pol1 = glm_vec4_fma(pol0, m, _mm_set1_ps(1.1676998740e-1f));
+	glm_vec4 const pol2 = glm_vec4_fma(pol1, m, _mm_set1_ps(-1.2420140846e-1f));
+	glm_vec4 const pol3 = glm_vec4_fma(pol2, m, _mm_set1_ps(1.4249322787e-1f));
+	glm_vec4 const pol4 = glm_vec4_fma(pol3, m, _mm_set1_ps(-1.6668057665e-1f));
+	glm_vec4 const pol5 = glm_vec4_fma(pol4, m, _mm_set1_ps(2.0000714765e-1f));
+	glm_vec4 const pol6 = glm_vec4_fma(pol5, m, _mm_set1_ps(-2.4999993993e-1f));
+	glm_vec4 const pol7 = glm_vec4_fma(pol6, m, _mm_set1_ps(3.3333331174e-1f));
+	glm_vec4 const mul0 = glm_vec4_mul(glm_vec4_mul(pol7, m), sqr0);
+	return glm_vec4_fma(sqr0, _mm_set1_ps(-0.5f), mul0);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_log(glm_vec4 x)
+{
+	glm_vec4 e, m;
+	glm_vec4 const lgm0 = glm_vec4_log_core(x, e, m);
+
+	// e * ln(2) added in two parts around the mantissa terms
+	glm_vec4 const add0 = glm_vec4_fma(e, _mm_set1_ps(-2.12194440e-4f), lgm0);
+	glm_vec4 const add1 = glm_vec4_add(m, add0);
+	glm_vec4 const add2 = glm_vec4_fma(e, _mm_set1_ps(0.693359375f), add1);
+	return glm_vec4_log_special(x, add2);
+}
+
+// log2(1 + m) as m + lgm + (m + lgm) * (log2(e) - 1)
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_log2_mantissa(glm_vec4 m, glm_vec4 lgm)
+{
+	glm_vec4 const mul0 = glm_vec4_mul(m, _mm_set1_ps(0.44269504088896340736f));
+	glm_vec4 const mad0 = glm_vec4_fma(lgm, _mm_set1_ps(0.44269504088896340736f), mul0);
+	return glm_vec4_add(glm_vec4_add(mad0, lgm), m);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_log2(glm_vec4 x)
+{
+	glm_vec4 e, m;
+	glm_vec4 const lgm0 = glm_vec4_log_core(x, e, m);
+	glm_vec4 const add0 = glm_vec4_add(glm_vec4_log2_mantissa(m, lgm0), e);
+	return glm_vec4_log_special(x, add0);
+}
+
+// x^y for finite x > 0 and |y| <= 65536, other inputs are not handled
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_pow(glm_vec4 x, glm_vec4 y)
+{
+	glm_vec4 e, m;
+	glm_vec4 const lgm0 = glm_vec4_log_core(x, e, m);
+	glm_vec4 const lgm1 = glm_vec4_log2_mantissa(m, lgm0);
+
+	// y * e computed exactly as hi + lo: e has 8 significant bits and y is split in two 12 bits halves
+	glm_vec4 const yhi0 = _mm_and_ps(y, _mm_castsi128_ps(_mm_set1_epi32(int(0xFFFFF000))));
+	glm_vec4 const ylo0 = glm_vec4_sub(y, yhi0);
+	glm_vec4 const phi0 = glm_vec4_mul(yhi0, e);
+	glm_vec4 const plo0 = glm_vec4_mul(ylo0, e);
+
+	glm_ivec4 const int0 = _mm_cvtps_epi32(phi0);
+	glm_vec4 const frc0 = glm_vec4_add(glm_vec4_sub(phi0, _mm_cvtepi32_ps(int0)), glm_vec4_fma(y, lgm1, plo0));
+
+	// frc0 may exceed [-0.5, 0.5] by y * log2(1 + m), move its integer part to the exponent
+	glm_ivec4 const int1 = _mm_cvtps_epi32(frc0);
+	glm_vec4 const frc1 = glm_vec4_sub(frc0, _mm_cvtepi32_ps(int1));
+	glm_vec4 const int2 = _mm_cvtepi32_ps(_mm_add_epi32(int0, int1));
+	glm_ivec4 const int3 = _mm_cvtps_epi32(_mm_min_ps(_mm_set1_ps(254.0f), _mm_max_ps(_mm_set1_ps(-252.0f), int2)));
+	return glm_vec4_ldexp_poly(glm_vec4_exp2_poly(frc1), int3);
 }
 
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
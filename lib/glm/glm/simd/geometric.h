@@ -4,6 +4,7 @@
 #pragma once
 
 #include "common.h"
+#include "exponential.h"
 
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
@@ -75,6 +76,14 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_cross(glm_vec4 v1, glm_vec4 v2)
 }
 
 GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_normalize(glm_vec4 v)
+{
+	glm_vec4 const dot0 = glm_vec4_dot(v, v);
+	glm_vec4 const sqt0 = _mm_sqrt_ps(dot0);
+	glm_vec4 const div0 = _mm_div_ps(v, sqt0);
+	return div0;
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_normalize_lowp(glm_vec4 v)
 {
 	glm_vec4 const dot0 = glm_vec4_dot(v, v);
 	glm_vec4 const isr0 = _mm_rsqrt_ps(dot0);
@@ -82,6 +91,14 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_normalize(glm_vec4 v)
 	return mul0;
 }
 
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_normalize_mediump(glm_vec4 v)
+{
+	glm_vec4 const dot0 = glm_vec4_dot(v, v);
+	glm_vec4 const isr0 = glm_vec4_inversesqrt_mediump(dot0);
+	glm_vec4 const mul0 = _mm_mul_ps(v, isr0);
+	return mul0;
+}
+
 GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_faceforward(glm_vec4 N, glm_vec4 I, glm_vec4 Nref)
 {
 	glm_vec4 const dot0 = glm_vec4_dot(Nref, I);
@@ -121,4 +138,60 @@ GLM_FUNC_QUALIFIER __m128 glm_vec4_refract(glm_vec4 I, glm_vec4 N, glm_vec4 eta)
 	return sub2;
 }
 
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_dot(glm_dvec4 v1, glm_dvec4 v2)
+{
+	glm_dvec4 const mul0 = _mm256_mul_pd(v1, v2);
+	glm_dvec4 const hadd0 = _mm256_hadd_pd(mul0, mul0);
+	glm_dvec4 const swp0 = _mm256_permute2f128_pd(hadd0, hadd0, 0x01);
+	glm_dvec4 const add0 = _mm256_add_pd(hadd0, swp0);
+	return add0;
+}
+
+// The dot product is broadcast, 128 bits sqrt and div are much cheaper than the 256 bits ones
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_length(glm_dvec4 x)
+{
+	glm_dvec4 const dot0 = glm_dvec4_dot(x, x);
+	glm_dvec2 const sqt0 = _mm_sqrt_pd(_mm256_castpd256_pd128(dot0));
+	return _mm256_insertf128_pd(_mm256_castpd128_pd256(sqt0), sqt0, 1);
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_distance(glm_dvec4 p0, glm_dvec4 p1)
+{
+	glm_dvec4 const sub0 = _mm256_sub_pd(p0, p1);
+	glm_dvec4 const len0 = glm_dvec4_length(sub0);
+	return len0;
+}
+
+// AVX has no cross lane double shuffle, swizzles are a permute2f128 and two in lane permutes
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_cross(glm_dvec4 v1, glm_dvec4 v2)
+{
+	glm_dvec4 const rot1 = _mm256_permute2f128_pd(v1, v1, 0x01);
+	glm_dvec4 const rot2 = _mm256_permute2f128_pd(v2, v2, 0x01);
+
+	// (y, z, x, w)
+	glm_dvec4 const swp0 = _mm256_blend_pd(_mm256_permute_pd(v1, 0x9), _mm256_permute_pd(rot1, 0x0), 0x6);
+	glm_dvec4 const swp2 = _mm256_blend_pd(_mm256_permute_pd(v2, 0x9), _mm256_permute_pd(rot2, 0x0), 0x6);
+	// (z, x, y, w)
+	glm_dvec4 const swp1 = _mm256_blend_pd(_mm256_permute_pd(v1, 0x8), _mm256_permute_pd(rot1, 0x4), 0x5);
+	glm_dvec4 const swp3 = _mm256_blend_pd(_mm256_permute_pd(v2, 0x8), _mm256_permute_pd(rot2, 0x4), 0x5);
+
+	glm_dvec4 const mul0 = _mm256_mul_pd(swp0, swp3);
+	glm_dvec4 const mul1 = _mm256_mul_pd(swp1, swp2);
+	glm_dvec4 const sub0 = _mm256_sub_pd(mul0, mul1);
+	return sub0;
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_normalize(glm_dvec4 v)
+{
+	glm_dvec4 const dot0 = glm_dvec4_dot(v, v);
+	glm_dvec2 const sqt0 = _mm_sqrt_pd(_mm256_castpd256_pd128(dot0));
+	glm_dvec2 const isr0 = _mm_div_pd(_mm_set1_pd(1.0), sqt0);
+	glm_dvec4 const mul0 = _mm256_mul_pd(v, _mm256_insertf128_pd(_mm256_castpd128_pd256(isr0), isr0, 1));
+	return mul0;
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
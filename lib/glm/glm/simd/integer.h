@@ -3,6 +3,25 @@
 
 #pragma once
 
+// BMI1, BMI2 and LZCNT have no arch bit: GCC and Clang enable them with -mbmi, -mbmi2 and -mlzcnt, Visual C++ with /arch:AVX2
+#if (GLM_ARCH & GLM_ARCH_AVX2_BIT) && (defined(__BMI__) || (GLM_COMPILER & GLM_COMPILER_VC))
+#	define GLM_ARCH_BMI 1
+#else
+#	define GLM_ARCH_BMI 0
+#endif
+
+#if (GLM_ARCH & GLM_ARCH_AVX2_BIT) && (defined(__BMI2__) || (GLM_COMPILER & GLM_COMPILER_VC))
+#	define GLM_ARCH_BMI2 1
+#else
+#	define GLM_ARCH_BMI2 0
+#endif
+
+#if (GLM_ARCH & GLM_ARCH_AVX2_BIT) && (defined(__LZCNT__) || (GLM_COMPILER & GLM_COMPILER_VC))
+#	define GLM_ARCH_LZCNT 1
+#else
+#	define GLM_ARCH_LZCNT 0
+#endif
+
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
 GLM_FUNC_QUALIFIER glm_uvec4 glm_i128_interleave(glm_uvec4 x)
@@ -112,4 +131,141 @@ GLM_FUNC_QUALIFIER glm_uvec4 glm_i128_interleave2(glm_uvec4 x, glm_uvec4 y)
 	return Reg1;
 }
 
+// Exponent of 4 floats, unbiased
+GLM_FUNC_QUALIFIER glm_ivec4 glm_ivec4_exponent(glm_vec4 x)
+{
+	glm_ivec4 const Bits = _mm_and_si128(_mm_srli_epi32(_mm_castps_si128(x), 23), _mm_set1_epi32(0xFF));
+	return _mm_sub_epi32(Bits, _mm_set1_epi32(127));
+}
+
+// Index of the highest set bit, -1 for 0.
+// x & ~(x >> 1) keeps the highest bit and no two adjacent bits below it so the float conversion can't round up to the next power of two.
+GLM_FUNC_QUALIFIER glm_ivec4 glm_ivec4_find_msb(glm_ivec4 x)
+{
+	glm_ivec4 const Sparse = _mm_andnot_si128(_mm_srli_epi32(x, 1), x);
+	glm_ivec4 const Exponent = glm_ivec4_exponent(_mm_cvtepi32_ps(Sparse));
+	glm_ivec4 const Top = _mm_srai_epi32(x, 31);
+	glm_ivec4 const Zero = _mm_cmpeq_epi32(x, _mm_setzero_si128());
+	return _mm_or_si128(_mm_or_si128(_mm_andnot_si128(Top, Exponent), _mm_and_si128(Top, _mm_set1_epi32(31))), Zero);
+}
+
+// Index of the lowest set bit, -1 for 0. x & -x is a power of two, exactly converted to float
+GLM_FUNC_QUALIFIER glm_ivec4 glm_ivec4_find_lsb(glm_ivec4 x)
+{
+	glm_ivec4 const Lowest = _mm_and_si128(x, _mm_sub_epi32(_mm_setzero_si128(), x));
+	glm_ivec4 const Exponent = glm_ivec4_exponent(_mm_cvtepi32_ps(Lowest));
+	return _mm_or_si128(Exponent, _mm_cmpeq_epi32(x, _mm_setzero_si128()));
+}
+
+// Number of set bits, with a nibble lookup table with SSSE3
+GLM_FUNC_QUALIFIER glm_ivec4 glm_ivec4_bit_count(glm_ivec4 x)
+{
+#	if GLM_ARCH & GLM_ARCH_SSSE3_BIT
+		glm_ivec4 const Table = _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+		glm_ivec4 const Nibble = _mm_set1_epi8(0x0F);
+		glm_ivec4 const Lo = _mm_shuffle_epi8(Table, _mm_and_si128(x, Nibble));
+		glm_ivec4 const Hi = _mm_shuffle_epi8(Table, _mm_and_si128(_mm_srli_epi16(x, 4), Nibble));
+		glm_ivec4 const Bytes = _mm_add_epi8(Lo, Hi);
+		return _mm_madd_epi16(_mm_maddubs_epi16(Bytes, _mm_set1_epi8(1)), _mm_set1_epi16(1));
+#	else
+		glm_ivec4 const Pairs = _mm_sub_epi32(x, _mm_and_si128(_mm_srli_epi32(x, 1), _mm_set1_epi32(0x55555555)));
+		glm_ivec4 const Quads = _mm_add_epi32(_mm_and_si128(Pairs, _mm_set1_epi32(0x33333333)), _mm_and_si128(_mm_srli_epi32(Pairs, 2), _mm_set1_epi32(0x33333333)));
+		glm_ivec4 const Bytes = _mm_and_si128(_mm_add_epi32(Quads, _mm_srli_epi32(Quads, 4)), _mm_set1_epi32(0x0F0F0F0F));
+		glm_ivec4 const Words = _mm_add_epi32(Bytes, _mm_srli_epi32(Bytes, 8));
+		return _mm_and_si128(_mm_add_epi32(Words, _mm_srli_epi32(Words, 16)), _mm_set1_epi32(0x3F));
+#	endif
+}
+
+// Unsigned x + y with the carry of each lane, 0 or 1
+GLM_FUNC_QUALIFIER glm_uvec4 glm_uvec4_add_carry(glm_uvec4 x, glm_uvec4 y, glm_uvec4* Carry)
+{
+	glm_uvec4 const Sign = _mm_set1_epi32(static_cast<int>(0x80000000));
+	glm_uvec4 const Sum = _mm_add_epi32(x, y);
+	*Carry = _mm_srli_epi32(_mm_cmpgt_epi32(_mm_xor_si128(x, Sign), _mm_xor_si128(Sum, Sign)), 31);
+	return Sum;
+}
+
+// Unsigned 64 bit products of the 4 lanes, split in their high and low 32 bits
+GLM_FUNC_QUALIFIER void glm_uvec4_mul_extended(glm_uvec4 x, glm_uvec4 y, glm_uvec4* Msb, glm_uvec4* Lsb)
+{
+	glm_uvec4 const Even = _mm_shuffle_epi32(_mm_mul_epu32(x, y), _MM_SHUFFLE(3, 1, 2, 0));
+	glm_uvec4 const Odd = _mm_shuffle_epi32(_mm_mul_epu32(_mm_srli_epi64(x, 32), _mm_srli_epi64(y, 32)), _MM_SHUFFLE(3, 1, 2, 0));
+	*Lsb = _mm_unpacklo_epi32(Even, Odd);
+	*Msb = _mm_unpackhi_epi32(Even, Odd);
+}
+
+// Signed 64 bit products, the high bits of the unsigned products are corrected by the signs with SSE2
+GLM_FUNC_QUALIFIER void glm_ivec4_mul_extended(glm_ivec4 x, glm_ivec4 y, glm_ivec4* Msb, glm_ivec4* Lsb)
+{
+#	if GLM_ARCH & GLM_ARCH_SSE41_BIT
+		glm_ivec4 const Even = _mm_shuffle_epi32(_mm_mul_epi32(x, y), _MM_SHUFFLE(3, 1, 2, 0));
+		glm_ivec4 const Odd = _mm_shuffle_epi32(_mm_mul_epi32(_mm_srli_epi64(x, 32), _mm_srli_epi64(y, 32)), _MM_SHUFFLE(3, 1, 2, 0));
+		*Lsb = _mm_unpacklo_epi32(Even, Odd);
+		*Msb = _mm_unpackhi_epi32(Even, Odd);
+#	else
+		glm_ivec4 High;
+		glm_uvec4_mul_extended(x, y, &High, Lsb);
+		glm_ivec4 const Fix = _mm_add_epi32(_mm_and_si128(_mm_srai_epi32(x, 31), y), _mm_and_si128(_mm_srai_epi32(y, 31), x));
+		*Msb = _mm_sub_epi32(High, Fix);
+#	endif
+}
+
+// Perfect shuffle of each lane: the low 16 bits go to the even bits and the high 16 bits to the odd bits
+GLM_FUNC_QUALIFIER glm_uvec4 glm_uvec4_interleave16(glm_uvec4 x)
+{
+	glm_uvec4 t;
+	t = _mm_and_si128(_mm_xor_si128(x, _mm_srli_epi32(x, 8)), _mm_set1_epi32(0x0000FF00));
+	x = _mm_xor_si128(x, _mm_xor_si128(t, _mm_slli_epi32(t, 8)));
+	t = _mm_and_si128(_mm_xor_si128(x, _mm_srli_epi32(x, 4)), _mm_set1_epi32(0x00F000F0));
+	x = _mm_xor_si128(x, _mm_xor_si128(t, _mm_slli_epi32(t, 4)));
+	t = _mm_and_si128(_mm_xor_si128(x, _mm_srli_epi32(x, 2)), _mm_set1_epi32(0x0C0C0C0C));
+	x = _mm_xor_si128(x, _mm_xor_si128(t, _mm_slli_epi32(t, 2)));
+	t = _mm_and_si128(_mm_xor_si128(x, _mm_srli_epi32(x, 1)), _mm_set1_epi32(0x22222222));
+	return _mm_xor_si128(x, _mm_xor_si128(t, _mm_slli_epi32(t, 1)));
+}
+
+// Inverse of glm_uvec4_interleave16, the same swaps in reverse order
+GLM_FUNC_QUALIFIER glm_uvec4 glm_uvec4_deinterleave16(glm_uvec4 x)
+{
+	glm_uvec4 t;
+	t = _mm_and_si128(_mm_xor_si128(x, _mm_srli_epi32(x, 1)), _mm_set1_epi32(0x22222222));
+	x = _mm_xor_si128(x, _mm_xor_si128(t, _mm_slli_epi32(t, 1)));
+	t = _mm_and_si128(_mm_xor_si128(x, _mm_srli_epi32(x, 2)), _mm_set1_epi32(0x0C0C0C0C));
+	x = _mm_xor_si128(x, _mm_xor_si128(t, _mm_slli_epi32(t, 2)));
+	t = _mm_and_si128(_mm_xor_si128(x, _mm_srli_epi32(x, 4)), _mm_set1_epi32(0x00F000F0));
+	x = _mm_xor_si128(x, _mm_xor_si128(t, _mm_slli_epi32(t, 4)));
+	t = _mm_and_si128(_mm_xor_si128(x, _mm_srli_epi32(x, 8)), _mm_set1_epi32(0x0000FF00));
+	return _mm_xor_si128(x, _mm_xor_si128(t, _mm_slli_epi32(t, 8)));
+}
+
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+GLM_FUNC_QUALIFIER __m256i glm_uvec8_interleave16(__m256i x)
+{
+	__m256i t;
+	t = _mm256_and_si256(_mm256_xor_si256(x, _mm256_srli_epi32(x, 8)), _mm256_set1_epi32(0x0000FF00));
+	x = _mm256_xor_si256(x, _mm256_xor_si256(t, _mm256_slli_epi32(t, 8)));
+	t = _mm256_and_si256(_mm256_xor_si256(x, _mm256_srli_epi32(x, 4)), _mm256_set1_epi32(0x00F000F0));
+	x = _mm256_xor_si256(x, _mm256_xor_si256(t, _mm256_slli_epi32(t, 4)));
+	t = _mm256_and_si256(_mm256_xor_si256(x, _mm256_srli_epi32(x, 2)), _mm256_set1_epi32(0x0C0C0C0C));
+	x = _mm256_xor_si256(x, _mm256_xor_si256(t, _mm256_slli_epi32(t, 2)));
+	t = _mm256_and_si256(_mm256_xor_si256(x, _mm256_srli_epi32(x, 1)), _mm256_set1_epi32(0x22222222));
+	return _mm256_xor_si256(x, _mm256_xor_si256(t, _mm256_slli_epi32(t, 1)));
+}
+
+GLM_FUNC_QUALIFIER __m256i glm_uvec8_deinterleave16(__m256i x)
+{
+	__m256i t;
+	t = _mm256_and_si256(_mm256_xor_si256(x, _mm256_srli_epi32(x, 1)), _mm256_set1_epi32(0x22222222));
+	x = _mm256_xor_si256(x, _mm256_xor_si256(t, _mm256_slli_epi32(t, 1)));
+	t = _mm256_and_si256(_mm256_xor_si256(x, _mm256_srli_epi32(x, 2)), _mm256_set1_epi32(0x0C0C0C0C));
+	x = _mm256_xor_si256(x, _mm256_xor_si256(t, _mm256_slli_epi32(t, 2)));
+	t = _mm256_and_si256(_mm256_xor_si256(x, _mm256_srli_epi32(x, 4)), _mm256_set1_epi32(0x00F000F0));
+	x = _mm256_xor_si256(x, _mm256_xor_si256(t, _mm256_slli_epi32(t, 4)));
+	t = _mm256_and_si256(_mm256_xor_si256(x, _mm256_srli_epi32(x, 8)), _mm256_set1_epi32(0x0000FF00));
+	return _mm256_xor_si256(x, _mm256_xor_si256(t, _mm256_slli_epi32(t, 8)));
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -39,12 +39,10 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_mat4_mul_vec4(glm_vec4 const m[4], glm_vec4 v)
 	__m128 v3 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3));
 
 	__m128 m0 = _mm_mul_ps(m[0], v0);
-	__m128 m1 = _mm_mul_ps(m[1], v1);
 	__m128 m2 = _mm_mul_ps(m[2], v2);
-	__m128 m3 = _mm_mul_ps(m[3], v3);
 
-	__m128 a0 = _mm_add_ps(m0, m1);
-	__m128 a1 = _mm_add_ps(m2, m3);
+	__m128 a0 = glm_vec4_fma(m[1], v1, m0);
+	__m128 a1 = glm_vec4_fma(m[3], v3, m2);
 	__m128 a2 = _mm_add_ps(a0, a1);
 
 	return a2;
@@ -77,80 +75,52 @@ GLM_FUNC_QUALIFIER __m128 glm_vec4_mul_mat4(glm_vec4 v, glm_vec4 const m[4])
 	return f2;
 }
 
-GLM_FUNC_QUALIFIER void glm_mat4_mul(glm_vec4 const in1[4], glm_vec4 const in2[4], glm_vec4 out[4])
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+// Two columns of in1 * in2, in2 columns c and c + 1 are loaded in a single 256 bits register
+GLM_FUNC_QUALIFIER __m256 glm_mat4_mul_col2(__m256 const a[4], glm_vec4 const in2[2])
 {
-	{
-		__m128 e0 = _mm_shuffle_ps(in2[0], in2[0], _MM_SHUFFLE(0, 0, 0, 0));
-		__m128 e1 = _mm_shuffle_ps(in2[0], in2[0], _MM_SHUFFLE(1, 1, 1, 1));
-		__m128 e2 = _mm_shuffle_ps(in2[0], in2[0], _MM_SHUFFLE(2, 2, 2, 2));
-		__m128 e3 = _mm_shuffle_ps(in2[0], in2[0], _MM_SHUFFLE(3, 3, 3, 3));
-
-		__m128 m0 = _mm_mul_ps(in1[0], e0);
-		__m128 m1 = _mm_mul_ps(in1[1], e1);
-		__m128 m2 = _mm_mul_ps(in1[2], e2);
-		__m128 m3 = _mm_mul_ps(in1[3], e3);
-
-		__m128 a0 = _mm_add_ps(m0, m1);
-		__m128 a1 = _mm_add_ps(m2, m3);
-		__m128 a2 = _mm_add_ps(a0, a1);
-
-		out[0] = a2;
-	}
+	__m256 b = _mm256_loadu_ps(reinterpret_cast<float const*>(in2));
 
-	{
-		__m128 e0 = _mm_shuffle_ps(in2[1], in2[1], _MM_SHUFFLE(0, 0, 0, 0));
-		__m128 e1 = _mm_shuffle_ps(in2[1], in2[1], _MM_SHUFFLE(1, 1, 1, 1));
-		__m128 e2 = _mm_shuffle_ps(in2[1], in2[1], _MM_SHUFFLE(2, 2, 2, 2));
-		__m128 e3 = _mm_shuffle_ps(in2[1], in2[1], _MM_SHUFFLE(3, 3, 3, 3));
+	__m256 e0 = _mm256_permute_ps(b, _MM_SHUFFLE(0, 0, 0, 0));
+	__m256 e1 = _mm256_permute_ps(b, _MM_SHUFFLE(1, 1, 1, 1));
+	__m256 e2 = _mm256_permute_ps(b, _MM_SHUFFLE(2, 2, 2, 2));
+	__m256 e3 = _mm256_permute_ps(b, _MM_SHUFFLE(3, 3, 3, 3));
 
-		__m128 m0 = _mm_mul_ps(in1[0], e0);
-		__m128 m1 = _mm_mul_ps(in1[1], e1);
-		__m128 m2 = _mm_mul_ps(in1[2], e2);
-		__m128 m3 = _mm_mul_ps(in1[3], e3);
+	__m256 m0 = _mm256_mul_ps(a[0], e0);
+	__m256 m2 = _mm256_mul_ps(a[2], e2);
 
-		__m128 a0 = _mm_add_ps(m0, m1);
-		__m128 a1 = _mm_add_ps(m2, m3);
-		__m128 a2 = _mm_add_ps(a0, a1);
+#	if (GLM_ARCH & GLM_ARCH_AVX2_BIT) && !(GLM_COMPILER & GLM_COMPILER_CLANG)
+		__m256 a0 = _mm256_fmadd_ps(a[1], e1, m0);
+		__m256 a1 = _mm256_fmadd_ps(a[3], e3, m2);
+#	else
+		__m256 a0 = _mm256_add_ps(_mm256_mul_ps(a[1], e1), m0);
+		__m256 a1 = _mm256_add_ps(_mm256_mul_ps(a[3], e3), m2);
+#	endif
 
-		out[1] = a2;
-	}
-
-	{
-		__m128 e0 = _mm_shuffle_ps(in2[2], in2[2], _MM_SHUFFLE(0, 0, 0, 0));
-		__m128 e1 = _mm_shuffle_ps(in2[2], in2[2], _MM_SHUFFLE(1, 1, 1, 1));
-		__m128 e2 = _mm_shuffle_ps(in2[2], in2[2], _MM_SHUFFLE(2, 2, 2, 2));
-		__m128 e3 = _mm_shuffle_ps(in2[2], in2[2], _MM_SHUFFLE(3, 3, 3, 3));
-
-		__m128 m0 = _mm_mul_ps(in1[0], e0);
-		__m128 m1 = _mm_mul_ps(in1[1], e1);
-		__m128 m2 = _mm_mul_ps(in1[2], e2);
-		__m128 m3 = _mm_mul_ps(in1[3], e3);
-
-		__m128 a0 = _mm_add_ps(m0, m1);
-		__m128 a1 = _mm_add_ps(m2, m3);
-		__m128 a2 = _mm_add_ps(a0, a1);
-
-		out[2] = a2;
-	}
+	return _mm256_add_ps(a0, a1);
+}
+#endif
 
-	{
-		//(__m128&)_mm_shuffle_epi32(__m128i&)in2[0], _MM_SHUFFLE(3, 3, 3, 3))
-		__m128 e0 = _mm_shuffle_ps(in2[3], in2[3], _MM_SHUFFLE(0, 0, 0, 0));
-		__m128 e1 = _mm_shuffle_ps(in2[3], in2[3], _MM_SHUFFLE(1, 1, 1, 1));
-		__m128 e2 = _mm_shuffle_ps(in2[3], in2[3], _MM_SHUFFLE(2, 2, 2, 2));
-		__m128 e3 = _mm_shuffle_ps(in2[3], in2[3], _MM_SHUFFLE(3, 3, 3, 3));
-
-		__m128 m0 = _mm_mul_ps(in1[0], e0);
-		__m128 m1 = _mm_mul_ps(in1[1], e1);
-		__m128 m2 = _mm_mul_ps(in1[2], e2);
-		__m128 m3 = _mm_mul_ps(in1[3], e3);
-
-		__m128 a0 = _mm_add_ps(m0, m1);
-		__m128 a1 = _mm_add_ps(m2, m3);
-		__m128 a2 = _mm_add_ps(a0, a1);
-
-		out[3] = a2;
-	}
+GLM_FUNC_QUALIFIER void glm_mat4_mul(glm_vec4 const in1[4], glm_vec4 const in2[4], glm_vec4 out[4])
+{
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+		__m256 a[4];
+		a[0] = _mm256_broadcast_ps(&in1[0]);
+		a[1] = _mm256_broadcast_ps(&in1[1]);
+		a[2] = _mm256_broadcast_ps(&in1[2]);
+		a[3] = _mm256_broadcast_ps(&in1[3]);
+
+		__m256 r0 = glm_mat4_mul_col2(a, in2 + 0);
+		__m256 r1 = glm_mat4_mul_col2(a, in2 + 2);
+
+		_mm256_storeu_ps(reinterpret_cast<float*>(out + 0), r0);
+		_mm256_storeu_ps(reinterpret_cast<float*>(out + 2), r1);
+#	else
+		out[0] = glm_mat4_mul_vec4(in1, in2[0]);
+		out[1] = glm_mat4_mul_vec4(in1, in2[1]);
+		out[2] = glm_mat4_mul_vec4(in1, in2[2]);
+		out[3] = glm_mat4_mul_vec4(in1, in2[3]);
+#	endif
 }
 
 GLM_FUNC_QUALIFIER void glm_mat4_transpose(glm_vec4 const in[4], glm_vec4 out[4])
@@ -1025,4 +995,269 @@ GLM_FUNC_QUALIFIER void glm_mat4_outerProduct(__m128 const& c, __m128 const& r,
 	out[3] = _mm_mul_ps(c, _mm_shuffle_ps(r, r, _MM_SHUFFLE(3, 3, 3, 3)));
 }
 
+// mat3 functions take columns padded to glm_vec4 with a w of 0
+GLM_FUNC_QUALIFIER glm_vec4 glm_mat3_mul_vec3(glm_vec4 const m[3], glm_vec4 v)
+{
+	__m128 v0 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0));
+	__m128 v1 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1));
+	__m128 v2 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2));
+
+	__m128 m0 = _mm_mul_ps(m[0], v0);
+	__m128 a0 = glm_vec4_fma(m[1], v1, m0);
+	__m128 a1 = glm_vec4_fma(m[2], v2, a0);
+
+	return a1;
+}
+
+GLM_FUNC_QUALIFIER void glm_mat3_transpose(glm_vec4 const in[3], glm_vec4 out[3])
+{
+	__m128 tmp0 = _mm_unpacklo_ps(in[0], in[1]);
+	__m128 tmp1 = _mm_unpackhi_ps(in[0], in[1]);
+
+	out[0] = _mm_shuffle_ps(tmp0, in[2], _MM_SHUFFLE(3, 0, 1, 0));
+	out[1] = _mm_shuffle_ps(tmp0, in[2], _MM_SHUFFLE(3, 1, 3, 2));
+	out[2] = _mm_shuffle_ps(tmp1, in[2], _MM_SHUFFLE(3, 2, 1, 0));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_mat3_determinant(glm_vec4 const in[3])
+{
+	return glm_vec4_dot(in[0], glm_vec4_cross(in[1], in[2]));
+}
+
+// The columns of the inverse transpose are the cross products of the other two columns divided by the determinant
+GLM_FUNC_QUALIFIER void glm_mat3_inverse_transpose(glm_vec4 const in[3], glm_vec4 out[3])
+{
+	__m128 crs0 = glm_vec4_cross(in[1], in[2]);
+	__m128 crs1 = glm_vec4_cross(in[2], in[0]);
+	__m128 crs2 = glm_vec4_cross(in[0], in[1]);
+
+	__m128 det0 = glm_vec4_dot(in[0], crs0);
+	__m128 rcp0 = _mm_div_ps(_mm_set1_ps(1.0f), det0);
+
+	out[0] = _mm_mul_ps(crs0, rcp0);
+	out[1] = _mm_mul_ps(crs1, rcp0);
+	out[2] = _mm_mul_ps(crs2, rcp0);
+}
+
+GLM_FUNC_QUALIFIER void glm_mat3_inverse(glm_vec4 const in[3], glm_vec4 out[3])
+{
+	__m128 Transpose[3];
+	glm_mat3_inverse_transpose(in, Transpose);
+	glm_mat3_transpose(Transpose, out);
+}
+
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+
+GLM_FUNC_QUALIFIER void glm_dmat4_matrixCompMult(glm_dvec4 const in1[4], glm_dvec4 const in2[4], glm_dvec4 out[4])
+{
+	out[0] = _mm256_mul_pd(in1[0], in2[0]);
+	out[1] = _mm256_mul_pd(in1[1], in2[1]);
+	out[2] = _mm256_mul_pd(in1[2], in2[2]);
+	out[3] = _mm256_mul_pd(in1[3], in2[3]);
+}
+
+GLM_FUNC_QUALIFIER void glm_dmat4_add(glm_dvec4 const in1[4], glm_dvec4 const in2[4], glm_dvec4 out[4])
+{
+	out[0] = _mm256_add_pd(in1[0], in2[0]);
+	out[1] = _mm256_add_pd(in1[1], in2[1]);
+	out[2] = _mm256_add_pd(in1[2], in2[2]);
+	out[3] = _mm256_add_pd(in1[3], in2[3]);
+}
+
+GLM_FUNC_QUALIFIER void glm_dmat4_sub(glm_dvec4 const in1[4], glm_dvec4 const in2[4], glm_dvec4 out[4])
+{
+	out[0] = _mm256_sub_pd(in1[0], in2[0]);
+	out[1] = _mm256_sub_pd(in1[1], in2[1]);
+	out[2] = _mm256_sub_pd(in1[2], in2[2]);
+	out[3] = _mm256_sub_pd(in1[3], in2[3]);
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dmat4_mul_dvec4(glm_dvec4 const m[4], glm_dvec4 v)
+{
+	glm_dvec4 lo = _mm256_permute2f128_pd(v, v, 0x00);
+	glm_dvec4 hi = _mm256_permute2f128_pd(v, v, 0x11);
+
+	glm_dvec4 v0 = _mm256_permute_pd(lo, 0x0);
+	glm_dvec4 v1 = _mm256_permute_pd(lo, 0xF);
+	glm_dvec4 v2 = _mm256_permute_pd(hi, 0x0);
+	glm_dvec4 v3 = _mm256_permute_pd(hi, 0xF);
+
+	glm_dvec4 m0 = _mm256_mul_pd(m[0], v0);
+	glm_dvec4 m2 = _mm256_mul_pd(m[2], v2);
+
+	glm_dvec4 a0 = glm_dvec4_fma(m[1], v1, m0);
+	glm_dvec4 a1 = glm_dvec4_fma(m[3], v3, m2);
+	glm_dvec4 a2 = _mm256_add_pd(a0, a1);
+
+	return a2;
+}
+
+GLM_FUNC_QUALIFIER void glm_dmat4_mul(glm_dvec4 const in1[4], glm_dvec4 const in2[4], glm_dvec4 out[4])
+{
+	glm_dvec4 const r0 = glm_dmat4_mul_dvec4(in1, in2[0]);
+	glm_dvec4 const r1 = glm_dmat4_mul_dvec4(in1, in2[1]);
+	glm_dvec4 const r2 = glm_dmat4_mul_dvec4(in1, in2[2]);
+	glm_dvec4 const r3 = glm_dmat4_mul_dvec4(in1, in2[3]);
+
+	out[0] = r0;
+	out[1] = r1;
+	out[2] = r2;
+	out[3] = r3;
+}
+
+GLM_FUNC_QUALIFIER void glm_dmat4_transpose(glm_dvec4 const in[4], glm_dvec4 out[4])
+{
+	// (m[0][0], m[1][0], m[0][2], m[1][2]) ...
+	glm_dvec4 const tmp0 = _mm256_unpacklo_pd(in[0], in[1]);
+	glm_dvec4 const tmp1 = _mm256_unpackhi_pd(in[0], in[1]);
+	glm_dvec4 const tmp2 = _mm256_unpacklo_pd(in[2], in[3]);
+	glm_dvec4 const tmp3 = _mm256_unpackhi_pd(in[2], in[3]);
+
+	glm_dvec4 const r0 = _mm256_permute2f128_pd(tmp0, tmp2, 0x20);
+	glm_dvec4 const r1 = _mm256_permute2f128_pd(tmp1, tmp3, 0x20);
+	glm_dvec4 const r2 = _mm256_permute2f128_pd(tmp0, tmp2, 0x31);
+	glm_dvec4 const r3 = _mm256_permute2f128_pd(tmp1, tmp3, 0x31);
+
+	out[0] = r0;
+	out[1] = r1;
+	out[2] = r2;
+	out[3] = r3;
+}
+
+// Same cofactor expansion as glm_mat4_inverse. Swp32_k holds (m[3][k], m[3][k], m[2][k], m[2][k]),
+// Swp21_k holds (m[2][k], m[2][k], m[1][k], m[1][k]) and Sub32_k is Swp32_k shuffled to (m[3][k], m[3][k], m[3][k], m[2][k])
+GLM_FUNC_QUALIFIER void glm_dmat4_inverse(glm_dvec4 const in[4], glm_dvec4 out[4])
+{
+	glm_dvec4 const Lo32 = _mm256_permute2f128_pd(in[3], in[2], 0x20);
+	glm_dvec4 const Hi32 = _mm256_permute2f128_pd(in[3], in[2], 0x31);
+	glm_dvec4 const Lo21 = _mm256_permute2f128_pd(in[2], in[1], 0x20);
+	glm_dvec4 const Hi21 = _mm256_permute2f128_pd(in[2], in[1], 0x31);
+	glm_dvec4 const Lo10 = _mm256_permute2f128_pd(in[1], in[0], 0x20);
+	glm_dvec4 const Hi10 = _mm256_permute2f128_pd(in[1], in[0], 0x31);
+
+	glm_dvec4 const Swp32_0 = _mm256_permute_pd(Lo32, 0x0);
+	glm_dvec4 const Swp32_1 = _mm256_permute_pd(Lo32, 0xF);
+	glm_dvec4 const Swp32_2 = _mm256_permute_pd(Hi32, 0x0);
+	glm_dvec4 const Swp32_3 = _mm256_permute_pd(Hi32, 0xF);
+
+	glm_dvec4 const Swp21_0 = _mm256_permute_pd(Lo21, 0x0);
+	glm_dvec4 const Swp21_1 = _mm256_permute_pd(Lo21, 0xF);
+	glm_dvec4 const Swp21_2 = _mm256_permute_pd(Hi21, 0x0);
+	glm_dvec4 const Swp21_3 = _mm256_permute_pd(Hi21, 0xF);
+
+	glm_dvec4 const Sub32_0 = _mm256_blend_pd(Swp32_0, _mm256_permute2f128_pd(Swp32_0, Swp32_0, 0x00), 0x4);
+	glm_dvec4 const Sub32_1 = _mm256_blend_pd(Swp32_1, _mm256_permute2f128_pd(Swp32_1, Swp32_1, 0x00), 0x4);
+	glm_dvec4 const Sub32_2 = _mm256_blend_pd(Swp32_2, _mm256_permute2f128_pd(Swp32_2, Swp32_2, 0x00), 0x4);
+	glm_dvec4 const Sub32_3 = _mm256_blend_pd(Swp32_3, _mm256_permute2f128_pd(Swp32_3, Swp32_3, 0x00), 0x4);
+
+	//	valType SubFactor00 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+	//	valType SubFactor06 = m[1][2] * m[3][3] - m[3][2] * m[1][3];
+	//	valType SubFactor13 = m[1][2] * m[2][3] - m[2][2] * m[1][3];
+	glm_dvec4 const Fac0 = _mm256_sub_pd(_mm256_mul_pd(Swp21_2, Sub32_3), _mm256_mul_pd(Sub32_2, Swp21_3));
+	//	valType SubFactor01 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+	//	valType SubFactor07 = m[1][1] * m[3][3] - m[3][1] * m[1][3];
+	//	valType SubFactor14 = m[1][1] * m[2][3] - m[2][1] * m[1][3];
+	glm_dvec4 const Fac1 = _mm256_sub_pd(_mm256_mul_pd(Swp21_1, Sub32_3), _mm256_mul_pd(Sub32_1, Swp21_3));
+	//	valType SubFactor02 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
+	//	valType SubFactor08 = m[1][1] * m[3][2] - m[3][1] * m[1][2];
+	//	valType SubFactor15 = m[1][1] * m[2][2] - m[2][1] * m[1][2];
+	glm_dvec4 const Fac2 = _mm256_sub_pd(_mm256_mul_pd(Swp21_1, Sub32_2), _mm256_mul_pd(Sub32_1, Swp21_2));
+	//	valType SubFactor03 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
+	//	valType SubFactor09 = m[1][0] * m[3][3] - m[3][0] * m[1][3];
+	//	valType SubFactor16 = m[1][0] * m[2][3] - m[2][0] * m[1][3];
+	glm_dvec4 const Fac3 = _mm256_sub_pd(_mm256_mul_pd(Swp21_0, Sub32_3), _mm256_mul_pd(Sub32_0, Swp21_3));
+	//	valType SubFactor04 = m[2][0] * m[3][2] - m[3][0] * m[2][2];
+	//	valType SubFactor10 = m[1][0] * m[3][2] - m[3][0] * m[1][2];
+	//	valType SubFactor17 = m[1][0] * m[2][2] - m[2][0] * m[1][2];
+	glm_dvec4 const Fac4 = _mm256_sub_pd(_mm256_mul_pd(Swp21_0, Sub32_2), _mm256_mul_pd(Sub32_0, Swp21_2));
+	//	valType SubFactor05 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
+	//	valType SubFactor12 = m[1][0] * m[3][1] - m[3][0] * m[1][1];
+	//	valType SubFactor18 = m[1][0] * m[2][1] - m[2][0] * m[1][1];
+	glm_dvec4 const Fac5 = _mm256_sub_pd(_mm256_mul_pd(Swp21_0, Sub32_1), _mm256_mul_pd(Sub32_0, Swp21_1));
+
+	glm_dvec4 const SignA = _mm256_set_pd( 1.0,-1.0, 1.0,-1.0);
+	glm_dvec4 const SignB = _mm256_set_pd(-1.0, 1.0,-1.0, 1.0);
+
+	// (m[1][k], m[0][k], m[0][k], m[0][k])
+	glm_dvec4 const Temp0 = _mm256_permute_pd(Lo10, 0x0);
+	glm_dvec4 const Temp1 = _mm256_permute_pd(Lo10, 0xF);
+	glm_dvec4 const Temp2 = _mm256_permute_pd(Hi10, 0x0);
+	glm_dvec4 const Temp3 = _mm256_permute_pd(Hi10, 0xF);
+	glm_dvec4 const Vec0 = _mm256_blend_pd(_mm256_permute2f128_pd(Temp0, Temp0, 0x11), Temp0, 0x1);
+	glm_dvec4 const Vec1 = _mm256_blend_pd(_mm256_permute2f128_pd(Temp1, Temp1, 0x11), Temp1, 0x1);
+	glm_dvec4 const Vec2 = _mm256_blend_pd(_mm256_permute2f128_pd(Temp2, Temp2, 0x11), Temp2, 0x1);
+	glm_dvec4 const Vec3 = _mm256_blend_pd(_mm256_permute2f128_pd(Temp3, Temp3, 0x11), Temp3, 0x1);
+
+	glm_dvec4 const Add00 = glm_dvec4_fma(Vec3, Fac2, _mm256_sub_pd(_mm256_mul_pd(Vec1, Fac0), _mm256_mul_pd(Vec2, Fac1)));
+	glm_dvec4 const Add01 = glm_dvec4_fma(Vec3, Fac4, _mm256_sub_pd(_mm256_mul_pd(Vec0, Fac0), _mm256_mul_pd(Vec2, Fac3)));
+	glm_dvec4 const Add02 = glm_dvec4_fma(Vec3, Fac5, _mm256_sub_pd(_mm256_mul_pd(Vec0, Fac1), _mm256_mul_pd(Vec1, Fac3)));
+	glm_dvec4 const Add03 = glm_dvec4_fma(Vec2, Fac5, _mm256_sub_pd(_mm256_mul_pd(Vec0, Fac2), _mm256_mul_pd(Vec1, Fac4)));
+
+	glm_dvec4 const Inv0 = _mm256_mul_pd(SignB, Add00);
+	glm_dvec4 const Inv1 = _mm256_mul_pd(SignA, Add01);
+	glm_dvec4 const Inv2 = _mm256_mul_pd(SignB, Add02);
+	glm_dvec4 const Inv3 = _mm256_mul_pd(SignA, Add03);
+
+	// (Inv0[0], Inv1[0], Inv2[0], Inv3[0])
+	glm_dvec4 const Row0 = _mm256_unpacklo_pd(Inv0, Inv1);
+	glm_dvec4 const Row1 = _mm256_unpacklo_pd(Inv2, Inv3);
+	glm_dvec4 const Row2 = _mm256_permute2f128_pd(Row0, Row1, 0x20);
+
+	glm_dvec4 const Det0 = glm_dvec4_dot(in[0], Row2);
+	glm_dvec4 const Rcp0 = _mm256_div_pd(_mm256_set1_pd(1.0), Det0);
+
+	out[0] = _mm256_mul_pd(Inv0, Rcp0);
+	out[1] = _mm256_mul_pd(Inv1, Rcp0);
+	out[2] = _mm256_mul_pd(Inv2, Rcp0);
+	out[3] = _mm256_mul_pd(Inv3, Rcp0);
+}
+
+// Only the first column of the cofactor matrix of glm_dmat4_inverse is required
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dmat4_determinant(glm_dvec4 const in[4])
+{
+	glm_dvec4 const Lo32 = _mm256_permute2f128_pd(in[3], in[2], 0x20);
+	glm_dvec4 const Hi32 = _mm256_permute2f128_pd(in[3], in[2], 0x31);
+	glm_dvec4 const Lo21 = _mm256_permute2f128_pd(in[2], in[1], 0x20);
+	glm_dvec4 const Hi21 = _mm256_permute2f128_pd(in[2], in[1], 0x31);
+	glm_dvec4 const Lo10 = _mm256_permute2f128_pd(in[1], in[0], 0x20);
+	glm_dvec4 const Hi10 = _mm256_permute2f128_pd(in[1], in[0], 0x31);
+
+	glm_dvec4 const Swp32_1 = _mm256_permute_pd(Lo32, 0xF);
+	glm_dvec4 const Swp32_2 = _mm256_permute_pd(Hi32, 0x0);
+	glm_dvec4 const Swp32_3 = _mm256_permute_pd(Hi32, 0xF);
+
+	glm_dvec4 const Swp21_1 = _mm256_permute_pd(Lo21, 0xF);
+	glm_dvec4 const Swp21_2 = _mm256_permute_pd(Hi21, 0x0);
+	glm_dvec4 const Swp21_3 = _mm256_permute_pd(Hi21, 0xF);
+
+	glm_dvec4 const Sub32_1 = _mm256_blend_pd(Swp32_1, _mm256_permute2f128_pd(Swp32_1, Swp32_1, 0x00), 0x4);
+	glm_dvec4 const Sub32_2 = _mm256_blend_pd(Swp32_2, _mm256_permute2f128_pd(Swp32_2, Swp32_2, 0x00), 0x4);
+	glm_dvec4 const Sub32_3 = _mm256_blend_pd(Swp32_3, _mm256_permute2f128_pd(Swp32_3, Swp32_3, 0x00), 0x4);
+
+	glm_dvec4 const Fac0 = _mm256_sub_pd(_mm256_mul_pd(Swp21_2, Sub32_3), _mm256_mul_pd(Sub32_2, Swp21_3));
+	glm_dvec4 const Fac1 = _mm256_sub_pd(_mm256_mul_pd(Swp21_1, Sub32_3), _mm256_mul_pd(Sub32_1, Swp21_3));
+	glm_dvec4 const Fac2 = _mm256_sub_pd(_mm256_mul_pd(Swp21_1, Sub32_2), _mm256_mul_pd(Sub32_1, Swp21_2));
+
+	glm_dvec4 const SignB = _mm256_set_pd(-1.0, 1.0,-1.0, 1.0);
+
+	glm_dvec4 const Temp1 = _mm256_permute_pd(Lo10, 0xF);
+	glm_dvec4 const Temp2 = _mm256_permute_pd(Hi10, 0x0);
+	glm_dvec4 const Temp3 = _mm256_permute_pd(Hi10, 0xF);
+	glm_dvec4 const Vec1 = _mm256_blend_pd(_mm256_permute2f128_pd(Temp1, Temp1, 0x11), Temp1, 0x1);
+	glm_dvec4 const Vec2 = _mm256_blend_pd(_mm256_permute2f128_pd(Temp2, Temp2, 0x11), Temp2, 0x1);
+	glm_dvec4 const Vec3 = _mm256_blend_pd(_mm256_permute2f128_pd(Temp3, Temp3, 0x11), Temp3, 0x1);
+
+	glm_dvec4 const Add00 = glm_dvec4_fma(Vec3, Fac2, _mm256_sub_pd(_mm256_mul_pd(Vec1, Fac0), _mm256_mul_pd(Vec2, Fac1)));
+	glm_dvec4 const Inv0 = _mm256_mul_pd(SignB, Add00);
+
+	// (m[0][0], m[1][0], m[2][0], m[3][0])
+	glm_dvec4 const Row0 = _mm256_unpacklo_pd(in[0], in[1]);
+	glm_dvec4 const Row1 = _mm256_unpacklo_pd(in[2], in[3]);
+	glm_dvec4 const Row2 = _mm256_permute2f128_pd(Row0, Row1, 0x20);
+
+	return glm_dvec4_dot(Row2, Inv0);
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
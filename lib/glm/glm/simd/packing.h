@@ -3,6 +3,236 @@
 
 #pragma once
 
+#include "common.h"
+
+// F16C has no arch bit: GCC and Clang enable it with -mf16c, Visual C++ with /arch:AVX2
+#if (GLM_ARCH & GLM_ARCH_AVX_BIT) && (defined(__F16C__) || ((GLM_COMPILER & GLM_COMPILER_VC) && (GLM_ARCH & GLM_ARCH_AVX2_BIT)))
+#	define GLM_ARCH_F16C 1
+#else
+#	define GLM_ARCH_F16C 0
+#endif
+
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
+// Load 4 packed vec2 (x0 y0 x1 y1 | x2 y2 x3 y3) as 2 vectors of 4 components
+GLM_FUNC_QUALIFIER void glm_vec4_load_packed2(float const* in, glm_vec4* x, glm_vec4* y)
+{
+	glm_vec4 const a0 = _mm_loadu_ps(in + 0);
+	glm_vec4 const a1 = _mm_loadu_ps(in + 4);
+
+	*x = _mm_shuffle_ps(a0, a1, _MM_SHUFFLE(2, 0, 2, 0));
+	*y = _mm_shuffle_ps(a0, a1, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+// Store 2 vectors of 4 components as 4 packed vec2
+GLM_FUNC_QUALIFIER void glm_vec4_store_packed2(float* out, glm_vec4 x, glm_vec4 y)
+{
+	_mm_storeu_ps(out + 0, _mm_unpacklo_ps(x, y));
+	_mm_storeu_ps(out + 4, _mm_unpackhi_ps(x, y));
+}
+
+// Load 4 packed vec3 (x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3) as 3 vectors of 4 components
+GLM_FUNC_QUALIFIER void glm_vec4_load_packed3(float const* in, glm_vec4* x, glm_vec4* y, glm_vec4* z)
+{
+	glm_vec4 const a0 = _mm_loadu_ps(in + 0);
+	glm_vec4 const a1 = _mm_loadu_ps(in + 4);
+	glm_vec4 const a2 = _mm_loadu_ps(in + 8);
+
+	glm_vec4 const t0 = _mm_shuffle_ps(a1, a2, _MM_SHUFFLE(2, 1, 3, 2)); // x2 y2 x3 y3
+	glm_vec4 const t1 = _mm_shuffle_ps(a0, a1, _MM_SHUFFLE(1, 0, 2, 1)); // y0 z0 y1 z1
+
+	*x = _mm_shuffle_ps(a0, t0, _MM_SHUFFLE(2, 0, 3, 0));
+	*y = _mm_shuffle_ps(t1, t0, _MM_SHUFFLE(3, 1, 2, 0));
+	*z = _mm_shuffle_ps(t1, a2, _MM_SHUFFLE(3, 0, 3, 1));
+}
+
+// Store 3 vectors of 4 components as 4 packed vec3
+GLM_FUNC_QUALIFIER void glm_vec4_store_packed3(float* out, glm_vec4 x, glm_vec4 y, glm_vec4 z)
+{
+	glm_vec4 const xy0 = _mm_unpacklo_ps(x, y); // x0 y0 x1 y1
+	glm_vec4 const xy1 = _mm_unpackhi_ps(x, y); // x2 y2 x3 y3
+
+	glm_vec4 const t0 = _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)); // z0 z0 x1 x1
+	glm_vec4 const t1 = _mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)); // y1 y1 z1 z1
+	glm_vec4 const t2 = _mm_shuffle_ps(z, xy1, _MM_SHUFFLE(2, 2, 2, 2)); // z2 z2 x3 x3
+	glm_vec4 const t3 = _mm_shuffle_ps(xy1, z, _MM_SHUFFLE(3, 3, 3, 3)); // y3 y3 z3 z3
+
+	_mm_storeu_ps(out + 0, _mm_shuffle_ps(xy0, t0, _MM_SHUFFLE(2, 0, 1, 0)));
+	_mm_storeu_ps(out + 4, _mm_shuffle_ps(t1, xy1, _MM_SHUFFLE(1, 0, 2, 0)));
+	_mm_storeu_ps(out + 8, _mm_shuffle_ps(t2, t3, _MM_SHUFFLE(2, 0, 2, 0)));
+}
+
+// Load 4 packed vec4 as 4 vectors of 4 components
+GLM_FUNC_QUALIFIER void glm_vec4_load_packed4(float const* in, glm_vec4* x, glm_vec4* y, glm_vec4* z, glm_vec4* w)
+{
+	glm_vec4 a0 = _mm_loadu_ps(in + 0);
+	glm_vec4 a1 = _mm_loadu_ps(in + 4);
+	glm_vec4 a2 = _mm_loadu_ps(in + 8);
+	glm_vec4 a3 = _mm_loadu_ps(in + 12);
+
+	_MM_TRANSPOSE4_PS(a0, a1, a2, a3);
+
+	*x = a0;
+	*y = a1;
+	*z = a2;
+	*w = a3;
+}
+
+// Store 4 vectors of 4 components as 4 packed vec4
+GLM_FUNC_QUALIFIER void glm_vec4_store_packed4(float* out, glm_vec4 x, glm_vec4 y, glm_vec4 z, glm_vec4 w)
+{
+	_MM_TRANSPOSE4_PS(x, y, z, w);
+
+	_mm_storeu_ps(out + 0, x);
+	_mm_storeu_ps(out + 4, y);
+	_mm_storeu_ps(out + 8, z);
+	_mm_storeu_ps(out + 12, w);
+}
+
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+
+// Load 8 packed vec2 as 2 vectors of 8 components
+GLM_FUNC_QUALIFIER void glm_vec8_load_packed2(float const* in, glm_vec8* x, glm_vec8* y)
+{
+	glm_vec8 const a0 = _mm256_loadu_ps(in + 0);
+	glm_vec8 const a1 = _mm256_loadu_ps(in + 8);
+
+	glm_vec8 const lo = _mm256_permute2f128_ps(a0, a1, 0x20); // x0 y0 x1 y1 | x4 y4 x5 y5
+	glm_vec8 const hi = _mm256_permute2f128_ps(a0, a1, 0x31); // x2 y2 x3 y3 | x6 y6 x7 y7
+
+	*x = _mm256_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0));
+	*y = _mm256_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+GLM_FUNC_QUALIFIER void glm_vec8_store_packed2(float* out, glm_vec8 x, glm_vec8 y)
+{
+	glm_vec8 const lo = _mm256_unpacklo_ps(x, y); // x0 y0 x1 y1 | x4 y4 x5 y5
+	glm_vec8 const hi = _mm256_unpackhi_ps(x, y); // x2 y2 x3 y3 | x6 y6 x7 y7
+
+	_mm256_storeu_ps(out + 0, _mm256_permute2f128_ps(lo, hi, 0x20));
+	_mm256_storeu_ps(out + 8, _mm256_permute2f128_ps(lo, hi, 0x31));
+}
+
+// Load 8 packed vec3 as 3 vectors of 8 components, each 128-bit lane deinterleaves 4 of them
+GLM_FUNC_QUALIFIER void glm_vec8_load_packed3(float const* in, glm_vec8* x, glm_vec8* y, glm_vec8* z)
+{
+	glm_vec4 x0, y0, z0, x1, y1, z1;
+	glm_vec4_load_packed3(in, &x0, &y0, &z0);
+	glm_vec4_load_packed3(in + 12, &x1, &y1, &z1);
+
+	*x = _mm256_insertf128_ps(_mm256_castps128_ps256(x0), x1, 1);
+	*y = _mm256_insertf128_ps(_mm256_castps128_ps256(y0), y1, 1);
+	*z = _mm256_insertf128_ps(_mm256_castps128_ps256(z0), z1, 1);
+}
+
+GLM_FUNC_QUALIFIER void glm_vec8_store_packed3(float* out, glm_vec8 x, glm_vec8 y, glm_vec8 z)
+{
+	glm_vec4_store_packed3(out, _mm256_castps256_ps128(x), _mm256_castps256_ps128(y), _mm256_castps256_ps128(z));
+	glm_vec4_store_packed3(out + 12, _mm256_extractf128_ps(x, 1), _mm256_extractf128_ps(y, 1), _mm256_extractf128_ps(z, 1));
+}
+
+GLM_FUNC_QUALIFIER void glm_vec8_load_packed4(float const* in, glm_vec8* x, glm_vec8* y, glm_vec8* z, glm_vec8* w)
+{
+	glm_vec4 x0, y0, z0, w0, x1, y1, z1, w1;
+	glm_vec4_load_packed4(in, &x0, &y0, &z0, &w0);
+	glm_vec4_load_packed4(in + 16, &x1, &y1, &z1, &w1);
+
+	*x = _mm256_insertf128_ps(_mm256_castps128_ps256(x0), x1, 1);
+	*y = _mm256_insertf128_ps(_mm256_castps128_ps256(y0), y1, 1);
+	*z = _mm256_insertf128_ps(_mm256_castps128_ps256(z0), z1, 1);
+	*w = _mm256_insertf128_ps(_mm256_castps128_ps256(w0), w1, 1);
+}
+
+GLM_FUNC_QUALIFIER void glm_vec8_store_packed4(float* out, glm_vec8 x, glm_vec8 y, glm_vec8 z, glm_vec8 w)
+{
+	glm_vec4_store_packed4(out, _mm256_castps256_ps128(x), _mm256_castps256_ps128(y), _mm256_castps256_ps128(z), _mm256_castps256_ps128(w));
+	glm_vec4_store_packed4(out + 16, _mm256_extractf128_ps(x, 1), _mm256_extractf128_ps(y, 1), _mm256_extractf128_ps(z, 1), _mm256_extractf128_ps(w, 1));
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+// Round to the nearest integer with halfway cases away from zero, like std::round, for |x| < 2^31
+GLM_FUNC_QUALIFIER glm_ivec4 glm_vec4_round_to_int(glm_vec4 x)
+{
+	glm_ivec4 const Sign = _mm_srai_epi32(_mm_castps_si128(x), 31);
+	glm_vec4 const Abs = glm_vec4_abs(x);
+	glm_ivec4 const Trunc = _mm_cvttps_epi32(Abs);
+	glm_vec4 const Fract = _mm_sub_ps(Abs, _mm_cvtepi32_ps(Trunc));
+	glm_ivec4 const Up = _mm_castps_si128(_mm_cmpge_ps(Fract, _mm_set1_ps(0.5f)));
+	glm_ivec4 const Magnitude = _mm_sub_epi32(Trunc, Up);
+	return _mm_sub_epi32(_mm_xor_si128(Magnitude, Sign), Sign);
+}
+
+// Convert 4 floats to half floats stored in the 4 low 16-bit lanes, rounding to nearest even
+GLM_FUNC_QUALIFIER glm_uvec4 glm_vec4_pack_half(glm_vec4 v)
+{
+#	if GLM_ARCH_F16C
+		return _mm_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT);
+#	else
+		glm_vec4 const SignMask = _mm_set1_ps(-0.0f);
+		glm_vec4 const Sign = _mm_and_ps(v, SignMask);
+		glm_vec4 const Abs = _mm_andnot_ps(SignMask, v);
+		glm_ivec4 const AbsBits = _mm_castps_si128(Abs);
+
+		// Values at or above 65520 round to infinity, NaN keeps a quiet NaN
+		glm_ivec4 const IsNaN = _mm_castps_si128(_mm_cmpunord_ps(Abs, Abs));
+		glm_ivec4 const IsRegular = _mm_cmpgt_epi32(_mm_set1_epi32((127 + 16) << 23), AbsBits);
+		glm_ivec4 const InfNaN = _mm_or_si128(_mm_set1_epi32(0x7c00), _mm_and_si128(IsNaN, _mm_set1_epi32(0x0200)));
+
+		// Denormal halves: let the float adder round the significand by aligning it on a magic exponent
+		glm_ivec4 const DenormMagic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+		glm_ivec4 const IsDenorm = _mm_cmpgt_epi32(_mm_set1_epi32((127 - 14) << 23), AbsBits);
+		glm_ivec4 const Denorm = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(Abs, _mm_castsi128_ps(DenormMagic))), DenormMagic);
+
+		// Normal halves: rebias the exponent and round the significand to nearest even
+		glm_ivec4 const Odd = _mm_srai_epi32(_mm_slli_epi32(AbsBits, 31 - 13), 31);
+		glm_ivec4 const Rounded = _mm_sub_epi32(_mm_add_epi32(AbsBits, _mm_set1_epi32(0xfff - ((127 - 15) << 23))), Odd);
+		glm_ivec4 const Normal = _mm_srli_epi32(Rounded, 13);
+
+		glm_ivec4 const Finite = _mm_or_si128(_mm_and_si128(IsDenorm, Denorm), _mm_andnot_si128(IsDenorm, Normal));
+		glm_ivec4 const Magnitude = _mm_or_si128(_mm_and_si128(IsRegular, Finite), _mm_andnot_si128(IsRegular, InfNaN));
+
+		// The sign is shifted arithmetically so that the saturating pack keeps the 16 low bits
+		glm_ivec4 const Result = _mm_or_si128(Magnitude, _mm_srai_epi32(_mm_castps_si128(Sign), 16));
+		return _mm_packs_epi32(Result, Result);
+#	endif
+}
+
+// Convert the half floats stored in the 4 low 16-bit lanes to 4 floats
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_unpack_half(glm_uvec4 v)
+{
+#	if GLM_ARCH_F16C
+		return _mm_cvtph_ps(v);
+#	else
+		glm_ivec4 const Half = _mm_unpacklo_epi16(v, _mm_setzero_si128());
+		glm_ivec4 const Magnitude = _mm_and_si128(Half, _mm_set1_epi32(0x7fff));
+		glm_ivec4 const Sign = _mm_slli_epi32(_mm_xor_si128(Half, Magnitude), 16);
+
+		// Rebias the exponent with a multiply, this also normalizes denormal halves
+		glm_vec4 const Scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(Magnitude, 13)), _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23)));
+
+		// Infinity and NaN need the maximum float exponent
+		glm_ivec4 const IsInfNaN = _mm_cmpgt_epi32(Magnitude, _mm_set1_epi32(0x7bff));
+		glm_vec4 const InfNaN = _mm_and_ps(_mm_castsi128_ps(IsInfNaN), _mm_castsi128_ps(_mm_set1_epi32(255 << 23)));
+
+		return _mm_or_ps(Scaled, _mm_or_ps(_mm_castsi128_ps(Sign), InfNaN));
+#	endif
+}
+
+#if GLM_ARCH_F16C
+
+// Convert 8 floats to 8 half floats, rounding to nearest even
+GLM_FUNC_QUALIFIER glm_uvec4 glm_vec8_pack_half(glm_vec8 v)
+{
+	return _mm256_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT);
+}
+
+// Convert 8 half floats to 8 floats
+GLM_FUNC_QUALIFIER glm_vec8 glm_vec8_unpack_half(glm_uvec4 v)
+{
+	return _mm256_cvtph_ps(v);
+}
+
+#endif//GLM_ARCH_F16C
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
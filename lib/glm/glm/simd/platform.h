@@ -382,7 +382,10 @@
 #endif
 
 #if GLM_ARCH & GLM_ARCH_AVX_BIT
+	typedef __m256			glm_f32vec8;
 	typedef __m256d			glm_f64vec4;
+
+	typedef glm_f32vec8		glm_vec8;
 	typedef glm_f64vec4		glm_dvec4;
 #endif
 
@@ -1,9 +1,302 @@
 /// @ref simd
 /// @file glm/simd/trigonometric.h
+///
+/// Cephes style polynomial approximations of the single precision trigonometric functions.
+/// Maximum errors measured against the double precision C library on the domain given with each function:
+/// - glm_vec4_sin, glm_vec4_cos: 2 ULP for |x| <= 8192
+/// - glm_vec4_tan: 4 ULP for |x| <= 8192
+/// - glm_vec4_asin, glm_vec4_acos: 2 ULP on [-1, 1]
+/// - glm_vec4_atan: 2 ULP on the whole float range
+/// Beyond |x| = 8192 the four-part Cody-Waite argument reduction loses precision, callers should fall back to the C library.
+/// The _lowp and _mediump functions implement the approximations of the lowp and mediump qualifiers, see detail/compute_approximation.hpp.
 
 #pragma once
 
+#include "common.h"
+
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
-#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+// Reduce |x| in [0, 8192] to [-pi/4, pi/4], y is the octant multiple of pi/4 to remove
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_trig_reduce(glm_vec4 x, glm_vec4 y)
+{
+	glm_vec4 const red0 = glm_vec4_fma(y, _mm_set1_ps(-0.78515625f), x);
+	glm_vec4 const red1 = glm_vec4_fma(y, _mm_set1_ps(-2.4175643920898438e-4f), red0);
+	glm_vec4 const red2 = glm_vec4_fma(y, _mm_set1_ps(-1.5692785382270813e-7f), red1);
+	glm_vec4 const red3 = glm_vec4_fma(y, _mm_set1_ps(-3.038550314138355e-11f), red2);
+	return red3;
+}
+
+// sin(x) for x in [-pi/4, pi/4], z = x * x
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_sin_poly(glm_vec4 x, glm_vec4 z)
+{
+	glm_vec4 const pol0 = glm_vec4_fma(_mm_set1_ps(-1.9515295891e-4f), z, _mm_set1_ps(8.3321608736e-3f));
+	glm_vec4 const pol1 = glm_vec4_fma(pol0, z, _mm_set1_ps(-1.6666654611e-1f));
+	glm_vec4 const mul0 = glm_vec4_mul(glm_vec4_mul(pol1, z), x);
+	return glm_vec4_add(mul0, x);
+}
+
+// cos(x) for x in [-pi/4, pi/4], z = x * x
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_cos_poly(glm_vec4 z)
+{
+	glm_vec4 const pol0 = glm_vec4_fma(_mm_set1_ps(2.443315711809948e-5f), z, _mm_set1_ps(-1.388731625493765e-3f));
+	glm_vec4 const pol1 = glm_vec4_fma(pol0, z, _mm_set1_ps(4.166664568298827e-2f));
+	glm_vec4 const mul0 = glm_vec4_mul(glm_vec4_mul(pol1, z), z);
+	glm_vec4 const mad0 = glm_vec4_fma(z, _mm_set1_ps(-0.5f), mul0);
+	return glm_vec4_add(mad0, _mm_set1_ps(1.0f));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_sin(glm_vec4 x)
+{
+	glm_ivec4 const sgn0 = _mm_and_si128(_mm_castps_si128(x), _mm_set1_epi32(int(0x80000000)));
+	glm_vec4 const abs0 = glm_vec4_abs(x);
+
+	// Octant of |x| rounded up to an even value
+	glm_ivec4 const oct0 = _mm_cvttps_epi32(glm_vec4_mul(abs0, _mm_set1_ps(1.27323954473516f)));
+	glm_ivec4 const oct1 = _mm_and_si128(_mm_add_epi32(oct0, _mm_set1_epi32(1)), _mm_set1_epi32(~1));
+	glm_vec4 const oct2 = _mm_cvtepi32_ps(oct1);
+
+	glm_ivec4 const flp0 = _mm_slli_epi32(_mm_and_si128(oct1, _mm_set1_epi32(4)), 29);
+	glm_vec4 const msk0 = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(oct1, _mm_set1_epi32(2)), _mm_setzero_si128()));
+
+	glm_vec4 const red0 = glm_vec4_trig_reduce(abs0, oct2);
+	glm_vec4 const sqr0 = glm_vec4_mul(red0, red0);
+	glm_vec4 const sel0 = glm_vec4_select(msk0, glm_vec4_sin_poly(red0, sqr0), glm_vec4_cos_poly(sqr0));
+
+	return _mm_xor_ps(sel0, _mm_castsi128_ps(_mm_xor_si128(sgn0, flp0)));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_cos(glm_vec4 x)
+{
+	glm_vec4 const abs0 = glm_vec4_abs(x);
+
+	glm_ivec4 const oct0 = _mm_cvttps_epi32(glm_vec4_mul(abs0, _mm_set1_ps(1.27323954473516f)));
+	glm_ivec4 const oct1 = _mm_and_si128(_mm_add_epi32(oct0, _mm_set1_epi32(1)), _mm_set1_epi32(~1));
+	glm_vec4 const oct2 = _mm_cvtepi32_ps(oct1);
+
+	// cos(x) = sin(x + pi/2): shift the octant by two
+	glm_ivec4 const oct3 = _mm_sub_epi32(oct1, _mm_set1_epi32(2));
+	glm_ivec4 const flp0 = _mm_slli_epi32(_mm_andnot_si128(oct3, _mm_set1_epi32(4)), 29);
+	glm_vec4 const msk0 = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(oct3, _mm_set1_epi32(2)), _mm_setzero_si128()));
+
+	glm_vec4 const red0 = glm_vec4_trig_reduce(abs0, oct2);
+	glm_vec4 const sqr0 = glm_vec4_mul(red0, red0);
+	glm_vec4 const sel0 = glm_vec4_select(msk0, glm_vec4_sin_poly(red0, sqr0), glm_vec4_cos_poly(sqr0));
+
+	return _mm_xor_ps(sel0, _mm_castsi128_ps(flp0));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_tan(glm_vec4 x)
+{
+	glm_ivec4 const sgn0 = _mm_and_si128(_mm_castps_si128(x), _mm_set1_epi32(int(0x80000000)));
+	glm_vec4 const abs0 = glm_vec4_abs(x);
+
+	glm_ivec4 const oct0 = _mm_cvttps_epi32(glm_vec4_mul(abs0, _mm_set1_ps(1.27323954473516f)));
+	glm_ivec4 const oct1 = _mm_and_si128(_mm_add_epi32(oct0, _mm_set1_epi32(1)), _mm_set1_epi32(~1));
+	glm_vec4 const oct2 = _mm_cvtepi32_ps(oct1);
+
+	glm_vec4 const red0 = glm_vec4_trig_reduce(abs0, oct2);
+	glm_vec4 const sqr0 = glm_vec4_mul(red0, red0);
+
+	glm_vec4 const pol0 = glm_vec4_fma(_mm_set1_ps(9.38540185543e-3f), sqr0, _mm_set1_ps(3.11992232697e-3f));
+	glm_vec4 const pol1 = glm_vec4_fma(pol0, sqr0, _mm_set1_ps(2.44301354525e-2f));
+	glm_vec4 const pol2 = glm_vec4_fma(pol1, sqr0, _mm_set1_ps(5.34112807005e-2f));
+	glm_vec4 const pol3 = glm_vec4_fma(pol2, sqr0, _mm_set1_ps(1.33387994085e-1f));
+	glm_vec4 const pol4 = glm_vec4_fma(pol3, sqr0, _mm_set1_ps(3.33331568548e-1f));
+	glm_vec4 const tan0 = glm_vec4_fma(glm_vec4_mul(pol4, sqr0), red0, red0);
+
+	// Odd quadrants: tan(x) = -1 / tan(x - pi/2)
+	glm_vec4 const msk0 = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(oct1, _mm_set1_epi32(2)), _mm_setzero_si128()));
+	glm_vec4 const cot0 = glm_vec4_div(_mm_set1_ps(-1.0f), tan0);
+	glm_vec4 const sel0 = glm_vec4_select(msk0, tan0, cot0);
+
+	return _mm_xor_ps(sel0, _mm_castsi128_ps(sgn0));
+}
+
+// Split x as (n + offset) * pi + y with y in [-pi/2, pi/2], sgn is (-1)^n as a sign bit
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_pi_reduce(glm_vec4 x, glm_vec4 offset, glm_ivec4& sgn)
+{
+	glm_ivec4 const int0 = _mm_cvtps_epi32(glm_vec4_sub(glm_vec4_mul(x, _mm_set1_ps(0.318309886f)), offset));
+	glm_vec4 const mul0 = glm_vec4_add(_mm_cvtepi32_ps(int0), offset);
+	sgn = _mm_slli_epi32(int0, 31);
+
+	// Two-part Cody-Waite reduction, 3.140625 has 8 significant bits
+	glm_vec4 const red0 = glm_vec4_fma(mul0, _mm_set1_ps(-3.140625f), x);
+	return glm_vec4_fma(mul0, _mm_set1_ps(-9.67653589793e-4f), red0);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_sin_lowp_poly(glm_vec4 y)
+{
+	glm_vec4 const sqr0 = glm_vec4_mul(y, y);
+	glm_vec4 const pol0 = glm_vec4_fma(_mm_set1_ps(0.00760293612f), sqr0, _mm_set1_ps(-0.165960222f));
+	glm_vec4 const pol1 = glm_vec4_fma(pol0, sqr0, _mm_set1_ps(0.999891877f));
+	return glm_vec4_mul(pol1, y);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_sin_mediump_poly(glm_vec4 y)
+{
+	glm_vec4 const sqr0 = glm_vec4_mul(y, y);
+	glm_vec4 const pol0 = glm_vec4_fma(_mm_set1_ps(-0.000184881734f), sqr0, _mm_set1_ps(0.00831190124f));
+	glm_vec4 const pol1 = glm_vec4_fma(pol0, sqr0, _mm_set1_ps(-0.16665554f));
+	glm_vec4 const pol2 = glm_vec4_fma(pol1, sqr0, _mm_set1_ps(0.999999046f));
+	return glm_vec4_mul(pol2, y);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_sin_lowp(glm_vec4 x)
+{
+	glm_ivec4 sgn0;
+	glm_vec4 const red0 = glm_vec4_pi_reduce(x, _mm_setzero_ps(), sgn0);
+	return _mm_xor_ps(glm_vec4_sin_lowp_poly(red0), _mm_castsi128_ps(sgn0));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_sin_mediump(glm_vec4 x)
+{
+	glm_ivec4 sgn0;
+	glm_vec4 const red0 = glm_vec4_pi_reduce(x, _mm_setzero_ps(), sgn0);
+	return _mm_xor_ps(glm_vec4_sin_mediump_poly(red0), _mm_castsi128_ps(sgn0));
+}
+
+// cos(x) = -sin(x - pi/2)
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_cos_lowp(glm_vec4 x)
+{
+	glm_ivec4 sgn0;
+	glm_vec4 const red0 = glm_vec4_pi_reduce(x, _mm_set1_ps(0.5f), sgn0);
+	glm_ivec4 const sgn1 = _mm_xor_si128(sgn0, _mm_set1_epi32(int(0x80000000)));
+	return _mm_xor_ps(glm_vec4_sin_lowp_poly(red0), _mm_castsi128_ps(sgn1));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_cos_mediump(glm_vec4 x)
+{
+	glm_ivec4 sgn0;
+	glm_vec4 const red0 = glm_vec4_pi_reduce(x, _mm_set1_ps(0.5f), sgn0);
+	glm_ivec4 const sgn1 = _mm_xor_si128(sgn0, _mm_set1_epi32(int(0x80000000)));
+	return _mm_xor_ps(glm_vec4_sin_mediump_poly(red0), _mm_castsi128_ps(sgn1));
+}
 
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_tan_lowp(glm_vec4 x)
+{
+	return glm_vec4_div(glm_vec4_sin_lowp(x), glm_vec4_cos_lowp(x));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_tan_mediump(glm_vec4 x)
+{
+	return glm_vec4_div(glm_vec4_sin_mediump(x), glm_vec4_cos_mediump(x));
+}
+
+// asin(x) for x in [0, 0.5], z = x * x
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_asin_poly(glm_vec4 x, glm_vec4 z)
+{
+	glm_vec4 const pol0 = glm_vec4_fma(_mm_set1_ps(4.2163199048e-2f), z, _mm_set1_ps(2.4181311049e-2f));
+	glm_vec4 const pol1 = glm_vec4_fma(pol0, z, _mm_set1_ps(4.5470025998e-2f));
+	glm_vec4 const pol2 = glm_vec4_fma(pol1, z, _mm_set1_ps(7.4953002686e-2f));
+	glm_vec4 const pol3 = glm_vec4_fma(pol2, z, _mm_set1_ps(1.6666752422e-1f));
+	return glm_vec4_fma(glm_vec4_mul(pol3, z), x, x);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_asin(glm_vec4 x)
+{
+	glm_ivec4 const sgn0 = _mm_and_si128(_mm_castps_si128(x), _mm_set1_epi32(int(0x80000000)));
+	glm_vec4 const abs0 = glm_vec4_abs(x);
+
+	// Above 0.5: asin(x) = pi/2 - 2 * asin(sqrt((1 - x) / 2)), NaN above 1
+	glm_vec4 const big0 = _mm_cmpgt_ps(abs0, _mm_set1_ps(0.5f));
+	glm_vec4 const hlf0 = glm_vec4_mul(_mm_set1_ps(0.5f), glm_vec4_sub(_mm_set1_ps(1.0f), abs0));
+	glm_vec4 const sqr0 = glm_vec4_select(big0, hlf0, glm_vec4_mul(abs0, abs0));
+	glm_vec4 const arg0 = glm_vec4_select(big0, _mm_sqrt_ps(hlf0), abs0);
+	glm_vec4 const pol0 = glm_vec4_asin_poly(arg0, sqr0);
+
+	glm_vec4 const rcv0 = glm_vec4_fma(pol0, _mm_set1_ps(-2.0f), _mm_set1_ps(1.57079632679489661923f));
+	glm_vec4 const sel0 = glm_vec4_select(big0, rcv0, pol0);
+
+	return _mm_xor_ps(sel0, _mm_castsi128_ps(sgn0));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_acos(glm_vec4 x)
+{
+	glm_vec4 const neg0 = _mm_cmplt_ps(x, _mm_setzero_ps());
+	glm_vec4 const abs0 = glm_vec4_abs(x);
+
+	glm_vec4 const big0 = _mm_cmpgt_ps(abs0, _mm_set1_ps(0.5f));
+	glm_vec4 const hlf0 = glm_vec4_mul(_mm_set1_ps(0.5f), glm_vec4_sub(_mm_set1_ps(1.0f), abs0));
+	glm_vec4 const sqr0 = glm_vec4_select(big0, hlf0, glm_vec4_mul(abs0, abs0));
+	glm_vec4 const arg0 = glm_vec4_select(big0, _mm_sqrt_ps(hlf0), abs0);
+	glm_vec4 const pol0 = glm_vec4_asin_poly(arg0, sqr0);
+
+	// Above 0.5: acos(|x|) = 2 * asin(sqrt((1 - |x|) / 2)) and acos(-|x|) = pi - acos(|x|)
+	glm_vec4 const big1 = glm_vec4_add(pol0, pol0);
+	glm_vec4 const big2 = glm_vec4_select(neg0, glm_vec4_sub(_mm_set1_ps(3.14159265358979323846f), big1), big1);
+
+	// Below 0.5: acos(x) = pi/2 - asin(x)
+	glm_vec4 const sml0 = _mm_xor_ps(pol0, _mm_and_ps(neg0, _mm_castsi128_ps(_mm_set1_epi32(int(0x80000000)))));
+	glm_vec4 const sml1 = glm_vec4_sub(_mm_set1_ps(1.57079632679489661923f), sml0);
+
+	return glm_vec4_select(big0, big2, sml1);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_atan(glm_vec4 x)
+{
+	glm_ivec4 const sgn0 = _mm_and_si128(_mm_castps_si128(x), _mm_set1_epi32(int(0x80000000)));
+	glm_vec4 const abs0 = glm_vec4_abs(x);
+
+	// Reduce to [-tan(pi/8), tan(pi/8)] using atan(x) = pi/2 + atan(-1/x) and atan(x) = pi/4 + atan((x - 1) / (x + 1))
+	glm_vec4 const big0 = _mm_cmpgt_ps(abs0, _mm_set1_ps(2.414213562373095f));
+	glm_vec4 const mid0 = _mm_andnot_ps(big0, _mm_cmpgt_ps(abs0, _mm_set1_ps(0.4142135623730950f)));
+	glm_vec4 const big1 = glm_vec4_div(_mm_set1_ps(-1.0f), abs0);
+	glm_vec4 const mid1 = glm_vec4_div(glm_vec4_sub(abs0, _mm_set1_ps(1.0f)), glm_vec4_add(abs0, _mm_set1_ps(1.0f)));
+	glm_vec4 const arg0 = glm_vec4_select(big0, big1, glm_vec4_select(mid0, mid1, abs0));
+	glm_vec4 const off0 = _mm_or_ps(_mm_and_ps(big0, _mm_set1_ps(1.57079632679489661923f)), _mm_and_ps(mid0, _mm_set1_ps(0.78539816339744830962f)));
+
+	glm_vec4 const sqr0 = glm_vec4_mul(arg0, arg0);
+	glm_vec4 const pol0 = glm_vec4_fma(_mm_set1_ps(8.05374449538e-2f), sqr0, _mm_set1_ps(-1.38776856032e-1f));
+	glm_vec4 const pol1 = glm_vec4_fma(pol0, sqr0, _mm_set1_ps(1.99777106478e-1f));
+	glm_vec4 const pol2 = glm_vec4_fma(pol1, sqr0, _mm_set1_ps(-3.33329491539e-1f));
+	glm_vec4 const pol3 = glm_vec4_fma(glm_vec4_mul(pol2, sqr0), arg0, arg0);
+
+	return _mm_xor_ps(glm_vec4_add(off0, pol3), _mm_castsi128_ps(sgn0));
+}
+
+#elif GLM_ARCH & GLM_ARCH_NEON_BIT
+
+GLM_FUNC_QUALIFIER float32x4_t glm_vec4_sincos_neon(float32x4_t x, int32x4_t shift, uint32x4_t sign)
+{
+	float32x4_t const abs0 = vabsq_f32(x);
+
+	int32x4_t const oct0 = vcvtq_s32_f32(vmulq_f32(abs0, vdupq_n_f32(1.27323954473516f)));
+	int32x4_t const oct1 = vandq_s32(vaddq_s32(oct0, vdupq_n_s32(1)), vdupq_n_s32(~1));
+	float32x4_t const oct2 = vcvtq_f32_s32(oct1);
+	int32x4_t const oct3 = vsubq_s32(oct1, shift);
+
+	uint32x4_t const flp0 = vshlq_n_u32(vreinterpretq_u32_s32(vandq_s32(oct3, vdupq_n_s32(4))), 29);
+	uint32x4_t const msk0 = vceqq_s32(vandq_s32(oct3, vdupq_n_s32(2)), vdupq_n_s32(0));
+
+	float32x4_t const red0 = vmlaq_f32(abs0, oct2, vdupq_n_f32(-0.78515625f));
+	float32x4_t const red1 = vmlaq_f32(red0, oct2, vdupq_n_f32(-2.4175643920898438e-4f));
+	float32x4_t const red2 = vmlaq_f32(red1, oct2, vdupq_n_f32(-1.5692785382270813e-7f));
+	float32x4_t const red3 = vmlaq_f32(red2, oct2, vdupq_n_f32(-3.038550314138355e-11f));
+	float32x4_t const sqr0 = vmulq_f32(red3, red3);
+
+	float32x4_t const sin0 = vmlaq_f32(vdupq_n_f32(8.3321608736e-3f), sqr0, vdupq_n_f32(-1.9515295891e-4f));
+	float32x4_t const sin1 = vmlaq_f32(vdupq_n_f32(-1.6666654611e-1f), sin0, sqr0);
+	float32x4_t const sin2 = vmlaq_f32(red3, vmulq_f32(sin1, sqr0), red3);
+
+	float32x4_t const cos0 = vmlaq_f32(vdupq_n_f32(-1.388731625493765e-3f), sqr0, vdupq_n_f32(2.443315711809948e-5f));
+	float32x4_t const cos1 = vmlaq_f32(vdupq_n_f32(4.166664568298827e-2f), cos0, sqr0);
+	float32x4_t const cos2 = vmlaq_f32(vmulq_f32(sqr0, vdupq_n_f32(-0.5f)), vmulq_f32(cos1, sqr0), sqr0);
+	float32x4_t const cos3 = vaddq_f32(cos2, vdupq_n_f32(1.0f));
+
+	float32x4_t const sel0 = vbslq_f32(msk0, sin2, cos3);
+	return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(sel0), veorq_u32(sign, flp0)));
+}
+
+GLM_FUNC_QUALIFIER float32x4_t glm_vec4_sin(float32x4_t x)
+{
+	uint32x4_t const sgn0 = vandq_u32(vreinterpretq_u32_f32(x), vdupq_n_u32(0x80000000u));
+	return glm_vec4_sincos_neon(x, vdupq_n_s32(0), sgn0);
+}
+
+GLM_FUNC_QUALIFIER float32x4_t glm_vec4_cos(float32x4_t x)
+{
+	// The octant is shifted by two and the flip test inverted by seeding the sign with bit 31
+	return glm_vec4_sincos_neon(x, vdupq_n_s32(2), vdupq_n_u32(0x80000000u));
+}
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -3,6 +3,52 @@
 
 #pragma once
 
+#include "platform.h"
+
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
+// Bit i is set when x[i] and y[i] are at most MaxULPs[i] units in the last place apart.
+// Like ext_vector_relational, components of different signs are equal when their magnitudes are, such as +0 and -0.
+GLM_FUNC_QUALIFIER int glm_vec4_equal_ulps(glm_vec4 x, glm_vec4 y, glm_ivec4 MaxULPs)
+{
+	glm_ivec4 const a = _mm_castps_si128(x);
+	glm_ivec4 const b = _mm_castps_si128(y);
+	glm_ivec4 const xor0 = _mm_xor_si128(a, b);
+
+	glm_ivec4 const SignDiff = _mm_srai_epi32(xor0, 31);
+	glm_ivec4 const SameMagnitude = _mm_cmpeq_epi32(_mm_slli_epi32(xor0, 1), _mm_setzero_si128());
+
+	glm_ivec4 const sub0 = _mm_sub_epi32(a, b);
+	glm_ivec4 const sgn0 = _mm_srai_epi32(sub0, 31);
+	glm_ivec4 const DiffULPs = _mm_sub_epi32(_mm_xor_si128(sub0, sgn0), sgn0);
+	glm_ivec4 const TooFar = _mm_cmpgt_epi32(DiffULPs, MaxULPs);
+
+	glm_ivec4 const Equal = _mm_or_si128(_mm_and_si128(SignDiff, SameMagnitude), _mm_andnot_si128(_mm_or_si128(SignDiff, TooFar), _mm_set1_epi32(-1)));
+	return _mm_movemask_ps(_mm_castsi128_ps(Equal));
+}
+
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+// 64-bit version of glm_vec4_equal_ulps, MaxULPs are sign extended
+GLM_FUNC_QUALIFIER int glm_dvec4_equal_ulps(glm_dvec4 x, glm_dvec4 y, glm_ivec4 MaxULPs)
+{
+	__m256i const Zero = _mm256_setzero_si256();
+	__m256i const a = _mm256_castpd_si256(x);
+	__m256i const b = _mm256_castpd_si256(y);
+	__m256i const xor0 = _mm256_xor_si256(a, b);
+
+	__m256i const SignDiff = _mm256_cmpgt_epi64(Zero, xor0);
+	__m256i const SameMagnitude = _mm256_cmpeq_epi64(_mm256_slli_epi64(xor0, 1), Zero);
+
+	__m256i const sub0 = _mm256_sub_epi64(a, b);
+	__m256i const sgn0 = _mm256_cmpgt_epi64(Zero, sub0);
+	__m256i const DiffULPs = _mm256_sub_epi64(_mm256_xor_si256(sub0, sgn0), sgn0);
+	__m256i const TooFar = _mm256_cmpgt_epi64(DiffULPs, _mm256_cvtepi32_epi64(MaxULPs));
+
+	__m256i const Equal = _mm256_or_si256(_mm256_and_si256(SignDiff, SameMagnitude), _mm256_andnot_si256(_mm256_or_si256(SignDiff, TooFar), _mm256_set1_epi64x(-1)));
+	return _mm256_movemask_pd(_mm256_castsi256_pd(Equal));
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -11,6 +11,8 @@
 /// the divisor of a ratio is 0, then results will be undefined.
 ///
 /// These all operate component-wise. The description is per component.
+/// With lowp and mediump float vectors, sin, cos and tan use faster approximations.
+/// Their maximum errors are listed in glm/detail/compute_approximation.hpp.
 ///
 /// Include <glm/trigonometric.hpp> to use these core features.
 ///
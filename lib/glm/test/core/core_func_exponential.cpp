@@ -5,8 +5,14 @@
 #include <glm/ext/vector_float2.hpp>
 #include <glm/ext/vector_float3.hpp>
 #include <glm/ext/vector_float4.hpp>
+#include <glm/ext/vector_float4_precision.hpp>
 #include <glm/common.hpp>
 #include <glm/exponential.hpp>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
+#include <limits>
+#include <cmath>
 
 static int test_pow()
 {
@@ -168,6 +174,173 @@ static int test_inversesqrt()
 	return Error;
 }
 
+namespace precision
+{
+	// Compares each component with the C library in double precision
+	template<typename vecType>
+	static int test_func(vecType (*Func)(vecType const&, float), double (*Ref)(double, double), float Min, float Max, float Param, int MaxULPs)
+	{
+		int Error = 0;
+
+		std::size_t const Samples = 4096;
+		for(std::size_t i = 0; i < Samples; i += 4)
+		{
+			vecType Value;
+			vecType Expected;
+			for(glm::length_t j = 0; j < 4; ++j)
+			{
+				Value[j] = Min + (Max - Min) * static_cast<float>(i + static_cast<std::size_t>(j)) / static_cast<float>(Samples);
+				Expected[j] = static_cast<float>(Ref(static_cast<double>(Value[j]), static_cast<double>(Param)));
+			}
+
+			vecType const Result = Func(Value, Param);
+			Error += glm::all(glm::equal(Result, Expected, MaxULPs)) ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	template<typename vecType>
+	static vecType call_pow(vecType const& v, float p){return glm::pow(v, vecType(p));}
+	template<typename vecType>
+	static vecType call_exp(vecType const& v, float){return glm::exp(v);}
+	template<typename vecType>
+	static vecType call_log(vecType const& v, float){return glm::log(v);}
+	template<typename vecType>
+	static vecType call_exp2(vecType const& v, float){return glm::exp2(v);}
+	template<typename vecType>
+	static vecType call_log2(vecType const& v, float){return glm::log2(v);}
+
+	static double ref_pow(double x, double p){return std::pow(x, p);}
+	static double ref_exp(double x, double){return std::exp(x);}
+	static double ref_log(double x, double){return std::log(x);}
+	static double ref_exp2(double x, double){return std::pow(2.0, x);}
+	static double ref_log2(double x, double){return std::log(x) / std::log(2.0);}
+
+	template<typename vecType>
+	static int test()
+	{
+		int Error = 0;
+
+		Error += test_func<vecType>(call_exp<vecType>, ref_exp, -87.0f, 88.0f, 0.0f, 1);
+		Error += test_func<vecType>(call_exp2<vecType>, ref_exp2, -126.0f, 127.0f, 0.0f, 1);
+		Error += test_func<vecType>(call_log<vecType>, ref_log, 1.0e-6f, 1.0e6f, 0.0f, 1);
+		Error += test_func<vecType>(call_log<vecType>, ref_log, 0.5f, 2.0f, 0.0f, 1);
+		Error += test_func<vecType>(call_log2<vecType>, ref_log2, 1.0e-6f, 1.0e6f, 0.0f, 1);
+		Error += test_func<vecType>(call_log2<vecType>, ref_log2, 0.5f, 2.0f, 0.0f, 1);
+		Error += test_func<vecType>(call_pow<vecType>, ref_pow, 1.0e-3f, 1.0e3f, 2.2f, 4);
+		Error += test_func<vecType>(call_pow<vecType>, ref_pow, 1.0e-3f, 1.0e3f, -8.0f, 4);
+		Error += test_func<vecType>(call_pow<vecType>, ref_pow, 0.5f, 2.0f, 0.45f, 4);
+
+		// Out of the polynomial domain the C library is used
+		vecType const Base(-2.0f, 0.0f, 2.0f, 1.5f);
+		vecType const Exponent(3.0f, 2.0f, 0.5f, 1.0e5f);
+		vecType const PowBase(std::pow(Base.x, Exponent.x), std::pow(Base.y, Exponent.y), std::pow(Base.z, Exponent.z), std::pow(Base.w, Exponent.w));
+		Error += glm::all(glm::equal(glm::pow(Base, Exponent), PowBase, 0)) ? 0 : 1;
+
+		return Error;
+	}
+}//namespace precision
+
+namespace approximation
+{
+	// Compares each component with the C library in double precision, with a relative or an absolute tolerance
+	template<typename vecType>
+	static int test_func(vecType (*Func)(vecType const&), double (*Ref)(double), float Min, float Max, double Tolerance, bool Relative)
+	{
+		int Error = 0;
+
+		std::size_t const Samples = 4096;
+		for(std::size_t i = 0; i < Samples; i += 4)
+		{
+			vecType Value;
+			for(glm::length_t j = 0; j < 4; ++j)
+				Value[j] = Min + (Max - Min) * static_cast<float>(i + static_cast<std::size_t>(j)) / static_cast<float>(Samples);
+
+			vecType const Result = Func(Value);
+			for(glm::length_t j = 0; j < 4; ++j)
+			{
+				double const Expected = Ref(static_cast<double>(Value[j]));
+				double const Scale = Relative ? std::abs(Expected) : 1.0;
+				Error += std::abs(static_cast<double>(Result[j]) - Expected) <= Tolerance * Scale ? 0 : 1;
+			}
+		}
+
+		return Error;
+	}
+
+	template<typename vecType>
+	static vecType call_sqrt(vecType const& v){return glm::sqrt(v);}
+	template<typename vecType>
+	static vecType call_inversesqrt(vecType const& v){return glm::inversesqrt(v);}
+	template<typename vecType>
+	static vecType call_exp(vecType const& v){return glm::exp(v);}
+	template<typename vecType>
+	static vecType call_log(vecType const& v){return glm::log(v);}
+	template<typename vecType>
+	static vecType call_exp2(vecType const& v){return glm::exp2(v);}
+	template<typename vecType>
+	static vecType call_log2(vecType const& v){return glm::log2(v);}
+
+	static double ref_sqrt(double x){return std::sqrt(x);}
+	static double ref_inversesqrt(double x){return 1.0 / std::sqrt(x);}
+	static double ref_exp(double x){return std::exp(x);}
+	static double ref_log(double x){return std::log(x);}
+	static double ref_exp2(double x){return std::pow(2.0, x);}
+	static double ref_log2(double x){return std::log(x) / std::log(2.0);}
+
+	// Each component equal to the IEEE result, NaN included
+	template<typename vecType>
+	static int test_special(vecType (*Func)(vecType const&), vecType const& Value, vecType const& Expected)
+	{
+		int Error = 0;
+
+		vecType const Result = Func(Value);
+		for(glm::length_t i = 0; i < 4; ++i)
+			Error += Result[i] == Expected[i] || (Result[i] != Result[i] && Expected[i] != Expected[i]) ? 0 : 1;
+
+		return Error;
+	}
+
+	// Tolerances of detail/compute_approximation.hpp
+	template<typename vecType>
+	static int test(bool Lowp)
+	{
+		int Error = 0;
+
+		double const Sqrt = Lowp ? 2e-3 : 5e-6;
+		double const Exp2 = Lowp ? 8e-5 : 3e-6;
+		double const Log2 = Lowp ? 2e-5 : 5e-7;
+
+		Error += test_func<vecType>(call_sqrt<vecType>, ref_sqrt, 1.0e-6f, 1.0e6f, Sqrt, true);
+		Error += test_func<vecType>(call_sqrt<vecType>, ref_sqrt, 0.5f, 2.0f, Sqrt, true);
+		Error += test_func<vecType>(call_inversesqrt<vecType>, ref_inversesqrt, 1.0e-6f, 1.0e6f, Sqrt, true);
+		Error += test_func<vecType>(call_exp2<vecType>, ref_exp2, -126.0f, 128.0f, Exp2, true);
+		Error += test_func<vecType>(call_exp<vecType>, ref_exp, -10.0f, 10.0f, Exp2 + 1e-6, true);
+		Error += test_func<vecType>(call_log2<vecType>, ref_log2, 0.5f, 2.0f, Log2, false);
+		Error += test_func<vecType>(call_log<vecType>, ref_log, 0.5f, 2.0f, Log2, false);
+
+		// IEEE results for zeros, infinities, NaN, negative inputs, overflow and underflow
+		float const Inf = std::numeric_limits<float>::infinity();
+		float const NaN = std::numeric_limits<float>::quiet_NaN();
+		vecType const Special(0.0f, -0.0f, Inf, -1.0f);
+		Error += test_special<vecType>(call_sqrt<vecType>, Special, vecType(0.0f, -0.0f, Inf, NaN));
+		Error += test_special<vecType>(call_log2<vecType>, Special, vecType(-Inf, -Inf, Inf, NaN));
+		Error += test_special<vecType>(call_log<vecType>, Special, vecType(-Inf, -Inf, Inf, NaN));
+		Error += test_special<vecType>(call_exp2<vecType>, vecType(-Inf, -200.0f, 200.0f, Inf), vecType(0.0f, 0.0f, Inf, Inf));
+		Error += test_special<vecType>(call_exp<vecType>, vecType(-Inf, -200.0f, 100.0f, Inf), vecType(0.0f, 0.0f, Inf, Inf));
+
+		vecType const Nan(NaN);
+		Error += test_special<vecType>(call_sqrt<vecType>, Nan, Nan);
+		Error += test_special<vecType>(call_log2<vecType>, Nan, Nan);
+		Error += test_special<vecType>(call_log<vecType>, Nan, Nan);
+		Error += test_special<vecType>(call_exp2<vecType>, Nan, Nan);
+		Error += test_special<vecType>(call_exp<vecType>, Nan, Nan);
+
+		return Error;
+	}
+}//namespace approximation
+
 int main()
 {
 	int Error = 0;
@@ -180,6 +353,18 @@ int main()
 	Error += test_log2();
 	Error += test_inversesqrt();
 
+	Error += precision::test<glm::vec4>();
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		Error += precision::test<glm::aligned_vec4>();
+#	endif
+
+	Error += approximation::test<glm::lowp_vec4>(true);
+	Error += approximation::test<glm::mediump_vec4>(false);
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		Error += approximation::test<glm::aligned_lowp_vec4>(true);
+		Error += approximation::test<glm::aligned_mediump_vec4>(false);
+#	endif
+
 	return Error;
 }
 
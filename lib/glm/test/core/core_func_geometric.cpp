@@ -6,10 +6,16 @@
 #include <glm/ext/vector_float2.hpp>
 #include <glm/ext/vector_float3.hpp>
 #include <glm/ext/vector_float4.hpp>
+#include <glm/ext/vector_float3_precision.hpp>
+#include <glm/ext/vector_float4_precision.hpp>
 #include <glm/ext/vector_double2.hpp>
 #include <glm/ext/vector_double3.hpp>
 #include <glm/ext/vector_double4.hpp>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
 #include <limits>
+#include <cmath>
 
 namespace length
 {
@@ -108,6 +114,25 @@ namespace normalize
 
 		return Error;
 	}
+
+	// The lowp and mediump tolerances of detail/compute_approximation.hpp
+	template<typename vecType>
+	static int test_approximation(float Tolerance)
+	{
+		int Error = 0;
+
+		for(int i = 1; i < 256; ++i)
+		{
+			float const Angle = static_cast<float>(i) * 0.1f;
+			vecType Value(0.0f);
+			for(glm::length_t j = 0; j < Value.length(); ++j)
+				Value[j] = std::cos(Angle * static_cast<float>(j + 1)) * static_cast<float>(i);
+
+			Error += glm::equal(glm::length(glm::normalize(Value)), 1.0f, Tolerance) ? 0 : 1;
+		}
+
+		return Error;
+	}
 }//namespace normalize
 
 namespace faceforward
@@ -182,6 +207,34 @@ namespace refract
 	}
 }//namespace refract
 
+namespace aligned
+{
+	// Aligned double vectors may use AVX, compare them with the packed path
+	int test()
+	{
+		int Error = 0;
+
+#		if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+			glm::dvec4 const A(1.5,-2.0, 3.25, 0.5);
+			glm::dvec4 const B(-0.5, 4.0, 1.0,-2.0);
+			glm::aligned_dvec4 const AlignedA(A);
+			glm::aligned_dvec4 const AlignedB(B);
+
+			Error += glm::equal(glm::dot(AlignedA, AlignedB), glm::dot(A, B), 1) ? 0 : 1;
+			Error += glm::equal(glm::length(AlignedA), glm::length(A), 1) ? 0 : 1;
+			Error += glm::equal(glm::distance(AlignedA, AlignedB), glm::distance(A, B), 1) ? 0 : 1;
+			Error += glm::all(glm::equal(glm::dvec4(glm::normalize(AlignedA)), glm::normalize(A), 2)) ? 0 : 1;
+
+			glm::aligned_dvec3 const CrossA(1.5,-2.0, 3.25);
+			glm::aligned_dvec3 const CrossB(-0.5, 4.0, 1.0);
+			glm::dvec3 const Cross = glm::cross(glm::dvec3(CrossA), glm::dvec3(CrossB));
+			Error += glm::all(glm::equal(glm::dvec3(glm::cross(CrossA, CrossB)), Cross, 0)) ? 0 : 1;
+#		endif
+
+		return Error;
+	}
+}//namespace aligned
+
 int main()
 {
 	int Error(0);
@@ -191,9 +244,18 @@ int main()
 	Error += dot::test();
 	Error += cross::test();
 	Error += normalize::test();
+	Error += normalize::test_approximation<glm::lowp_vec3>(2e-3f);
+	Error += normalize::test_approximation<glm::mediump_vec3>(5e-6f);
+	Error += normalize::test_approximation<glm::lowp_vec4>(2e-3f);
+	Error += normalize::test_approximation<glm::mediump_vec4>(5e-6f);
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		Error += normalize::test_approximation<glm::aligned_lowp_vec4>(2e-3f);
+		Error += normalize::test_approximation<glm::aligned_mediump_vec4>(5e-6f);
+#	endif
 	Error += faceforward::test();
 	Error += reflect::test();
 	Error += refract::test();
+	Error += aligned::test();
 
 	return Error;
 }
@@ -10,6 +10,9 @@
 #include <glm/ext/vector_uint4.hpp>
 #include <glm/ext/scalar_int_sized.hpp>
 #include <glm/ext/scalar_uint_sized.hpp>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
 #include <vector>
 #include <ctime>
 #include <cstdio>
@@ -1426,7 +1429,7 @@ namespace bitCount
 	template<glm::length_t L, typename T, glm::qualifier Q>
 	static glm::vec<L, int, Q> bitCount_bitfield(glm::vec<L, T, Q> const& v)
 	{
-		glm::vec<L, typename glm::detail::make_unsigned<T>::type, Q> x(*reinterpret_cast<glm::vec<L, typename glm::detail::make_unsigned<T>::type, Q> const *>(&v));
+		glm::vec<L, typename glm::detail::make_unsigned<T>::type, Q> x(v);
 		x = compute_bitfieldBitCountStep<sizeof(T) * 8 >=  2>::call(x, static_cast<typename glm::detail::make_unsigned<T>::type>(0x5555555555555555ull), static_cast<typename glm::detail::make_unsigned<T>::type>( 1));
 		x = compute_bitfieldBitCountStep<sizeof(T) * 8 >=  4>::call(x, static_cast<typename glm::detail::make_unsigned<T>::type>(0x3333333333333333ull), static_cast<typename glm::detail::make_unsigned<T>::type>( 2));
 		x = compute_bitfieldBitCountStep<sizeof(T) * 8 >=  8>::call(x, static_cast<typename glm::detail::make_unsigned<T>::type>(0x0F0F0F0F0F0F0F0Full), static_cast<typename glm::detail::make_unsigned<T>::type>( 4));
@@ -1526,6 +1529,108 @@ namespace bitCount
 	}
 }//bitCount
 
+// Each lane of the 4 component vectors, aligned or not, matches the scalar functions
+namespace vector4
+{
+	static glm::uint const Values[] =
+	{
+		0x00000000, 0x00000001, 0x00000002, 0x00000003, 0x7fffffff, 0x80000000, 0x80000001, 0xffffffff,
+		0x00ffffff, 0x01000000, 0x01ffffff, 0x0fffffff, 0x12345678, 0x9abcdef0, 0xfedcba98, 0x55555555
+	};
+
+	template<typename T, glm::qualifier Q>
+	static int test_bits()
+	{
+		int Error = 0;
+
+		std::size_t const Count = sizeof(Values) / sizeof(Values[0]);
+		for(std::size_t i = 0; i < Count; i += 4)
+		{
+			glm::vec<4, T, Q> const v(static_cast<T>(Values[i]), static_cast<T>(Values[i + 1]), static_cast<T>(Values[i + 2]), static_cast<T>(Values[i + 3]));
+			glm::vec<4, T, Q> const w(static_cast<T>(Values[Count - 1 - i]), static_cast<T>(Values[i + 2]), static_cast<T>(Values[i + 1]), static_cast<T>(Values[i]));
+
+			glm::vec<4, int, Q> const MSB = glm::findMSB(v);
+			glm::vec<4, int, Q> const LSB = glm::findLSB(v);
+			glm::vec<4, int, Q> const Count1 = glm::bitCount(v);
+			glm::vec<4, T, Q> const Reverse = glm::bitfieldReverse(v);
+			glm::vec<4, T, Q> const Extract = glm::bitfieldExtract(v, 5, 11);
+			glm::vec<4, T, Q> const ExtractAll = glm::bitfieldExtract(v, 0, 32);
+			glm::vec<4, T, Q> const Insert = glm::bitfieldInsert(v, w, 7, 13);
+			glm::vec<4, T, Q> const InsertAll = glm::bitfieldInsert(v, w, 0, 32);
+
+			for(glm::length_t j = 0; j < 4; ++j)
+			{
+				Error += MSB[j] == glm::findMSB(v[j]) ? 0 : 1;
+				Error += LSB[j] == glm::findLSB(v[j]) ? 0 : 1;
+				Error += Count1[j] == glm::bitCount(v[j]) ? 0 : 1;
+				Error += Reverse[j] == glm::bitfieldReverse(v[j]) ? 0 : 1;
+				Error += Extract[j] == glm::bitfieldExtract(v[j], 5, 11) ? 0 : 1;
+				Error += ExtractAll[j] == v[j] ? 0 : 1;
+				Error += Insert[j] == glm::bitfieldInsert(v[j], w[j], 7, 13) ? 0 : 1;
+				Error += InsertAll[j] == w[j] ? 0 : 1;
+			}
+		}
+
+		return Error;
+	}
+
+	template<glm::qualifier Q>
+	static int test_extended()
+	{
+		int Error = 0;
+
+		std::size_t const Count = sizeof(Values) / sizeof(Values[0]);
+		for(std::size_t i = 0; i < Count; i += 4)
+		for(std::size_t k = 0; k < Count; k += 4)
+		{
+			glm::vec<4, glm::uint, Q> const x(Values[i], Values[i + 1], Values[i + 2], Values[i + 3]);
+			glm::vec<4, glm::uint, Q> const y(Values[k + 3], Values[k + 1], Values[k], Values[k + 2]);
+
+			glm::vec<4, glm::uint, Q> Carry;
+			glm::vec<4, glm::uint, Q> const Sum = glm::uaddCarry(x, y, Carry);
+
+			glm::vec<4, glm::uint, Q> uMsb, uLsb;
+			glm::umulExtended(x, y, uMsb, uLsb);
+
+			glm::vec<4, int, Q> iMsb, iLsb;
+			glm::imulExtended(glm::vec<4, int, Q>(x), glm::vec<4, int, Q>(y), iMsb, iLsb);
+
+			for(glm::length_t j = 0; j < 4; ++j)
+			{
+				glm::uint64 const uSum = static_cast<glm::uint64>(x[j]) + static_cast<glm::uint64>(y[j]);
+				Error += Sum[j] == static_cast<glm::uint>(uSum) ? 0 : 1;
+				Error += Carry[j] == static_cast<glm::uint>(uSum >> 32) ? 0 : 1;
+
+				glm::uint64 const uProduct = static_cast<glm::uint64>(x[j]) * static_cast<glm::uint64>(y[j]);
+				Error += uMsb[j] == static_cast<glm::uint>(uProduct >> 32) ? 0 : 1;
+				Error += uLsb[j] == static_cast<glm::uint>(uProduct) ? 0 : 1;
+
+				glm::int64 const iProduct = static_cast<glm::int64>(static_cast<int>(x[j])) * static_cast<glm::int64>(static_cast<int>(y[j]));
+				Error += iMsb[j] == static_cast<int>(static_cast<glm::uint64>(iProduct) >> 32) ? 0 : 1;
+				Error += iLsb[j] == static_cast<int>(static_cast<glm::uint>(static_cast<glm::uint64>(iProduct))) ? 0 : 1;
+			}
+		}
+
+		return Error;
+	}
+
+	static int test()
+	{
+		int Error = 0;
+
+		Error += test_bits<int, glm::defaultp>();
+		Error += test_bits<glm::uint, glm::defaultp>();
+		Error += test_extended<glm::defaultp>();
+#		if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+			Error += test_bits<int, glm::aligned_highp>();
+			Error += test_bits<glm::uint, glm::aligned_highp>();
+			Error += test_extended<glm::aligned_highp>();
+#		endif
+
+		return Error;
+	}
+}//namespace vector4
+
 int main()
 {
 	int Error = 0;
@@ -1540,6 +1645,7 @@ int main()
 	Error += ::usubBorrow::test();
 	Error += ::bitfieldInsert::test();
 	Error += ::bitfieldExtract::test();
+	Error += ::vector4::test();
 
 #	ifdef NDEBUG
 		std::size_t const Samples = 1000;
@@ -3,6 +3,9 @@
 #include <glm/gtc/ulp.hpp>
 #include <glm/gtc/epsilon.hpp>
 #include <glm/gtc/constants.hpp>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
 #include <vector>
 #include <ctime>
 #include <cstdio>
@@ -257,6 +260,36 @@ int test_inverse_simd()
 	return Error;
 }
 
+int test_aligned_dmat4()
+{
+	int Error = 0;
+
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		glm::dmat4 const A = glm::rotate(glm::translate(glm::dmat4(1), glm::dvec3(1.0, -2.0, 3.0)), 0.7, glm::normalize(glm::dvec3(1.0, 2.0, 3.0))) * 2.5;
+		glm::aligned_dmat4 const B(A);
+
+		Error += epsilonEqual(glm::determinant(B), glm::determinant(A), 1e-12) ? 0 : 1;
+
+		glm::dmat4 const InverseA = glm::inverse(A);
+		glm::dmat4 const InverseB(glm::inverse(B));
+		glm::dmat4 const TransposeB(glm::transpose(B));
+		glm::dmat4 const ProductB(B * glm::aligned_dmat4(InverseA));
+		glm::dvec4 const VectorB(B * glm::aligned_dvec4(1.0, 2.0, 3.0, 1.0));
+		glm::dvec4 const VectorA(A * glm::dvec4(1.0, 2.0, 3.0, 1.0));
+		glm::dmat4 const Identity(1);
+
+		for(length_t l = 0; l < A.length(); ++l)
+		{
+			Error += all(epsilonEqual(InverseB[l], InverseA[l], 1e-12)) ? 0 : 1;
+			Error += all(epsilonEqual(ProductB[l], Identity[l], 1e-12)) ? 0 : 1;
+			Error += all(equal(TransposeB[l], transpose(A)[l])) ? 0 : 1;
+		}
+		Error += all(epsilonEqual(VectorB, VectorA, 1e-12)) ? 0 : 1;
+#	endif
+
+	return Error;
+}
+
 template<typename VEC3, typename MAT4>
 int test_inverse_perf(std::size_t Count, std::size_t Instance, char const * Message)
 {
@@ -311,6 +344,7 @@ int main()
 	Error += test_determinant();
 	Error += test_inverse();
 	Error += test_inverse_simd();
+	Error += test_aligned_dmat4();
 
 #	ifdef NDEBUG
 	std::size_t const Samples = 1000;
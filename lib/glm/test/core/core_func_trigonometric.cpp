@@ -1,9 +1,156 @@
 #include <glm/trigonometric.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/ext/vector_float4.hpp>
+#include <glm/ext/vector_float4_precision.hpp>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
+#include <limits>
+#include <cmath>
+
+namespace trigonometric
+{
+	// Compares each component with the C library in double precision
+	template<typename vecType>
+	static int test_func(vecType (*Func)(vecType const&), double (*Ref)(double), float Min, float Max, int MaxULPs)
+	{
+		int Error = 0;
+
+		std::size_t const Samples = 4096;
+		for(std::size_t i = 0; i < Samples; i += 4)
+		{
+			vecType Value;
+			vecType Expected;
+			for(glm::length_t j = 0; j < 4; ++j)
+			{
+				Value[j] = Min + (Max - Min) * static_cast<float>(i + static_cast<std::size_t>(j)) / static_cast<float>(Samples);
+				Expected[j] = static_cast<float>(Ref(static_cast<double>(Value[j])));
+			}
+
+			vecType const Result = Func(Value);
+			Error += glm::all(glm::equal(Result, Expected, MaxULPs)) ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	template<typename vecType>
+	static vecType call_sin(vecType const& v){return glm::sin(v);}
+	template<typename vecType>
+	static vecType call_cos(vecType const& v){return glm::cos(v);}
+	template<typename vecType>
+	static vecType call_tan(vecType const& v){return glm::tan(v);}
+	template<typename vecType>
+	static vecType call_asin(vecType const& v){return glm::asin(v);}
+	template<typename vecType>
+	static vecType call_acos(vecType const& v){return glm::acos(v);}
+	template<typename vecType>
+	static vecType call_atan(vecType const& v){return glm::atan(v);}
+
+	static double ref_sin(double x){return std::sin(x);}
+	static double ref_cos(double x){return std::cos(x);}
+	static double ref_tan(double x){return std::tan(x);}
+	static double ref_asin(double x){return std::asin(x);}
+	static double ref_acos(double x){return std::acos(x);}
+	static double ref_atan(double x){return std::atan(x);}
+
+	template<typename vecType>
+	static int test()
+	{
+		int Error = 0;
+
+		Error += test_func<vecType>(call_sin<vecType>, ref_sin, -10.0f, 10.0f, 2);
+		Error += test_func<vecType>(call_sin<vecType>, ref_sin, -8192.0f, 8192.0f, 2);
+		Error += test_func<vecType>(call_cos<vecType>, ref_cos, -10.0f, 10.0f, 2);
+		Error += test_func<vecType>(call_cos<vecType>, ref_cos, -8192.0f, 8192.0f, 2);
+		Error += test_func<vecType>(call_tan<vecType>, ref_tan, -1.5f, 1.5f, 4);
+		Error += test_func<vecType>(call_tan<vecType>, ref_tan, -8192.0f, 8192.0f, 4);
+		Error += test_func<vecType>(call_asin<vecType>, ref_asin, -1.0f, 1.0f, 2);
+		Error += test_func<vecType>(call_acos<vecType>, ref_acos, -1.0f, 1.0f, 2);
+		Error += test_func<vecType>(call_atan<vecType>, ref_atan, -100.0f, 100.0f, 2);
+
+		// Out of the polynomial range the C library is used
+		vecType const Large(1.0e6f, -1.0e6f, 3.0e7f, 8193.0f);
+		vecType const SinLarge(std::sin(Large.x), std::sin(Large.y), std::sin(Large.z), std::sin(Large.w));
+		Error += glm::all(glm::equal(glm::sin(Large), SinLarge, 0)) ? 0 : 1;
+
+		return Error;
+	}
+}//namespace trigonometric
+
+namespace approximation
+{
+	// Compares each component with the C library in double precision with an absolute tolerance
+	template<typename vecType>
+	static int test_func(vecType (*Func)(vecType const&), double (*Ref)(double), float Min, float Max, double Tolerance)
+	{
+		int Error = 0;
+
+		std::size_t const Samples = 4096;
+		for(std::size_t i = 0; i < Samples; i += 4)
+		{
+			vecType Value;
+			for(glm::length_t j = 0; j < 4; ++j)
+				Value[j] = Min + (Max - Min) * static_cast<float>(i + static_cast<std::size_t>(j)) / static_cast<float>(Samples);
+
+			vecType const Result = Func(Value);
+			for(glm::length_t j = 0; j < 4; ++j)
+				Error += std::abs(static_cast<double>(Result[j]) - Ref(static_cast<double>(Value[j]))) <= Tolerance ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	// Tolerances of detail/compute_approximation.hpp
+	template<typename vecType>
+	static int test(bool Lowp)
+	{
+		int Error = 0;
+
+		double const Tolerance = Lowp ? 1.2e-4 : 1.5e-6;
+
+		Error += test_func<vecType>(trigonometric::call_sin<vecType>, trigonometric::ref_sin, -10.0f, 10.0f, Tolerance);
+		Error += test_func<vecType>(trigonometric::call_sin<vecType>, trigonometric::ref_sin, -8192.0f, 8192.0f, Tolerance);
+		Error += test_func<vecType>(trigonometric::call_cos<vecType>, trigonometric::ref_cos, -10.0f, 10.0f, Tolerance);
+		Error += test_func<vecType>(trigonometric::call_cos<vecType>, trigonometric::ref_cos, -8192.0f, 8192.0f, Tolerance);
+		Error += test_func<vecType>(trigonometric::call_tan<vecType>, trigonometric::ref_tan, -1.0f, 1.0f, Tolerance * 6.0);
+
+		// The C library beyond |x| = 8192 and for NaN
+		vecType const Large(-3.0e9f, 8200.0f, 1.0e5f, 1.0e30f);
+		vecType const Sin = glm::sin(Large);
+		vecType const Cos = glm::cos(Large);
+		vecType const Tan = glm::tan(Large);
+		for(glm::length_t i = 0; i < 4; ++i)
+		{
+			Error += Sin[i] == std::sin(Large[i]) ? 0 : 1;
+			Error += Cos[i] == std::cos(Large[i]) ? 0 : 1;
+			Error += Tan[i] == std::tan(Large[i]) ? 0 : 1;
+		}
+
+		vecType const NaN(std::numeric_limits<float>::quiet_NaN());
+		Error += glm::any(glm::equal(glm::sin(NaN), glm::sin(NaN))) ? 1 : 0;
+		Error += glm::any(glm::equal(glm::cos(NaN), glm::cos(NaN))) ? 1 : 0;
+		Error += glm::any(glm::equal(glm::tan(NaN), glm::tan(NaN))) ? 1 : 0;
+
+		return Error;
+	}
+}//namespace approximation
 
 int main()
 {
 	int Error = 0;
 
+	Error += trigonometric::test<glm::vec4>();
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		Error += trigonometric::test<glm::aligned_vec4>();
+#	endif
+
+	Error += approximation::test<glm::lowp_vec4>(true);
+	Error += approximation::test<glm::mediump_vec4>(false);
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		Error += approximation::test<glm::aligned_lowp_vec4>(true);
+		Error += approximation::test<glm::aligned_mediump_vec4>(false);
+#	endif
 
 	return Error;
 }
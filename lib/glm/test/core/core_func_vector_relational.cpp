@@ -3,6 +3,10 @@
 #include <glm/vec4.hpp>
 #include <glm/vector_relational.hpp>
 #include <glm/gtc/vec1.hpp>
+#include <limits>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
 
 static int test_not()
 {
@@ -166,6 +170,54 @@ static int test_equal()
 	return Error;
 }
 
+// Components compared lower, equal, greater and equal
+template<typename T, glm::qualifier Q>
+static int test_relational()
+{
+	typedef glm::vec<4, T, Q> vec4;
+	typedef glm::vec<4, bool, Q> bvec4;
+
+	int Error = 0;
+
+	vec4 const A(1, 2, 3, 4);
+	vec4 const B(2, 2, 1, 4);
+
+	Error += glm::all(glm::equal(glm::lessThan(A, B), bvec4(true, false, false, false))) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::lessThanEqual(A, B), bvec4(true, true, false, true))) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::greaterThan(A, B), bvec4(false, false, true, false))) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::greaterThanEqual(A, B), bvec4(false, true, true, true))) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::equal(A, B), bvec4(false, true, false, true))) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::notEqual(A, B), bvec4(true, false, true, false))) ? 0 : 1;
+
+	Error += A == A ? 0 : 1;
+	Error += A == B ? 1 : 0;
+	Error += A != B ? 0 : 1;
+	Error += A != A ? 1 : 0;
+
+	return Error;
+}
+
+// Only notEqual is true with NaN
+template<typename T, glm::qualifier Q>
+static int test_nan()
+{
+	typedef glm::vec<4, T, Q> vec4;
+
+	int Error = 0;
+
+	vec4 const A(static_cast<T>(0), static_cast<T>(1), std::numeric_limits<T>::quiet_NaN(), static_cast<T>(1));
+	vec4 const B(std::numeric_limits<T>::quiet_NaN());
+
+	Error += !glm::any(glm::lessThan(A, B)) ? 0 : 1;
+	Error += !glm::any(glm::lessThanEqual(A, B)) ? 0 : 1;
+	Error += !glm::any(glm::greaterThan(A, B)) ? 0 : 1;
+	Error += !glm::any(glm::greaterThanEqual(A, B)) ? 0 : 1;
+	Error += !glm::any(glm::equal(A, B)) ? 0 : 1;
+	Error += glm::all(glm::notEqual(A, B)) ? 0 : 1;
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
@@ -174,6 +226,18 @@ int main()
 	Error += test_less();
 	Error += test_greater();
 	Error += test_equal();
+	Error += test_relational<float, glm::defaultp>();
+	Error += test_relational<int, glm::defaultp>();
+	Error += test_relational<double, glm::defaultp>();
+	Error += test_nan<float, glm::defaultp>();
+	Error += test_nan<double, glm::defaultp>();
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		Error += test_relational<float, glm::aligned_highp>();
+		Error += test_relational<int, glm::aligned_highp>();
+		Error += test_relational<double, glm::aligned_highp>();
+		Error += test_nan<float, glm::aligned_highp>();
+		Error += test_nan<double, glm::aligned_highp>();
+#	endif
 
 	return Error;
 }
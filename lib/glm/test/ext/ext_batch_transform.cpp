@@ -0,0 +1,167 @@
+#include <glm/ext/batch_transform.hpp>
+#include <glm/ext/matrix_clip_space.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/ext/matrix_float4x4.hpp>
+#include <glm/ext/matrix_double4x4.hpp>
+#include <glm/ext/vector_float3.hpp>
+#include <glm/ext/vector_double3.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <vector>
+
+// Sizes that exercise the 8 and 4 wide loops and the scalar tail
+static std::size_t const Counts[] = {0, 1, 3, 4, 7, 8, 13, 16, 37};
+
+template<typename T>
+static glm::mat<4, 4, T, glm::defaultp> transform_matrix()
+{
+	glm::mat<4, 4, T, glm::defaultp> const Model = glm::translate(glm::rotate(glm::mat<4, 4, T, glm::defaultp>(1), static_cast<T>(0.7), glm::vec<3, T, glm::defaultp>(1, 2, 3)), glm::vec<3, T, glm::defaultp>(2, -1, 4));
+	return glm::scale(Model, glm::vec<3, T, glm::defaultp>(1.5, 0.5, 2));
+}
+
+template<typename T>
+static glm::vec<4, T, glm::defaultp> sample(std::size_t i)
+{
+	T const t = static_cast<T>(i);
+	return glm::vec<4, T, glm::defaultp>(t * static_cast<T>(0.25) - 3, static_cast<T>(2) - t * static_cast<T>(0.5), t + static_cast<T>(0.5), static_cast<T>(1) + t * static_cast<T>(0.125));
+}
+
+template<typename T>
+static int test_transform(T Epsilon)
+{
+	typedef glm::vec<4, T, glm::defaultp> vec4_t;
+
+	int Error = 0;
+
+	glm::mat<4, 4, T, glm::defaultp> const M = transform_matrix<T>();
+
+	for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+	{
+		std::size_t const Count = Counts[c];
+
+		std::vector<T> X(Count + 1), Y(Count + 1), Z(Count + 1), W(Count + 1);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			vec4_t const v = sample<T>(i);
+			X[i] = v.x; Y[i] = v.y; Z[i] = v.z; W[i] = v.w;
+		}
+
+		std::vector<T> OX(Count + 1, T(-7)), OY(Count + 1, T(-7)), OZ(Count + 1, T(-7)), OW(Count + 1, T(-7));
+		glm::batchTransform(M, &X[0], &Y[0], &Z[0], &W[0], &OX[0], &OY[0], &OZ[0], &OW[0], Count);
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			vec4_t const Expected = M * sample<T>(i);
+			Error += glm::all(glm::equal(vec4_t(OX[i], OY[i], OZ[i], OW[i]), Expected, Epsilon)) ? 0 : 1;
+		}
+
+		// Elements past Count are left untouched
+		Error += glm::equal(OX[Count], T(-7), T(0)) && glm::equal(OW[Count], T(-7), T(0)) ? 0 : 1;
+
+		// In place
+		glm::batchTransform(M, &X[0], &Y[0], &Z[0], &W[0], &X[0], &Y[0], &Z[0], &W[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(vec4_t(X[i], Y[i], Z[i], W[i]), vec4_t(OX[i], OY[i], OZ[i], OW[i]), T(0))) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<typename T>
+static int test_points_soa(T Epsilon)
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3_t;
+	typedef glm::vec<4, T, glm::defaultp> vec4_t;
+
+	int Error = 0;
+
+	glm::mat<4, 4, T, glm::defaultp> const Model = transform_matrix<T>();
+	glm::mat<4, 4, T, glm::defaultp> const Proj = glm::perspective(static_cast<T>(0.8), static_cast<T>(1.5), static_cast<T>(0.1), static_cast<T>(100)) * Model;
+
+	for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+	{
+		std::size_t const Count = Counts[c];
+
+		std::vector<T> X(Count + 1), Y(Count + 1), Z(Count + 1);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			vec4_t const v = sample<T>(i);
+			X[i] = v.x; Y[i] = v.y; Z[i] = v.z;
+		}
+
+		std::vector<T> OX(Count + 1), OY(Count + 1), OZ(Count + 1);
+
+		glm::batchTransformPoints(Model, &X[0], &Y[0], &Z[0], &OX[0], &OY[0], &OZ[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			vec3_t const Expected(Model * vec4_t(vec3_t(sample<T>(i)), 1));
+			Error += glm::all(glm::equal(vec3_t(OX[i], OY[i], OZ[i]), Expected, Epsilon)) ? 0 : 1;
+		}
+
+		glm::batchProjectPoints(Proj, &X[0], &Y[0], &Z[0], &OX[0], &OY[0], &OZ[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			vec4_t const Clip(Proj * vec4_t(vec3_t(sample<T>(i)), 1));
+			Error += glm::all(glm::equal(vec3_t(OX[i], OY[i], OZ[i]), vec3_t(Clip) / Clip.w, Epsilon)) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+template<typename T>
+static int test_points_packed(T Epsilon)
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3_t;
+	typedef glm::vec<4, T, glm::defaultp> vec4_t;
+
+	int Error = 0;
+
+	glm::mat<4, 4, T, glm::defaultp> const Model = transform_matrix<T>();
+	glm::mat<4, 4, T, glm::defaultp> const Proj = glm::perspective(static_cast<T>(0.8), static_cast<T>(1.5), static_cast<T>(0.1), static_cast<T>(100)) * Model;
+
+	for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+	{
+		std::size_t const Count = Counts[c];
+
+		std::vector<vec3_t> In(Count + 1);
+		for(std::size_t i = 0; i < Count; ++i)
+			In[i] = vec3_t(sample<T>(i));
+
+		std::vector<vec3_t> Out(Count + 1, vec3_t(-7));
+
+		glm::batchTransformPoints(Model, &In[0], &Out[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Out[i], vec3_t(Model * vec4_t(In[i], 1)), Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(Out[Count], vec3_t(-7), T(0))) ? 0 : 1;
+
+		glm::batchProjectPoints(Proj, &In[0], &Out[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			vec4_t const Clip(Proj * vec4_t(In[i], 1));
+			Error += glm::all(glm::equal(Out[i], vec3_t(Clip) / Clip.w, Epsilon)) ? 0 : 1;
+		}
+
+		// In place
+		std::vector<vec3_t> Inout(In);
+		glm::batchProjectPoints(Proj, &Inout[0], &Inout[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Inout[i], Out[i], T(0))) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_transform<float>(0.0001f);
+	Error += test_transform<double>(0.0000001);
+	Error += test_points_soa<float>(0.0001f);
+	Error += test_points_soa<double>(0.0000001);
+	Error += test_points_packed<float>(0.0001f);
+	Error += test_points_packed<double>(0.0000001);
+
+	return Error;
+}
@@ -0,0 +1,198 @@
+#include <glm/ext/culling.hpp>
+#include <glm/ext/matrix_clip_space.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/ext/scalar_constants.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <limits>
+#include <vector>
+
+// Sizes that exercise whole masks, the 8 and 4 wide loops and the scalar tail
+static std::size_t const Counts[] = {0, 1, 7, 31, 32, 33, 64, 77, 200};
+
+template<typename T>
+static glm::mat<4, 4, T, glm::defaultp> view_projection()
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3;
+
+	glm::mat<4, 4, T, glm::defaultp> const Projection = glm::perspectiveZO(static_cast<T>(1), static_cast<T>(1.5), static_cast<T>(0.5), static_cast<T>(50));
+	return Projection * glm::lookAt(vec3(1, 2, 3), vec3(0, 0, -10), vec3(0, 1, 0));
+}
+
+template<typename T>
+static T signed_distance(glm::vec<4, T, glm::defaultp> const& Plane, glm::vec<3, T, glm::defaultp> const& p)
+{
+	return glm::dot(glm::vec<3, T, glm::defaultp>(Plane), p) + Plane.w;
+}
+
+template<typename T>
+static int test_planes()
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3;
+	typedef glm::vec<4, T, glm::defaultp> vec4;
+
+	int Error = 0;
+
+	T const Near = static_cast<T>(0.5);
+	T const Far = static_cast<T>(50);
+	T const Epsilon = static_cast<T>(1e-4);
+
+	// The plane distances suffer from cancellation, relative to the far distance
+	vec4 const PlaneEpsilon(Epsilon, Epsilon, Epsilon, Epsilon * Far);
+
+	vec4 ZO[6];
+	glm::frustumPlanesZO(glm::perspectiveZO(glm::pi<T>() * static_cast<T>(0.5), static_cast<T>(1), Near, Far), ZO);
+	vec4 NO[6];
+	glm::frustumPlanesNO(glm::perspectiveNO(glm::pi<T>() * static_cast<T>(0.5), static_cast<T>(1), Near, Far), NO);
+
+	for(int i = 0; i < 6; ++i)
+	{
+		Error += glm::equal(glm::length(vec3(ZO[i])), static_cast<T>(1), Epsilon) ? 0 : 1;
+		Error += glm::all(glm::equal(ZO[i], NO[i], PlaneEpsilon)) ? 0 : 1;
+
+		// The camera looks down -z, a point on the axis between the near and far planes is inside
+		Error += signed_distance(ZO[i], vec3(0, 0, -Near * static_cast<T>(2))) > static_cast<T>(0) ? 0 : 1;
+	}
+
+	// With a 90 degrees field of view, the side planes are at 45 degrees
+	Error += glm::all(glm::equal(ZO[0], vec4(glm::sqrt(static_cast<T>(0.5)), 0, -glm::sqrt(static_cast<T>(0.5)), 0), Epsilon)) ? 0 : 1;
+	Error += glm::all(glm::equal(ZO[4], vec4(0, 0, -1, -Near), Epsilon)) ? 0 : 1;
+	Error += glm::all(glm::equal(ZO[5], vec4(0, 0, 1, Far), PlaneEpsilon)) ? 0 : 1;
+
+	// The far plane of an infinite projection never culls
+	vec4 Infinite[6];
+	glm::frustumPlanes(glm::infinitePerspective(static_cast<T>(1), static_cast<T>(1), Near), Infinite);
+	Error += glm::all(glm::equal(Infinite[5], vec4(0, 0, 0, 1), Epsilon)) ? 0 : 1;
+
+	return Error;
+}
+
+template<typename T>
+static int test_spheres()
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3;
+	typedef glm::vec<4, T, glm::defaultp> vec4;
+
+	int Error = 0;
+
+	vec4 Planes[6];
+	glm::frustumPlanes(view_projection<T>(), Planes);
+
+	for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+	{
+		std::size_t const Count = Counts[c];
+
+		std::vector<T> x(Count + 1), y(Count + 1), z(Count + 1), r(Count + 1);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			T const t = static_cast<T>(i);
+			x[i] = glm::sin(t * static_cast<T>(1.7)) * static_cast<T>(20);
+			y[i] = glm::cos(t * static_cast<T>(0.9)) * static_cast<T>(15);
+			z[i] = -glm::mod(t * static_cast<T>(3.1), static_cast<T>(70)) + static_cast<T>(5);
+			r[i] = static_cast<T>(0.5) + glm::mod(t, static_cast<T>(4));
+		}
+
+		std::vector<glm::uint32> Visible((Count + 31) / 32 + 1, 0xdeadbeef);
+		std::size_t const VisibleCount = glm::cullSpheres(Planes, &x[0], &y[0], &z[0], &r[0], &Visible[0], Count);
+
+		std::size_t Expected = 0;
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			T Distance = signed_distance(Planes[0], vec3(x[i], y[i], z[i]));
+			for(int p = 1; p < 6; ++p)
+				Distance = glm::min(Distance, signed_distance(Planes[p], vec3(x[i], y[i], z[i])));
+
+			bool const Bit = ((Visible[i / 32] >> (i % 32)) & 1u) != 0;
+			Expected += Bit ? 1 : 0;
+
+			// Skip the spheres that touch a plane, the rounding of the SIMD paths may differ
+			if(glm::abs(Distance + r[i]) > static_cast<T>(1e-3))
+				Error += Bit == (Distance + r[i] >= static_cast<T>(0)) ? 0 : 1;
+		}
+
+		Error += VisibleCount == Expected ? 0 : 1;
+		if(Count % 32)
+			Error += (Visible[Count / 32] >> (Count % 32)) == 0 ? 0 : 1;
+		Error += Visible[(Count + 31) / 32] == 0xdeadbeef ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<typename T>
+static int test_aabbs()
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3;
+	typedef glm::vec<4, T, glm::defaultp> vec4;
+
+	int Error = 0;
+
+	vec4 Planes[6];
+	glm::frustumPlanes(view_projection<T>(), Planes);
+
+	for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+	{
+		std::size_t const Count = Counts[c];
+
+		std::vector<T> MinX(Count + 1), MinY(Count + 1), MinZ(Count + 1), MaxX(Count + 1), MaxY(Count + 1), MaxZ(Count + 1);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			T const t = static_cast<T>(i);
+			vec3 const Center(glm::sin(t * static_cast<T>(1.3)) * static_cast<T>(25), glm::cos(t * static_cast<T>(0.7)) * static_cast<T>(20), -glm::mod(t * static_cast<T>(2.3), static_cast<T>(70)) + static_cast<T>(5));
+			vec3 const Extent(static_cast<T>(0.5) + glm::mod(t, static_cast<T>(3)), static_cast<T>(1), static_cast<T>(0.25) + glm::mod(t, static_cast<T>(5)));
+			MinX[i] = Center.x - Extent.x;
+			MinY[i] = Center.y - Extent.y;
+			MinZ[i] = Center.z - Extent.z;
+			MaxX[i] = Center.x + Extent.x;
+			MaxY[i] = Center.y + Extent.y;
+			MaxZ[i] = Center.z + Extent.z;
+		}
+
+		std::vector<glm::uint32> Visible((Count + 31) / 32 + 1, 0xdeadbeef);
+		std::size_t const VisibleCount = glm::cullAABBs(Planes, &MinX[0], &MinY[0], &MinZ[0], &MaxX[0], &MaxY[0], &MaxZ[0], &Visible[0], Count);
+
+		std::size_t Expected = 0;
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			// Signed distance of the 8 corners, the box is visible unless all corners are behind one plane
+			T Distance = std::numeric_limits<T>::max();
+			for(int p = 0; p < 6; ++p)
+			{
+				T Furthest = -std::numeric_limits<T>::max();
+				for(int Corner = 0; Corner < 8; ++Corner)
+				{
+					vec3 const Point(Corner & 1 ? MaxX[i] : MinX[i], Corner & 2 ? MaxY[i] : MinY[i], Corner & 4 ? MaxZ[i] : MinZ[i]);
+					Furthest = glm::max(Furthest, signed_distance(Planes[p], Point));
+				}
+				Distance = glm::min(Distance, Furthest);
+			}
+
+			bool const Bit = ((Visible[i / 32] >> (i % 32)) & 1u) != 0;
+			Expected += Bit ? 1 : 0;
+
+			if(glm::abs(Distance) > static_cast<T>(1e-3))
+				Error += Bit == (Distance >= static_cast<T>(0)) ? 0 : 1;
+		}
+
+		Error += VisibleCount == Expected ? 0 : 1;
+		if(Count % 32)
+			Error += (Visible[Count / 32] >> (Count % 32)) == 0 ? 0 : 1;
+		Error += Visible[(Count + 31) / 32] == 0xdeadbeef ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_planes<float>();
+	Error += test_planes<double>();
+	Error += test_spheres<float>();
+	Error += test_spheres<double>();
+	Error += test_aabbs<float>();
+	Error += test_aabbs<double>();
+
+	return Error;
+}
@@ -0,0 +1,148 @@
+#include <glm/ext/matrix_affine.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
+#include <vector>
+
+template<typename T, glm::qualifier Q>
+static glm::mat<4, 4, T, Q> affine_transform(T Angle, glm::vec<3, T, Q> const& Scale)
+{
+	typedef glm::vec<3, T, Q> vec3;
+
+	glm::mat<4, 4, T, Q> const Translate = glm::translate(glm::mat<4, 4, T, Q>(static_cast<T>(1)), vec3(1, -2, 3));
+	glm::mat<4, 4, T, Q> const Rotate = glm::rotate(Translate, Angle, glm::normalize(vec3(1, 2, 3)));
+	return glm::scale(Rotate, Scale);
+}
+
+template<typename T, glm::qualifier Q>
+static int test_cast()
+{
+	int Error = 0;
+
+	glm::mat<4, 4, T, Q> const M = affine_transform<T, Q>(static_cast<T>(0.7), glm::vec<3, T, Q>(static_cast<T>(0.5), 2, 4));
+	glm::mat<3, 4, T, Q> const A = glm::mat3x4_cast(M);
+
+	for(glm::length_t r = 0; r < 3; ++r)
+	for(glm::length_t c = 0; c < 4; ++c)
+		Error += glm::equal(A[r][c], M[c][r], static_cast<T>(0)) ? 0 : 1;
+
+	Error += glm::all(glm::equal(glm::mat4_cast(A), M, static_cast<T>(0))) ? 0 : 1;
+
+	return Error;
+}
+
+template<typename T, glm::qualifier Q>
+static int test_compose()
+{
+	typedef glm::vec<3, T, Q> vec3;
+
+	int Error = 0;
+
+	T const Epsilon = static_cast<T>(1e-5);
+
+	glm::mat<4, 4, T, Q> const M0 = affine_transform<T, Q>(static_cast<T>(0.7), vec3(static_cast<T>(0.5), 2, 4));
+	glm::mat<4, 4, T, Q> const M1 = affine_transform<T, Q>(static_cast<T>(-1.3), vec3(3, 1, static_cast<T>(0.25)));
+
+	glm::mat<3, 4, T, Q> const A = glm::affineCompose(glm::mat3x4_cast(M0), glm::mat3x4_cast(M1));
+	Error += glm::all(glm::equal(glm::mat4_cast(A), M0 * M1, Epsilon)) ? 0 : 1;
+
+	// Arrays, with the output aliasing the first input
+	std::vector<glm::mat<3, 4, T, Q> > a(17), b(17);
+	for(std::size_t i = 0; i < a.size(); ++i)
+	{
+		a[i] = glm::mat3x4_cast(affine_transform<T, Q>(static_cast<T>(i) * static_cast<T>(0.1), vec3(1, 2, 3)));
+		b[i] = glm::mat3x4_cast(affine_transform<T, Q>(static_cast<T>(i) * static_cast<T>(-0.2), vec3(3, 2, 1)));
+	}
+	std::vector<glm::mat<3, 4, T, Q> > Expected(a.size());
+	for(std::size_t i = 0; i < a.size(); ++i)
+		Expected[i] = glm::mat3x4_cast(glm::mat4_cast(a[i]) * glm::mat4_cast(b[i]));
+
+	glm::affineCompose(&a[0], &b[0], &a[0], a.size());
+	for(std::size_t i = 0; i < a.size(); ++i)
+		Error += glm::all(glm::equal(a[i], Expected[i], Epsilon)) ? 0 : 1;
+
+	return Error;
+}
+
+template<typename T, glm::qualifier Q>
+static int test_transform()
+{
+	typedef glm::vec<3, T, Q> vec3;
+	typedef glm::vec<4, T, Q> vec4;
+
+	int Error = 0;
+
+	T const Epsilon = static_cast<T>(1e-5);
+
+	glm::mat<4, 4, T, Q> const M = affine_transform<T, Q>(static_cast<T>(0.7), vec3(static_cast<T>(0.5), 2, 4));
+	glm::mat<3, 4, T, Q> const A = glm::mat3x4_cast(M);
+
+	vec3 const p(static_cast<T>(1.5), -3, static_cast<T>(0.25));
+	Error += glm::all(glm::equal(glm::affineTransformPoint(A, p), vec3(M * vec4(p, 1)), Epsilon)) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::affineTransformVector(A, p), vec3(M * vec4(p, 0)), Epsilon)) ? 0 : 1;
+
+	return Error;
+}
+
+template<typename T, glm::qualifier Q>
+static int test_inverse()
+{
+	typedef glm::vec<3, T, Q> vec3;
+
+	int Error = 0;
+
+	T const Epsilon = static_cast<T>(1e-5);
+	glm::mat<3, 4, T, Q> const Identity = glm::mat3x4_cast(glm::mat<4, 4, T, Q>(static_cast<T>(1)));
+
+	{
+		glm::mat<4, 4, T, Q> const M = affine_transform<T, Q>(static_cast<T>(0.7), vec3(static_cast<T>(0.5), 2, 4));
+		glm::mat<3, 4, T, Q> const A = glm::mat3x4_cast(M);
+		glm::mat<3, 4, T, Q> const I = glm::affineInverse(A);
+
+		Error += glm::all(glm::equal(glm::mat4_cast(I), glm::inverse(M), Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::affineCompose(A, I), Identity, Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::affineCompose(I, A), Identity, Epsilon)) ? 0 : 1;
+	}
+
+	{
+		glm::mat<4, 4, T, Q> const M = affine_transform<T, Q>(static_cast<T>(-2.1), vec3(1, 1, 1));
+		glm::mat<3, 4, T, Q> const A = glm::mat3x4_cast(M);
+		glm::mat<3, 4, T, Q> const I = glm::rigidInverse(A);
+
+		Error += glm::all(glm::equal(glm::mat4_cast(I), glm::inverse(M), Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(I, glm::affineInverse(A), Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::affineCompose(A, I), Identity, Epsilon)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<typename T, glm::qualifier Q>
+static int test_affine()
+{
+	int Error = 0;
+
+	Error += test_cast<T, Q>();
+	Error += test_compose<T, Q>();
+	Error += test_transform<T, Q>();
+	Error += test_inverse<T, Q>();
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_affine<float, glm::defaultp>();
+	Error += test_affine<double, glm::defaultp>();
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		Error += test_affine<float, glm::aligned_highp>();
+#	endif
+
+	return Error;
+}
@@ -0,0 +1,157 @@
+#include <glm/ext/quaternion_soa.hpp>
+#include <glm/ext/quaternion_common.hpp>
+#include <glm/ext/quaternion_geometric.hpp>
+#include <glm/ext/quaternion_relational.hpp>
+#include <glm/ext/quaternion_float.hpp>
+#include <glm/ext/quaternion_double.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/matrix.hpp>
+#include <vector>
+
+// Unit quaternions spread over the sphere, every fourth pair on opposite hemispheres and a few identical pairs
+template<typename T>
+static glm::qua<T, glm::defaultp> sample(std::size_t i, std::size_t Seed)
+{
+	T const a = static_cast<T>(i * 7 + Seed * 13);
+	glm::qua<T, glm::defaultp> const q(glm::sin(a * static_cast<T>(0.37)), glm::cos(a * static_cast<T>(0.71)), glm::sin(a * static_cast<T>(1.13) + static_cast<T>(1)), glm::cos(a * static_cast<T>(0.29) + static_cast<T>(2)));
+	return glm::normalize(q);
+}
+
+template<typename T>
+static void samples(std::size_t Count, std::vector<glm::qua<T, glm::defaultp> >& x, std::vector<glm::qua<T, glm::defaultp> >& y, std::vector<T>& a)
+{
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		x.push_back(sample<T>(i, 0));
+		y.push_back(i % 5 == 0 ? x[i] : i % 4 == 0 ? -sample<T>(i, 1) : sample<T>(i, 1));
+		a.push_back(static_cast<T>(i % 11) / static_cast<T>(10));
+	}
+}
+
+template<typename T>
+static int test_load_store()
+{
+	int Error = 0;
+
+	std::vector<glm::qua<T, glm::defaultp> > x, y, Out(8);
+	std::vector<T> a;
+	samples<T>(8, x, y, a);
+
+	glm::soa_qua<T, 4> const q = glm::soa_qua<T, 4>::load(&x[0]);
+	Error += glm::equal(q.w[1], x[1].w, glm::epsilon<T>()) ? 0 : 1;
+	Error += glm::equal(q.x[2], x[2].x, glm::epsilon<T>()) ? 0 : 1;
+
+	q.store(&Out[0]);
+	for(std::size_t i = 0; i < 4; ++i)
+		Error += glm::all(glm::equal(Out[i], x[i], glm::epsilon<T>())) ? 0 : 1;
+
+	glm::soa_qua<T, 4> const p = glm::soa_qua<T, 4>::load(&y[0]);
+	(p * q).store(&Out[0]);
+	for(std::size_t i = 0; i < 4; ++i)
+		Error += glm::all(glm::equal(Out[i], y[i] * x[i], glm::epsilon<T>() * static_cast<T>(4))) ? 0 : 1;
+
+	glm::conjugate(q).store(&Out[0]);
+	for(std::size_t i = 0; i < 4; ++i)
+		Error += glm::all(glm::equal(Out[i], glm::conjugate(x[i]), glm::epsilon<T>())) ? 0 : 1;
+
+	return Error;
+}
+
+template<typename T>
+static int test_slerp(T Epsilon)
+{
+	int Error = 0;
+
+	// Not a multiple of the width to cover the tail
+	std::size_t const Count = 1003;
+
+	std::vector<glm::qua<T, glm::defaultp> > x, y, Out(Count);
+	std::vector<T> a;
+	samples<T>(Count, x, y, a);
+
+	glm::slerp(&x[0], &y[0], &a[0], &Out[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(Out[i], glm::slerp(x[i], y[i], a[i]), Epsilon)) ? 0 : 1;
+
+	glm::slerp(&x[0], &y[0], static_cast<T>(0.25), &Out[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(Out[i], glm::slerp(x[i], y[i], static_cast<T>(0.25)), Epsilon)) ? 0 : 1;
+
+	// The end points are exact up to the sign of y
+	glm::slerp(&x[0], &y[0], static_cast<T>(1), &Out[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::abs(glm::dot(Out[i], y[i])) > static_cast<T>(1) - Epsilon ? 0 : 1;
+
+	return Error;
+}
+
+template<typename T>
+static int test_nlerp(T Epsilon)
+{
+	int Error = 0;
+
+	std::size_t const Count = 1003;
+
+	std::vector<glm::qua<T, glm::defaultp> > x, y, Out(Count);
+	std::vector<T> a;
+	samples<T>(Count, x, y, a);
+
+	glm::nlerp(&x[0], &y[0], &a[0], &Out[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::qua<T, glm::defaultp> const z = glm::dot(x[i], y[i]) < static_cast<T>(0) ? -y[i] : y[i];
+		Error += glm::all(glm::equal(Out[i], glm::normalize(glm::lerp(x[i], z, a[i])), Epsilon)) ? 0 : 1;
+	}
+
+	glm::nlerp(&x[0], &y[0], static_cast<T>(0.5), &Out[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::qua<T, glm::defaultp> const z = glm::dot(x[i], y[i]) < static_cast<T>(0) ? -y[i] : y[i];
+		Error += glm::all(glm::equal(Out[i], glm::normalize(glm::lerp(x[i], z, static_cast<T>(0.5))), Epsilon)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<typename T>
+static int test_mat_cast(T Epsilon)
+{
+	int Error = 0;
+
+	std::size_t const Count = 13;
+
+	std::vector<glm::qua<T, glm::defaultp> > x, y;
+	std::vector<T> a;
+	samples<T>(Count, x, y, a);
+
+	std::vector<glm::mat<4, 4, T, glm::defaultp> > Mat4(Count);
+	glm::mat4_cast(&x[0], &Mat4[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(Mat4[i], glm::mat4_cast(x[i]), Epsilon)) ? 0 : 1;
+
+	std::vector<glm::mat<3, 4, T, glm::defaultp> > Mat3x4(Count);
+	glm::mat3x4_cast(&x[0], &Mat3x4[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(Mat3x4[i], glm::mat<3, 4, T, glm::defaultp>(glm::transpose(glm::mat4_cast(x[i]))), Epsilon)) ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_load_store<float>();
+	Error += test_load_store<double>();
+	Error += test_slerp<float>(1e-6f);
+	Error += test_slerp<double>(1e-7);
+	Error += test_nlerp<float>(1e-6f);
+	Error += test_nlerp<double>(1e-12);
+	Error += test_mat_cast<float>(1e-6f);
+	Error += test_mat_cast<double>(1e-12);
+
+	return Error;
+}
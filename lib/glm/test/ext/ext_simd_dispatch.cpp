@@ -0,0 +1,320 @@
+#include <glm/ext/simd_dispatch.hpp>
+#include <glm/ext/matrix_clip_space.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <cstring>
+#include <vector>
+
+// Sizes that exercise the 16 and 8 wide kernels, whole masks and the tails
+static std::size_t const Counts[] = {0, 1, 7, 8, 16, 31, 32, 33, 64, 77, 200};
+
+static glm::simd_level const Levels[] = {glm::simd_level_generic, glm::simd_level_avx2, glm::simd_level_avx512};
+
+static float random_float(unsigned& Seed, float Min, float Max)
+{
+	Seed = Seed * 1664525u + 1013904223u;
+	return Min + (Max - Min) * static_cast<float>(Seed >> 8) / static_cast<float>(1 << 24);
+}
+
+static glm::mat4 view_projection()
+{
+	glm::mat4 const Projection = glm::perspectiveZO(1.0f, 1.5f, 0.5f, 50.0f);
+	return Projection * glm::lookAt(glm::vec3(1, 2, 3), glm::vec3(0, 0, -10), glm::vec3(0, 1, 0));
+}
+
+static bool bit(std::vector<glm::uint32> const& Visible, std::size_t i)
+{
+	return ((Visible[i / 32] >> (i % 32)) & 1u) != 0;
+}
+
+// Object by object references the dispatched kernels are checked against, independently of the array functions
+static bool reference_sphere(glm::vec4 const Planes[6], glm::vec3 const& Center, float Radius)
+{
+	for(int p = 0; p < 6; ++p)
+		if(glm::dot(glm::vec3(Planes[p]), Center) + Planes[p].w < -Radius)
+			return false;
+	return true;
+}
+
+static bool reference_aabb(glm::vec4 const Planes[6], glm::vec3 const& Min, glm::vec3 const& Max)
+{
+	for(int p = 0; p < 6; ++p)
+	{
+		bool Behind = true;
+		for(int Corner = 0; Corner < 8; ++Corner)
+		{
+			glm::vec3 const Vertex(Corner & 1 ? Max.x : Min.x, Corner & 2 ? Max.y : Min.y, Corner & 4 ? Max.z : Min.z);
+			Behind = Behind && glm::dot(glm::vec3(Planes[p]), Vertex) + Planes[p].w < 0.0f;
+		}
+		if(Behind)
+			return false;
+	}
+	return true;
+}
+
+static int test_level()
+{
+	int Error = 0;
+
+	glm::simd_level const Detected = glm::detectSimdLevel();
+	Error += glm::simdLevel() == Detected ? 0 : 1;
+
+#	if GLM_CONFIG_SIMD_DISPATCH == GLM_DISABLE
+		Error += Detected == glm::simd_level_generic ? 0 : 1;
+#	endif
+
+	// The level is clamped to the detected level
+	for(std::size_t l = 0; l < sizeof(Levels) / sizeof(Levels[0]); ++l)
+	{
+		glm::simd_level const Forced = glm::forceSimdLevel(Levels[l]);
+		Error += Forced == (Levels[l] < Detected ? Levels[l] : Detected) ? 0 : 1;
+		Error += glm::simdLevel() == Forced ? 0 : 1;
+	}
+	glm::forceSimdLevel(Detected);
+
+	Error += std::strcmp(glm::simdLevelName(glm::simd_level_generic), "generic") == 0 ? 0 : 1;
+	Error += std::strcmp(glm::simdLevelName(glm::simd_level_avx2), "avx2") == 0 ? 0 : 1;
+	Error += std::strcmp(glm::simdLevelName(glm::simd_level_avx512), "avx512") == 0 ? 0 : 1;
+
+	return Error;
+}
+
+static int test_transform()
+{
+	int Error = 0;
+
+	glm::mat4 const m = view_projection();
+	unsigned Seed = 1;
+
+	for(std::size_t l = 0; l < sizeof(Levels) / sizeof(Levels[0]); ++l)
+	{
+		glm::forceSimdLevel(Levels[l]);
+
+		for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+		{
+			std::size_t const Count = Counts[c];
+
+			std::vector<float> In[4];
+			for(int k = 0; k < 4; ++k)
+			{
+				In[k].resize(Count + 1);
+				for(std::size_t i = 0; i < In[k].size(); ++i)
+					In[k][i] = random_float(Seed, -10.0f, 10.0f);
+			}
+			// Keep the points in front of the camera so the projection doesn't divide by a tiny w
+			for(std::size_t i = 0; i < Count; ++i)
+				In[2][i] = random_float(Seed, -40.0f, -5.0f);
+
+			std::vector<float> Expected[4];
+			std::vector<float> Result[4];
+			for(int k = 0; k < 4; ++k)
+			{
+				Expected[k].assign(Count + 1, 0.0f);
+				Result[k].assign(Count + 1, 0.0f);
+			}
+
+			glm::batchTransform(m, &In[0][0], &In[1][0], &In[2][0], &In[3][0], &Expected[0][0], &Expected[1][0], &Expected[2][0], &Expected[3][0], Count);
+			glm::dispatch::batchTransform(m, &In[0][0], &In[1][0], &In[2][0], &In[3][0], &Result[0][0], &Result[1][0], &Result[2][0], &Result[3][0], Count);
+			for(int k = 0; k < 4; ++k)
+			for(std::size_t i = 0; i < Count + 1; ++i)
+				Error += glm::equal(Expected[k][i], Result[k][i], 1e-4f) ? 0 : 1;
+
+			glm::batchTransformPoints(m, &In[0][0], &In[1][0], &In[2][0], &Expected[0][0], &Expected[1][0], &Expected[2][0], Count);
+			glm::dispatch::batchTransformPoints(m, &In[0][0], &In[1][0], &In[2][0], &Result[0][0], &Result[1][0], &Result[2][0], Count);
+			for(int k = 0; k < 3; ++k)
+			for(std::size_t i = 0; i < Count + 1; ++i)
+				Error += glm::equal(Expected[k][i], Result[k][i], 1e-4f) ? 0 : 1;
+
+			glm::batchProjectPoints(m, &In[0][0], &In[1][0], &In[2][0], &Expected[0][0], &Expected[1][0], &Expected[2][0], Count);
+			glm::dispatch::batchProjectPoints(m, &In[0][0], &In[1][0], &In[2][0], &Result[0][0], &Result[1][0], &Result[2][0], Count);
+			for(int k = 0; k < 3; ++k)
+			for(std::size_t i = 0; i < Count + 1; ++i)
+				Error += glm::equal(Expected[k][i], Result[k][i], 1e-5f) ? 0 : 1;
+		}
+	}
+	glm::forceSimdLevel(glm::detectSimdLevel());
+
+	return Error;
+}
+
+static int test_culling()
+{
+	int Error = 0;
+
+	glm::vec4 Planes[6];
+	glm::frustumPlanes(view_projection(), Planes);
+	unsigned Seed = 2;
+
+	for(std::size_t l = 0; l < sizeof(Levels) / sizeof(Levels[0]); ++l)
+	{
+		glm::forceSimdLevel(Levels[l]);
+
+		for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+		{
+			std::size_t const Count = Counts[c];
+			std::size_t const Words = (Count + 31) / 32 + 1;
+
+			std::vector<float> Min[3];
+			std::vector<float> Max[3];
+			std::vector<float> Radius(Count + 1);
+			for(int k = 0; k < 3; ++k)
+			{
+				Min[k].resize(Count + 1);
+				Max[k].resize(Count + 1);
+			}
+			for(std::size_t i = 0; i < Count + 1; ++i)
+			{
+				Min[0][i] = random_float(Seed, -20.0f, 20.0f);
+				Min[1][i] = random_float(Seed, -20.0f, 20.0f);
+				Min[2][i] = random_float(Seed, -60.0f, 5.0f);
+				Radius[i] = random_float(Seed, 0.0f, 2.0f);
+				for(int k = 0; k < 3; ++k)
+					Max[k][i] = Min[k][i] + Radius[i];
+			}
+
+			// Skip the objects so close to a plane that the rounding of fused multiply-adds may change the result
+			std::vector<bool> Robust(Count, true);
+			for(std::size_t i = 0; i < Count; ++i)
+			for(int p = 0; p < 6; ++p)
+			{
+				glm::vec3 const Center(Min[0][i], Min[1][i], Min[2][i]);
+				float const Distance = glm::dot(glm::vec3(Planes[p]), Center) + Planes[p].w;
+				if(glm::abs(Distance + Radius[i]) < 1e-3f)
+					Robust[i] = false;
+				for(int Corner = 0; Corner < 8; ++Corner)
+				{
+					glm::vec3 const Vertex(
+						Corner & 1 ? Max[0][i] : Min[0][i],
+						Corner & 2 ? Max[1][i] : Min[1][i],
+						Corner & 4 ? Max[2][i] : Min[2][i]);
+					if(glm::abs(glm::dot(glm::vec3(Planes[p]), Vertex) + Planes[p].w) < 1e-3f)
+						Robust[i] = false;
+				}
+			}
+
+			std::vector<glm::uint32> Expected(Words, 0u);
+			std::vector<glm::uint32> Result(Words, 0u);
+
+			std::size_t const ExpectedSpheres = glm::cullSpheres(Planes, &Min[0][0], &Min[1][0], &Min[2][0], &Radius[0], &Expected[0], Count);
+			std::size_t const ResultSpheres = glm::dispatch::cullSpheres(Planes, &Min[0][0], &Min[1][0], &Min[2][0], &Radius[0], &Result[0], Count);
+			std::size_t Robusts = 0;
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				bool const Reference = reference_sphere(Planes, glm::vec3(Min[0][i], Min[1][i], Min[2][i]), Radius[i]);
+				Error += !Robust[i] || bit(Expected, i) == bit(Result, i) ? 0 : 1;
+				Error += !Robust[i] || bit(Result, i) == Reference ? 0 : 1;
+				Robusts += Robust[i] ? 1 : 0;
+			}
+			Error += ResultSpheres + Robusts >= ExpectedSpheres && ResultSpheres <= ExpectedSpheres + Count - Robusts ? 0 : 1;
+
+			Expected.assign(Words, 0u);
+			Result.assign(Words, 0u);
+			std::size_t const ExpectedAABBs = glm::cullAABBs(Planes, &Min[0][0], &Min[1][0], &Min[2][0], &Max[0][0], &Max[1][0], &Max[2][0], &Expected[0], Count);
+			std::size_t const ResultAABBs = glm::dispatch::cullAABBs(Planes, &Min[0][0], &Min[1][0], &Min[2][0], &Max[0][0], &Max[1][0], &Max[2][0], &Result[0], Count);
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				bool const Reference = reference_aabb(Planes, glm::vec3(Min[0][i], Min[1][i], Min[2][i]), glm::vec3(Max[0][i], Max[1][i], Max[2][i]));
+				Error += !Robust[i] || bit(Expected, i) == bit(Result, i) ? 0 : 1;
+				Error += !Robust[i] || bit(Result, i) == Reference ? 0 : 1;
+			}
+			Error += ResultAABBs + Robusts >= ExpectedAABBs && ResultAABBs <= ExpectedAABBs + Count - Robusts ? 0 : 1;
+
+			// The words past the last object are untouched
+			Error += Result[Words - 1] == 0u ? 0 : 1;
+		}
+	}
+	glm::forceSimdLevel(glm::detectSimdLevel());
+
+	return Error;
+}
+
+static int test_half()
+{
+	int Error = 0;
+
+	unsigned Seed = 3;
+
+	for(std::size_t l = 0; l < sizeof(Levels) / sizeof(Levels[0]); ++l)
+	{
+		glm::forceSimdLevel(Levels[l]);
+
+		for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+		{
+			std::size_t const Count = Counts[c];
+
+			std::vector<float> In(Count + 1);
+			for(std::size_t i = 0; i < In.size(); ++i)
+				In[i] = random_float(Seed, -70000.0f, 70000.0f) * (i % 3 == 0 ? 1e-4f : 1.0f);
+
+			std::vector<glm::uint16> Expected(Count + 1, 0);
+			std::vector<glm::uint16> Result(Count + 1, 0);
+			glm::packHalf(&In[0], &Expected[0], Count);
+			glm::dispatch::packHalf(&In[0], &Result[0], Count);
+			for(std::size_t i = 0; i < Count + 1; ++i)
+				Error += Expected[i] == Result[i] ? 0 : 1;
+
+			std::vector<float> ExpectedFloat(Count + 1, 0.0f);
+			std::vector<float> ResultFloat(Count + 1, 0.0f);
+			glm::unpackHalf(&Expected[0], &ExpectedFloat[0], Count);
+			glm::dispatch::unpackHalf(&Expected[0], &ResultFloat[0], Count);
+			Error += std::memcmp(&ExpectedFloat[0], &ResultFloat[0], sizeof(float) * (Count + 1)) == 0 ? 0 : 1;
+		}
+	}
+	glm::forceSimdLevel(glm::detectSimdLevel());
+
+	return Error;
+}
+
+static int test_noise()
+{
+	int Error = 0;
+
+	unsigned Seed = 4;
+
+	for(std::size_t l = 0; l < sizeof(Levels) / sizeof(Levels[0]); ++l)
+	{
+		glm::forceSimdLevel(Levels[l]);
+
+		for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+		{
+			std::size_t const Count = Counts[c];
+
+			std::vector<glm::vec3> p(Count + 1);
+			for(std::size_t i = 0; i < p.size(); ++i)
+				p[i] = glm::vec3(random_float(Seed, -50.0f, 50.0f), random_float(Seed, -50.0f, 50.0f), random_float(Seed, -50.0f, 50.0f));
+
+			std::vector<float> Expected(Count + 1, 0.0f);
+			std::vector<float> Result(Count + 1, 0.0f);
+			glm::simplex(&p[0], &Expected[0], Count);
+			glm::dispatch::simplex(&p[0], &Result[0], Count);
+			for(std::size_t i = 0; i < Count + 1; ++i)
+				Error += glm::equal(Expected[i], Result[i], 1e-4f) ? 0 : 1;
+			for(std::size_t i = 0; i < Count; ++i)
+				Error += glm::equal(glm::simplex(p[i]), Result[i], 1e-4f) ? 0 : 1;
+
+			glm::simplexFbm(&p[0], &Expected[0], Count, 4, 2.0f, 0.5f);
+			glm::dispatch::simplexFbm(&p[0], &Result[0], Count, 4);
+			for(std::size_t i = 0; i < Count + 1; ++i)
+				Error += glm::equal(Expected[i], Result[i], 1e-4f) ? 0 : 1;
+			for(std::size_t i = 0; i < Count; ++i)
+				Error += glm::equal(glm::simplexFbm(p[i], 4, 2.0f, 0.5f), Result[i], 1e-4f) ? 0 : 1;
+		}
+	}
+	glm::forceSimdLevel(glm::detectSimdLevel());
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_level();
+	Error += test_transform();
+	Error += test_culling();
+	Error += test_half();
+	Error += test_noise();
+
+	return Error;
+}
@@ -16,6 +16,10 @@
 #include <glm/ext/vector_double4.hpp>
 #include <glm/ext/vector_double4_precision.hpp>
 #include <glm/ext/vector_ulp.hpp>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
+#include <limits>
 
 template <typename vecType>
 static int test_equal()
@@ -119,6 +123,41 @@ static int test_notEqual_ulps()
 	return Error;
 }
 
+template<typename T, glm::qualifier Q>
+static int test_mask()
+{
+	typedef glm::vec<4, T, Q> vec4;
+
+	int Error = 0;
+
+	T const One(1);
+	vec4 const A(One, glm::nextFloat(glm::nextFloat(One)), static_cast<T>(0), static_cast<T>(-2));
+	vec4 const B(glm::nextFloat(One), One, -static_cast<T>(0), static_cast<T>(3));
+
+	Error += glm::lessThanMask(A, B) == (1 | 8) ? 0 : 1;
+	Error += glm::lessThanEqualMask(A, B) == (1 | 4 | 8) ? 0 : 1;
+	Error += glm::greaterThanMask(A, B) == 2 ? 0 : 1;
+	Error += glm::greaterThanEqualMask(A, B) == (2 | 4) ? 0 : 1;
+	Error += glm::equalMask(A, B) == 4 ? 0 : 1;
+	Error += glm::notEqualMask(A, B) == (1 | 2 | 8) ? 0 : 1;
+
+	Error += glm::equalMask(A, B, static_cast<T>(0.001)) == (1 | 2 | 4) ? 0 : 1;
+	Error += glm::notEqualMask(A, B, vec4(static_cast<T>(0.001))) == 8 ? 0 : 1;
+	Error += glm::equalMask(A, B, 1) == (1 | 4) ? 0 : 1;
+	Error += glm::notEqualMask(A, B, glm::vec<4, int, Q>(1)) == (2 | 8) ? 0 : 1;
+	Error += glm::equalMask(A, B, glm::vec<4, int, Q>(1, 2, 0, 0)) == (1 | 2 | 4) ? 0 : 1;
+
+	// Only notEqual is true with NaN, the epsilon comparisons are both false
+	vec4 const NaN(std::numeric_limits<T>::quiet_NaN());
+	Error += glm::lessThanMask(NaN, B) == 0 ? 0 : 1;
+	Error += glm::greaterThanEqualMask(NaN, B) == 0 ? 0 : 1;
+	Error += glm::notEqualMask(NaN, NaN) == 15 ? 0 : 1;
+	Error += glm::equalMask(NaN, B, static_cast<T>(1)) == 0 ? 0 : 1;
+	Error += glm::notEqualMask(NaN, B, static_cast<T>(1)) == 0 ? 0 : 1;
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
@@ -128,6 +167,13 @@ int main()
 	Error += test_notEqual_ulps<float>();
 	Error += test_notEqual_ulps<double>();
 
+	Error += test_mask<float, glm::defaultp>();
+	Error += test_mask<double, glm::defaultp>();
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		Error += test_mask<float, glm::aligned_highp>();
+		Error += test_mask<double, glm::aligned_highp>();
+#	endif
+
 	Error += test_equal<glm::vec1>();
 	Error += test_equal<glm::lowp_vec1>();
 	Error += test_equal<glm::mediump_vec1>();
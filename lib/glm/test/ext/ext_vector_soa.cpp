@@ -0,0 +1,255 @@
+#include <glm/ext/vector_soa.hpp>
+#include <glm/ext/vector_float2.hpp>
+#include <glm/ext/vector_float3.hpp>
+#include <glm/ext/vector_float4.hpp>
+#include <glm/ext/vector_double2.hpp>
+#include <glm/ext/vector_double3.hpp>
+#include <glm/ext/vector_double4.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <glm/common.hpp>
+#include <glm/geometric.hpp>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
+
+// Components in [-5.5, 4.5], never 0
+template<glm::length_t L, typename T, glm::qualifier Q>
+static glm::vec<L, T, Q> sample(glm::length_t i, glm::length_t Seed)
+{
+	glm::vec<L, T, Q> Result;
+	for(glm::length_t c = 0; c < L; ++c)
+		Result[c] = static_cast<T>((i * 7 + c * 3 + Seed * 5) % 11) - static_cast<T>(5.5);
+	return Result;
+}
+
+template<glm::length_t L, typename T, glm::length_t W, glm::qualifier Q>
+static int test_load_store()
+{
+	typedef glm::vec<L, T, Q> vec_t;
+
+	int Error = 0;
+
+	vec_t In[W];
+	for(glm::length_t i = 0; i < W; ++i)
+		In[i] = sample<L, T, Q>(i, 0);
+
+	glm::soa_vec<L, T, W> const v = glm::soa_vec<L, T, W>::load(In);
+	for(glm::length_t i = 0; i < W; ++i)
+	for(glm::length_t c = 0; c < L; ++c)
+		Error += glm::equal(v[c][i], In[i][c], static_cast<T>(0)) ? 0 : 1;
+
+	vec_t Out[W];
+	v.store(Out);
+	for(glm::length_t i = 0; i < W; ++i)
+		Error += glm::all(glm::equal(Out[i], In[i], static_cast<T>(0))) ? 0 : 1;
+
+	T Components[L][W];
+	for(glm::length_t c = 0; c < L; ++c)
+		v[c].store(Components[c]);
+	for(glm::length_t i = 0; i < W; ++i)
+	for(glm::length_t c = 0; c < L; ++c)
+		Error += glm::equal(Components[c][i], In[i][c], static_cast<T>(0)) ? 0 : 1;
+
+	return Error;
+}
+
+template<glm::length_t L, typename T, glm::length_t W>
+static int test_arithmetic(T Epsilon)
+{
+	typedef glm::vec<L, T, glm::defaultp> vec_t;
+	typedef glm::soa_vec<L, T, W> soa_t;
+	typedef glm::soa_scalar<T, W> scalar_t;
+
+	int Error = 0;
+
+	vec_t A[W], B[W];
+	T S[W];
+	for(glm::length_t i = 0; i < W; ++i)
+	{
+		A[i] = sample<L, T, glm::defaultp>(i, 0);
+		B[i] = sample<L, T, glm::defaultp>(i, 1);
+		S[i] = static_cast<T>(i + 1) * static_cast<T>(0.125);
+	}
+
+	soa_t const a = soa_t::load(A);
+	soa_t const b = soa_t::load(B);
+	scalar_t const s = scalar_t::load(S);
+
+	soa_t Results[13];
+	Results[0] = a + b;
+	Results[1] = a - b;
+	Results[2] = a * b;
+	Results[3] = a / b;
+	Results[4] = a * s;
+	Results[5] = -(a / s);
+	Results[6] = glm::min(a, b);
+	Results[7] = glm::max(a, b);
+	Results[8] = glm::clamp(a, scalar_t(static_cast<T>(-1)), scalar_t(static_cast<T>(2)));
+	Results[9] = glm::mix(a, b, s);
+	Results[10] = glm::normalize(a);
+	Results[11] = glm::floor(a * s);
+	Results[12] = glm::fract(a * s);
+
+	soa_t Compound(a);
+	Compound += b;
+	Compound *= s;
+	Compound -= a;
+	Compound /= b;
+
+	scalar_t const Dot = glm::dot(a, b);
+	scalar_t const Length = glm::length(a);
+	scalar_t const Distance = glm::distance(a, b);
+
+	vec_t Out[13][W];
+	for(std::size_t r = 0; r < 13; ++r)
+		Results[r].store(Out[r]);
+	vec_t OutCompound[W];
+	Compound.store(OutCompound);
+
+	for(glm::length_t i = 0; i < W; ++i)
+	{
+		vec_t const x = A[i];
+		vec_t const y = B[i];
+
+		Error += glm::all(glm::equal(Out[0][i], x + y, Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(Out[1][i], x - y, Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(Out[2][i], x * y, Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(Out[3][i], x / y, Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(Out[4][i], x * S[i], Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(Out[5][i], -(x / S[i]), Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(Out[6][i], glm::min(x, y), Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(Out[7][i], glm::max(x, y), Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(Out[8][i], glm::clamp(x, static_cast<T>(-1), static_cast<T>(2)), Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(Out[9][i], glm::mix(x, y, S[i]), Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(Out[10][i], glm::normalize(x), Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(Out[11][i], glm::floor(x * S[i]), Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(Out[12][i], glm::fract(x * S[i]), Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(OutCompound[i], ((x + y) * S[i] - x) / y, Epsilon)) ? 0 : 1;
+
+		Error += glm::equal(Dot[i], glm::dot(x, y), Epsilon) ? 0 : 1;
+		Error += glm::equal(Length[i], glm::length(x), Epsilon) ? 0 : 1;
+		Error += glm::equal(Distance[i], glm::distance(x, y), Epsilon) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<typename T, glm::length_t W>
+static int test_cross(T Epsilon)
+{
+	typedef glm::vec<3, T, glm::defaultp> vec_t;
+	typedef glm::soa_vec<3, T, W> soa_t;
+
+	int Error = 0;
+
+	vec_t A[W], B[W];
+	for(glm::length_t i = 0; i < W; ++i)
+	{
+		A[i] = sample<3, T, glm::defaultp>(i, 2);
+		B[i] = sample<3, T, glm::defaultp>(i, 3);
+	}
+
+	vec_t Out[W];
+	glm::cross(soa_t::load(A), soa_t::load(B)).store(Out);
+
+	for(glm::length_t i = 0; i < W; ++i)
+		Error += glm::all(glm::equal(Out[i], glm::cross(A[i], B[i]), Epsilon)) ? 0 : 1;
+
+	return Error;
+}
+
+template<typename T, glm::length_t W>
+static int test_scalar(T Epsilon)
+{
+	typedef glm::soa_scalar<T, W> scalar_t;
+
+	int Error = 0;
+
+	T X[W], Y[W], Z[W];
+	for(glm::length_t i = 0; i < W; ++i)
+	{
+		X[i] = static_cast<T>(i) - static_cast<T>(2.5);
+		Y[i] = static_cast<T>(i) * static_cast<T>(0.5) + static_cast<T>(1);
+		Z[i] = i % 2 ? X[i] : Y[i];
+	}
+
+	scalar_t const x = scalar_t::load(X);
+	scalar_t const y = scalar_t::load(Y);
+	scalar_t const z = scalar_t::load(Z);
+
+	scalar_t const Abs = glm::abs(x);
+	scalar_t const Sqrt = glm::sqrt(y);
+	scalar_t const InvSqrt = glm::inversesqrt(y);
+	scalar_t const Fma = glm::fma(x, y, scalar_t(static_cast<T>(3)));
+	scalar_t const Ops = (static_cast<T>(2) - x) * static_cast<T>(3) + y / static_cast<T>(4) - static_cast<T>(1) / y;
+	scalar_t const Floor = glm::floor(x);
+	scalar_t const Fract = glm::fract(x);
+	scalar_t const Mod = glm::mod(x, y);
+	scalar_t const Step = glm::step(y - static_cast<T>(3), x);
+	int const LessThan = glm::lessThanMask(x, z);
+	int const LessThanEqual = glm::lessThanEqualMask(x, z);
+	int const GreaterThan = glm::greaterThanMask(x, z);
+	int const GreaterThanEqual = glm::greaterThanEqualMask(x, z);
+
+	for(glm::length_t i = 0; i < W; ++i)
+	{
+		Error += glm::equal(Abs[i], glm::abs(X[i]), Epsilon) ? 0 : 1;
+		Error += glm::equal(Sqrt[i], glm::sqrt(Y[i]), Epsilon) ? 0 : 1;
+		Error += glm::equal(InvSqrt[i], glm::inversesqrt(Y[i]), Epsilon) ? 0 : 1;
+		Error += glm::equal(Fma[i], X[i] * Y[i] + static_cast<T>(3), Epsilon) ? 0 : 1;
+		Error += glm::equal(Ops[i], (static_cast<T>(2) - X[i]) * static_cast<T>(3) + Y[i] / static_cast<T>(4) - static_cast<T>(1) / Y[i], Epsilon) ? 0 : 1;
+		Error += Floor[i] == glm::floor(X[i]) ? 0 : 1;
+		Error += Fract[i] == glm::fract(X[i]) ? 0 : 1;
+		Error += Mod[i] == glm::mod(X[i], Y[i]) ? 0 : 1;
+		Error += Step[i] == glm::step(Y[i] - static_cast<T>(3), X[i]) ? 0 : 1;
+		Error += ((LessThan >> i) & 1) == (X[i] < Z[i] ? 1 : 0) ? 0 : 1;
+		Error += ((LessThanEqual >> i) & 1) == (X[i] <= Z[i] ? 1 : 0) ? 0 : 1;
+		Error += ((GreaterThan >> i) & 1) == (X[i] > Z[i] ? 1 : 0) ? 0 : 1;
+		Error += ((GreaterThanEqual >> i) & 1) == (X[i] >= Z[i] ? 1 : 0) ? 0 : 1;
+	}
+	Error += (LessThan >> W) == 0 && (GreaterThanEqual >> W) == 0 ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_load_store<2, float, 4, glm::defaultp>();
+	Error += test_load_store<2, float, 8, glm::defaultp>();
+	Error += test_load_store<2, double, 4, glm::defaultp>();
+	Error += test_load_store<3, float, 4, glm::defaultp>();
+	Error += test_load_store<3, float, 8, glm::defaultp>();
+	Error += test_load_store<4, float, 4, glm::defaultp>();
+	Error += test_load_store<4, float, 8, glm::defaultp>();
+	Error += test_load_store<3, double, 4, glm::defaultp>();
+	Error += test_load_store<4, double, 4, glm::defaultp>();
+	Error += test_load_store<3, float, 2, glm::defaultp>();
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		Error += test_load_store<3, float, 4, glm::aligned_highp>();
+		Error += test_load_store<3, double, 4, glm::aligned_highp>();
+#	endif
+
+	Error += test_scalar<float, 4>(0.0001f);
+	Error += test_scalar<float, 8>(0.0001f);
+	Error += test_scalar<double, 4>(0.0000001);
+	Error += test_scalar<float, 3>(0.0001f);
+
+	Error += test_arithmetic<2, float, 4>(0.0001f);
+	Error += test_arithmetic<2, float, 8>(0.0001f);
+	Error += test_arithmetic<3, float, 4>(0.0001f);
+	Error += test_arithmetic<3, float, 8>(0.0001f);
+	Error += test_arithmetic<4, float, 4>(0.0001f);
+	Error += test_arithmetic<4, float, 8>(0.0001f);
+	Error += test_arithmetic<3, double, 4>(0.0000001);
+	Error += test_arithmetic<4, double, 4>(0.0000001);
+	Error += test_arithmetic<3, float, 2>(0.0001f);
+
+	Error += test_cross<float, 4>(0.0001f);
+	Error += test_cross<float, 8>(0.0001f);
+	Error += test_cross<double, 4>(0.0000001);
+
+	return Error;
+}
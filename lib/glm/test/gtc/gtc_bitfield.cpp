@@ -895,6 +895,53 @@ namespace bitfieldInterleave5
 
 }//namespace bitfieldInterleave5
 
+namespace bitfieldInterleaveArray
+{
+	// 8 and 4 coordinates at a time, then the remainder one at a time
+	static int test(std::size_t Count)
+	{
+		int Error = 0;
+
+		std::vector<glm::u16vec2> Coords2(Count);
+		std::vector<glm::u16vec3> Coords3(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::uint32 const Hash = static_cast<glm::uint32>(i) * 2654435761u;
+			Coords2[i] = glm::u16vec2(Hash & 0xFFFF, Hash >> 16);
+			Coords3[i] = glm::u16vec3(Hash & 0xFFFF, Hash >> 16, static_cast<glm::uint16>(i));
+		}
+
+		std::vector<glm::uint32> Codes2(Count);
+		glm::bitfieldInterleave(&Coords2[0], &Codes2[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += Codes2[i] == glm::bitfieldInterleave(Coords2[i]) ? 0 : 1;
+
+		std::vector<glm::u16vec2> Result2(Count);
+		glm::bitfieldDeinterleave(&Codes2[0], &Result2[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += Result2[i] == Coords2[i] ? 0 : 1;
+
+		std::vector<glm::uint64> Codes3(Count);
+		glm::bitfieldInterleave(&Coords3[0], &Codes3[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += Codes3[i] == glm::bitfieldInterleave(Coords3[i]) ? 0 : 1;
+
+		return Error;
+	}
+
+	static int test()
+	{
+		int Error = 0;
+
+		Error += test(1);
+		Error += test(7);
+		Error += test(37);
+		Error += test(4096);
+
+		return Error;
+	}
+}//namespace bitfieldInterleaveArray
+
 static int test_bitfieldRotateRight()
 {
 	glm::ivec4 const A = glm::bitfieldRotateRight(glm::ivec4(2), 1);
@@ -923,6 +970,7 @@ int main()
 	Error += ::bitfieldInterleave3::test();
 	Error += ::bitfieldInterleave4::test();
 	Error += ::bitfieldInterleave::test();
+	Error += ::bitfieldInterleaveArray::test();
 
 	Error += test_bitfieldRotateRight();
 	Error += test_bitfieldRotateLeft();
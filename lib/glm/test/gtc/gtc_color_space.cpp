@@ -1,6 +1,10 @@
 #include <glm/gtc/color_space.hpp>
 #include <glm/gtc/epsilon.hpp>
 #include <glm/gtc/constants.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <cmath>
+#include <vector>
 
 namespace srgb
 {
@@ -67,12 +71,104 @@ namespace srgb_lowp
 	}
 }//namespace srgb_lowp
 
+namespace srgb_array
+{
+	static double encode(double c)
+	{
+		c = glm::clamp(c, 0.0, 1.0);
+		return c < 0.0031308 ? c * 12.92 : std::pow(c, 1.0 / 2.4) * 1.055 - 0.055;
+	}
+
+	static double decode(double c)
+	{
+		c = glm::clamp(c, 0.0, 1.0);
+		return c <= 0.04045 ? c / 12.92 : std::pow((c + 0.055) / 1.055, 2.4);
+	}
+
+	// Counts that are not multiples of 4 use both the SIMD loop and the remaining pixels path
+	static int test_float(std::size_t Count)
+	{
+		int Error = 0;
+
+		std::vector<glm::vec4> In(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			float const x = static_cast<float>(i) / static_cast<float>(Count);
+			In[i] = glm::vec4(x, x * x, 1.2f - x * 1.4f, x * 0.5f);
+		}
+
+		std::vector<glm::vec4> SRGB(Count);
+		glm::convertLinearToSRGB(&In[0], &SRGB[0], Count);
+		std::vector<glm::vec4> Linear(Count);
+		glm::convertSRGBToLinear(&In[0], &Linear[0], Count);
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			for(glm::length_t c = 0; c < 3; ++c)
+			{
+				Error += std::abs(SRGB[i][c] - encode(In[i][c])) < 2.5e-7 ? 0 : 1;
+				Error += std::abs(Linear[i][c] - decode(In[i][c])) <= decode(In[i][c]) * 1e-6 ? 0 : 1;
+			}
+			Error += glm::equal(SRGB[i].w, In[i].w, 0.0f) ? 0 : 1;
+			Error += glm::equal(Linear[i].w, In[i].w, 0.0f) ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	static int test_uint8()
+	{
+		int Error = 0;
+
+		// Every 8 bit value through the lookup table, then back to 8 bit
+		std::vector<glm::u8vec4> Codes(256);
+		for(std::size_t i = 0; i < Codes.size(); ++i)
+			Codes[i] = glm::u8vec4(static_cast<glm::uint8>(i), static_cast<glm::uint8>(255 - i), static_cast<glm::uint8>(i * 7), static_cast<glm::uint8>(i));
+
+		std::vector<glm::vec4> Linear(Codes.size());
+		glm::convertSRGBToLinear(&Codes[0], &Linear[0], Codes.size());
+		for(std::size_t i = 0; i < Codes.size(); ++i)
+		{
+			for(glm::length_t c = 0; c < 3; ++c)
+				Error += glm::equal(Linear[i][c], static_cast<float>(decode(Codes[i][c] / 255.0)), 0.0f) ? 0 : 1;
+			Error += glm::equal(Linear[i].w, static_cast<float>(i) / 255.0f, 1e-7f) ? 0 : 1;
+		}
+
+		std::vector<glm::u8vec4> RoundTrip(Codes.size());
+		glm::convertLinearToSRGB(&Linear[0], &RoundTrip[0], Linear.size());
+		for(std::size_t i = 0; i < Codes.size(); ++i)
+			Error += glm::all(glm::equal(RoundTrip[i], Codes[i])) ? 0 : 1;
+
+		// Out of range colors are clamped
+		glm::vec4 const Outside[] = {glm::vec4(-1.0f, 2.0f, 0.5f, 1.5f), glm::vec4(0.001f, 1.0f, 0.0f, -0.5f), glm::vec4(0.2f), glm::vec4(0.7f), glm::vec4(0.0f)};
+		glm::u8vec4 Clamped[5];
+		glm::convertLinearToSRGB(Outside, Clamped, 5);
+		Error += glm::all(glm::equal(Clamped[0], glm::u8vec4(0, 255, 188, 255))) ? 0 : 1;
+		Error += glm::all(glm::equal(Clamped[1], glm::u8vec4(3, 255, 0, 0))) ? 0 : 1;
+		Error += glm::all(glm::equal(Clamped[4], glm::u8vec4(0))) ? 0 : 1;
+
+		return Error;
+	}
+
+	int test()
+	{
+		int Error = 0;
+
+		Error += test_float(1);
+		Error += test_float(1027);
+		Error += test_uint8();
+
+		return Error;
+	}
+}//namespace srgb_array
+
 int main()
 {
 	int Error(0);
 
 	Error += srgb::test();
 	Error += srgb_lowp::test();
+	Error += srgb_array::test();
 
 	return Error;
 }
@@ -1,5 +1,11 @@
 #include <glm/gtc/matrix_inverse.hpp>
 #include <glm/gtc/epsilon.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/matrix_access.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
 
 int test_affine()
 {
@@ -41,11 +47,62 @@ int test_affine()
 	return Error;
 }
 
+template<typename mat4Type, typename mat3Type>
+static int test_affine_transform()
+{
+	int Error = 0;
+
+	glm::mat4 const Transform = glm::scale(glm::rotate(glm::translate(glm::mat4(1.0f), glm::vec3(1.0f, -2.0f, 3.0f)), 0.7f, glm::normalize(glm::vec3(1.0f, 2.0f, 3.0f))), glm::vec3(0.5f, 2.0f, 4.0f));
+
+	mat4Type const M(Transform);
+	mat4Type const A = glm::affineInverse(M);
+	mat4Type const I = glm::inverse(M);
+	Error += glm::all(glm::equal(glm::mat4(A), glm::mat4(I), 0.0001f)) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::mat4(A * M), glm::mat4(1.0f), 0.0001f)) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::row(glm::mat4(A), 3), glm::vec4(0.0f, 0.0f, 0.0f, 1.0f))) ? 0 : 1;
+
+	return Error;
+}
+
+template<typename mat4Type, typename mat3Type>
+static int test_inverse_transpose()
+{
+	int Error = 0;
+
+	glm::mat4 const Transform = glm::scale(glm::rotate(glm::translate(glm::mat4(1.0f), glm::vec3(1.0f, -2.0f, 3.0f)), 0.7f, glm::normalize(glm::vec3(1.0f, 2.0f, 3.0f))), glm::vec3(0.5f, 2.0f, 4.0f));
+
+	{
+		mat4Type const M(Transform);
+		mat4Type const I = glm::inverseTranspose(M);
+		Error += glm::all(glm::equal(glm::mat4(I), glm::transpose(glm::inverse(Transform)), 0.0001f)) ? 0 : 1;
+	}
+
+	{
+		mat3Type const M(Transform);
+		mat3Type const I = glm::inverseTranspose(M);
+		Error += glm::all(glm::equal(glm::mat3(I), glm::transpose(glm::inverse(glm::mat3(Transform))), 0.0001f)) ? 0 : 1;
+	}
+
+	{
+		mat3Type const N = glm::normalMatrix(mat4Type(Transform));
+		Error += glm::all(glm::equal(glm::mat3(N), glm::inverseTranspose(glm::mat3(Transform)), 0.0001f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
 
 	Error += test_affine();
+	Error += test_affine_transform<glm::mat4, glm::mat3>();
+	Error += test_inverse_transpose<glm::mat4, glm::mat3>();
+	Error += test_inverse_transpose<glm::dmat4, glm::dmat3>();
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		Error += test_affine_transform<glm::aligned_mat4, glm::aligned_mat3>();
+		Error += test_inverse_transpose<glm::aligned_mat4, glm::aligned_mat3>();
+#	endif
 
 	return Error;
 }
@@ -2,6 +2,7 @@
 #include <glm/gtc/noise.hpp>
 #include <glm/gtc/type_precision.hpp>
 #include <glm/gtx/raw_data.hpp>
+#include <vector>
 
 static int test_simplex_float()
 {
@@ -69,6 +70,94 @@ static int test_perlin_pedioric_double()
 	return Error;
 }
 
+template<glm::length_t L, typename T>
+static std::vector<glm::vec<L, T, glm::defaultp> > noise_points(std::size_t Count)
+{
+	std::vector<glm::vec<L, T, glm::defaultp> > Points(Count, glm::vec<L, T, glm::defaultp>(static_cast<T>(0)));
+	for(std::size_t i = 0; i < Count; ++i)
+	for(glm::length_t c = 0; c < L; ++c)
+		Points[i][c] = static_cast<T>(static_cast<double>((i * (c + 7) * 2654435761u) % 20011) / 137.0 - 73.0);
+	return Points;
+}
+
+// GCC contracts the multiply-adds of the scalar noise when FMA is available,
+// it then rounds differently and a few points pick another gradient
+#if (GLM_ARCH & GLM_ARCH_AVX2_BIT) && (GLM_COMPILER & GLM_COMPILER_GCC)
+	static std::size_t max_mismatch(std::size_t Count)
+	{
+		return Count / 16;
+	}
+
+	template<typename T>
+	static bool same_noise(T Batched, T Scalar)
+	{
+		return glm::abs(Batched - Scalar) <= static_cast<T>(1e-4);
+	}
+#else
+	static std::size_t max_mismatch(std::size_t)
+	{
+		return 0;
+	}
+
+	template<typename T>
+	static bool same_noise(T Batched, T Scalar)
+	{
+		return Batched == Scalar;
+	}
+#endif
+
+template<glm::length_t L, typename T>
+static int test_batched()
+{
+	int Error = 0;
+
+	std::size_t const Count = 1003;
+	std::vector<glm::vec<L, T, glm::defaultp> > const Points = noise_points<L, T>(Count);
+	std::vector<T> Perlin(Count), Simplex(Count), Fbm(Count);
+
+	glm::perlin(&Points[0], &Perlin[0], Count);
+	glm::simplex(&Points[0], &Simplex[0], Count);
+	glm::simplexFbm(&Points[0], &Fbm[0], Count, 4);
+
+	std::size_t Mismatch = 0;
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Mismatch += same_noise(Perlin[i], glm::perlin(Points[i])) ? 0 : 1;
+		Mismatch += same_noise(Simplex[i], glm::simplex(Points[i])) ? 0 : 1;
+		Mismatch += same_noise(Fbm[i], glm::simplexFbm(Points[i], 4)) ? 0 : 1;
+	}
+	Error += Mismatch <= max_mismatch(Count) ? 0 : 1;
+
+	glm::soa_vec<L, T, 4> const Lanes = glm::soa_vec<L, T, 4>::load(&Points[0]);
+	glm::soa_scalar<T, 4> const PerlinLanes = glm::perlin(Lanes);
+	glm::soa_scalar<T, 4> const SimplexLanes = glm::simplex(Lanes);
+	for(glm::length_t i = 0; i < 4; ++i)
+	{
+		Error += PerlinLanes[i] == Perlin[i] ? 0 : 1;
+		Error += SimplexLanes[i] == Simplex[i] ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int test_fbm()
+{
+	int Error = 0;
+
+	glm::vec3 const Position(1.3f, -7.2f, 0.45f);
+
+	// A single octave is the noise itself
+	Error += glm::simplexFbm(Position, 1) == glm::simplex(Position) ? 0 : 1;
+
+	for(int Octaves = 1; Octaves <= 8; ++Octaves)
+	{
+		float const Value = glm::simplexFbm(Position, Octaves, 2.0f, 0.5f);
+		Error += Value >= -1.0f && Value <= 1.0f ? 0 : 1;
+	}
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
@@ -82,5 +171,11 @@ int main()
 	Error += test_perlin_pedioric_float();
 	Error += test_perlin_pedioric_double();
 
+	Error += test_batched<2, float>();
+	Error += test_batched<3, float>();
+	Error += test_batched<2, double>();
+	Error += test_batched<3, double>();
+	Error += test_fbm();
+
 	return Error;
 }
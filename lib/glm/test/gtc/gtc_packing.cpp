@@ -4,6 +4,7 @@
 #include <glm/ext/vector_relational.hpp>
 #include <cstdio>
 #include <vector>
+#include <limits>
 
 void print_bits(float const& s)
 {
@@ -109,6 +110,209 @@ int test_Half4x16()
 	return Error;
 }
 
+int test_HalfArray()
+{
+	int Error = 0;
+
+	// Every half value, including denormals and infinities, survives a bulk round trip
+	std::vector<glm::uint16> Halfs(65536);
+	for(std::size_t i = 0; i < Halfs.size(); ++i)
+		Halfs[i] = static_cast<glm::uint16>(i);
+
+	std::vector<float> Floats(Halfs.size());
+	glm::unpackHalf(&Halfs[0], &Floats[0], Halfs.size());
+
+	std::vector<glm::uint16> Packed(Halfs.size());
+	glm::packHalf(&Floats[0], &Packed[0], Floats.size());
+
+	for(std::size_t i = 0; i < Halfs.size(); ++i)
+	{
+		bool const IsNaN = (Halfs[i] & 0x7c00) == 0x7c00 && (Halfs[i] & 0x03ff) != 0;
+		if(IsNaN)
+			Error += (Packed[i] & 0x7c00) == 0x7c00 && (Packed[i] & 0x03ff) != 0 && Floats[i] != Floats[i] ? 0 : 1;
+		else
+			Error += Packed[i] == Halfs[i] ? 0 : 1;
+	}
+
+	float const Values[] = {1.0f, -2.0f, 0.5f, 65504.0f, 1e6f, -1e6f, 5.9604645e-8f, -1e-10f, 0.0f, -0.0f, 0.1f, 3.14159f, 1e-5f};
+	glm::uint16 const Expected[] = {0x3c00, 0xc000, 0x3800, 0x7bff, 0x7c00, 0xfc00, 0x0001, 0x8000, 0x0000, 0x8000, 0x2e66, 0x4248, 0x00a8};
+	std::size_t const Count = sizeof(Values) / sizeof(Values[0]);
+
+	// Odd counts exercise the wide loops and the tail
+	for(std::size_t n = 1; n <= Count; ++n)
+	{
+		glm::uint16 Out[Count];
+		glm::packHalf(Values, Out, n);
+		for(std::size_t i = 0; i < n; ++i)
+		{
+			Error += Out[i] == Expected[i] ? 0 : 1;
+			Error += Out[i] == glm::packHalf1x16(Values[i]) ? 0 : 1;
+		}
+
+		float Back[Count];
+		glm::unpackHalf(Expected, Back, n);
+		for(std::size_t i = 0; i < n; ++i)
+			Error += Back[i] == glm::unpackHalf1x16(Expected[i]) ? 0 : 1;
+	}
+
+	glm::vec2 const A(0.25f, -3.0f);
+	Error += glm::packHalf2x16(A) == 0xc2003400 ? 0 : 1;
+	Error += glm::all(glm::equal(glm::unpackHalf2x16(0xc2003400), A, 0.0f)) ? 0 : 1;
+
+	glm::vec3 const B(1.0f, 2.0f, -0.5f);
+	Error += glm::all(glm::equal(glm::packHalf(B), glm::u16vec3(0x3c00, 0x4000, 0xb800))) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::unpackHalf(glm::packHalf(B)), B, 0.0f)) ? 0 : 1;
+
+	return Error;
+}
+
+static float packing_sample(std::size_t i)
+{
+	// Covers out of range values, exact halfway cases of the 8 and 10 bit scales and arbitrary fractions
+	switch(i % 6)
+	{
+	default:
+	case 0: return static_cast<float>(i % 301) / 150.0f - 1.0f;
+	case 1: return (static_cast<float>(i % 255) + 0.5f) / 255.0f;
+	case 2: return -(static_cast<float>(i % 511) + 0.5f) / 511.0f;
+	case 3: return static_cast<float>(i % 17) * 0.37f - 3.0f;
+	case 4: return static_cast<float>(i % 1023) / 1023.0f;
+	case 5: return -static_cast<float>(i % 127) / 127.0f;
+	}
+}
+
+int test_PackingArray()
+{
+	int Error = 0;
+
+	std::size_t const Counts[] = {1, 3, 4, 15, 16, 17, 37, 1000};
+
+	for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+	{
+		std::size_t const Count = Counts[c];
+
+		std::vector<float> Floats(Count);
+		std::vector<glm::vec3> Vec3s(Count, glm::vec3(0.0f));
+		std::vector<glm::vec4> Vec4s(Count, glm::vec4(0.0f));
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Floats[i] = packing_sample(i);
+			Vec3s[i] = glm::vec3(packing_sample(i + 1), packing_sample(i + 2) + 2.0f, static_cast<float>(i) * 0.25f + 0.125f);
+			Vec4s[i] = glm::vec4(packing_sample(i), packing_sample(i + 1), packing_sample(i + 2), packing_sample(i + 3));
+		}
+
+		std::vector<glm::uint8> Unorm8(Count);
+		std::vector<glm::uint16> Unorm16(Count);
+		std::vector<glm::int8> Snorm8(Count);
+		std::vector<glm::int16> Snorm16(Count);
+		glm::packUnorm(&Floats[0], &Unorm8[0], Count);
+		glm::packUnorm(&Floats[0], &Unorm16[0], Count);
+		glm::packSnorm(&Floats[0], &Snorm8[0], Count);
+		glm::packSnorm(&Floats[0], &Snorm16[0], Count);
+
+		std::vector<float> FromUnorm8(Count), FromUnorm16(Count), FromSnorm8(Count), FromSnorm16(Count);
+		glm::unpackUnorm(&Unorm8[0], &FromUnorm8[0], Count);
+		glm::unpackUnorm(&Unorm16[0], &FromUnorm16[0], Count);
+		glm::unpackSnorm(&Snorm8[0], &FromSnorm8[0], Count);
+		glm::unpackSnorm(&Snorm16[0], &FromSnorm16[0], Count);
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += Unorm8[i] == glm::packUnorm1x8(Floats[i]) ? 0 : 1;
+			Error += Unorm16[i] == glm::packUnorm1x16(Floats[i]) ? 0 : 1;
+			Error += static_cast<glm::uint8>(Snorm8[i]) == glm::packSnorm1x8(Floats[i]) ? 0 : 1;
+			Error += static_cast<glm::uint16>(Snorm16[i]) == glm::packSnorm1x16(Floats[i]) ? 0 : 1;
+
+			Error += FromUnorm8[i] == glm::unpackUnorm1x8(Unorm8[i]) ? 0 : 1;
+			Error += FromUnorm16[i] == glm::unpackUnorm1x16(Unorm16[i]) ? 0 : 1;
+			Error += FromSnorm8[i] == glm::unpackSnorm1x8(static_cast<glm::uint8>(Snorm8[i])) ? 0 : 1;
+			Error += FromSnorm16[i] == glm::unpackSnorm1x16(static_cast<glm::uint16>(Snorm16[i])) ? 0 : 1;
+		}
+
+		std::vector<glm::uint32> Unorm3x10(Count), Snorm3x10(Count), F2x11(Count);
+		glm::packUnorm3x10_1x2(&Vec4s[0], &Unorm3x10[0], Count);
+		glm::packSnorm3x10_1x2(&Vec4s[0], &Snorm3x10[0], Count);
+		glm::packF2x11_1x10(&Vec3s[0], &F2x11[0], Count);
+
+		std::vector<glm::vec4> FromUnorm3x10(Count, glm::vec4(0.0f)), FromSnorm3x10(Count, glm::vec4(0.0f));
+		std::vector<glm::vec3> FromF2x11(Count, glm::vec3(0.0f));
+		glm::unpackUnorm3x10_1x2(&Unorm3x10[0], &FromUnorm3x10[0], Count);
+		glm::unpackSnorm3x10_1x2(&Snorm3x10[0], &FromSnorm3x10[0], Count);
+		glm::unpackF2x11_1x10(&F2x11[0], &FromF2x11[0], Count);
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			// The aligned vec4 round used by the per-element functions sends halfway cases to even
+			if(!glm::detail::is_aligned<glm::defaultp>::value)
+			{
+				Error += Unorm3x10[i] == glm::packUnorm3x10_1x2(Vec4s[i]) ? 0 : 1;
+				Error += Snorm3x10[i] == glm::packSnorm3x10_1x2(Vec4s[i]) ? 0 : 1;
+			}
+			Error += glm::all(glm::equal(FromUnorm3x10[i], glm::clamp(Vec4s[i], 0.0f, 1.0f), glm::vec4(0.0006f, 0.0006f, 0.0006f, 0.17f))) ? 0 : 1;
+			Error += glm::all(glm::equal(FromSnorm3x10[i], glm::clamp(Vec4s[i], -1.0f, 1.0f), glm::vec4(0.0011f, 0.0011f, 0.0011f, 0.51f))) ? 0 : 1;
+			Error += F2x11[i] == glm::packF2x11_1x10(Vec3s[i]) ? 0 : 1;
+
+			Error += glm::all(glm::equal(FromUnorm3x10[i], glm::unpackUnorm3x10_1x2(Unorm3x10[i]))) ? 0 : 1;
+			Error += glm::all(glm::equal(FromSnorm3x10[i], glm::unpackSnorm3x10_1x2(Snorm3x10[i]))) ? 0 : 1;
+			Error += glm::all(glm::equal(FromF2x11[i], glm::unpackF2x11_1x10(F2x11[i]))) ? 0 : 1;
+			Error += glm::all(glm::equal(FromF2x11[i], glm::abs(Vec3s[i]), glm::abs(Vec3s[i]) * 0.04f)) ? 0 : 1;
+		}
+	}
+
+	// Zero, infinity and NaN components
+	glm::vec3 const Specials[] = {
+		glm::vec3(0.0f, 1.0f, 0.0f),
+		glm::vec3(std::numeric_limits<float>::infinity(), 0.0f, 2.0f),
+		glm::vec3(1.0f, std::numeric_limits<float>::quiet_NaN(), 0.0f),
+		glm::vec3(0.5f, 0.25f, -std::numeric_limits<float>::infinity())};
+	glm::uint32 PackedSpecials[4];
+	glm::vec3 UnpackedSpecials[4];
+	glm::packF2x11_1x10(Specials, PackedSpecials, 4);
+	glm::unpackF2x11_1x10(PackedSpecials, UnpackedSpecials, 4);
+	for(std::size_t i = 0; i < 4; ++i)
+	{
+		Error += PackedSpecials[i] == glm::packF2x11_1x10(Specials[i]) ? 0 : 1;
+		for(glm::length_t j = 0; j < 3; ++j)
+		{
+			float const Expected = glm::isinf(Specials[i][j]) ? std::numeric_limits<float>::infinity() : Specials[i][j];
+			Error += glm::isnan(Expected) ? (glm::isnan(UnpackedSpecials[i][j]) ? 0 : 1) : (UnpackedSpecials[i][j] == Expected ? 0 : 1);
+			Error += glm::isnan(Expected) == glm::isnan(glm::unpackF2x11_1x10(PackedSpecials[i])[j]) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+int test_HalfTies()
+{
+	int Error = 0;
+
+	// Halfway values round to even in the scalar and SIMD paths, 65520 is halfway between 65504 and infinity
+	float const Values[] = {1.00048828125f, 1.00146484375f, -1.00048828125f, 1.0005f, 2.98023224e-8f, 8.94069672e-8f, 1.49011612e-7f, 65520.0f};
+	glm::uint16 const Expected[] = {0x3c00, 0x3c02, 0xbc00, 0x3c01, 0x0000, 0x0002, 0x0002, 0x7c00};
+	std::size_t const Count = sizeof(Values) / sizeof(Values[0]);
+
+	glm::uint16 Out[Count];
+	glm::packHalf(Values, Out, Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Error += Out[i] == Expected[i] ? 0 : 1;
+		Error += glm::packHalf1x16(Values[i]) == Expected[i] ? 0 : 1;
+	}
+
+	for(std::size_t i = 0; i < Count; i += 4)
+	{
+		glm::vec4 const v(Values[i], Values[i + 1], Values[i + 2], Values[i + 3]);
+		glm::u16vec4 const e(Expected[i], Expected[i + 1], Expected[i + 2], Expected[i + 3]);
+		glm::uint64 const p = glm::packHalf4x16(v);
+		Error += glm::all(glm::equal(glm::packHalf(v), e)) ? 0 : 1;
+		Error += p == (glm::uint64(e.x) | (glm::uint64(e.y) << 16) | (glm::uint64(e.z) << 32) | (glm::uint64(e.w) << 48)) ? 0 : 1;
+		Error += glm::packHalf2x16(glm::vec2(v.x, v.y)) == (glm::uint(e.x) | (glm::uint(e.y) << 16)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
 int test_I3x10_1x2()
 {
 	int Error = 0;
@@ -873,6 +1077,9 @@ int main()
 	Error += test_U3x10_1x2();
 	Error += test_Half1x16();
 	Error += test_Half4x16();
+	Error += test_HalfArray();
+	Error += test_HalfTies();
+	Error += test_PackingArray();
 
 	return Error;
 }
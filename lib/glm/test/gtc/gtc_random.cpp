@@ -2,8 +2,10 @@
 #include <glm/gtc/random.hpp>
 #include <glm/gtc/epsilon.hpp>
 #include <glm/gtc/type_precision.hpp>
+#include <vector>
 #if GLM_LANG & GLM_LANG_CXX0X_FLAG
 #	include <array>
+#	include <random>
 #endif
 
 std::size_t const TestSamples = 10000;
@@ -217,6 +219,41 @@ int test_linearRand()
 		assert(!Error);
 	}
 
+	// Ranges covering the whole type reach both bounds
+	{
+		glm::xoshiro128 Engine(42);
+
+		glm::u8vec4 UMin(std::numeric_limits<glm::u8>::max());
+		glm::u8vec4 UMax(std::numeric_limits<glm::u8>::min());
+		glm::i8vec4 IMin(std::numeric_limits<glm::i8>::max());
+		glm::i8vec4 IMax(std::numeric_limits<glm::i8>::min());
+		glm::bvec4 I32Low(false);
+		glm::bvec4 I32High(false);
+		for(std::size_t i = 0; i < TestSamples; ++i)
+		{
+			glm::u8vec4 const A = glm::linearRand(glm::u8vec4(0), glm::u8vec4(255), Engine);
+			UMin = glm::min(UMin, A);
+			UMax = glm::max(UMax, A);
+
+			glm::i8vec4 const B = glm::linearRand(glm::i8vec4(-128), glm::i8vec4(127), Engine);
+			IMin = glm::min(IMin, B);
+			IMax = glm::max(IMax, B);
+
+			glm::i32vec4 const C = glm::linearRand(glm::i32vec4(std::numeric_limits<glm::i32>::min()), glm::i32vec4(std::numeric_limits<glm::i32>::max()), Engine);
+			I32Low = glm::bvec4(I32Low.x || C.x < -(1 << 30), I32Low.y || C.y < -(1 << 30), I32Low.z || C.z < -(1 << 30), I32Low.w || C.w < -(1 << 30));
+			I32High = glm::bvec4(I32High.x || C.x > (1 << 30), I32High.y || C.y > (1 << 30), I32High.z || C.z > (1 << 30), I32High.w || C.w > (1 << 30));
+		}
+
+		Error += glm::all(glm::equal(UMin, glm::u8vec4(0))) ? 0 : 1;
+		Error += glm::all(glm::equal(UMax, glm::u8vec4(255))) ? 0 : 1;
+		Error += glm::all(glm::equal(IMin, glm::i8vec4(-128))) ? 0 : 1;
+		Error += glm::all(glm::equal(IMax, glm::i8vec4(127))) ? 0 : 1;
+		Error += glm::all(I32Low) && glm::all(I32High) ? 0 : 1;
+
+		Error += glm::linearRand(glm::uint64(0), std::numeric_limits<glm::uint64>::max(), Engine) != glm::linearRand(glm::uint64(0), std::numeric_limits<glm::uint64>::max(), Engine) ? 0 : 1;
+		assert(!Error);
+	}
+
 	return Error;
 }
 
@@ -322,6 +359,144 @@ int test_ballRand()
 
 	return Error;
 }
+
+int test_engine()
+{
+	int Error = 0;
+
+	// Reference values of xoshiro128++ from the state {1, 2, 3, 4}
+	{
+		glm::xoshiro128 Engine;
+		Engine.state[0] = 1;
+		Engine.state[1] = 2;
+		Engine.state[2] = 3;
+		Engine.state[3] = 4;
+
+		Error += Engine() == 641u ? 0 : 1;
+		Error += Engine() == 1573767u ? 0 : 1;
+		Error += Engine() == 3222811527u ? 0 : 1;
+		Error += Engine() == 3517856514u ? 0 : 1;
+	}
+
+	{
+		glm::xoshiro128 A(42);
+		glm::xoshiro128 B(42);
+		glm::xoshiro128 C(43);
+
+		for(std::size_t i = 0; i < 16; ++i)
+			Error += glm::linearRand(glm::vec3(-1.0f), glm::vec3(1.0f), A) == glm::linearRand(glm::vec3(-1.0f), glm::vec3(1.0f), B) ? 0 : 1;
+
+		Error += A() != C() ? 0 : 1;
+
+		B.jump();
+		Error += A() != B() ? 0 : 1;
+	}
+
+	{
+		glm::thread_random_engine().seed(7);
+		float const A = glm::gaussRand(0.0f, 1.0f);
+		glm::ivec4 const B = glm::linearRand(glm::ivec4(-100), glm::ivec4(100));
+
+		glm::thread_random_engine().seed(7);
+		Error += glm::gaussRand(0.0f, 1.0f) == A ? 0 : 1;
+		Error += glm::all(glm::equal(glm::linearRand(glm::ivec4(-100), glm::ivec4(100)), B)) ? 0 : 1;
+	}
+
+#	if GLM_LANG & GLM_LANG_CXX0X_FLAG
+	{
+		std::mt19937 Engine(42);
+		for(std::size_t i = 0; i < TestSamples; ++i)
+			Error += glm::length(glm::ballRand(2.0f, Engine)) <= 2.0f ? 0 : 1;
+
+		std::uniform_int_distribution<int> Distribution(0, 9);
+		glm::xoshiro128 Xoshiro;
+		Error += Distribution(Xoshiro) <= 9 ? 0 : 1;
+	}
+#	endif
+
+	return Error;
+}
+
+template<typename T>
+int test_batch()
+{
+	int Error = 0;
+
+	// Odd count to cover the scalar tail of the SIMD loops
+	std::size_t const Count = TestSamples + 3;
+	glm::xoshiro128 Engine(1);
+
+	{
+		std::vector<T> Out(Count);
+		glm::linearRand(static_cast<T>(-2), static_cast<T>(6), &Out[0], Count, Engine);
+
+		T Sum(0);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += Out[i] >= static_cast<T>(-2) && Out[i] <= static_cast<T>(6) ? 0 : 1;
+			Sum += Out[i];
+		}
+		Error += glm::abs(Sum / static_cast<T>(Count) - static_cast<T>(2)) < static_cast<T>(0.1) ? 0 : 1;
+	}
+
+	{
+		std::vector<T> Out(Count);
+		glm::gaussRand(static_cast<T>(3), static_cast<T>(1), &Out[0], Count);
+
+		T Sum(0);
+		T Sum2(0);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Sum += Out[i];
+			Sum2 += (Out[i] - static_cast<T>(3)) * (Out[i] - static_cast<T>(3));
+		}
+		Error += glm::abs(Sum / static_cast<T>(Count) - static_cast<T>(3)) < static_cast<T>(0.05) ? 0 : 1;
+		Error += glm::abs(Sum2 / static_cast<T>(Count) - static_cast<T>(1)) < static_cast<T>(0.05) ? 0 : 1;
+	}
+
+	{
+		std::vector<glm::vec<3, T, glm::defaultp> > Out(Count, glm::vec<3, T, glm::defaultp>(0));
+		glm::sphericalRand(static_cast<T>(2), &Out[0], Count, Engine);
+
+		glm::vec<3, T, glm::defaultp> Sum(0);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += glm::abs(glm::length(Out[i]) - static_cast<T>(2)) < static_cast<T>(0.0001) ? 0 : 1;
+			Sum += Out[i];
+		}
+		Error += glm::length(Sum / static_cast<T>(Count)) < static_cast<T>(0.1) ? 0 : 1;
+	}
+
+	{
+		std::vector<glm::vec<2, T, glm::defaultp> > Out(Count, glm::vec<2, T, glm::defaultp>(0));
+		glm::diskRand(static_cast<T>(2), &Out[0], Count, Engine);
+
+		// The mean distance to the center of a uniform disk is 2/3 of its radius
+		T Sum(0);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += glm::length(Out[i]) <= static_cast<T>(2) * (static_cast<T>(1) + glm::epsilon<T>()) ? 0 : 1;
+			Sum += glm::length(Out[i]);
+		}
+		Error += glm::abs(Sum / static_cast<T>(Count) - static_cast<T>(4) / static_cast<T>(3)) < static_cast<T>(0.05) ? 0 : 1;
+	}
+
+	{
+		std::vector<glm::vec<3, T, glm::defaultp> > Out(Count, glm::vec<3, T, glm::defaultp>(0));
+		glm::ballRand(static_cast<T>(2), &Out[0], Count);
+
+		// The mean distance to the center of a uniform ball is 3/4 of its radius
+		T Sum(0);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += glm::length(Out[i]) <= static_cast<T>(2) * (static_cast<T>(1) + glm::epsilon<T>()) ? 0 : 1;
+			Sum += glm::length(Out[i]);
+		}
+		Error += glm::abs(Sum / static_cast<T>(Count) - static_cast<T>(1.5)) < static_cast<T>(0.05) ? 0 : 1;
+	}
+
+	return Error;
+}
 /*
 #if(GLM_LANG & GLM_LANG_CXX0X_FLAG)
 int test_grid()
@@ -372,6 +547,9 @@ int main()
 	Error += test_sphericalRand();
 	Error += test_diskRand();
 	Error += test_ballRand();
+	Error += test_engine();
+	Error += test_batch<float>();
+	Error += test_batch<double>();
 /*
 #if(GLM_LANG & GLM_LANG_CXX0X_FLAG)
 	Error += test_grid();
@@ -0,0 +1,345 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/bvh.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <algorithm>
+#include <vector>
+
+// Height field of Size * Size quads, 2 indexed triangles per quad, and some triangles floating above it
+template<typename T>
+struct mesh
+{
+	std::vector<glm::vec<3, T, glm::defaultp> > Positions;
+	std::vector<glm::uint32> Indices;
+
+	std::size_t triangle_count() const
+	{
+		return Indices.size() / 3;
+	}
+
+	glm::vec<3, T, glm::defaultp> const& vertex(std::size_t Triangle, std::size_t Corner) const
+	{
+		return Positions[Indices[Triangle * 3 + Corner]];
+	}
+};
+
+template<typename T>
+static mesh<T> make_mesh(int Size)
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3;
+
+	mesh<T> Mesh;
+	for(int y = 0; y <= Size; ++y)
+	for(int x = 0; x <= Size; ++x)
+	{
+		T const u = static_cast<T>(x) / static_cast<T>(Size) * static_cast<T>(10) - static_cast<T>(5);
+		T const v = static_cast<T>(y) / static_cast<T>(Size) * static_cast<T>(10) - static_cast<T>(5);
+		Mesh.Positions.push_back(vec3(u, glm::sin(u) * glm::cos(v * static_cast<T>(1.3)), v));
+	}
+
+	glm::uint32 const Row = static_cast<glm::uint32>(Size + 1);
+	for(glm::uint32 y = 0; y < static_cast<glm::uint32>(Size); ++y)
+	for(glm::uint32 x = 0; x < static_cast<glm::uint32>(Size); ++x)
+	{
+		glm::uint32 const i = y * Row + x;
+		glm::uint32 const Quad[6] = {i, i + Row, i + 1, i + 1, i + Row, i + Row + 1};
+		Mesh.Indices.insert(Mesh.Indices.end(), Quad, Quad + 6);
+	}
+
+	for(int i = 0; i < 64; ++i)
+	{
+		T const t = static_cast<T>(i);
+		vec3 const Center(glm::sin(t * static_cast<T>(1.7)) * static_cast<T>(4), static_cast<T>(2) + glm::cos(t) , glm::cos(t * static_cast<T>(2.3)) * static_cast<T>(4));
+		glm::uint32 const First = static_cast<glm::uint32>(Mesh.Positions.size());
+		Mesh.Positions.push_back(Center + vec3(-0.3, 0, -0.2));
+		Mesh.Positions.push_back(Center + vec3(0.3, 0.1, -0.2));
+		Mesh.Positions.push_back(Center + vec3(0, -0.1, 0.4));
+		Mesh.Indices.push_back(First);
+		Mesh.Indices.push_back(First + 1);
+		Mesh.Indices.push_back(First + 2);
+	}
+
+	return Mesh;
+}
+
+template<typename T>
+static glm::vec<3, T, glm::defaultp> sample(int i, T Scale)
+{
+	T const t = static_cast<T>(i);
+	return glm::vec<3, T, glm::defaultp>(glm::sin(t * static_cast<T>(1.7)), glm::cos(t * static_cast<T>(2.3)), glm::sin(t * static_cast<T>(0.7) + static_cast<T>(1))) * Scale;
+}
+
+// Check the bounds of the nodes and that each triangle is in exactly one leaf
+template<typename T>
+static int check_nodes(glm::tbvh<T, glm::defaultp> const& Bvh, std::size_t Index, std::vector<int>& Visits)
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3;
+	typename glm::tbvh<T, glm::defaultp>::node const& Node = Bvh.Nodes[Index];
+
+	int Error = 0;
+
+	if(Node.Count == 0)
+	{
+		std::size_t const Children[2] = {Index + 1, Node.Offset};
+		for(int c = 0; c < 2; ++c)
+		{
+			Error += Children[c] > Index && Children[c] < Bvh.Nodes.size() ? 0 : 1;
+			if(Error)
+				return Error;
+			Error += glm::all(glm::lessThanEqual(Node.Min, Bvh.Nodes[Children[c]].Min)) ? 0 : 1;
+			Error += glm::all(glm::lessThanEqual(Bvh.Nodes[Children[c]].Max, Node.Max)) ? 0 : 1;
+			Error += check_nodes(Bvh, Children[c], Visits);
+		}
+		return Error;
+	}
+
+	for(std::size_t i = Node.Offset; i < Node.Offset + Node.Count; ++i)
+	{
+		++Visits[Bvh.Triangles[i]];
+		for(std::size_t Corner = 0; Corner < 3; ++Corner)
+		{
+			vec3 const& v = Bvh.Vertices[i * 3 + Corner];
+			Error += glm::all(glm::lessThanEqual(Node.Min, v)) && glm::all(glm::lessThanEqual(v, Node.Max)) ? 0 : 1;
+		}
+	}
+	return Error;
+}
+
+template<typename T>
+static int test_build()
+{
+	int Error = 0;
+
+	mesh<T> const Mesh = make_mesh<T>(48);
+	std::size_t const Count = Mesh.triangle_count();
+
+	glm::tbvh<T, glm::defaultp> Bvh;
+	glm::buildBVH(Bvh, &Mesh.Positions[0], &Mesh.Indices[0], Count);
+
+	Error += Bvh.Triangles.size() == Count ? 0 : 1;
+	Error += Bvh.Vertices.size() == Count * 3 ? 0 : 1;
+	Error += Bvh.Nodes.size() > 1 && Bvh.Nodes.size() < Count * 2 ? 0 : 1;
+
+	std::vector<int> Visits(Count, 0);
+	Error += check_nodes(Bvh, 0, Visits);
+	Error += std::count(Visits.begin(), Visits.end(), 1) == static_cast<std::ptrdiff_t>(Count) ? 0 : 1;
+
+	for(std::size_t i = 0; i < Count; ++i)
+	for(std::size_t Corner = 0; Corner < 3; ++Corner)
+		Error += Bvh.Vertices[i * 3 + Corner] == Mesh.vertex(Bvh.Triangles[i], Corner) ? 0 : 1;
+
+	// A triangle soup builds the same hierarchy as the indexed mesh
+	std::vector<glm::vec<3, T, glm::defaultp> > Soup;
+	for(std::size_t i = 0; i < Count; ++i)
+	for(std::size_t Corner = 0; Corner < 3; ++Corner)
+		Soup.push_back(Mesh.vertex(i, Corner));
+
+	glm::tbvh<T, glm::defaultp> SoupBvh;
+	glm::buildBVH(SoupBvh, &Soup[0], static_cast<glm::uint32 const*>(0), Count);
+	Error += SoupBvh.Triangles == Bvh.Triangles ? 0 : 1;
+	Error += SoupBvh.Nodes.size() == Bvh.Nodes.size() ? 0 : 1;
+
+	// Several threads build the same hierarchy
+	glm::tbvh<T, glm::defaultp> ThreadBvh;
+	glm::buildBVH(ThreadBvh, &Mesh.Positions[0], &Mesh.Indices[0], Count, 4);
+	Error += ThreadBvh.Triangles == Bvh.Triangles ? 0 : 1;
+	Error += ThreadBvh.Nodes.size() == Bvh.Nodes.size() ? 0 : 1;
+	for(std::size_t i = 0; i < Bvh.Nodes.size() && i < ThreadBvh.Nodes.size(); ++i)
+	{
+		Error += ThreadBvh.Nodes[i].Offset == Bvh.Nodes[i].Offset ? 0 : 1;
+		Error += ThreadBvh.Nodes[i].Count == Bvh.Nodes[i].Count ? 0 : 1;
+	}
+
+	// Identical triangles can't be separated by SAH and are split in halves
+	std::vector<glm::vec<3, T, glm::defaultp> > Stack;
+	for(int i = 0; i < 100; ++i)
+	{
+		Stack.push_back(glm::vec<3, T, glm::defaultp>(0, 0, 0));
+		Stack.push_back(glm::vec<3, T, glm::defaultp>(1, 0, 0));
+		Stack.push_back(glm::vec<3, T, glm::defaultp>(0, 1, 0));
+	}
+	glm::tbvh<T, glm::defaultp> StackBvh;
+	glm::buildBVH(StackBvh, &Stack[0], static_cast<glm::uint32 const*>(0), 100);
+	std::vector<int> StackVisits(100, 0);
+	Error += check_nodes(StackBvh, 0, StackVisits);
+	Error += std::count(StackVisits.begin(), StackVisits.end(), 1) == 100 ? 0 : 1;
+
+	// An empty mesh builds an empty hierarchy that never intersects
+	glm::buildBVH(Bvh, &Mesh.Positions[0], &Mesh.Indices[0], 0);
+	Error += Bvh.Nodes.empty() && Bvh.Vertices.empty() && Bvh.Triangles.empty() ? 0 : 1;
+
+	glm::uint32 Triangle = 0;
+	glm::vec<2, T, glm::defaultp> Bary;
+	T Distance = 0;
+	Error += glm::intersectRayBVH(Bvh, glm::vec<3, T, glm::defaultp>(0, 5, 0), glm::vec<3, T, glm::defaultp>(0, -1, 0), static_cast<T>(0), std::numeric_limits<T>::max(), Triangle, Bary, Distance) ? 1 : 0;
+	Error += glm::intersectRayBVHAny(Bvh, glm::vec<3, T, glm::defaultp>(0, 5, 0), glm::vec<3, T, glm::defaultp>(0, -1, 0), static_cast<T>(0), std::numeric_limits<T>::max()) ? 1 : 0;
+
+	return Error;
+}
+
+template<typename T>
+static int test_intersectRay()
+{
+	typedef glm::vec<2, T, glm::defaultp> vec2;
+	typedef glm::vec<3, T, glm::defaultp> vec3;
+
+	int Error = 0;
+
+	mesh<T> const Mesh = make_mesh<T>(32);
+	std::size_t const Count = Mesh.triangle_count();
+
+	glm::tbvh<T, glm::defaultp> Bvh;
+	glm::buildBVH(Bvh, &Mesh.Positions[0], &Mesh.Indices[0], Count);
+
+	T const Epsilon = static_cast<T>(1e-4);
+	int Hits = 0;
+
+	for(int r = 0; r < 200; ++r)
+	{
+		vec3 const Orig = sample(r, static_cast<T>(6)) + vec3(0, 4, 0);
+		vec3 const Dir = glm::normalize(sample(r + 1000, static_cast<T>(3)) - Orig);
+		T const tMin = static_cast<T>(r % 4) * static_cast<T>(0.5);
+		T const tMax = r % 3 ? static_cast<T>(20) : static_cast<T>(6);
+
+		// Brute force reference
+		bool Expected = false;
+		T ExpectedDistance = tMax;
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			vec2 Bary;
+			T Distance;
+			if(glm::intersectRayTriangle(Orig, Dir, Mesh.vertex(i, 0), Mesh.vertex(i, 1), Mesh.vertex(i, 2), Bary, Distance) && Distance >= tMin && Distance <= ExpectedDistance)
+			{
+				Expected = true;
+				ExpectedDistance = Distance;
+			}
+		}
+
+		glm::uint32 Triangle = 0;
+		vec2 Bary(0);
+		T Distance = 0;
+		bool const Result = glm::intersectRayBVH(Bvh, Orig, Dir, tMin, tMax, Triangle, Bary, Distance);
+		Error += Result == Expected ? 0 : 1;
+		Error += glm::intersectRayBVHAny(Bvh, Orig, Dir, tMin, tMax) == Expected ? 0 : 1;
+		Hits += Result ? 1 : 0;
+
+		if(Result && Expected)
+		{
+			Error += glm::equal(Distance, ExpectedDistance, Epsilon) ? 0 : 1;
+
+			// The reported triangle and barycentric coordinates match the hit point
+			vec3 const Point = Orig + Dir * Distance;
+			vec3 const& v0 = Mesh.vertex(Triangle, 0);
+			vec3 const BaryPoint = v0 + (Mesh.vertex(Triangle, 1) - v0) * Bary.x + (Mesh.vertex(Triangle, 2) - v0) * Bary.y;
+			Error += glm::all(glm::equal(Point, BaryPoint, static_cast<T>(1e-3))) ? 0 : 1;
+		}
+	}
+
+	Error += Hits > 20 && Hits < 190 ? 0 : 1;
+
+	return Error;
+}
+
+template<typename T>
+static int test_overlap()
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3;
+
+	int Error = 0;
+
+	mesh<T> const Mesh = make_mesh<T>(24);
+	std::size_t const Count = Mesh.triangle_count();
+
+	glm::tbvh<T, glm::defaultp> Bvh;
+	glm::buildBVH(Bvh, &Mesh.Positions[0], &Mesh.Indices[0], Count);
+
+	int Found = 0;
+	for(int q = 0; q < 50; ++q)
+	{
+		vec3 const Center = sample(q, static_cast<T>(4)) * vec3(1, static_cast<T>(0.5), 1);
+		vec3 const Extent = glm::abs(sample(q + 300, static_cast<T>(1))) + static_cast<T>(0.05);
+		T const Radius = Extent.x;
+
+		std::vector<glm::uint32> Boxes(1, 12345);
+		std::size_t const BoxCount = glm::overlapBVHAABB(Bvh, Center - Extent, Center + Extent, Boxes);
+		Error += Boxes.size() == BoxCount + 1 && Boxes[0] == 12345 ? 0 : 1;
+		std::vector<bool> InBox(Count, false);
+		for(std::size_t i = 1; i < Boxes.size(); ++i)
+		{
+			Error += InBox[Boxes[i]] ? 1 : 0;
+			InBox[Boxes[i]] = true;
+		}
+
+		std::vector<glm::uint32> Spheres;
+		std::size_t const SphereCount = glm::overlapBVHSphere(Bvh, Center, Radius, Spheres);
+		Error += Spheres.size() == SphereCount ? 0 : 1;
+		std::vector<bool> InSphere(Count, false);
+		for(std::size_t i = 0; i < Spheres.size(); ++i)
+		{
+			Error += InSphere[Spheres[i]] ? 1 : 0;
+			InSphere[Spheres[i]] = true;
+		}
+		Found += static_cast<int>(BoxCount + SphereCount);
+
+		// A triangle with a vertex inside the volume overlaps, a triangle with bounds outside of it doesn't
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			vec3 TriangleMin(std::numeric_limits<T>::max());
+			vec3 TriangleMax(-std::numeric_limits<T>::max());
+			bool VertexInBox = false;
+			bool VertexInSphere = false;
+			for(std::size_t Corner = 0; Corner < 3; ++Corner)
+			{
+				vec3 const& v = Mesh.vertex(i, Corner);
+				TriangleMin = glm::min(TriangleMin, v);
+				TriangleMax = glm::max(TriangleMax, v);
+				VertexInBox = VertexInBox || glm::all(glm::lessThan(glm::abs(v - Center), Extent));
+				VertexInSphere = VertexInSphere || glm::length(v - Center) < Radius;
+			}
+
+			if(VertexInBox)
+				Error += InBox[i] ? 0 : 1;
+			if(glm::any(glm::greaterThan(TriangleMin, Center + Extent)) || glm::any(glm::lessThan(TriangleMax, Center - Extent)))
+				Error += InBox[i] ? 1 : 0;
+
+			if(VertexInSphere)
+				Error += InSphere[i] ? 0 : 1;
+			vec3 const Outside = Center - glm::clamp(Center, TriangleMin, TriangleMax);
+			if(glm::length(Outside) > Radius)
+				Error += InSphere[i] ? 1 : 0;
+		}
+	}
+	Error += Found > 0 ? 0 : 1;
+
+	// A large triangle crossing a small volume without any vertex inside it
+	{
+		vec3 const Triangle[3] = {vec3(-10, 0, -10), vec3(10, 0, -10), vec3(0, 0, 10)};
+		glm::tbvh<T, glm::defaultp> Single;
+		glm::buildBVH(Single, Triangle, static_cast<glm::uint32 const*>(0), 1);
+
+		std::vector<glm::uint32> Result;
+		Error += glm::overlapBVHAABB(Single, vec3(-1, -1, -1), vec3(1, 1, 1), Result) == 1 ? 0 : 1;
+		Error += glm::overlapBVHSphere(Single, vec3(0, static_cast<T>(0.5), 0), static_cast<T>(1), Result) == 1 ? 0 : 1;
+
+		// Inside the bounds of the triangle but beside its hypotenuse
+		Error += glm::overlapBVHAABB(Single, vec3(8, -1, 6), vec3(9, 1, 7), Result) == 0 ? 0 : 1;
+		Error += glm::overlapBVHSphere(Single, vec3(8, 0, 6), static_cast<T>(1), Result) == 0 ? 0 : 1;
+		Error += glm::overlapBVHSphere(Single, vec3(0, 2, 0), static_cast<T>(1), Result) == 0 ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_build<float>();
+	Error += test_build<double>();
+	Error += test_intersectRay<float>();
+	Error += test_intersectRay<double>();
+	Error += test_overlap<float>();
+	Error += test_overlap<double>();
+
+	return Error;
+}
@@ -76,6 +76,236 @@ int test_intersectLineTriangle()
 	return Error;
 }
 
+// Triangles and rays spread around the origin so that about half of the tests hit
+template<typename T>
+static glm::vec<3, T, glm::defaultp> sample(int i, T Scale)
+{
+	T const t = static_cast<T>(i);
+	return glm::vec<3, T, glm::defaultp>(glm::sin(t * static_cast<T>(1.7)), glm::cos(t * static_cast<T>(2.3)), glm::sin(t * static_cast<T>(0.7) + static_cast<T>(1))) * Scale;
+}
+
+// Skip the hits on the edges of the triangles, the packet tests use the barycentric coordinates divided by the determinant
+template<typename T>
+static bool near_edge(glm::vec<2, T, glm::defaultp> const& Bary)
+{
+	T const Epsilon = static_cast<T>(1e-3);
+	return glm::abs(Bary.x) < Epsilon || glm::abs(Bary.y) < Epsilon || glm::abs(Bary.x + Bary.y - static_cast<T>(1)) < Epsilon;
+}
+
+template<typename T, glm::length_t W>
+static int test_intersectRayTriangle_packet()
+{
+	typedef glm::vec<2, T, glm::defaultp> vec2;
+	typedef glm::vec<3, T, glm::defaultp> vec3;
+
+	int Error = 0;
+
+	T const Epsilon = static_cast<T>(1e-3);
+
+	// One ray against W triangles
+	for(int i = 0; i < 16; ++i)
+	{
+		vec3 const Orig = sample(i, static_cast<T>(0.5)) + vec3(0, 0, 3);
+		vec3 const Dir = glm::normalize(sample(i + 100, static_cast<T>(0.3)) - Orig);
+
+		vec3 Vert0[W], Vert1[W], Vert2[W];
+		for(glm::length_t l = 0; l < W; ++l)
+		{
+			int const k = i * W + l;
+			Vert0[l] = sample(k * 3 + 0, static_cast<T>(1));
+			Vert1[l] = sample(k * 3 + 1, static_cast<T>(1));
+			Vert2[l] = sample(k * 3 + 2, static_cast<T>(1));
+		}
+
+		glm::soa_vec<2, T, W> BaryPositions;
+		glm::soa_scalar<T, W> Distances;
+		int const Mask = glm::intersectRayTriangle(Orig, Dir,
+			glm::soa_vec<3, T, W>::load(Vert0), glm::soa_vec<3, T, W>::load(Vert1), glm::soa_vec<3, T, W>::load(Vert2),
+			BaryPositions, Distances);
+
+		vec2 Bary[W];
+		BaryPositions.store(Bary);
+		for(glm::length_t l = 0; l < W; ++l)
+		{
+			vec2 Expected(0);
+			T Distance = 0;
+			bool const Result = glm::intersectRayTriangle(Orig, Dir, Vert0[l], Vert1[l], Vert2[l], Expected, Distance);
+			bool const Bit = ((Mask >> l) & 1) != 0;
+
+			if(Result && Bit)
+			{
+				Error += glm::all(glm::epsilonEqual(Bary[l], Expected, Epsilon)) ? 0 : 1;
+				Error += glm::epsilonEqual(Distances[l], Distance, Epsilon) ? 0 : 1;
+			}
+			else if(!near_edge(Bit ? Bary[l] : Expected))
+				Error += Result == Bit ? 0 : 1;
+		}
+		Error += (Mask >> W) == 0 ? 0 : 1;
+	}
+
+	// W rays against one triangle
+	vec3 const Vert0(-1, -1, 0);
+	vec3 const Vert1(1, -1, 0);
+	vec3 const Vert2(0, 1, 0);
+	int Hits = 0;
+	for(int i = 0; i < 16; ++i)
+	{
+		vec3 Orig[W], Dir[W];
+		for(glm::length_t l = 0; l < W; ++l)
+		{
+			int const k = i * W + l;
+			Orig[l] = sample(k, static_cast<T>(2)) + vec3(0, 0, 4);
+			Dir[l] = glm::normalize(sample(k + 1000, static_cast<T>(1)) - Orig[l]);
+		}
+
+		glm::soa_vec<2, T, W> BaryPositions;
+		glm::soa_scalar<T, W> Distances;
+		int const Mask = glm::intersectRayTriangle(glm::soa_vec<3, T, W>::load(Orig), glm::soa_vec<3, T, W>::load(Dir),
+			Vert0, Vert1, Vert2, BaryPositions, Distances);
+
+		vec2 Bary[W];
+		BaryPositions.store(Bary);
+		for(glm::length_t l = 0; l < W; ++l)
+		{
+			vec2 Expected(0);
+			T Distance = 0;
+			bool const Result = glm::intersectRayTriangle(Orig[l], Dir[l], Vert0, Vert1, Vert2, Expected, Distance);
+			bool const Bit = ((Mask >> l) & 1) != 0;
+			Hits += Bit ? 1 : 0;
+
+			if(Result && Bit)
+			{
+				Error += glm::all(glm::epsilonEqual(Bary[l], Expected, Epsilon)) ? 0 : 1;
+				Error += glm::epsilonEqual(Distances[l], Distance, Epsilon) ? 0 : 1;
+			}
+			else if(!near_edge(Bit ? Bary[l] : Expected))
+				Error += Result == Bit ? 0 : 1;
+		}
+	}
+	Error += Hits > 0 && Hits < 16 * W ? 0 : 1;
+
+	// A ray parallel to the triangle never intersects
+	{
+		glm::soa_vec<2, T, W> BaryPositions;
+		glm::soa_scalar<T, W> Distances;
+		int const Mask = glm::intersectRayTriangle(glm::soa_vec<3, T, W>(vec3(0, 0, 0)), glm::soa_vec<3, T, W>(vec3(1, 0, 0)),
+			Vert0, Vert1, Vert2, BaryPositions, Distances);
+		Error += Mask == 0 ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<typename T>
+static int test_intersectRayAABB()
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3;
+
+	int Error = 0;
+
+	T const Epsilon = static_cast<T>(1e-5);
+	T const Max = std::numeric_limits<T>::max();
+	vec3 const BoxMin(-1, -1, -1);
+	vec3 const BoxMax(1, 1, 1);
+
+	// Entering through the face z = 1
+	{
+		T Distance = 0;
+		bool const Result = glm::intersectRayAABB(vec3(0, 0, 3), static_cast<T>(1) / vec3(0, 0, -1), BoxMin, BoxMax, static_cast<T>(0), Max, Distance);
+		Error += Result ? 0 : 1;
+		Error += glm::epsilonEqual(Distance, static_cast<T>(2), Epsilon) ? 0 : 1;
+	}
+
+	// Starting inside the box, the entry distance is tMin
+	{
+		T Distance = 0;
+		bool const Result = glm::intersectRayAABB(vec3(0, 0, 0), static_cast<T>(1) / glm::normalize(vec3(1, 2, 3)), BoxMin, BoxMax, static_cast<T>(0), Max, Distance);
+		Error += Result ? 0 : 1;
+		Error += glm::epsilonEqual(Distance, static_cast<T>(0), Epsilon) ? 0 : 1;
+	}
+
+	// Box behind the ray, box beyond tMax and ray passing by the box
+	{
+		T Distance = static_cast<T>(7);
+		Error += glm::intersectRayAABB(vec3(0, 0, 3), static_cast<T>(1) / vec3(0, 0, 1), BoxMin, BoxMax, static_cast<T>(0), Max, Distance) ? 1 : 0;
+		Error += glm::intersectRayAABB(vec3(0, 0, 3), static_cast<T>(1) / vec3(0, 0, -1), BoxMin, BoxMax, static_cast<T>(0), static_cast<T>(1.5), Distance) ? 1 : 0;
+		Error += glm::intersectRayAABB(vec3(2, 0, 3), static_cast<T>(1) / vec3(0, 0, -1), BoxMin, BoxMax, static_cast<T>(0), Max, Distance) ? 1 : 0;
+		Error += glm::epsilonEqual(Distance, static_cast<T>(7), Epsilon) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<typename T, glm::length_t W>
+static int test_intersectRayAABB_packet()
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3;
+
+	int Error = 0;
+
+	T const Epsilon = static_cast<T>(1e-4);
+	int Hits = 0;
+
+	for(int i = 0; i < 16; ++i)
+	{
+		// One ray against W boxes
+		vec3 const Orig = sample(i, static_cast<T>(4));
+		vec3 const InvDir = static_cast<T>(1) / glm::normalize(sample(i + 100, static_cast<T>(1)) - Orig);
+		T const tMin = static_cast<T>(0);
+		T const tMax = static_cast<T>(8);
+
+		vec3 BoxMin[W], BoxMax[W], Orig4[W], InvDir4[W];
+		T tMin4[W], tMax4[W];
+		for(glm::length_t l = 0; l < W; ++l)
+		{
+			int const k = i * W + l;
+			vec3 const Center = sample(k * 2, static_cast<T>(2));
+			vec3 const Extent = glm::abs(sample(k * 2 + 1, static_cast<T>(1))) + static_cast<T>(0.1);
+			BoxMin[l] = Center - Extent;
+			BoxMax[l] = Center + Extent;
+
+			Orig4[l] = sample(k + 500, static_cast<T>(4));
+			InvDir4[l] = static_cast<T>(1) / glm::normalize(sample(k + 700, static_cast<T>(1)) - Orig4[l]);
+			tMin4[l] = static_cast<T>(l % 3);
+			tMax4[l] = static_cast<T>(4 + l % 5);
+		}
+
+		glm::soa_scalar<T, W> Distances;
+		int const Mask = glm::intersectRayAABB(Orig, InvDir, glm::soa_vec<3, T, W>::load(BoxMin), glm::soa_vec<3, T, W>::load(BoxMax), tMin, tMax, Distances);
+		for(glm::length_t l = 0; l < W; ++l)
+		{
+			T Distance = 0;
+			bool const Result = glm::intersectRayAABB(Orig, InvDir, BoxMin[l], BoxMax[l], tMin, tMax, Distance);
+			bool const Bit = ((Mask >> l) & 1) != 0;
+			Hits += Bit ? 1 : 0;
+
+			Error += Result == Bit ? 0 : 1;
+			if(Result && Bit)
+				Error += glm::epsilonEqual(Distances[l], Distance, Epsilon) ? 0 : 1;
+		}
+		Error += (Mask >> W) == 0 ? 0 : 1;
+
+		// W rays against one box
+		glm::soa_scalar<T, W> RayDistances;
+		int const RayMask = glm::intersectRayAABB(glm::soa_vec<3, T, W>::load(Orig4), glm::soa_vec<3, T, W>::load(InvDir4), BoxMin[0], BoxMax[0],
+			glm::soa_scalar<T, W>::load(tMin4), glm::soa_scalar<T, W>::load(tMax4), RayDistances);
+		for(glm::length_t l = 0; l < W; ++l)
+		{
+			T Distance = 0;
+			bool const Result = glm::intersectRayAABB(Orig4[l], InvDir4[l], BoxMin[0], BoxMax[0], tMin4[l], tMax4[l], Distance);
+			bool const Bit = ((RayMask >> l) & 1) != 0;
+			Hits += Bit ? 1 : 0;
+
+			Error += Result == Bit ? 0 : 1;
+			if(Result && Bit)
+				Error += glm::epsilonEqual(RayDistances[l], Distance, Epsilon) ? 0 : 1;
+		}
+	}
+	Error += Hits > 0 && Hits < 32 * W ? 0 : 1;
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
@@ -83,6 +313,14 @@ int main()
 	Error += test_intersectRayPlane();
 	Error += test_intersectRayTriangle();
 	Error += test_intersectLineTriangle();
+	Error += test_intersectRayTriangle_packet<float, 4>();
+	Error += test_intersectRayTriangle_packet<float, 8>();
+	Error += test_intersectRayTriangle_packet<double, 4>();
+	Error += test_intersectRayAABB<float>();
+	Error += test_intersectRayAABB<double>();
+	Error += test_intersectRayAABB_packet<float, 4>();
+	Error += test_intersectRayAABB_packet<float, 8>();
+	Error += test_intersectRayAABB_packet<double, 4>();
 
 	return Error;
 }
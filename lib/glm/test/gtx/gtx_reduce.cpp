@@ -0,0 +1,141 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/reduce.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
+#include <limits>
+#include <vector>
+
+// More than 8 blocks and a partial block, with values of both signs
+template<glm::length_t L, typename T>
+static std::vector<glm::vec<L, T, glm::defaultp> > make_values(std::size_t Count)
+{
+	std::vector<glm::vec<L, T, glm::defaultp> > Values(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	for(glm::length_t c = 0; c < L; ++c)
+		Values[i][c] = static_cast<T>(static_cast<int>((i * 7919 + static_cast<std::size_t>(c) * 104729) % 201) - 100) / static_cast<T>(64);
+	return Values;
+}
+
+template<glm::length_t L, typename T>
+static int test_reduce(std::size_t Count, unsigned ThreadCount)
+{
+	typedef glm::vec<L, T, glm::defaultp> vec_type;
+
+	int Error = 0;
+
+	std::vector<vec_type> const x = make_values<L, T>(Count);
+	std::vector<vec_type> const y = make_values<L, T>(Count + 3);
+	vec_type const* const X = x.empty() ? 0 : &x[0];
+	vec_type const* const Y = &y[3];
+
+	vec_type Min(std::numeric_limits<T>::max());
+	vec_type Max(-std::numeric_limits<T>::max());
+	vec_type Sum(static_cast<T>(0));
+	T Dot(0);
+	T MaxLength2(0);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Min = glm::min(Min, x[i]);
+		Max = glm::max(Max, x[i]);
+		Sum += x[i];
+		Dot += glm::dot(x[i], Y[i]);
+		MaxLength2 = glm::max(MaxLength2, glm::dot(x[i], x[i]));
+	}
+
+	// Values are small multiples of 1/64 so sums of components are exact whatever the order
+	vec_type BoundsMin, BoundsMax;
+	glm::reduceBounds(X, Count, BoundsMin, BoundsMax, ThreadCount);
+	Error += glm::all(glm::equal(BoundsMin, Min)) ? 0 : 1;
+	Error += glm::all(glm::equal(BoundsMax, Max)) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::reduceMin(X, Count, ThreadCount), Min)) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::reduceMax(X, Count, ThreadCount), Max)) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::reduceSum(X, Count, ThreadCount), Sum)) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::reduceMean(X, Count, ThreadCount), Count > 0 ? Sum / static_cast<T>(Count) : vec_type(0))) ? 0 : 1;
+	Error += glm::equal(glm::reduceDot(X, Y, Count, ThreadCount), Dot, glm::abs(Dot) * static_cast<T>(0.0001) + static_cast<T>(0.001)) ? 0 : 1;
+	Error += glm::equal(glm::reduceMaxLength2(X, Count, ThreadCount), MaxLength2, static_cast<T>(0)) ? 0 : 1;
+
+	return Error;
+}
+
+// Inexact sums don't depend on the number of threads
+static int test_deterministic()
+{
+	int Error = 0;
+
+	std::size_t const Count = 100003;
+	std::vector<glm::vec3> Values(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Values[i] = glm::vec3(1.0f / static_cast<float>(i + 1), 0.1f * static_cast<float>(i % 13), glm::sqrt(static_cast<float>(i)));
+
+	glm::vec3 const Sum = glm::reduceSum(&Values[0], Count, 1);
+	float const Dot = glm::reduceDot(&Values[0], &Values[0], Count, 1);
+
+	unsigned const ThreadCounts[] = {2, 3, 4, 0};
+	for(std::size_t i = 0; i < sizeof(ThreadCounts) / sizeof(unsigned); ++i)
+	{
+		Error += glm::all(glm::equal(glm::reduceSum(&Values[0], Count, ThreadCounts[i]), Sum)) ? 0 : 1;
+		Error += glm::equal(glm::reduceDot(&Values[0], &Values[0], Count, ThreadCounts[i]), Dot, 0.0f) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int test_aligned()
+{
+	int Error = 0;
+
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		std::vector<glm::aligned_vec4> Values(1000);
+		for(std::size_t i = 0; i < Values.size(); ++i)
+			Values[i] = glm::aligned_vec4(static_cast<float>(i), -static_cast<float>(i), 1.0f, 0.5f);
+
+		glm::aligned_vec4 Min, Max;
+		glm::reduceBounds(&Values[0], Values.size(), Min, Max);
+		Error += glm::all(glm::equal(Min, glm::aligned_vec4(0.0f, -999.0f, 1.0f, 0.5f))) ? 0 : 1;
+		Error += glm::all(glm::equal(Max, glm::aligned_vec4(999.0f, 0.0f, 1.0f, 0.5f))) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::reduceMean(&Values[0], Values.size()), glm::aligned_vec4(499.5f, -499.5f, 1.0f, 0.5f))) ? 0 : 1;
+#	endif
+
+	return Error;
+}
+
+static int test_int()
+{
+	int Error = 0;
+
+	std::vector<glm::ivec2> const Values = make_values<2, int>(20000);
+
+	glm::ivec2 Min, Max;
+	glm::reduceBounds(&Values[0], Values.size(), Min, Max, 4);
+	Error += glm::all(glm::equal(Min, glm::ivec2(-1))) ? 0 : 1;
+	Error += glm::all(glm::equal(Max, glm::ivec2(1))) ? 0 : 1;
+
+	glm::ivec2 EmptyMin, EmptyMax;
+	glm::reduceBounds(static_cast<glm::ivec2 const*>(0), 0, EmptyMin, EmptyMax);
+	Error += glm::all(glm::equal(EmptyMin, glm::ivec2(std::numeric_limits<int>::max()))) ? 0 : 1;
+	Error += glm::all(glm::equal(EmptyMax, glm::ivec2(std::numeric_limits<int>::min()))) ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_reduce<3, float>(0, 1);
+	Error += test_reduce<3, float>(7, 1);
+	Error += test_reduce<3, float>(70001, 1);
+	Error += test_reduce<3, float>(70001, 4);
+	Error += test_reduce<4, float>(70001, 0);
+	Error += test_reduce<2, float>(20001, 3);
+	Error += test_reduce<3, double>(70001, 4);
+	Error += test_reduce<4, double>(1001, 1);
+	Error += test_deterministic();
+	Error += test_aligned();
+	Error += test_int();
+
+	return Error;
+}
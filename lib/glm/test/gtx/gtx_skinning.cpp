@@ -0,0 +1,134 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/skinning.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/gtc/type_precision.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <vector>
+
+template<typename T>
+struct rig
+{
+	std::vector<glm::tdualquat<T, glm::defaultp> > DualQuat;
+	std::vector<glm::mat<3, 4, T, glm::defaultp> > Matrix;
+	std::vector<glm::u16vec4> Indices;
+	std::vector<glm::vec<4, T, glm::defaultp> > Weights;
+	std::vector<glm::vec<3, T, glm::defaultp> > Positions, Normals;
+};
+
+template<typename T>
+static rig<T> make_rig(std::size_t Bones, std::size_t Count)
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3;
+	typedef glm::vec<4, T, glm::defaultp> vec4;
+
+	rig<T> Rig;
+	for(std::size_t b = 0; b < Bones; ++b)
+	{
+		T const t = static_cast<T>(b);
+		glm::qua<T, glm::defaultp> const Rotation = glm::angleAxis(t * static_cast<T>(0.9), glm::normalize(vec3(glm::sin(t), glm::cos(t * static_cast<T>(1.3)), static_cast<T>(0.5))));
+		vec3 const Translation(glm::cos(t), t * static_cast<T>(0.1), -glm::sin(t * static_cast<T>(2)));
+		Rig.DualQuat.push_back(glm::tdualquat<T, glm::defaultp>(Rotation, Translation));
+		Rig.Matrix.push_back(glm::mat3x4_cast(Rig.DualQuat.back()));
+	}
+
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		T const t = static_cast<T>(i);
+		Rig.Indices.push_back(glm::u16vec4(i % Bones, (i * 7 + 3) % Bones, (i * 5 + 1) % Bones, (i * 3 + 2) % Bones));
+
+		// Every fourth vertex has a single influence
+		vec4 const Weight = i % 4 == 0 ? vec4(1, 0, 0, 0) : vec4(static_cast<T>(2) + glm::sin(t), static_cast<T>(1), static_cast<T>(i % 3), static_cast<T>(0.5));
+		Rig.Weights.push_back(Weight / (Weight.x + Weight.y + Weight.z + Weight.w));
+
+		Rig.Positions.push_back(vec3(glm::sin(t * static_cast<T>(0.7)), glm::cos(t * static_cast<T>(0.3)), t * static_cast<T>(0.01)));
+		Rig.Normals.push_back(glm::normalize(vec3(glm::cos(t), static_cast<T>(1), glm::sin(t * static_cast<T>(0.2)))));
+	}
+
+	return Rig;
+}
+
+template<typename T>
+static int test_dual_quat(T Epsilon)
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3;
+
+	int Error = 0;
+
+	// Not a multiple of the width to cover the tail
+	std::size_t const Count = 37;
+	rig<T> const Rig = make_rig<T>(11, Count);
+
+	std::vector<vec3> Positions(Count, vec3(0)), Normals(Count, vec3(0));
+	glm::skinDualQuat(&Rig.DualQuat[0], &Rig.Indices[0], &Rig.Weights[0], &Rig.Positions[0], &Rig.Normals[0], &Positions[0], &Normals[0], Count);
+
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::tdualquat<T, glm::defaultp> Blend = Rig.DualQuat[Rig.Indices[i].x] * Rig.Weights[i].x;
+		for(glm::length_t k = 1; k < 4; ++k)
+		{
+			glm::tdualquat<T, glm::defaultp> const& Bone = Rig.DualQuat[Rig.Indices[i][k]];
+			T const Weight = glm::dot(Bone.real, Rig.DualQuat[Rig.Indices[i].x].real) < static_cast<T>(0) ? -Rig.Weights[i][k] : Rig.Weights[i][k];
+			Blend = Blend + Bone * Weight;
+		}
+		Blend = glm::normalize(Blend);
+
+		Error += glm::all(glm::equal(Positions[i], Blend * Rig.Positions[i], Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(Normals[i], Blend.real * Rig.Normals[i], Epsilon)) ? 0 : 1;
+	}
+
+	// Normals are optional and outputs may be the inputs
+	std::vector<vec3> InPlace(Rig.Positions);
+	glm::skinDualQuat(&Rig.DualQuat[0], &Rig.Indices[0], &Rig.Weights[0], &InPlace[0], static_cast<vec3 const*>(GLM_NULLPTR), &InPlace[0], static_cast<vec3*>(GLM_NULLPTR), Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(InPlace[i], Positions[i], Epsilon)) ? 0 : 1;
+
+	return Error;
+}
+
+template<typename T>
+static int test_linear_blend(T Epsilon)
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3;
+	typedef glm::vec<4, T, glm::defaultp> vec4;
+
+	int Error = 0;
+
+	std::size_t const Count = 37;
+	rig<T> const Rig = make_rig<T>(11, Count);
+
+	std::vector<vec3> Positions(Count, vec3(0)), Normals(Count, vec3(0));
+	glm::skinLinearBlend(&Rig.Matrix[0], &Rig.Indices[0], &Rig.Weights[0], &Rig.Positions[0], &Rig.Normals[0], &Positions[0], &Normals[0], Count);
+
+	std::vector<vec3> DualQuatPositions(Count, vec3(0));
+	glm::skinDualQuat(&Rig.DualQuat[0], &Rig.Indices[0], &Rig.Weights[0], &Rig.Positions[0], static_cast<vec3 const*>(GLM_NULLPTR), &DualQuatPositions[0], static_cast<vec3*>(GLM_NULLPTR), Count);
+
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::mat<3, 4, T, glm::defaultp> Blend = Rig.Matrix[Rig.Indices[i].x] * Rig.Weights[i].x;
+		for(glm::length_t k = 1; k < 4; ++k)
+			Blend += Rig.Matrix[Rig.Indices[i][k]] * Rig.Weights[i][k];
+
+		vec4 const p(Rig.Positions[i], 1);
+		vec4 const v(Rig.Normals[i], 0);
+		Error += glm::all(glm::equal(Positions[i], vec3(glm::dot(Blend[0], p), glm::dot(Blend[1], p), glm::dot(Blend[2], p)), Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(Normals[i], glm::normalize(vec3(glm::dot(Blend[0], v), glm::dot(Blend[1], v), glm::dot(Blend[2], v))), Epsilon)) ? 0 : 1;
+
+		// With a single influence both methods apply the same rigid transformation
+		if(i % 4 == 0)
+			Error += glm::all(glm::equal(Positions[i], DualQuatPositions[i], Epsilon)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_dual_quat<float>(1e-5f);
+	Error += test_dual_quat<double>(1e-12);
+	Error += test_linear_blend<float>(1e-5f);
+	Error += test_linear_blend<double>(1e-12);
+
+	return Error;
+}
@@ -3,6 +3,9 @@
 #include <glm/vec3.hpp>
 #include <glm/vec4.hpp>
 #include <glm/gtx/spline.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <vector>
 
 namespace catmullRom
 {
@@ -88,6 +91,118 @@ namespace cubic
 	}
 }//catmullRom
 
+namespace spline
+{
+	template<glm::length_t L, typename T>
+	static std::vector<glm::vec<L, T, glm::defaultp> > make_points(std::size_t Count)
+	{
+		std::vector<glm::vec<L, T, glm::defaultp> > Points(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		for(glm::length_t c = 0; c < L; ++c)
+			Points[i][c] = static_cast<T>((i * 37 + static_cast<std::size_t>(c) * 11) % 17) - static_cast<T>(8);
+		return Points;
+	}
+
+	// Sampled curves match catmullRom and hermite, including the parameters not processed by the SIMD loop
+	template<glm::length_t L, typename T>
+	static int test_evaluate()
+	{
+		typedef glm::vec<L, T, glm::defaultp> vec_type;
+
+		int Error = 0;
+
+		std::size_t const PointCount = 9;
+		std::vector<vec_type> const Points = make_points<L, T>(PointCount);
+		std::vector<vec_type> const Tangents = make_points<L, T>(PointCount + 1);
+
+		glm::tspline<L, T, glm::defaultp> CatmullRom;
+		glm::buildCatmullRomSpline(CatmullRom, &Points[0], PointCount);
+		glm::tspline<L, T, glm::defaultp> Hermite;
+		glm::buildHermiteSpline(Hermite, &Points[0], &Tangents[1], PointCount);
+
+		std::size_t const SampleCount = 103;
+		std::vector<T> Parameters(SampleCount);
+		for(std::size_t i = 0; i < SampleCount; ++i)
+			Parameters[i] = static_cast<T>(i) / static_cast<T>(SampleCount - 3) - static_cast<T>(0.01);
+
+		std::vector<vec_type> CatmullRomPoints(SampleCount);
+		glm::evaluateSpline(CatmullRom, &Parameters[0], SampleCount, &CatmullRomPoints[0]);
+		std::vector<vec_type> HermitePoints(SampleCount);
+		glm::evaluateSpline(Hermite, &Parameters[0], SampleCount, &HermitePoints[0]);
+
+		for(std::size_t i = 0; i < SampleCount; ++i)
+		{
+			T const u = glm::clamp(Parameters[i], static_cast<T>(0), static_cast<T>(1)) * static_cast<T>(PointCount - 1);
+			std::size_t const j = glm::min(static_cast<std::size_t>(u), PointCount - 2);
+			T const s = u - static_cast<T>(j);
+
+			vec_type const ExpectedCatmullRom = glm::catmullRom(Points[j > 0 ? j - 1 : 0], Points[j], Points[j + 1], Points[glm::min(j + 2, PointCount - 1)], s);
+			vec_type const ExpectedHermite = glm::hermite(Points[j], Tangents[j + 1], Points[j + 1], Tangents[j + 2], s);
+
+			Error += glm::all(glm::equal(CatmullRomPoints[i], ExpectedCatmullRom, static_cast<T>(0.0001))) ? 0 : 1;
+			Error += glm::all(glm::equal(HermitePoints[i], ExpectedHermite, static_cast<T>(0.0001))) ? 0 : 1;
+			Error += glm::all(glm::equal(glm::evaluateSpline(CatmullRom, Parameters[i]), CatmullRomPoints[i], static_cast<T>(0.0001))) ? 0 : 1;
+		}
+
+		// The curve goes through its points
+		Error += glm::all(glm::equal(glm::evaluateSpline(CatmullRom, static_cast<T>(0)), Points[0], static_cast<T>(0.0001))) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::evaluateSpline(CatmullRom, static_cast<T>(0.5)), Points[4], static_cast<T>(0.0001))) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::evaluateSpline(CatmullRom, static_cast<T>(1)), Points[8], static_cast<T>(0.0001))) ? 0 : 1;
+
+		return Error;
+	}
+
+	// Straight hermite curve whose speed goes from 1 to 20 and back to 1: parameters don't move at constant speed but distances do
+	template<typename T>
+	static int test_arc_length()
+	{
+		typedef glm::vec<3, T, glm::defaultp> vec3;
+
+		int Error = 0;
+
+		vec3 const Points[] = {vec3(0, 0, 0), vec3(10, 0, 0), vec3(20, 0, 0)};
+		vec3 const Tangents[] = {vec3(1, 0, 0), vec3(20, 0, 0), vec3(1, 0, 0)};
+		glm::tspline<3, T, glm::defaultp> Spline;
+		glm::buildHermiteSpline(Spline, Points, Tangents, 3);
+		glm::buildArcLengthTable(Spline, 64);
+
+		Error += glm::equal(glm::splineLength(Spline), static_cast<T>(20), static_cast<T>(0.001)) ? 0 : 1;
+		Error += glm::equal(glm::splineParameter(Spline, static_cast<T>(0)), static_cast<T>(0), static_cast<T>(0)) ? 0 : 1;
+		Error += glm::equal(glm::splineParameter(Spline, static_cast<T>(1)), static_cast<T>(1), static_cast<T>(0)) ? 0 : 1;
+		Error += glm::equal(glm::splineParameter(Spline, static_cast<T>(0.5)), static_cast<T>(0.5), static_cast<T>(0.001)) ? 0 : 1;
+
+		std::size_t const SampleCount = 301;
+		std::vector<T> Distances(SampleCount);
+		for(std::size_t i = 0; i < SampleCount; ++i)
+			Distances[i] = static_cast<T>(i) / static_cast<T>(SampleCount - 1);
+
+		std::vector<vec3> Uniform(SampleCount);
+		glm::evaluateSplineConstantSpeed(Spline, &Distances[0], SampleCount, &Uniform[0]);
+		for(std::size_t i = 0; i < SampleCount; ++i)
+			Error += glm::all(glm::equal(Uniform[i], vec3(static_cast<T>(20) * Distances[i], 0, 0), static_cast<T>(0.05))) ? 0 : 1;
+
+		std::vector<vec3> Parametric(SampleCount);
+		glm::evaluateSpline(Spline, &Distances[0], SampleCount, &Parametric[0]);
+		Error += glm::all(glm::equal(Parametric[30], vec3(2, 0, 0), static_cast<T>(0.01))) ? 1 : 0;
+
+		return Error;
+	}
+
+	int test()
+	{
+		int Error = 0;
+
+		Error += test_evaluate<2, float>();
+		Error += test_evaluate<3, float>();
+		Error += test_evaluate<4, float>();
+		Error += test_evaluate<3, double>();
+		Error += test_arc_length<float>();
+		Error += test_arc_length<double>();
+
+		return Error;
+	}
+}//namespace spline
+
 int main()
 {
 	int Error(0);
@@ -95,6 +210,7 @@ int main()
 	Error += catmullRom::test();
 	Error += hermite::test();
 	Error += cubic::test();
+	Error += spline::test();
 
 	return Error;
 }
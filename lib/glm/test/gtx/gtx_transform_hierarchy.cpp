@@ -0,0 +1,164 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/transform_hierarchy.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <algorithm>
+#include <vector>
+
+// Parent of each node, identifiers in reverse creation order: 4 roots, a wide level to be split between threads, then 2 more levels
+static std::vector<glm::uint32> make_parents(std::size_t NodeCount)
+{
+	std::vector<glm::uint32> Parents(NodeCount);
+	for(std::size_t i = 0; i < NodeCount; ++i)
+	{
+		// Node i is the (NodeCount - 1 - i)th created node
+		std::size_t const Created = NodeCount - 1 - i;
+		std::size_t Parent;
+		if(Created < 4)
+			Parent = NodeCount;
+		else if(Created < NodeCount / 2)
+			Parent = Created % 4;
+		else
+			Parent = Created - NodeCount / 4;
+		Parents[i] = Parent == NodeCount ? glm::transform_hierarchy::root : static_cast<glm::uint32>(NodeCount - 1 - Parent);
+	}
+	return Parents;
+}
+
+template<typename T>
+static void local_transform(std::size_t Node, T Time, glm::vec<3, T, glm::defaultp>& Translation, glm::qua<T, glm::defaultp>& Rotation, glm::vec<3, T, glm::defaultp>& Scale)
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3;
+
+	T const t = static_cast<T>(Node % 97) * static_cast<T>(0.01) + Time;
+	Translation = vec3(t, static_cast<T>(-0.5), static_cast<T>(0.25) * t);
+	Rotation = glm::angleAxis(t, glm::normalize(vec3(1, 2, 3)));
+	Scale = vec3(1, static_cast<T>(0.5) + t, static_cast<T>(1.25));
+}
+
+// World transforms computed recursively with mat4
+template<typename T>
+static glm::mat<4, 4, T, glm::defaultp> const& world_transform(std::vector<glm::uint32> const& Parents, std::vector<glm::mat<4, 4, T, glm::defaultp> > const& Locals,
+	std::vector<glm::mat<4, 4, T, glm::defaultp> >& Worlds, std::vector<bool>& Done, glm::uint32 Node)
+{
+	if(!Done[Node])
+	{
+		Worlds[Node] = Parents[Node] == glm::transform_hierarchy::root ? Locals[Node] : world_transform(Parents, Locals, Worlds, Done, Parents[Node]) * Locals[Node];
+		Done[Node] = true;
+	}
+	return Worlds[Node];
+}
+
+template<typename T>
+static int check_worlds(glm::ttransform_hierarchy<T, glm::defaultp> const& Hierarchy, std::vector<glm::uint32> const& Parents, T Time, std::vector<bool> const& Moved)
+{
+	typedef glm::mat<4, 4, T, glm::defaultp> mat4;
+
+	std::vector<mat4> Locals(Parents.size());
+	for(std::size_t i = 0; i < Parents.size(); ++i)
+	{
+		glm::vec<3, T, glm::defaultp> Translation, Scale;
+		glm::qua<T, glm::defaultp> Rotation;
+		local_transform(i, Moved[i] ? Time : static_cast<T>(0), Translation, Rotation, Scale);
+		Locals[i] = glm::scale(glm::translate(mat4(static_cast<T>(1)), Translation) * glm::mat4_cast(Rotation), Scale);
+	}
+
+	std::vector<mat4> Worlds(Parents.size());
+	std::vector<bool> Done(Parents.size(), false);
+
+	int Error = 0;
+	for(std::size_t i = 0; i < Parents.size(); ++i)
+	{
+		mat4 const& Expected = world_transform(Parents, Locals, Worlds, Done, static_cast<glm::uint32>(i));
+		Error += glm::all(glm::equal(glm::mat4_cast(glm::worldTransform(Hierarchy, static_cast<glm::uint32>(i))), Expected, static_cast<T>(1e-3))) ? 0 : 1;
+	}
+	return Error;
+}
+
+template<typename T>
+static int test_update(unsigned ThreadCount)
+{
+	int Error = 0;
+
+	std::size_t const NodeCount = 40000;
+	std::vector<glm::uint32> const Parents = make_parents(NodeCount);
+
+	glm::ttransform_hierarchy<T, glm::defaultp> Hierarchy;
+	glm::buildTransformHierarchy(Hierarchy, &Parents[0], Parents.size());
+
+	// Parents precede their children
+	for(std::size_t i = 0; i < NodeCount; ++i)
+	{
+		glm::uint32 const Parent = Hierarchy.Parents[i];
+		Error += Parent == glm::transform_hierarchy::root || Parent < i ? 0 : 1;
+	}
+	Error += Hierarchy.Levels.front() == 0 && Hierarchy.Levels[1] == 4 && Hierarchy.Levels.back() == NodeCount ? 0 : 1;
+
+	std::vector<bool> Moved(NodeCount, true);
+	for(std::size_t i = 0; i < NodeCount; ++i)
+	{
+		glm::vec<3, T, glm::defaultp> Translation, Scale;
+		glm::qua<T, glm::defaultp> Rotation;
+		local_transform(i, static_cast<T>(0), Translation, Rotation, Scale);
+		glm::setLocalTransform(Hierarchy, static_cast<glm::uint32>(i), Translation, Rotation, Scale);
+	}
+	Error += glm::updateTransformHierarchy(Hierarchy, ThreadCount) == NodeCount ? 0 : 1;
+	Error += check_worlds(Hierarchy, Parents, static_cast<T>(0), Moved);
+
+	// Nothing changed
+	Error += glm::updateTransformHierarchy(Hierarchy, ThreadCount) == 0 ? 0 : 1;
+
+	// Moving a leaf updates only it
+	{
+		glm::uint32 const Leaf = 0;
+		glm::vec<3, T, glm::defaultp> Translation, Scale;
+		glm::qua<T, glm::defaultp> Rotation;
+		local_transform(Leaf, static_cast<T>(0.5), Translation, Rotation, Scale);
+		glm::setLocalTransform(Hierarchy, Leaf, Translation, Rotation, Scale);
+		std::fill(Moved.begin(), Moved.end(), false);
+		Moved[Leaf] = true;
+
+		Error += glm::updateTransformHierarchy(Hierarchy, ThreadCount) == 1 ? 0 : 1;
+		Error += check_worlds(Hierarchy, Parents, static_cast<T>(0.5), Moved);
+	}
+
+	// Moving a root updates its subtree
+	{
+		glm::uint32 const Root = static_cast<glm::uint32>(NodeCount - 1);
+		glm::vec<3, T, glm::defaultp> Translation, Scale;
+		glm::qua<T, glm::defaultp> Rotation;
+		local_transform(Root, static_cast<T>(0.5), Translation, Rotation, Scale);
+		glm::setLocalTransform(Hierarchy, Root, Translation, Rotation, Scale);
+		Moved[Root] = true;
+
+		std::size_t const Updated = glm::updateTransformHierarchy(Hierarchy, ThreadCount);
+		Error += Updated > NodeCount / 8 && Updated < NodeCount ? 0 : 1;
+		Error += check_worlds(Hierarchy, Parents, static_cast<T>(0.5), Moved);
+	}
+
+	return Error;
+}
+
+static int test_empty()
+{
+	int Error = 0;
+
+	glm::transform_hierarchy Hierarchy;
+	glm::buildTransformHierarchy(Hierarchy, static_cast<glm::uint32 const*>(0), 0);
+	Error += glm::updateTransformHierarchy(Hierarchy) == 0 ? 0 : 1;
+	Error += Hierarchy.Levels.size() == 1 ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_empty();
+	Error += test_update<float>(1);
+	Error += test_update<float>(4);
+	Error += test_update<double>(0);
+
+	return Error;
+}
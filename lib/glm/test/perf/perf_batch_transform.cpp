@@ -0,0 +1,104 @@
+#define GLM_FORCE_INLINE
+#include <glm/ext/batch_transform.hpp>
+#include <glm/ext/matrix_clip_space.hpp>
+#include <glm/ext/matrix_float4x4.hpp>
+#include <glm/ext/vector_float3.hpp>
+#include <glm/ext/vector_float4.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/common.hpp>
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+static int launch_sisd(std::vector<glm::vec3>& O, glm::mat4 const& Transform, std::vector<glm::vec3> const& I)
+{
+	O.resize(I.size());
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0, n = I.size(); i < n; ++i)
+	{
+		glm::vec4 const Clip(Transform * glm::vec4(I[i], 1.0f));
+		O[i] = glm::vec3(Clip) / Clip.w;
+	}
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+static int launch_packed(std::vector<glm::vec3>& O, glm::mat4 const& Transform, std::vector<glm::vec3> const& I)
+{
+	O.resize(I.size());
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	glm::batchProjectPoints(Transform, &I[0], &O[0], I.size());
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+static int launch_soa(std::vector<glm::vec3>& O, glm::mat4 const& Transform, std::vector<glm::vec3> const& I)
+{
+	std::size_t const Samples = I.size();
+
+	std::vector<float> X(Samples), Y(Samples), Z(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		X[i] = I[i].x;
+		Y[i] = I[i].y;
+		Z[i] = I[i].z;
+	}
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	glm::batchProjectPoints(Transform, &X[0], &Y[0], &Z[0], &X[0], &Y[0], &Z[0], Samples);
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	O.resize(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+		O[i] = glm::vec3(X[i], Y[i], Z[i]);
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+int main()
+{
+	std::size_t const Samples = 1000000;
+
+	int Error = 0;
+
+	glm::mat4 const Transform = glm::perspective(0.8f, 1.5f, 0.1f, 100.0f) * glm::mat4(1, 2, 3, 0, 4, 5, 6, 0, 7, 8, 9, 0, 1, 2, -20, 1);
+
+	std::vector<glm::vec3> I(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+		I[i] = glm::vec3(0.01f, 0.02f, 0.03f) * static_cast<float>(i % 1000);
+
+	std::printf("project points:\n");
+
+	std::vector<glm::vec3> SISD;
+	std::printf("- SISD: %d us\n", launch_sisd(SISD, Transform, I));
+
+	std::vector<glm::vec3> Packed;
+	std::printf("- SIMD packed: %d us\n", launch_packed(Packed, Transform, I));
+
+	std::vector<glm::vec3> SoA;
+	std::printf("- SIMD SoA: %d us\n", launch_soa(SoA, Transform, I));
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		// The SIMD path may use FMA and a different summation order, compare relatively to the magnitude of the result
+		glm::vec3 const Epsilon = glm::max(glm::abs(SISD[i]), glm::vec3(1.0f)) * 0.00001f;
+		Error += glm::all(glm::equal(SISD[i], Packed[i], Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(SISD[i], SoA[i], Epsilon)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
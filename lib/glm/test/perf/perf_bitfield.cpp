@@ -0,0 +1,133 @@
+#define GLM_FORCE_INLINE
+#include <glm/gtc/bitfield.hpp>
+#include <glm/integer.hpp>
+#include <glm/ext/vector_int4.hpp>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+template<typename clock>
+static int elapsed(typename clock::time_point Start)
+{
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - Start).count());
+}
+
+// Morton codes of a 1024 x 1024 tile grid, as a spatial sort would compute them
+static int perf_morton(std::size_t Count)
+{
+	int Error = 0;
+
+	std::vector<glm::u16vec2> Coords2(Count);
+	std::vector<glm::u16vec3> Coords3(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Coords2[i] = glm::u16vec2(i % 1024, i / 1024);
+		Coords3[i] = glm::u16vec3(i % 128, (i / 128) % 128, i / 16384);
+	}
+
+	std::printf("%d coordinates:\n", static_cast<int>(Count));
+
+	typedef std::chrono::high_resolution_clock clock;
+
+	std::vector<glm::uint32> Expected2(Count);
+	{
+		clock::time_point const Start = clock::now();
+		for(std::size_t i = 0; i < Count; ++i)
+			Expected2[i] = glm::bitfieldInterleave(Coords2[i]);
+		std::printf("- bitfieldInterleave u16vec2 per coordinate: %d us\n", elapsed<clock>(Start));
+	}
+
+	std::vector<glm::uint32> Codes2(Count);
+	{
+		clock::time_point const Start = clock::now();
+		glm::bitfieldInterleave(&Coords2[0], &Codes2[0], Count);
+		std::printf("- bitfieldInterleave u16vec2 array: %d us\n", elapsed<clock>(Start));
+	}
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += Codes2[i] == Expected2[i] ? 0 : 1;
+
+	std::vector<glm::u16vec2> Result2(Count);
+	{
+		clock::time_point const Start = clock::now();
+		for(std::size_t i = 0; i < Count; ++i)
+			Result2[i] = glm::bitfieldDeinterleave(Codes2[i]);
+		std::printf("- bitfieldDeinterleave uint32 per code: %d us\n", elapsed<clock>(Start));
+	}
+	{
+		clock::time_point const Start = clock::now();
+		glm::bitfieldDeinterleave(&Codes2[0], &Result2[0], Count);
+		std::printf("- bitfieldDeinterleave uint32 array: %d us\n", elapsed<clock>(Start));
+	}
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += Result2[i] == Coords2[i] ? 0 : 1;
+
+	std::vector<glm::uint64> Expected3(Count);
+	{
+		clock::time_point const Start = clock::now();
+		for(std::size_t i = 0; i < Count; ++i)
+			Expected3[i] = glm::bitfieldInterleave(Coords3[i]);
+		std::printf("- bitfieldInterleave u16vec3 per coordinate: %d us\n", elapsed<clock>(Start));
+	}
+
+	std::vector<glm::uint64> Codes3(Count);
+	{
+		clock::time_point const Start = clock::now();
+		glm::bitfieldInterleave(&Coords3[0], &Codes3[0], Count);
+		std::printf("- bitfieldInterleave u16vec3 array: %d us\n", elapsed<clock>(Start));
+	}
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += Codes3[i] == Expected3[i] ? 0 : 1;
+
+	return Error;
+}
+
+template<glm::qualifier Q>
+static int perf_bits(char const* Name, std::size_t Count)
+{
+	int Error = 0;
+
+	std::vector<glm::vec<4, int, Q> > Values(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		int const Hash = static_cast<int>(static_cast<glm::uint>(i) * 2654435761u);
+		Values[i] = glm::vec<4, int, Q>(Hash, Hash >> 3, Hash >> 17, static_cast<int>(i));
+	}
+
+	typedef std::chrono::high_resolution_clock clock;
+
+	glm::vec<4, int, Q> Sum(0);
+	{
+		clock::time_point const Start = clock::now();
+		for(std::size_t i = 0; i < Count; ++i)
+			Sum += glm::findMSB(Values[i]) + glm::findLSB(Values[i]) + glm::bitCount(Values[i]);
+		std::printf("- findMSB, findLSB and bitCount %s: %d us\n", Name, elapsed<clock>(Start));
+	}
+
+	glm::ivec4 Expected(0);
+	for(std::size_t i = 0; i < Count; ++i)
+		for(glm::length_t j = 0; j < 4; ++j)
+			Expected[j] += glm::findMSB(Values[i][j]) + glm::findLSB(Values[i][j]) + glm::bitCount(Values[i][j]);
+
+	for(glm::length_t j = 0; j < 4; ++j)
+		Error += Sum[j] == Expected[j] ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += perf_morton(1 << 20);
+
+	std::printf("%d ivec4:\n", 1 << 20);
+	Error += perf_bits<glm::packed_highp>("packed", 1 << 20);
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		Error += perf_bits<glm::aligned_highp>("aligned", 1 << 20);
+#	endif
+
+	return Error;
+}
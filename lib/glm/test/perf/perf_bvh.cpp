@@ -0,0 +1,155 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/bvh.hpp>
+#include <glm/ext/vector_float3.hpp>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <cstdio>
+
+struct scene
+{
+	std::vector<glm::vec3> Positions;
+	std::vector<glm::uint32> Indices;
+	std::vector<glm::vec3> Origins;
+	std::vector<glm::vec3> Directions;
+	glm::bvh Bvh;
+};
+
+// Height field of Size * Size quads
+static void make_terrain(scene& S, int Size)
+{
+	for(int y = 0; y <= Size; ++y)
+	for(int x = 0; x <= Size; ++x)
+	{
+		float const u = static_cast<float>(x) / static_cast<float>(Size) * 100.0f - 50.0f;
+		float const v = static_cast<float>(y) / static_cast<float>(Size) * 100.0f - 50.0f;
+		S.Positions.push_back(glm::vec3(u, glm::sin(u * 0.3f) * glm::cos(v * 0.2f) * 4.0f + glm::sin(u * 3.1f + v * 2.3f) * 0.2f, v));
+	}
+
+	glm::uint32 const Row = static_cast<glm::uint32>(Size + 1);
+	for(glm::uint32 y = 0; y < static_cast<glm::uint32>(Size); ++y)
+	for(glm::uint32 x = 0; x < static_cast<glm::uint32>(Size); ++x)
+	{
+		glm::uint32 const i = y * Row + x;
+		glm::uint32 const Quad[6] = {i, i + Row, i + 1, i + 1, i + Row, i + Row + 1};
+		S.Indices.insert(S.Indices.end(), Quad, Quad + 6);
+	}
+
+	for(int i = 0; i < 100000; ++i)
+	{
+		float const t = static_cast<float>(i);
+		glm::vec3 const Origin(glm::sin(t * 1.7f) * 40.0f, 20.0f, glm::cos(t * 2.3f) * 40.0f);
+		glm::vec3 const Target(glm::sin(t * 0.7f) * 45.0f, 0.0f, glm::cos(t * 1.1f) * 45.0f);
+		S.Origins.push_back(Origin);
+		S.Directions.push_back(glm::normalize(Target - Origin));
+	}
+}
+
+template<typename clock>
+static int elapsed(typename clock::time_point Start)
+{
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(clock::now() - Start).count());
+}
+
+static void perf_build(scene& S, unsigned ThreadCount)
+{
+	std::chrono::high_resolution_clock::time_point const Start = std::chrono::high_resolution_clock::now();
+	glm::buildBVH(S.Bvh, &S.Positions[0], &S.Indices[0], S.Indices.size() / 3, ThreadCount);
+	int const Time = elapsed<std::chrono::high_resolution_clock>(Start);
+
+	if(ThreadCount == 0)
+		std::printf("- %u hardware threads: %d ms, %d nodes\n", std::thread::hardware_concurrency(), Time, static_cast<int>(S.Bvh.Nodes.size()));
+	else
+		std::printf("- %u thread: %d ms, %d nodes\n", ThreadCount, Time, static_cast<int>(S.Bvh.Nodes.size()));
+}
+
+static void perf_closest(scene& S)
+{
+	std::size_t const BruteCount = 16;
+	std::size_t BruteHits = 0;
+	std::chrono::high_resolution_clock::time_point const BruteStart = std::chrono::high_resolution_clock::now();
+	for(std::size_t r = 0; r < BruteCount; ++r)
+	{
+		float Closest = 1e30f;
+		for(std::size_t i = 0; i < S.Indices.size(); i += 3)
+		{
+			glm::vec2 Bary;
+			float Distance;
+			if(glm::intersectRayTriangle(S.Origins[r], S.Directions[r], S.Positions[S.Indices[i]], S.Positions[S.Indices[i + 1]], S.Positions[S.Indices[i + 2]], Bary, Distance) && Distance >= 0.0f && Distance < Closest)
+				Closest = Distance;
+		}
+		BruteHits += Closest < 1e30f ? 1 : 0;
+	}
+	int const BruteTime = glm::max(elapsed<std::chrono::high_resolution_clock>(BruteStart), 1);
+
+	std::size_t Hits = 0;
+	std::chrono::high_resolution_clock::time_point const Start = std::chrono::high_resolution_clock::now();
+	for(std::size_t r = 0; r < S.Origins.size(); ++r)
+	{
+		glm::uint32 Triangle;
+		glm::vec2 Bary;
+		float Distance;
+		Hits += glm::intersectRayBVH(S.Bvh, S.Origins[r], S.Directions[r], 0.0f, 1e30f, Triangle, Bary, Distance) ? 1 : 0;
+	}
+	int const Time = glm::max(elapsed<std::chrono::high_resolution_clock>(Start), 1);
+
+	std::printf("- brute force: %d rays/s, %d of %d hits\n", static_cast<int>(BruteCount * 1000 / static_cast<std::size_t>(BruteTime)), static_cast<int>(BruteHits), static_cast<int>(BruteCount));
+	std::printf("- intersectRayBVH: %d rays/s, %d of %d hits\n", static_cast<int>(S.Origins.size() * 1000 / static_cast<std::size_t>(Time)), static_cast<int>(Hits), static_cast<int>(S.Origins.size()));
+}
+
+static void perf_any(scene& S)
+{
+	// Shadow rays from above the terrain toward a light
+	std::size_t Hits = 0;
+	glm::vec3 const Light = glm::normalize(glm::vec3(0.3f, 0.2f, 0.1f));
+	std::chrono::high_resolution_clock::time_point const Start = std::chrono::high_resolution_clock::now();
+	for(std::size_t r = 0; r < S.Origins.size(); ++r)
+	{
+		glm::vec3 const Origin(S.Origins[r].x, 1.0f, S.Origins[r].z);
+		Hits += glm::intersectRayBVHAny(S.Bvh, Origin, Light, 0.0f, 1e30f) ? 1 : 0;
+	}
+	int const Time = glm::max(elapsed<std::chrono::high_resolution_clock>(Start), 1);
+
+	std::printf("- intersectRayBVHAny: %d rays/s, %d of %d hits\n", static_cast<int>(S.Origins.size() * 1000 / static_cast<std::size_t>(Time)), static_cast<int>(Hits), static_cast<int>(S.Origins.size()));
+}
+
+static void perf_overlap(scene& S)
+{
+	std::vector<glm::uint32> Triangles;
+	std::size_t BoxCount = 0;
+	std::size_t SphereCount = 0;
+	std::chrono::high_resolution_clock::time_point const Start = std::chrono::high_resolution_clock::now();
+	for(std::size_t q = 0; q < S.Origins.size(); ++q)
+	{
+		glm::vec3 const Center(S.Origins[q].x, 0.0f, S.Origins[q].z);
+		Triangles.clear();
+		BoxCount += glm::overlapBVHAABB(S.Bvh, Center - glm::vec3(0.5f), Center + glm::vec3(0.5f), Triangles);
+		Triangles.clear();
+		SphereCount += glm::overlapBVHSphere(S.Bvh, Center, 0.5f, Triangles);
+	}
+	int const Time = glm::max(elapsed<std::chrono::high_resolution_clock>(Start), 1);
+
+	std::printf("- overlapBVHAABB and overlapBVHSphere: %d query pairs/s, %d and %d triangles\n", static_cast<int>(S.Origins.size() * 1000 / static_cast<std::size_t>(Time)), static_cast<int>(BoxCount), static_cast<int>(SphereCount));
+}
+
+int main()
+{
+	scene S;
+	make_terrain(S, 708);
+
+	std::printf("buildBVH of %d triangles:\n", static_cast<int>(S.Indices.size() / 3));
+	perf_build(S, 1);
+	perf_build(S, 0);
+
+	std::printf("closest hit:\n");
+	perf_closest(S);
+
+	std::printf("any hit:\n");
+	perf_any(S);
+
+	std::printf("overlap:\n");
+	perf_overlap(S);
+
+	return 0;
+}
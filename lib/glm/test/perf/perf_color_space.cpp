@@ -0,0 +1,106 @@
+#define GLM_FORCE_INLINE
+#include <glm/gtc/color_space.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+template<typename clock>
+static int elapsed(typename clock::time_point Start)
+{
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - Start).count());
+}
+
+static void print(char const* Name, std::size_t Pixels, int Time)
+{
+	std::printf("- %s: %d us, %.1f MP/s\n", Name, Time, static_cast<double>(Pixels) / static_cast<double>(Time > 0 ? Time : 1));
+}
+
+// A 1080p frame converted row by row, as an image loader or a tone mapper would
+static int perf_color_space(std::size_t Width, std::size_t Height)
+{
+	int Error = 0;
+
+	std::size_t const Pixels = Width * Height;
+	std::vector<glm::vec4> Linear(Pixels);
+	for(std::size_t i = 0; i < Pixels; ++i)
+		Linear[i] = glm::vec4(static_cast<float>(i % Width) / static_cast<float>(Width), static_cast<float>(i % 4099) / 4099.0f, static_cast<float>(i % 257) / 256.0f, 1.0f);
+
+	std::printf("%dx%d frame:\n", static_cast<int>(Width), static_cast<int>(Height));
+
+	typedef std::chrono::high_resolution_clock clock;
+
+	std::vector<glm::vec4> Expected(Pixels);
+	{
+		clock::time_point const Start = clock::now();
+		for(std::size_t i = 0; i < Pixels; ++i)
+			Expected[i] = glm::convertLinearToSRGB(Linear[i]);
+		print("convertLinearToSRGB per pixel", Pixels, elapsed<clock>(Start));
+	}
+
+	std::vector<glm::vec4> SRGB(Pixels);
+	{
+		clock::time_point const Start = clock::now();
+		for(std::size_t y = 0; y < Height; ++y)
+			glm::convertLinearToSRGB(&Linear[y * Width], &SRGB[y * Width], Width);
+		print("convertLinearToSRGB rows", Pixels, elapsed<clock>(Start));
+	}
+
+	// The per pixel function uses the 0.41666 gamma approximation
+	for(std::size_t i = 0; i < Pixels; ++i)
+		Error += glm::all(glm::equal(SRGB[i], Expected[i], 0.0001f)) ? 0 : 1;
+
+	std::vector<glm::u8vec4> SRGB8(Pixels);
+	{
+		clock::time_point const Start = clock::now();
+		for(std::size_t y = 0; y < Height; ++y)
+			glm::convertLinearToSRGB(&Linear[y * Width], &SRGB8[y * Width], Width);
+		print("convertLinearToSRGB 8 bit rows", Pixels, elapsed<clock>(Start));
+	}
+
+	{
+		clock::time_point const Start = clock::now();
+		for(std::size_t i = 0; i < Pixels; ++i)
+			Expected[i] = glm::convertSRGBToLinear(SRGB[i]);
+		print("convertSRGBToLinear per pixel", Pixels, elapsed<clock>(Start));
+	}
+
+	std::vector<glm::vec4> Result(Pixels);
+	{
+		clock::time_point const Start = clock::now();
+		for(std::size_t y = 0; y < Height; ++y)
+			glm::convertSRGBToLinear(&SRGB[y * Width], &Result[y * Width], Width);
+		print("convertSRGBToLinear rows", Pixels, elapsed<clock>(Start));
+	}
+
+	for(std::size_t i = 0; i < Pixels; ++i)
+		Error += glm::all(glm::equal(Result[i], Expected[i], 0.0001f)) ? 0 : 1;
+
+	{
+		clock::time_point const Start = clock::now();
+		for(std::size_t i = 0; i < Pixels; ++i)
+			Expected[i] = glm::convertSRGBToLinear(glm::vec4(SRGB8[i]) / 255.0f);
+		print("convertSRGBToLinear 8 bit per pixel", Pixels, elapsed<clock>(Start));
+	}
+
+	{
+		clock::time_point const Start = clock::now();
+		for(std::size_t y = 0; y < Height; ++y)
+			glm::convertSRGBToLinear(&SRGB8[y * Width], &Result[y * Width], Width);
+		print("convertSRGBToLinear 8 bit rows", Pixels, elapsed<clock>(Start));
+	}
+
+	for(std::size_t i = 0; i < Pixels; ++i)
+		Error += glm::all(glm::equal(Result[i], Expected[i], 0.0001f)) ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += perf_color_space(1920, 1080);
+
+	return Error;
+}
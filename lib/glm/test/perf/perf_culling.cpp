@@ -0,0 +1,133 @@
+#define GLM_FORCE_INLINE
+#include <glm/ext/culling.hpp>
+#include <glm/ext/matrix_clip_space.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/ext/vector_float3.hpp>
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+struct scene
+{
+	glm::vec4 Planes[6];
+	std::vector<float> x, y, z, r;
+	std::vector<float> MinX, MinY, MinZ, MaxX, MaxY, MaxZ;
+	std::vector<glm::uint32> Visible;
+	std::size_t VisibleCount;
+};
+
+static void spheres_sisd(scene& S)
+{
+	std::size_t const Count = S.x.size();
+	S.VisibleCount = 0;
+	for(std::size_t i = 0; i < Count; i += 32)
+	{
+		glm::uint32 Mask = 0;
+		for(std::size_t j = 0; j < 32 && i + j < Count; ++j)
+		{
+			glm::vec3 const Center(S.x[i + j], S.y[i + j], S.z[i + j]);
+			bool Inside = true;
+			for(int p = 0; p < 6; ++p)
+				Inside = Inside && glm::dot(glm::vec3(S.Planes[p]), Center) + S.Planes[p].w >= -S.r[i + j];
+			Mask |= static_cast<glm::uint32>(Inside) << j;
+			S.VisibleCount += Inside ? 1 : 0;
+		}
+		S.Visible[i / 32] = Mask;
+	}
+}
+
+static void spheres_simd(scene& S)
+{
+	S.VisibleCount = glm::cullSpheres(S.Planes, &S.x[0], &S.y[0], &S.z[0], &S.r[0], &S.Visible[0], S.x.size());
+}
+
+static void aabbs_sisd(scene& S)
+{
+	std::size_t const Count = S.MinX.size();
+	S.VisibleCount = 0;
+	for(std::size_t i = 0; i < Count; i += 32)
+	{
+		glm::uint32 Mask = 0;
+		for(std::size_t j = 0; j < 32 && i + j < Count; ++j)
+		{
+			std::size_t const k = i + j;
+			bool Inside = true;
+			for(int p = 0; p < 6; ++p)
+			{
+				glm::vec3 const Corner(
+					S.Planes[p].x >= 0.0f ? S.MaxX[k] : S.MinX[k],
+					S.Planes[p].y >= 0.0f ? S.MaxY[k] : S.MinY[k],
+					S.Planes[p].z >= 0.0f ? S.MaxZ[k] : S.MinZ[k]);
+				Inside = Inside && glm::dot(glm::vec3(S.Planes[p]), Corner) + S.Planes[p].w >= 0.0f;
+			}
+			Mask |= static_cast<glm::uint32>(Inside) << j;
+			S.VisibleCount += Inside ? 1 : 0;
+		}
+		S.Visible[i / 32] = Mask;
+	}
+}
+
+static void aabbs_simd(scene& S)
+{
+	S.VisibleCount = glm::cullAABBs(S.Planes, &S.MinX[0], &S.MinY[0], &S.MinZ[0], &S.MaxX[0], &S.MaxY[0], &S.MaxZ[0], &S.Visible[0], S.MinX.size());
+}
+
+static int launch(void (*Func)(scene&), scene& S)
+{
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	Func(S);
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+static void compare(char const* Name, void (*SISD)(scene&), void (*SIMD)(scene&), scene& S)
+{
+	std::printf("%s:\n", Name);
+
+	int const TimeSISD = launch(SISD, S);
+	std::printf("- SISD: %d us, %d visible\n", TimeSISD, static_cast<int>(S.VisibleCount));
+	int const TimeSIMD = launch(SIMD, S);
+	std::printf("- SIMD: %d us, %d visible\n", TimeSIMD, static_cast<int>(S.VisibleCount));
+}
+
+int main()
+{
+	std::size_t const Count = 200000;
+
+	scene S;
+	glm::frustumPlanes(glm::perspective(1.0f, 1.5f, 0.5f, 500.0f) * glm::lookAt(glm::vec3(0), glm::vec3(0, 0, -1), glm::vec3(0, 1, 0)), S.Planes);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		float const t = static_cast<float>(i);
+		glm::vec3 const Center(glm::sin(t * 1.7f) * 400.0f, glm::cos(t * 0.9f) * 100.0f, glm::sin(t * 0.3f) * 500.0f);
+		float const Radius = 0.5f + glm::mod(t, 8.0f);
+
+		S.x.push_back(Center.x);
+		S.y.push_back(Center.y);
+		S.z.push_back(Center.z);
+		S.r.push_back(Radius);
+		S.MinX.push_back(Center.x - Radius);
+		S.MinY.push_back(Center.y - Radius);
+		S.MinZ.push_back(Center.z - Radius);
+		S.MaxX.push_back(Center.x + Radius);
+		S.MaxY.push_back(Center.y + Radius);
+		S.MaxZ.push_back(Center.z + Radius);
+	}
+	S.Visible.resize((Count + 31) / 32);
+
+	compare("cullSpheres", spheres_sisd, spheres_simd, S);
+	compare("cullAABBs", aabbs_sisd, aabbs_simd, S);
+
+	return 0;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
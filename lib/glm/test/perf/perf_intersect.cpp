@@ -0,0 +1,148 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/intersect.hpp>
+#include <glm/ext/vector_float3.hpp>
+#include <glm/integer.hpp>
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+static glm::length_t const Lanes = 8;
+#else
+static glm::length_t const Lanes = 4;
+#endif
+
+typedef glm::soa_vec<3, float, Lanes> soa_vec3;
+typedef glm::soa_vec<2, float, Lanes> soa_vec2;
+typedef glm::soa_scalar<float, Lanes> soa_float;
+
+struct scene
+{
+	glm::vec3 Orig, Dir, InvDir;
+	std::vector<glm::vec3> Vert0, Vert1, Vert2;
+	std::vector<glm::vec3> BoxMin, BoxMax;
+	std::size_t Hits;
+	float Closest;
+};
+
+static void triangles_sisd(scene& S)
+{
+	S.Hits = 0;
+	S.Closest = 1e30f;
+	for(std::size_t i = 0; i < S.Vert0.size(); ++i)
+	{
+		glm::vec2 Bary;
+		float Distance;
+		if(glm::intersectRayTriangle(S.Orig, S.Dir, S.Vert0[i], S.Vert1[i], S.Vert2[i], Bary, Distance) && Distance > 0.0f)
+		{
+			++S.Hits;
+			S.Closest = glm::min(S.Closest, Distance);
+		}
+	}
+}
+
+static void triangles_simd(scene& S)
+{
+	S.Hits = 0;
+	S.Closest = 1e30f;
+	for(std::size_t i = 0; i < S.Vert0.size(); i += Lanes)
+	{
+		soa_vec2 Bary;
+		soa_float Distance;
+		int const Mask = glm::intersectRayTriangle(S.Orig, S.Dir, soa_vec3::load(&S.Vert0[i]), soa_vec3::load(&S.Vert1[i]), soa_vec3::load(&S.Vert2[i]), Bary, Distance)
+			& glm::greaterThanMask(Distance, soa_float(0.0f));
+		for(int Bits = Mask; Bits; Bits &= Bits - 1)
+		{
+			++S.Hits;
+			S.Closest = glm::min(S.Closest, Distance[glm::findLSB(Bits)]);
+		}
+	}
+}
+
+static void boxes_sisd(scene& S)
+{
+	S.Hits = 0;
+	S.Closest = 1e30f;
+	for(std::size_t i = 0; i < S.BoxMin.size(); ++i)
+	{
+		float Distance;
+		if(glm::intersectRayAABB(S.Orig, S.InvDir, S.BoxMin[i], S.BoxMax[i], 0.0f, 1e30f, Distance))
+		{
+			++S.Hits;
+			S.Closest = glm::min(S.Closest, Distance);
+		}
+	}
+}
+
+static void boxes_simd(scene& S)
+{
+	S.Hits = 0;
+	S.Closest = 1e30f;
+	for(std::size_t i = 0; i < S.BoxMin.size(); i += Lanes)
+	{
+		soa_float Distance;
+		int const Mask = glm::intersectRayAABB(S.Orig, S.InvDir, soa_vec3::load(&S.BoxMin[i]), soa_vec3::load(&S.BoxMax[i]), 0.0f, 1e30f, Distance);
+		for(int Bits = Mask; Bits; Bits &= Bits - 1)
+		{
+			++S.Hits;
+			S.Closest = glm::min(S.Closest, Distance[glm::findLSB(Bits)]);
+		}
+	}
+}
+
+static int launch(void (*Func)(scene&), scene& S)
+{
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	Func(S);
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+static void compare(char const* Name, void (*SISD)(scene&), void (*SIMD)(scene&), scene& S)
+{
+	std::printf("%s:\n", Name);
+
+	int const TimeSISD = launch(SISD, S);
+	std::printf("- SISD: %d us, %d hits, closest %f\n", TimeSISD, static_cast<int>(S.Hits), S.Closest);
+	int const TimeSIMD = launch(SIMD, S);
+	std::printf("- SIMD: %d us, %d hits, closest %f\n", TimeSIMD, static_cast<int>(S.Hits), S.Closest);
+}
+
+int main()
+{
+	std::size_t const Count = 1 << 20;
+
+	scene S;
+	S.Orig = glm::vec3(0.1f, 0.2f, 10.0f);
+	S.Dir = glm::normalize(glm::vec3(0.01f, -0.02f, -1.0f));
+	S.InvDir = 1.0f / S.Dir;
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		float const t = static_cast<float>(i);
+		glm::vec3 const Center(glm::sin(t * 1.7f) * 2.0f, glm::cos(t * 0.9f) * 2.0f, glm::sin(t * 0.3f) * 5.0f);
+		glm::vec3 const Extent(0.2f + glm::mod(t, 3.0f) * 0.3f);
+
+		S.Vert0.push_back(Center + glm::vec3(-Extent.x, -Extent.y, 0.0f));
+		S.Vert1.push_back(Center + glm::vec3(Extent.x, -Extent.y, 0.1f));
+		S.Vert2.push_back(Center + glm::vec3(0.0f, Extent.y, -0.1f));
+		S.BoxMin.push_back(Center - Extent);
+		S.BoxMax.push_back(Center + Extent);
+	}
+
+	compare("intersectRayTriangle", triangles_sisd, triangles_simd, S);
+	compare("intersectRayAABB", boxes_sisd, boxes_simd, S);
+
+	return 0;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
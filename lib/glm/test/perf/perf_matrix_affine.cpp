@@ -0,0 +1,154 @@
+#define GLM_FORCE_INLINE
+#include <glm/ext/matrix_affine.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/gtc/matrix_inverse.hpp>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+// Local and parent world transforms of a scene graph
+static void init_transforms(std::vector<glm::mat4>& Local, std::vector<glm::mat4>& Parent, std::size_t Samples)
+{
+	Local.resize(Samples);
+	Parent.resize(Samples);
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		float const t = static_cast<float>(i) * 0.001f;
+		glm::mat4 const Translate = glm::translate(glm::mat4(1.0f), glm::vec3(t, -2.0f * t, 1.0f));
+		Local[i] = glm::scale(glm::rotate(Translate, t, glm::vec3(0.48f, 0.6f, 0.64f)), glm::vec3(1.0f + t, 2.0f, 0.5f));
+		Parent[i] = glm::rotate(Translate, -t, glm::vec3(0.6f, 0.0f, 0.8f));
+	}
+}
+
+template<typename matType>
+static int launch_mat4_compose(std::vector<glm::mat4> const& Local, std::vector<glm::mat4> const& Parent, std::vector<glm::mat4>& World)
+{
+	std::vector<matType> const L(Local.begin(), Local.end());
+	std::vector<matType> const P(Parent.begin(), Parent.end());
+	std::vector<matType> W(L.size());
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0, n = L.size(); i < n; ++i)
+		W[i] = P[i] * L[i];
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	World.assign(W.begin(), W.end());
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+static int launch_affine_compose(std::vector<glm::mat4> const& Local, std::vector<glm::mat4> const& Parent, std::vector<glm::mat4>& World)
+{
+	std::vector<glm::mat3x4> L(Local.size());
+	std::vector<glm::mat3x4> P(Parent.size());
+	std::vector<glm::mat3x4> W(L.size());
+	for(std::size_t i = 0; i < L.size(); ++i)
+	{
+		L[i] = glm::mat3x4_cast(Local[i]);
+		P[i] = glm::mat3x4_cast(Parent[i]);
+	}
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	glm::affineCompose(&P[0], &L[0], &W[0], W.size());
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	World.resize(W.size());
+	for(std::size_t i = 0; i < W.size(); ++i)
+		World[i] = glm::mat4_cast(W[i]);
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+template<typename matType>
+static int launch_mat4_inverse(std::vector<glm::mat4> const& Local, std::vector<glm::mat4>& Inverse)
+{
+	std::vector<matType> const L(Local.begin(), Local.end());
+	std::vector<matType> I(L.size());
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0, n = L.size(); i < n; ++i)
+		I[i] = glm::affineInverse(L[i]);
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	Inverse.assign(I.begin(), I.end());
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+static int launch_affine_inverse(std::vector<glm::mat4> const& Local, std::vector<glm::mat4>& Inverse)
+{
+	std::vector<glm::mat3x4> L(Local.size());
+	std::vector<glm::mat3x4> I(L.size());
+	for(std::size_t i = 0; i < L.size(); ++i)
+		L[i] = glm::mat3x4_cast(Local[i]);
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0, n = L.size(); i < n; ++i)
+		I[i] = glm::affineInverse(L[i]);
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	Inverse.resize(I.size());
+	for(std::size_t i = 0; i < I.size(); ++i)
+		Inverse[i] = glm::mat4_cast(I[i]);
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+static int comp_results(std::vector<glm::mat4> const& A, std::vector<glm::mat4> const& B)
+{
+	int Error = 0;
+
+	for(std::size_t i = 0; i < A.size(); ++i)
+		Error += glm::all(glm::equal(A[i], B[i], 0.001f)) ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	std::size_t const Samples = 500000;
+
+	int Error = 0;
+
+	std::vector<glm::mat4> Local, Parent;
+	init_transforms(Local, Parent, Samples);
+
+	{
+		std::vector<glm::mat4> Packed, Affine;
+
+		std::printf("Compose %d world matrices:\n", static_cast<int>(Samples));
+		std::printf("- mat4 * mat4: %d us\n", launch_mat4_compose<glm::mat4>(Local, Parent, Packed));
+#		if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		{
+			std::vector<glm::mat4> Aligned;
+			std::printf("- aligned_mat4 * aligned_mat4: %d us\n", launch_mat4_compose<glm::aligned_mat4>(Local, Parent, Aligned));
+			Error += comp_results(Packed, Aligned);
+		}
+#		endif
+		std::printf("- affineCompose(mat3x4): %d us\n", launch_affine_compose(Local, Parent, Affine));
+		Error += comp_results(Packed, Affine);
+	}
+
+	{
+		std::vector<glm::mat4> Packed, Affine;
+
+		std::printf("Invert %d affine matrices:\n", static_cast<int>(Samples));
+		std::printf("- affineInverse(mat4): %d us\n", launch_mat4_inverse<glm::mat4>(Local, Packed));
+#		if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		{
+			std::vector<glm::mat4> Aligned;
+			std::printf("- affineInverse(aligned_mat4): %d us\n", launch_mat4_inverse<glm::aligned_mat4>(Local, Aligned));
+			Error += comp_results(Packed, Aligned);
+		}
+#		endif
+		std::printf("- affineInverse(mat3x4): %d us\n", launch_affine_inverse(Local, Affine));
+		Error += comp_results(Packed, Affine);
+	}
+
+	return Error;
+}
@@ -0,0 +1,124 @@
+#define GLM_FORCE_INLINE
+#include <glm/matrix.hpp>
+#include <glm/gtc/matrix_inverse.hpp>
+#include <glm/ext/matrix_float3x3.hpp>
+#include <glm/ext/matrix_float4x4.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#include <glm/gtc/type_aligned.hpp>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+template <typename inType, typename outType>
+static int launch_mat_func(outType (*Func)(inType const&), std::vector<outType>& O, std::size_t Samples)
+{
+	std::vector<inType> I(Samples);
+	O.resize(Samples);
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		float const t = static_cast<float>(i) * 0.001f;
+		glm::mat4 const Translate = glm::translate(glm::mat4(1.0f), glm::vec3(t, -2.0f * t, 1.0f));
+		glm::mat4 const Rotate = glm::rotate(Translate, t, glm::vec3(0.48f, 0.6f, 0.64f));
+		I[i] = inType(glm::scale(Rotate, glm::vec3(1.0f + t, 2.0f, 0.5f)));
+	}
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+		O[i] = Func(I[i]);
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+template <typename refType, typename outType>
+static int comp_mat_results(std::vector<refType> const& A, std::vector<outType> const& B)
+{
+	int Error = 0;
+
+	for(std::size_t i = 0; i < A.size(); ++i)
+		Error += glm::all(glm::equal(A[i], refType(B[i]), 0.001f)) ? 0 : 1;
+
+	return Error;
+}
+
+static glm::mat3 inverse_transpose_mat3_scalar(glm::mat3 const& m){return glm::transpose(glm::inverse(m));}
+static glm::mat3 inverse_transpose_mat3(glm::mat3 const& m){return glm::inverseTranspose(m);}
+static glm::aligned_mat3 inverse_transpose_aligned_mat3(glm::aligned_mat3 const& m){return glm::inverseTranspose(m);}
+
+static glm::mat4 inverse_transpose_mat4(glm::mat4 const& m){return glm::inverseTranspose(m);}
+static glm::aligned_mat4 inverse_transpose_aligned_mat4(glm::aligned_mat4 const& m){return glm::inverseTranspose(m);}
+
+static glm::mat3 normal_matrix_scalar(glm::mat4 const& m){return glm::inverseTranspose(glm::mat3(m));}
+static glm::mat3 normal_matrix_mat4(glm::mat4 const& m){return glm::normalMatrix(m);}
+static glm::aligned_mat3 normal_matrix_aligned_mat4(glm::aligned_mat4 const& m){return glm::normalMatrix(m);}
+
+static glm::mat4 inverse_mat4(glm::mat4 const& m){return glm::inverse(m);}
+static glm::mat4 affine_inverse_mat4(glm::mat4 const& m){return glm::affineInverse(m);}
+static glm::aligned_mat4 affine_inverse_aligned_mat4(glm::aligned_mat4 const& m){return glm::affineInverse(m);}
+
+int main()
+{
+	std::size_t const Samples = 100000;
+
+	int Error = 0;
+
+	{
+		std::vector<glm::mat3> Ref, Packed;
+		std::vector<glm::aligned_mat3> Aligned;
+
+		std::printf("glm::inverseTranspose(mat3):\n");
+		std::printf("- transpose(inverse(mat3)): %d us\n", launch_mat_func(inverse_transpose_mat3_scalar, Ref, Samples));
+		std::printf("- packed: %d us\n", launch_mat_func(inverse_transpose_mat3, Packed, Samples));
+		std::printf("- aligned: %d us\n", launch_mat_func(inverse_transpose_aligned_mat3, Aligned, Samples));
+		Error += comp_mat_results(Ref, Packed);
+		Error += comp_mat_results(Ref, Aligned);
+	}
+
+	{
+		std::vector<glm::mat4> Packed;
+		std::vector<glm::aligned_mat4> Aligned;
+
+		std::printf("glm::inverseTranspose(mat4):\n");
+		std::printf("- packed: %d us\n", launch_mat_func(inverse_transpose_mat4, Packed, Samples));
+		std::printf("- aligned: %d us\n", launch_mat_func(inverse_transpose_aligned_mat4, Aligned, Samples));
+		Error += comp_mat_results(Packed, Aligned);
+	}
+
+	{
+		std::vector<glm::mat3> Ref, Packed;
+		std::vector<glm::aligned_mat3> Aligned;
+
+		std::printf("glm::normalMatrix(mat4):\n");
+		std::printf("- inverseTranspose(mat3(mat4)): %d us\n", launch_mat_func(normal_matrix_scalar, Ref, Samples));
+		std::printf("- packed: %d us\n", launch_mat_func(normal_matrix_mat4, Packed, Samples));
+		std::printf("- aligned: %d us\n", launch_mat_func(normal_matrix_aligned_mat4, Aligned, Samples));
+		Error += comp_mat_results(Ref, Packed);
+		Error += comp_mat_results(Ref, Aligned);
+	}
+
+	{
+		std::vector<glm::mat4> Ref, Packed;
+		std::vector<glm::aligned_mat4> Aligned;
+
+		std::printf("glm::affineInverse(mat4):\n");
+		std::printf("- inverse(mat4): %d us\n", launch_mat_func(inverse_mat4, Ref, Samples));
+		std::printf("- packed: %d us\n", launch_mat_func(affine_inverse_mat4, Packed, Samples));
+		std::printf("- aligned: %d us\n", launch_mat_func(affine_inverse_aligned_mat4, Aligned, Samples));
+		Error += comp_mat_results(Ref, Packed);
+		Error += comp_mat_results(Ref, Aligned);
+	}
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
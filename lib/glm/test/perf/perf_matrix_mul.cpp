@@ -39,6 +39,25 @@ static int launch_mat_mul_mat(std::vector<matType>& O, matType const& Transform,
 	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
 }
 
+template <typename matType>
+static int launch_mat_arithmetic(std::vector<matType>& O, matType const& Transform, matType const& Scale, std::size_t Samples)
+{
+	typedef typename matType::value_type T;
+
+	std::vector<matType> I(Samples);
+	O.resize(Samples);
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		I[i] = Scale * static_cast<T>(i);
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+		O[i] = (Transform + I[i]) * static_cast<T>(0.5) - I[i];
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
 template <typename packedMatType, typename alignedMatType>
 static int comp_mat2_mul_mat2(std::size_t Samples)
 {
@@ -94,8 +113,6 @@ static int comp_mat3_mul_mat3(std::size_t Samples)
 template <typename packedMatType, typename alignedMatType>
 static int comp_mat4_mul_mat4(std::size_t Samples)
 {
-	typedef typename packedMatType::value_type T;
-	
 	int Error = 0;
 
 	packedMatType const Transform(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16);
@@ -111,12 +128,39 @@ static int comp_mat4_mul_mat4(std::size_t Samples)
 	{
 		packedMatType const A = SISD[i];
 		packedMatType const B = SIMD[i];
-		Error += glm::all(glm::equal(A, B, static_cast<T>(0.001))) ? 0 : 1;
+		// Values reach 1e5 and the SIMD path may use FMA, compare in ULPs rather than with an absolute epsilon
+		Error += glm::all(glm::equal(A, B, 4)) ? 0 : 1;
 	}
 	
 	return Error;
 }
 
+template <typename packedMatType, typename alignedMatType>
+static int comp_mat4_arithmetic(std::size_t Samples)
+{
+	typedef typename packedMatType::value_type T;
+
+	int Error = 0;
+
+	packedMatType const Transform(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16);
+	packedMatType const Scale(0.01, 0.02, 0.03, 0.05, 0.01, 0.02, 0.03, 0.05, 0.01, 0.02, 0.03, 0.05, 0.01, 0.02, 0.03, 0.05);
+
+	std::vector<packedMatType> SISD;
+	std::printf("- SISD: %d us\n", launch_mat_arithmetic<packedMatType>(SISD, Transform, Scale, Samples));
+
+	std::vector<alignedMatType> SIMD;
+	std::printf("- SIMD: %d us\n", launch_mat_arithmetic<alignedMatType>(SIMD, Transform, Scale, Samples));
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		packedMatType const A = SISD[i];
+		packedMatType const B = SIMD[i];
+		Error += glm::all(glm::equal(A, B, static_cast<T>(0.001))) ? 0 : 1;
+	}
+
+	return Error;
+}
+
 int main()
 {
 	std::size_t const Samples = 100000;
@@ -141,6 +185,9 @@ int main()
 	std::printf("dmat4 * dmat4:\n");
 	Error += comp_mat4_mul_mat4<glm::dmat4, glm::aligned_dmat4>(Samples);
 
+	std::printf("(mat4 + mat4) * float - mat4:\n");
+	Error += comp_mat4_arithmetic<glm::mat4, glm::aligned_mat4>(Samples);
+
 	return Error;
 }
 
@@ -0,0 +1,112 @@
+#define GLM_FORCE_INLINE
+#include <glm/gtc/noise.hpp>
+#include <glm/ext/vector_float2.hpp>
+#include <glm/ext/vector_float3.hpp>
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+template<typename vecType>
+static void perlin_sisd(vecType const* In, float* Out, std::size_t Count)
+{
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = glm::perlin(In[i]);
+}
+
+template<typename vecType>
+static void simplex_sisd(vecType const* In, float* Out, std::size_t Count)
+{
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = glm::simplex(In[i]);
+}
+
+template<typename vecType>
+static void fbm_sisd(vecType const* In, float* Out, std::size_t Count)
+{
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = glm::simplexFbm(In[i], 6);
+}
+
+template<typename vecType>
+static void perlin_simd(vecType const* In, float* Out, std::size_t Count)
+{
+	glm::perlin(In, Out, Count);
+}
+
+template<typename vecType>
+static void simplex_simd(vecType const* In, float* Out, std::size_t Count)
+{
+	glm::simplex(In, Out, Count);
+}
+
+template<typename vecType>
+static void fbm_simd(vecType const* In, float* Out, std::size_t Count)
+{
+	glm::simplexFbm(In, Out, Count, 6);
+}
+
+template<typename vecType>
+static int launch(void (*Func)(vecType const*, float*, std::size_t), std::vector<float>& O, std::vector<vecType> const& I)
+{
+	O.resize(I.size());
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	Func(&I[0], &O[0], I.size());
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+// With FMA contraction the scalar version rounds differently and a few points pick another gradient
+template<typename vecType>
+static int compare(char const* Name, void (*SISD)(vecType const*, float*, std::size_t), void (*SIMD)(vecType const*, float*, std::size_t), std::vector<vecType> const& I)
+{
+	std::printf("%s:\n", Name);
+
+	std::vector<float> OutSISD;
+	std::printf("- SISD: %d us\n", launch(SISD, OutSISD, I));
+
+	std::vector<float> OutSIMD;
+	std::printf("- SIMD: %d us\n", launch(SIMD, OutSIMD, I));
+
+	std::size_t Mismatch = 0;
+	for(std::size_t i = 0; i < I.size(); ++i)
+		Mismatch += glm::abs(OutSISD[i] - OutSIMD[i]) <= 1e-4f ? 0 : 1;
+
+	return Mismatch <= I.size() / 16 ? 0 : 1;
+}
+
+int main()
+{
+	std::size_t const Samples = 1 << 20;
+
+	std::vector<glm::vec2> Points2(Samples);
+	std::vector<glm::vec3> Points3(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		float const x = static_cast<float>(i % 1024) * 0.0625f;
+		float const y = static_cast<float>(i / 1024) * 0.0625f;
+		Points2[i] = glm::vec2(x, y);
+		Points3[i] = glm::vec3(x, y, x * 0.5f - y);
+	}
+
+	int Error = 0;
+
+	Error += compare("perlin vec2", perlin_sisd<glm::vec2>, perlin_simd<glm::vec2>, Points2);
+	Error += compare("perlin vec3", perlin_sisd<glm::vec3>, perlin_simd<glm::vec3>, Points3);
+	Error += compare("simplex vec2", simplex_sisd<glm::vec2>, simplex_simd<glm::vec2>, Points2);
+	Error += compare("simplex vec3", simplex_sisd<glm::vec3>, simplex_simd<glm::vec3>, Points3);
+	Error += compare("simplexFbm vec2, 6 octaves", fbm_sisd<glm::vec2>, fbm_simd<glm::vec2>, Points2);
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
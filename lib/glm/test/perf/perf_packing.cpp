@@ -0,0 +1,137 @@
+#define GLM_FORCE_INLINE
+#include <glm/gtc/packing.hpp>
+#include <glm/ext/vector_float3.hpp>
+#include <glm/ext/vector_float4.hpp>
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+template<typename genIn, typename genOut>
+static int launch(void (*Func)(genIn const*, genOut*, std::size_t), std::vector<genOut>& O, std::vector<genIn> const& I)
+{
+	O.resize(I.size());
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	Func(&I[0], &O[0], I.size());
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+template<typename genIn, typename genOut>
+static int compare(char const* Name, void (*SISD)(genIn const*, genOut*, std::size_t), void (*SIMD)(genIn const*, genOut*, std::size_t), std::vector<genIn> const& I)
+{
+	int Error = 0;
+
+	std::printf("%s:\n", Name);
+
+	std::vector<genOut> OutSISD;
+	std::printf("- SISD: %d us\n", launch(SISD, OutSISD, I));
+
+	std::vector<genOut> OutSIMD;
+	std::printf("- SIMD: %d us\n", launch(SIMD, OutSIMD, I));
+
+	for(std::size_t i = 0; i < I.size(); ++i)
+		Error += OutSISD[i] == OutSIMD[i] ? 0 : 1;
+
+	return Error;
+}
+
+static void packHalf_sisd(float const* In, glm::uint16* Out, std::size_t Count)
+{
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = static_cast<glm::uint16>(glm::detail::toFloat16(In[i]));
+}
+
+static void unpackHalf_sisd(glm::uint16 const* In, float* Out, std::size_t Count)
+{
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = glm::detail::toFloat32(static_cast<glm::detail::hdata>(In[i]));
+}
+
+static void packUnorm8_sisd(float const* In, glm::uint8* Out, std::size_t Count)
+{
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = glm::packUnorm1x8(In[i]);
+}
+
+static void packSnorm16_sisd(float const* In, glm::uint16* Out, std::size_t Count)
+{
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = glm::packSnorm1x16(In[i]);
+}
+
+static void packSnorm16_simd(float const* In, glm::uint16* Out, std::size_t Count)
+{
+	glm::packSnorm(In, reinterpret_cast<glm::int16*>(Out), Count);
+}
+
+static void unpackUnorm8_sisd(glm::uint8 const* In, float* Out, std::size_t Count)
+{
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = glm::unpackUnorm1x8(In[i]);
+}
+
+static void packSnorm3x10_1x2_sisd(glm::vec4 const* In, glm::uint32* Out, std::size_t Count)
+{
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = glm::packSnorm3x10_1x2(In[i]);
+}
+
+static void packF2x11_1x10_sisd(glm::vec3 const* In, glm::uint32* Out, std::size_t Count)
+{
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = glm::packF2x11_1x10(In[i]);
+}
+
+static void unpackF2x11_1x10_sisd(glm::uint32 const* In, glm::vec3* Out, std::size_t Count)
+{
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = glm::unpackF2x11_1x10(In[i]);
+}
+
+int main()
+{
+	std::size_t const Samples = 4000000;
+
+	int Error = 0;
+
+	// Values chosen away from rounding ties, where the scalar half conversion rounds up and SIMD rounds to even
+	std::vector<float> Floats(Samples);
+	std::vector<glm::vec3> Colors(Samples);
+	std::vector<glm::vec4> Tangents(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		Floats[i] = (static_cast<float>(i % 4096) - 2048.0f) * 0.0625f;
+		Colors[i] = glm::vec3(static_cast<float>(i % 1000) * 0.01f, static_cast<float>(i % 300) * 0.1f + 0.1f, 4.0f);
+		Tangents[i] = glm::vec4(static_cast<float>(i % 200) * 0.01f - 1.0f, 0.3f, -0.7f, (i & 1) ? 1.0f : -1.0f);
+	}
+
+	std::vector<glm::uint16> Halfs;
+	launch(glm::packHalf, Halfs, Floats);
+	std::vector<glm::uint8> Unorms;
+	launch(glm::packUnorm, Unorms, Floats);
+	std::vector<glm::uint32> Packed;
+	launch(glm::packF2x11_1x10, Packed, Colors);
+
+	Error += compare("packHalf", packHalf_sisd, glm::packHalf, Floats);
+	Error += compare("unpackHalf", unpackHalf_sisd, glm::unpackHalf, Halfs);
+	Error += compare("packUnorm uint8", packUnorm8_sisd, glm::packUnorm, Floats);
+	Error += compare("unpackUnorm uint8", unpackUnorm8_sisd, glm::unpackUnorm, Unorms);
+	Error += compare("packSnorm int16", packSnorm16_sisd, packSnorm16_simd, Floats);
+	Error += compare("packSnorm3x10_1x2", packSnorm3x10_1x2_sisd, glm::packSnorm3x10_1x2, Tangents);
+	Error += compare("packF2x11_1x10", packF2x11_1x10_sisd, glm::packF2x11_1x10, Colors);
+	Error += compare("unpackF2x11_1x10", unpackF2x11_1x10_sisd, glm::unpackF2x11_1x10, Packed);
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
@@ -0,0 +1,128 @@
+#define GLM_FORCE_INLINE
+#include <glm/ext/quaternion_soa.hpp>
+#include <glm/ext/quaternion_common.hpp>
+#include <glm/ext/quaternion_float.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/gtc/random.hpp>
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+struct pose
+{
+	std::vector<glm::quat> x, y, q;
+	std::vector<glm::mat4> Mat4;
+	std::vector<glm::mat3x4> Mat3x4;
+};
+
+static void slerp_sisd(pose& P)
+{
+	for(std::size_t i = 0; i < P.q.size(); ++i)
+		P.q[i] = glm::slerp(P.x[i], P.y[i], 0.3f);
+}
+
+static void slerp_simd(pose& P)
+{
+	glm::slerp(&P.x[0], &P.y[0], 0.3f, &P.q[0], P.q.size());
+}
+
+static void nlerp_sisd(pose& P)
+{
+	for(std::size_t i = 0; i < P.q.size(); ++i)
+		P.q[i] = glm::normalize(glm::lerp(P.x[i], glm::dot(P.x[i], P.y[i]) < 0.0f ? -P.y[i] : P.y[i], 0.3f));
+}
+
+static void nlerp_simd(pose& P)
+{
+	glm::nlerp(&P.x[0], &P.y[0], 0.3f, &P.q[0], P.q.size());
+}
+
+static void mat4_sisd(pose& P)
+{
+	for(std::size_t i = 0; i < P.q.size(); ++i)
+		P.Mat4[i] = glm::mat4_cast(P.x[i]);
+}
+
+static void mat4_simd(pose& P)
+{
+	glm::mat4_cast(&P.x[0], &P.Mat4[0], P.q.size());
+}
+
+static void mat3x4_sisd(pose& P)
+{
+	for(std::size_t i = 0; i < P.q.size(); ++i)
+	{
+		glm::mat3 const m = glm::mat3_cast(P.x[i]);
+		P.Mat3x4[i] = glm::mat3x4(glm::vec4(m[0][0], m[1][0], m[2][0], 0), glm::vec4(m[0][1], m[1][1], m[2][1], 0), glm::vec4(m[0][2], m[1][2], m[2][2], 0));
+	}
+}
+
+static void mat3x4_simd(pose& P)
+{
+	glm::mat3x4_cast(&P.x[0], &P.Mat3x4[0], P.q.size());
+}
+
+static void sample_sisd(pose& P)
+{
+	for(std::size_t i = 0; i < P.q.size(); ++i)
+		P.Mat4[i] = glm::mat4_cast(glm::slerp(P.x[i], P.y[i], 0.3f));
+}
+
+static void sample_simd(pose& P)
+{
+	glm::slerp(&P.x[0], &P.y[0], 0.3f, &P.q[0], P.q.size());
+	glm::mat4_cast(&P.q[0], &P.Mat4[0], P.q.size());
+}
+
+static double launch(void (*Func)(pose&), pose& P)
+{
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	Func(P);
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return std::chrono::duration<double, std::milli>(t2 - t1).count();
+}
+
+static void compare(char const* Name, void (*SISD)(pose&), void (*SIMD)(pose&), pose& P)
+{
+	std::printf("%s:\n", Name);
+
+	double const Bones = static_cast<double>(P.q.size());
+	std::printf("- SISD: %d bones/ms\n", static_cast<int>(Bones / launch(SISD, P)));
+	std::printf("- SIMD: %d bones/ms\n", static_cast<int>(Bones / launch(SIMD, P)));
+}
+
+int main()
+{
+	std::size_t const Bones = 1 << 18;
+
+	pose P;
+	P.x.resize(Bones);
+	P.y.resize(Bones);
+	P.q.resize(Bones);
+	P.Mat4.resize(Bones);
+	P.Mat3x4.resize(Bones);
+	for(std::size_t i = 0; i < Bones; ++i)
+	{
+		P.x[i] = glm::angleAxis(glm::linearRand(0.0f, 6.28f), glm::sphericalRand(1.0f));
+		P.y[i] = glm::angleAxis(glm::linearRand(0.0f, 6.28f), glm::sphericalRand(1.0f));
+	}
+
+	compare("slerp", slerp_sisd, slerp_simd, P);
+	compare("nlerp", nlerp_sisd, nlerp_simd, P);
+	compare("mat4_cast", mat4_sisd, mat4_simd, P);
+	compare("mat3x4_cast", mat3x4_sisd, mat3x4_simd, P);
+	compare("slerp and mat4_cast", sample_sisd, sample_simd, P);
+
+	return 0;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
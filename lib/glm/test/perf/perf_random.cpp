@@ -0,0 +1,115 @@
+#define GLM_FORCE_INLINE
+#include <glm/gtc/random.hpp>
+#include <glm/ext/vector_float2.hpp>
+#include <glm/ext/vector_float3.hpp>
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+template<typename T>
+static void linear_sisd(T* Out, std::size_t Count)
+{
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = glm::linearRand(-1.0f, 1.0f);
+}
+
+template<typename T>
+static void linear_simd(T* Out, std::size_t Count)
+{
+	glm::linearRand(-1.0f, 1.0f, Out, Count);
+}
+
+template<typename T>
+static void gauss_sisd(T* Out, std::size_t Count)
+{
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = glm::gaussRand(0.0f, 1.0f);
+}
+
+template<typename T>
+static void gauss_simd(T* Out, std::size_t Count)
+{
+	glm::gaussRand(0.0f, 1.0f, Out, Count);
+}
+
+template<typename T>
+static void spherical_sisd(T* Out, std::size_t Count)
+{
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = glm::sphericalRand(1.0f);
+}
+
+template<typename T>
+static void spherical_simd(T* Out, std::size_t Count)
+{
+	glm::sphericalRand(1.0f, Out, Count);
+}
+
+template<typename T>
+static void disk_sisd(T* Out, std::size_t Count)
+{
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = glm::diskRand(1.0f);
+}
+
+template<typename T>
+static void disk_simd(T* Out, std::size_t Count)
+{
+	glm::diskRand(1.0f, Out, Count);
+}
+
+template<typename T>
+static void ball_sisd(T* Out, std::size_t Count)
+{
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = glm::ballRand(1.0f);
+}
+
+template<typename T>
+static void ball_simd(T* Out, std::size_t Count)
+{
+	glm::ballRand(1.0f, Out, Count);
+}
+
+template<typename T>
+static int launch(void (*Func)(T*, std::size_t), std::vector<T>& O)
+{
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	Func(&O[0], O.size());
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+template<typename T>
+static void compare(char const* Name, void (*SISD)(T*, std::size_t), void (*SIMD)(T*, std::size_t), std::size_t Count)
+{
+	std::printf("%s:\n", Name);
+
+	std::vector<T> Out(Count);
+	std::printf("- SISD: %d us\n", launch(SISD, Out));
+	std::printf("- SIMD: %d us\n", launch(SIMD, Out));
+}
+
+int main()
+{
+	std::size_t const Samples = 1 << 20;
+
+	compare("linearRand float", linear_sisd<float>, linear_simd<float>, Samples);
+	compare("gaussRand float", gauss_sisd<float>, gauss_simd<float>, Samples);
+	compare("sphericalRand vec3", spherical_sisd<glm::vec3>, spherical_simd<glm::vec3>, Samples);
+	compare("diskRand vec2", disk_sisd<glm::vec2>, disk_simd<glm::vec2>, Samples);
+	compare("ballRand vec3", ball_sisd<glm::vec3>, ball_simd<glm::vec3>, Samples);
+
+	return 0;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
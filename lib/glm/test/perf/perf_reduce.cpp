@@ -0,0 +1,169 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/reduce.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <cstdio>
+
+template<typename clock>
+static int elapsed(typename clock::time_point Start)
+{
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - Start).count());
+}
+
+// Loops a caller would write without the extension
+struct loops
+{
+	static void bounds(glm::vec3 const* p, std::size_t Count, glm::vec3& Min, glm::vec3& Max)
+	{
+		Min = glm::vec3(3.4e38f);
+		Max = glm::vec3(-3.4e38f);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Min = glm::min(Min, p[i]);
+			Max = glm::max(Max, p[i]);
+		}
+	}
+
+	static glm::vec3 sum(glm::vec3 const* p, std::size_t Count)
+	{
+		glm::vec3 Result(0.0f);
+		for(std::size_t i = 0; i < Count; ++i)
+			Result += p[i];
+		return Result;
+	}
+
+	static float dot(glm::vec3 const* x, glm::vec3 const* y, std::size_t Count)
+	{
+		float Result(0.0f);
+		for(std::size_t i = 0; i < Count; ++i)
+			Result += glm::dot(x[i], y[i]);
+		return Result;
+	}
+
+	static float maxLength2(glm::vec3 const* p, std::size_t Count)
+	{
+		float Result(0.0f);
+		for(std::size_t i = 0; i < Count; ++i)
+			Result = glm::max(Result, glm::dot(p[i], p[i]));
+		return Result;
+	}
+};
+
+// Each size reduces about 16M points in total
+static int perf_reduce(char const* Name, std::size_t Count)
+{
+	int Error = 0;
+
+	std::size_t const Repeat = (16u << 20) / Count;
+
+	std::vector<glm::vec3> Points(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Points[i] = glm::vec3(static_cast<float>(i % 1021), -static_cast<float>(i % 97), static_cast<float>(i % 13)) * 0.125f;
+	glm::vec3 const* const p = &Points[0];
+
+	// Float loops lose precision on large arrays, sums are checked against double sums
+	glm::dvec3 Reference(0.0);
+	double ReferenceDot = 0.0;
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Reference += glm::dvec3(Points[i]);
+		ReferenceDot += glm::dot(glm::dvec3(Points[i]), glm::dvec3(Points[i]));
+	}
+
+	std::printf("%s, %d vec3 x %d:\n", Name, static_cast<int>(Count), static_cast<int>(Repeat));
+
+	typedef std::chrono::high_resolution_clock clock;
+
+	glm::vec3 Min, Max, LoopMin, LoopMax;
+	{
+		clock::time_point const Start = clock::now();
+		for(std::size_t r = 0; r < Repeat; ++r)
+			loops::bounds(p, Count, LoopMin, LoopMax);
+		std::printf("- bounds loop: %d us\n", elapsed<clock>(Start));
+	}
+	{
+		clock::time_point const Start = clock::now();
+		for(std::size_t r = 0; r < Repeat; ++r)
+			glm::reduceBounds(p, Count, Min, Max);
+		std::printf("- reduceBounds: %d us\n", elapsed<clock>(Start));
+	}
+	Error += glm::all(glm::equal(Min, LoopMin)) && glm::all(glm::equal(Max, LoopMax)) ? 0 : 1;
+
+	glm::vec3 Sum, LoopSum;
+	{
+		clock::time_point const Start = clock::now();
+		for(std::size_t r = 0; r < Repeat; ++r)
+			LoopSum = loops::sum(p, Count);
+		std::printf("- sum loop: %d us\n", elapsed<clock>(Start));
+	}
+	{
+		clock::time_point const Start = clock::now();
+		for(std::size_t r = 0; r < Repeat; ++r)
+			Sum = glm::reduceSum(p, Count);
+		std::printf("- reduceSum: %d us\n", elapsed<clock>(Start));
+	}
+	Error += glm::all(glm::equal(glm::dvec3(Sum), Reference, glm::abs(Reference) * 0.0001)) ? 0 : 1;
+	std::printf("- sum relative error, loop: %g, reduceSum: %g\n",
+		glm::length(glm::dvec3(LoopSum) - Reference) / glm::length(Reference), glm::length(glm::dvec3(Sum) - Reference) / glm::length(Reference));
+
+	float Dot = 0.0f, LoopDot = 0.0f;
+	{
+		clock::time_point const Start = clock::now();
+		for(std::size_t r = 0; r < Repeat; ++r)
+			LoopDot = loops::dot(p, p, Count);
+		std::printf("- dot loop: %d us\n", elapsed<clock>(Start));
+	}
+	{
+		clock::time_point const Start = clock::now();
+		for(std::size_t r = 0; r < Repeat; ++r)
+			Dot = glm::reduceDot(p, p, Count);
+		std::printf("- reduceDot: %d us\n", elapsed<clock>(Start));
+	}
+	Error += glm::equal(static_cast<double>(Dot), ReferenceDot, ReferenceDot * 0.0001) ? 0 : 1;
+	std::printf("- dot relative error, loop: %g, reduceDot: %g\n",
+		glm::abs(static_cast<double>(LoopDot) - ReferenceDot) / ReferenceDot, glm::abs(static_cast<double>(Dot) - ReferenceDot) / ReferenceDot);
+
+	float Length2 = 0.0f, LoopLength2 = 0.0f;
+	{
+		clock::time_point const Start = clock::now();
+		for(std::size_t r = 0; r < Repeat; ++r)
+			LoopLength2 = loops::maxLength2(p, Count);
+		std::printf("- max length2 loop: %d us\n", elapsed<clock>(Start));
+	}
+	{
+		clock::time_point const Start = clock::now();
+		for(std::size_t r = 0; r < Repeat; ++r)
+			Length2 = glm::reduceMaxLength2(p, Count);
+		std::printf("- reduceMaxLength2: %d us\n", elapsed<clock>(Start));
+	}
+	Error += glm::equal(Length2, LoopLength2, 0.0f) ? 0 : 1;
+
+	// Blocks split between the hardware threads
+	unsigned const ThreadCount = std::thread::hardware_concurrency();
+	if(Count > 8192 && ThreadCount > 1)
+	{
+		clock::time_point const Start = clock::now();
+		for(std::size_t r = 0; r < Repeat; ++r)
+			glm::reduceBounds(p, Count, Min, Max, ThreadCount);
+		std::printf("- reduceBounds with %u threads: %d us\n", ThreadCount, elapsed<clock>(Start));
+		Error += glm::all(glm::equal(Min, LoopMin)) && glm::all(glm::equal(Max, LoopMax)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	// 24KB, 192KB and 48MB of points
+	Error += perf_reduce("L1", 2048);
+	Error += perf_reduce("L2", 16384);
+	Error += perf_reduce("DRAM", 4u << 20);
+
+	return Error;
+}
@@ -0,0 +1,117 @@
+#define GLM_FORCE_INLINE
+#include <glm/ext/simd_dispatch.hpp>
+#include <glm/ext/matrix_clip_space.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+struct data
+{
+	glm::mat4 m;
+	glm::vec4 Planes[6];
+	std::vector<float> x, y, z, r;
+	std::vector<float> OutX, OutY, OutZ;
+	std::vector<glm::uint32> Visible;
+	std::vector<glm::uint16> Half;
+	std::vector<glm::vec3> p;
+	std::vector<float> Noise;
+	std::size_t VisibleCount;
+};
+
+static void transform(data& D)
+{
+	glm::dispatch::batchTransformPoints(D.m, &D.x[0], &D.y[0], &D.z[0], &D.OutX[0], &D.OutY[0], &D.OutZ[0], D.x.size());
+}
+
+static void project(data& D)
+{
+	glm::dispatch::batchProjectPoints(D.m, &D.x[0], &D.y[0], &D.z[0], &D.OutX[0], &D.OutY[0], &D.OutZ[0], D.x.size());
+}
+
+static void cull(data& D)
+{
+	D.VisibleCount = glm::dispatch::cullSpheres(D.Planes, &D.x[0], &D.y[0], &D.z[0], &D.r[0], &D.Visible[0], D.x.size());
+}
+
+static void pack(data& D)
+{
+	glm::dispatch::packHalf(&D.x[0], &D.Half[0], D.x.size());
+	glm::dispatch::unpackHalf(&D.Half[0], &D.OutX[0], D.x.size());
+}
+
+static void noise(data& D)
+{
+	glm::dispatch::simplexFbm(&D.p[0], &D.Noise[0], D.p.size(), 4);
+}
+
+static int launch(void (*Func)(data&), data& D)
+{
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	Func(D);
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+static void compare(char const* Name, void (*Func)(data&), data& D)
+{
+	std::printf("%s:\n", Name);
+
+	glm::simd_level const Levels[] = {glm::simd_level_generic, glm::simd_level_avx2, glm::simd_level_avx512};
+	for(std::size_t l = 0; l < sizeof(Levels) / sizeof(Levels[0]); ++l)
+	{
+		if(Levels[l] > glm::detectSimdLevel())
+			break;
+		glm::forceSimdLevel(Levels[l]);
+		Func(D); // Warm up the caches
+		int const Time = launch(Func, D);
+		std::printf("- %s: %d us\n", glm::simdLevelName(Levels[l]), Time);
+	}
+	glm::forceSimdLevel(glm::detectSimdLevel());
+}
+
+int main()
+{
+	std::size_t const Count = 1 << 20;
+
+	data D;
+	D.m = glm::perspective(1.0f, 1.5f, 0.5f, 500.0f) * glm::lookAt(glm::vec3(0), glm::vec3(0, 0, -1), glm::vec3(0, 1, 0));
+	glm::frustumPlanes(D.m, D.Planes);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		float const t = static_cast<float>(i);
+		D.x.push_back(glm::sin(t * 1.7f) * 400.0f);
+		D.y.push_back(glm::cos(t * 0.9f) * 100.0f);
+		D.z.push_back(glm::sin(t * 0.3f) * 500.0f);
+		D.r.push_back(0.5f + glm::mod(t, 8.0f));
+	}
+	D.OutX.resize(Count);
+	D.OutY.resize(Count);
+	D.OutZ.resize(Count);
+	D.Visible.resize((Count + 31) / 32);
+	D.Half.resize(Count);
+	for(std::size_t i = 0; i < Count / 8; ++i)
+		D.p.push_back(glm::vec3(D.x[i], D.y[i], D.z[i]) * 0.05f);
+	D.Noise.resize(D.p.size());
+
+	std::printf("Detected level: %s\n", glm::simdLevelName(glm::detectSimdLevel()));
+
+	compare("batchTransformPoints", transform, D);
+	compare("batchProjectPoints", project, D);
+	compare("cullSpheres", cull, D);
+	compare("packHalf and unpackHalf", pack, D);
+	compare("simplexFbm", noise, D);
+
+	return 0;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
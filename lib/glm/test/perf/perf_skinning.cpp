@@ -0,0 +1,117 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/skinning.hpp>
+#include <glm/gtc/type_precision.hpp>
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+struct mesh
+{
+	std::vector<glm::dualquat> DualQuat;
+	std::vector<glm::mat3x4> Matrix;
+	std::vector<glm::u16vec4> Indices;
+	std::vector<glm::vec4> Weights;
+	std::vector<glm::vec3> Positions, Normals, OutPositions, OutNormals;
+};
+
+static void dual_quat_sisd(mesh& M)
+{
+	for(std::size_t i = 0; i < M.Positions.size(); ++i)
+	{
+		glm::dualquat const& First = M.DualQuat[M.Indices[i].x];
+		glm::dualquat Blend = First * M.Weights[i].x;
+		for(glm::length_t k = 1; k < 4; ++k)
+		{
+			glm::dualquat const& Bone = M.DualQuat[M.Indices[i][k]];
+			Blend = Blend + Bone * (glm::dot(Bone.real, First.real) < 0.0f ? -M.Weights[i][k] : M.Weights[i][k]);
+		}
+		Blend = glm::normalize(Blend);
+
+		M.OutPositions[i] = Blend * M.Positions[i];
+		M.OutNormals[i] = Blend.real * M.Normals[i];
+	}
+}
+
+static void dual_quat_simd(mesh& M)
+{
+	glm::skinDualQuat(&M.DualQuat[0], &M.Indices[0], &M.Weights[0], &M.Positions[0], &M.Normals[0], &M.OutPositions[0], &M.OutNormals[0], M.Positions.size());
+}
+
+static void linear_blend_sisd(mesh& M)
+{
+	for(std::size_t i = 0; i < M.Positions.size(); ++i)
+	{
+		glm::mat3x4 Blend = M.Matrix[M.Indices[i].x] * M.Weights[i].x;
+		for(glm::length_t k = 1; k < 4; ++k)
+			Blend += M.Matrix[M.Indices[i][k]] * M.Weights[i][k];
+
+		glm::vec4 const p(M.Positions[i], 1.0f);
+		glm::vec4 const v(M.Normals[i], 0.0f);
+		M.OutPositions[i] = glm::vec3(glm::dot(Blend[0], p), glm::dot(Blend[1], p), glm::dot(Blend[2], p));
+		M.OutNormals[i] = glm::normalize(glm::vec3(glm::dot(Blend[0], v), glm::dot(Blend[1], v), glm::dot(Blend[2], v)));
+	}
+}
+
+static void linear_blend_simd(mesh& M)
+{
+	glm::skinLinearBlend(&M.Matrix[0], &M.Indices[0], &M.Weights[0], &M.Positions[0], &M.Normals[0], &M.OutPositions[0], &M.OutNormals[0], M.Positions.size());
+}
+
+static double launch(void (*Func)(mesh&), mesh& M)
+{
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	Func(M);
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return std::chrono::duration<double, std::milli>(t2 - t1).count();
+}
+
+static void compare(char const* Name, void (*SISD)(mesh&), void (*SIMD)(mesh&), mesh& M)
+{
+	std::printf("%s:\n", Name);
+
+	double const Vertices = static_cast<double>(M.Positions.size());
+	std::printf("- SISD: %d vertices/ms\n", static_cast<int>(Vertices / launch(SISD, M)));
+	std::printf("- SIMD: %d vertices/ms\n", static_cast<int>(Vertices / launch(SIMD, M)));
+}
+
+int main()
+{
+	std::size_t const Bones = 64;
+	std::size_t const Vertices = 1 << 18;
+
+	mesh M;
+	for(std::size_t b = 0; b < Bones; ++b)
+	{
+		float const t = static_cast<float>(b);
+		M.DualQuat.push_back(glm::dualquat(glm::angleAxis(t * 0.1f, glm::normalize(glm::vec3(glm::sin(t), glm::cos(t), 0.5f))), glm::vec3(t * 0.1f, 0.0f, -t * 0.05f)));
+		M.Matrix.push_back(glm::mat3x4_cast(M.DualQuat.back()));
+	}
+
+	for(std::size_t i = 0; i < Vertices; ++i)
+	{
+		float const t = static_cast<float>(i);
+		M.Indices.push_back(glm::u16vec4(i % Bones, (i + 1) % Bones, (i + 7) % Bones, (i + 13) % Bones));
+		M.Weights.push_back(glm::vec4(0.4f, 0.3f, 0.2f, 0.1f));
+		M.Positions.push_back(glm::vec3(glm::sin(t), glm::cos(t), t * 1e-5f));
+		M.Normals.push_back(glm::normalize(glm::vec3(glm::cos(t), 1.0f, glm::sin(t))));
+	}
+	M.OutPositions.resize(Vertices);
+	M.OutNormals.resize(Vertices);
+
+	compare("skinDualQuat", dual_quat_sisd, dual_quat_simd, M);
+	compare("skinLinearBlend", linear_blend_sisd, linear_blend_simd, M);
+
+	return 0;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
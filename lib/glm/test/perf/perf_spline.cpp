@@ -0,0 +1,97 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/spline.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/trigonometric.hpp>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+template<typename clock>
+static int elapsed(typename clock::time_point Start)
+{
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - Start).count());
+}
+
+// One catmullRom call per sample, finding the control points of the segment
+static int launch_catmull_rom(std::vector<glm::vec3> const& Points, std::vector<float> const& Parameters, std::vector<glm::vec3>& Samples)
+{
+	std::size_t const Last = Points.size() - 1;
+
+	std::chrono::high_resolution_clock::time_point const Start = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0; i < Parameters.size(); ++i)
+	{
+		float const u = glm::clamp(Parameters[i], 0.0f, 1.0f) * static_cast<float>(Last);
+		std::size_t const j = glm::min(static_cast<std::size_t>(u), Last - 1);
+		Samples[i] = glm::catmullRom(Points[j > 0 ? j - 1 : 0], Points[j], Points[j + 1], Points[glm::min(j + 2, Last)], u - static_cast<float>(j));
+	}
+	return elapsed<std::chrono::high_resolution_clock>(Start);
+}
+
+static int launch_spline(glm::spline3 const& Spline, std::vector<float> const& Parameters, std::vector<glm::vec3>& Samples)
+{
+	std::chrono::high_resolution_clock::time_point const Start = std::chrono::high_resolution_clock::now();
+	glm::evaluateSpline(Spline, &Parameters[0], Parameters.size(), &Samples[0]);
+	return elapsed<std::chrono::high_resolution_clock>(Start);
+}
+
+static int launch_constant_speed(glm::spline3 const& Spline, std::vector<float> const& Distances, std::vector<glm::vec3>& Samples)
+{
+	std::chrono::high_resolution_clock::time_point const Start = std::chrono::high_resolution_clock::now();
+	glm::evaluateSplineConstantSpeed(Spline, &Distances[0], Distances.size(), &Samples[0]);
+	return elapsed<std::chrono::high_resolution_clock>(Start);
+}
+
+// Camera path around a helix, sampled at many more parameters than control points
+static int perf_spline(std::size_t PointCount, std::size_t SampleCount)
+{
+	int Error = 0;
+
+	std::vector<glm::vec3> Points(PointCount);
+	for(std::size_t i = 0; i < PointCount; ++i)
+	{
+		float const a = static_cast<float>(i) * 0.7f;
+		Points[i] = glm::vec3(glm::cos(a) * 10.0f, static_cast<float>(i % 7), glm::sin(a) * 10.0f + static_cast<float>(i));
+	}
+
+	std::vector<float> Parameters(SampleCount);
+	for(std::size_t i = 0; i < SampleCount; ++i)
+		Parameters[i] = static_cast<float>((i * 7919) % SampleCount) / static_cast<float>(SampleCount - 1);
+
+	std::printf("%d control points, %d samples:\n", static_cast<int>(PointCount), static_cast<int>(SampleCount));
+
+	std::vector<glm::vec3> Expected(SampleCount);
+	std::printf("- catmullRom per sample: %d us\n", launch_catmull_rom(Points, Parameters, Expected));
+
+	glm::spline3 Spline;
+	{
+		std::chrono::high_resolution_clock::time_point const Start = std::chrono::high_resolution_clock::now();
+		glm::buildCatmullRomSpline(Spline, &Points[0], PointCount);
+		std::printf("- buildCatmullRomSpline: %d us\n", elapsed<std::chrono::high_resolution_clock>(Start));
+	}
+
+	std::vector<glm::vec3> Samples(SampleCount);
+	std::printf("- evaluateSpline: %d us\n", launch_spline(Spline, Parameters, Samples));
+	for(std::size_t i = 0; i < SampleCount; ++i)
+		Error += glm::all(glm::equal(Samples[i], Expected[i], 0.001f)) ? 0 : 1;
+
+	{
+		std::chrono::high_resolution_clock::time_point const Start = std::chrono::high_resolution_clock::now();
+		glm::buildArcLengthTable(Spline);
+		std::printf("- buildArcLengthTable: %d us\n", elapsed<std::chrono::high_resolution_clock>(Start));
+	}
+	std::printf("- evaluateSplineConstantSpeed: %d us\n", launch_constant_speed(Spline, Parameters, Samples));
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += perf_spline(64, 1000);
+	Error += perf_spline(1000, 100000);
+	Error += perf_spline(1000, 1000000);
+
+	return Error;
+}
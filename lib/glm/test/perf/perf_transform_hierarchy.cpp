@@ -0,0 +1,127 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/transform_hierarchy.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <cstdio>
+
+// Scene graph with 16 roots and 4 children per node, with node identifiers in creation order
+struct scene
+{
+	std::vector<glm::uint32> Parents;
+	std::vector<glm::vec3> Translations;
+	std::vector<glm::quat> Rotations;
+	std::vector<glm::vec3> Scales;
+};
+
+static void make_scene(scene& S, std::size_t NodeCount)
+{
+	S.Parents.resize(NodeCount);
+	S.Translations.resize(NodeCount);
+	S.Rotations.resize(NodeCount);
+	S.Scales.resize(NodeCount);
+	for(std::size_t i = 0; i < NodeCount; ++i)
+	{
+		float const t = static_cast<float>(i % 1021) * 0.001f;
+		S.Parents[i] = i < 16 ? glm::transform_hierarchy::root : static_cast<glm::uint32>(i / 4 - 4);
+		S.Translations[i] = glm::vec3(t, 1.0f, -t);
+		S.Rotations[i] = glm::angleAxis(t, glm::vec3(0.48f, 0.6f, 0.64f));
+		S.Scales[i] = glm::vec3(1.0f + t, 1.0f, 1.0f - t);
+	}
+}
+
+template<typename clock>
+static int elapsed(typename clock::time_point Start)
+{
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - Start).count());
+}
+
+// Parents are created before their children so a single pass in creation order computes the world transforms
+static int launch_mat4(scene const& S, std::vector<glm::mat4>& Worlds)
+{
+	Worlds.resize(S.Parents.size());
+
+	std::chrono::high_resolution_clock::time_point const Start = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0; i < S.Parents.size(); ++i)
+	{
+		glm::mat4 const Local = glm::scale(glm::translate(glm::mat4(1.0f), S.Translations[i]) * glm::mat4_cast(S.Rotations[i]), S.Scales[i]);
+		Worlds[i] = S.Parents[i] == glm::transform_hierarchy::root ? Local : Worlds[S.Parents[i]] * Local;
+	}
+	return elapsed<std::chrono::high_resolution_clock>(Start);
+}
+
+static int launch_update(glm::transform_hierarchy& Hierarchy, unsigned ThreadCount, std::size_t& Updated)
+{
+	std::chrono::high_resolution_clock::time_point const Start = std::chrono::high_resolution_clock::now();
+	Updated = glm::updateTransformHierarchy(Hierarchy, ThreadCount);
+	return elapsed<std::chrono::high_resolution_clock>(Start);
+}
+
+static int comp_results(glm::transform_hierarchy const& Hierarchy, std::vector<glm::mat4> const& Worlds)
+{
+	int Error = 0;
+
+	for(std::size_t i = 0; i < Worlds.size(); ++i)
+		Error += glm::all(glm::equal(glm::mat4_cast(glm::worldTransform(Hierarchy, static_cast<glm::uint32>(i))), Worlds[i], 0.01f)) ? 0 : 1;
+
+	return Error;
+}
+
+static int perf_hierarchy(std::size_t NodeCount)
+{
+	int Error = 0;
+
+	scene S;
+	make_scene(S, NodeCount);
+
+	glm::transform_hierarchy Hierarchy;
+	glm::buildTransformHierarchy(Hierarchy, &S.Parents[0], NodeCount);
+
+	std::printf("%d nodes, %d levels:\n", static_cast<int>(NodeCount), static_cast<int>(Hierarchy.Levels.size() - 1));
+
+	std::vector<glm::mat4> Worlds;
+	std::printf("- mat4 in creation order: %d us\n", launch_mat4(S, Worlds));
+
+	unsigned const ThreadCounts[] = {1, 0};
+	for(std::size_t t = 0; t < sizeof(ThreadCounts) / sizeof(ThreadCounts[0]); ++t)
+	{
+		unsigned const ThreadCount = ThreadCounts[t] == 0 ? std::thread::hardware_concurrency() : ThreadCounts[t];
+
+		for(std::size_t i = 0; i < NodeCount; ++i)
+			glm::setLocalTransform(Hierarchy, static_cast<glm::uint32>(i), S.Translations[i], S.Rotations[i], S.Scales[i]);
+
+		std::size_t Updated = 0;
+		int const Time = launch_update(Hierarchy, ThreadCount, Updated);
+		std::printf("- updateTransformHierarchy with %u threads, all dirty: %d us, %d updated\n", ThreadCount, Time, static_cast<int>(Updated));
+		Error += Updated == NodeCount ? 0 : 1;
+		Error += comp_results(Hierarchy, Worlds);
+	}
+
+	// Move 1% of the leaves
+	std::size_t const Moved = NodeCount / 100;
+	for(std::size_t i = 0; i < Moved; ++i)
+	{
+		glm::uint32 const Node = static_cast<glm::uint32>(NodeCount - 1 - i * 97 % (NodeCount / 2));
+		glm::setLocalTransform(Hierarchy, Node, S.Translations[Node], S.Rotations[Node], S.Scales[Node]);
+	}
+	std::size_t Updated = 0;
+	int const Time = launch_update(Hierarchy, 1, Updated);
+	std::printf("- updateTransformHierarchy, 1 thread, 1%% of the leaves dirty: %d us, %d updated\n", Time, static_cast<int>(Updated));
+	Error += Updated <= Moved ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += perf_hierarchy(10000);
+	Error += perf_hierarchy(100000);
+	Error += perf_hierarchy(1000000);
+
+	return Error;
+}
@@ -0,0 +1,92 @@
+#define GLM_FORCE_INLINE
+#include <glm/exponential.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/ext/vector_float4.hpp>
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#include <glm/gtc/type_aligned.hpp>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+template <typename vecType>
+static int launch_vec_func(std::vector<vecType>& O, vecType (*Func)(vecType const&), float Min, float Max, std::size_t Samples)
+{
+	std::vector<vecType> I(Samples);
+	O.resize(Samples);
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	for(glm::length_t j = 0; j < 4; ++j)
+		I[i][j] = Min + (Max - Min) * static_cast<float>(i * 4 + static_cast<std::size_t>(j)) / static_cast<float>(Samples * 4);
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+		O[i] = Func(I[i]);
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+template <typename packedVecType, typename alignedVecType>
+static int comp_vec_func(packedVecType (*PackedFunc)(packedVecType const&), alignedVecType (*AlignedFunc)(alignedVecType const&), float Min, float Max, int MaxULPs, std::size_t Samples)
+{
+	int Error = 0;
+
+	std::vector<packedVecType> SISD;
+	std::printf("- SISD: %d us\n", launch_vec_func<packedVecType>(SISD, PackedFunc, Min, Max, Samples));
+
+	std::vector<alignedVecType> SIMD;
+	std::printf("- SIMD: %d us\n", launch_vec_func<alignedVecType>(SIMD, AlignedFunc, Min, Max, Samples));
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		packedVecType const A = SISD[i];
+		packedVecType const B = SIMD[i];
+		Error += glm::all(glm::equal(A, B, MaxULPs)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template <typename vecType>
+static vecType call_exp(vecType const& v){return glm::exp(v);}
+template <typename vecType>
+static vecType call_log(vecType const& v){return glm::log(v);}
+template <typename vecType>
+static vecType call_exp2(vecType const& v){return glm::exp2(v);}
+template <typename vecType>
+static vecType call_log2(vecType const& v){return glm::log2(v);}
+template <typename vecType>
+static vecType call_pow(vecType const& v){return glm::pow(v, vecType(2.2f));}
+
+int main()
+{
+	std::size_t const Samples = 100000;
+
+	int Error = 0;
+
+	std::printf("exp(vec4):\n");
+	Error += comp_vec_func<glm::vec4, glm::aligned_vec4>(call_exp<glm::vec4>, call_exp<glm::aligned_vec4>, -80.0f, 80.0f, 2, Samples);
+
+	std::printf("log(vec4):\n");
+	Error += comp_vec_func<glm::vec4, glm::aligned_vec4>(call_log<glm::vec4>, call_log<glm::aligned_vec4>, 0.001f, 1000.0f, 2, Samples);
+
+	std::printf("exp2(vec4):\n");
+	Error += comp_vec_func<glm::vec4, glm::aligned_vec4>(call_exp2<glm::vec4>, call_exp2<glm::aligned_vec4>, -120.0f, 120.0f, 2, Samples);
+
+	std::printf("log2(vec4):\n");
+	Error += comp_vec_func<glm::vec4, glm::aligned_vec4>(call_log2<glm::vec4>, call_log2<glm::aligned_vec4>, 0.001f, 1000.0f, 2, Samples);
+
+	std::printf("pow(vec4, 2.2):\n");
+	Error += comp_vec_func<glm::vec4, glm::aligned_vec4>(call_pow<glm::vec4>, call_pow<glm::aligned_vec4>, 0.001f, 1000.0f, 8, Samples);
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
@@ -0,0 +1,87 @@
+#define GLM_FORCE_INLINE
+#include <glm/geometric.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/ext/vector_float4.hpp>
+#include <glm/ext/vector_double4.hpp>
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#include <glm/gtc/type_aligned.hpp>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+template <typename vecType>
+static int launch_vec_func(std::vector<vecType>& O, vecType (*Func)(vecType const&, vecType const&), std::size_t Samples)
+{
+	typedef typename vecType::value_type T;
+
+	std::vector<vecType> I(Samples);
+	O.resize(Samples);
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		I[i] = vecType(static_cast<T>(i) * static_cast<T>(0.01), static_cast<T>(1), -static_cast<T>(i) * static_cast<T>(0.02), static_cast<T>(2));
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+		O[i] = Func(I[i], I[Samples - i - 1]);
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+template <typename packedVecType, typename alignedVecType>
+static int comp_vec_func(packedVecType (*PackedFunc)(packedVecType const&, packedVecType const&), alignedVecType (*AlignedFunc)(alignedVecType const&, alignedVecType const&), int MaxULPs, std::size_t Samples)
+{
+	int Error = 0;
+
+	std::vector<packedVecType> SISD;
+	std::printf("- SISD: %d us\n", launch_vec_func<packedVecType>(SISD, PackedFunc, Samples));
+
+	std::vector<alignedVecType> SIMD;
+	std::printf("- SIMD: %d us\n", launch_vec_func<alignedVecType>(SIMD, AlignedFunc, Samples));
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		packedVecType const A = SISD[i];
+		packedVecType const B = SIMD[i];
+		Error += glm::all(glm::equal(A, B, MaxULPs)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template <typename vecType>
+static vecType call_dot(vecType const& a, vecType const& b){return vecType(glm::dot(a, b));}
+template <typename vecType>
+static vecType call_length(vecType const& a, vecType const&){return vecType(glm::length(a));}
+template <typename vecType>
+static vecType call_normalize(vecType const& a, vecType const&){return glm::normalize(a);}
+
+int main()
+{
+	std::size_t const Samples = 100000;
+
+	int Error = 0;
+
+	std::printf("dot(vec4, vec4):\n");
+	Error += comp_vec_func<glm::vec4, glm::aligned_vec4>(call_dot<glm::vec4>, call_dot<glm::aligned_vec4>, 4, Samples);
+
+	std::printf("dot(dvec4, dvec4):\n");
+	Error += comp_vec_func<glm::dvec4, glm::aligned_dvec4>(call_dot<glm::dvec4>, call_dot<glm::aligned_dvec4>, 4, Samples);
+
+	std::printf("length(dvec4):\n");
+	Error += comp_vec_func<glm::dvec4, glm::aligned_dvec4>(call_length<glm::dvec4>, call_length<glm::aligned_dvec4>, 4, Samples);
+
+	std::printf("normalize(dvec4):\n");
+	Error += comp_vec_func<glm::dvec4, glm::aligned_dvec4>(call_normalize<glm::dvec4>, call_normalize<glm::aligned_dvec4>, 4, Samples);
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
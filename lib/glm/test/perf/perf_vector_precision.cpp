@@ -0,0 +1,85 @@
+#define GLM_FORCE_INLINE
+#include <glm/exponential.hpp>
+#include <glm/geometric.hpp>
+#include <glm/trigonometric.hpp>
+#include <glm/ext/vector_float4_precision.hpp>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+template <typename vecType>
+static int launch_vec_func(vecType (*Func)(vecType const&), float Min, float Max, std::size_t Samples, float& Checksum)
+{
+	std::vector<vecType> I(Samples);
+	std::vector<vecType> O(Samples);
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	for(glm::length_t j = 0; j < 4; ++j)
+		I[i][j] = Min + (Max - Min) * static_cast<float>(i * 4 + static_cast<std::size_t>(j)) / static_cast<float>(Samples * 4);
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+		O[i] = Func(I[i]);
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	// Keeps the results alive
+	for(std::size_t i = 0; i < Samples; ++i)
+		Checksum += O[i].x;
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+template <template<typename> class Func, typename highpType, typename mediumpType, typename lowpType>
+static void comp_vec_func(char const* Name, float Min, float Max, std::size_t Samples, float& Checksum)
+{
+	std::printf("- %s highp: %d us\n", Name, launch_vec_func<highpType>(Func<highpType>::call, Min, Max, Samples, Checksum));
+	std::printf("- %s mediump: %d us\n", Name, launch_vec_func<mediumpType>(Func<mediumpType>::call, Min, Max, Samples, Checksum));
+	std::printf("- %s lowp: %d us\n", Name, launch_vec_func<lowpType>(Func<lowpType>::call, Min, Max, Samples, Checksum));
+}
+
+template <template<typename> class Func>
+static void comp_vec_func(char const* Title, float Min, float Max, std::size_t Samples, float& Checksum)
+{
+	std::printf("%s:\n", Title);
+	comp_vec_func<Func, glm::highp_vec4, glm::mediump_vec4, glm::lowp_vec4>("packed", Min, Max, Samples, Checksum);
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		comp_vec_func<Func, glm::aligned_highp_vec4, glm::aligned_mediump_vec4, glm::aligned_lowp_vec4>("aligned", Min, Max, Samples, Checksum);
+#	endif
+}
+
+template <typename vecType>
+struct call_sqrt{static vecType call(vecType const& v){return glm::sqrt(v);}};
+template <typename vecType>
+struct call_inversesqrt{static vecType call(vecType const& v){return glm::inversesqrt(v);}};
+template <typename vecType>
+struct call_normalize{static vecType call(vecType const& v){return glm::normalize(v);}};
+template <typename vecType>
+struct call_sin{static vecType call(vecType const& v){return glm::sin(v);}};
+template <typename vecType>
+struct call_cos{static vecType call(vecType const& v){return glm::cos(v);}};
+template <typename vecType>
+struct call_exp{static vecType call(vecType const& v){return glm::exp(v);}};
+template <typename vecType>
+struct call_log{static vecType call(vecType const& v){return glm::log(v);}};
+
+int main()
+{
+	std::size_t const Samples = 100000;
+
+	float Checksum = 0.0f;
+
+	comp_vec_func<call_sqrt>("sqrt(vec4)", 0.001f, 1000.0f, Samples, Checksum);
+	comp_vec_func<call_inversesqrt>("inversesqrt(vec4)", 0.001f, 1000.0f, Samples, Checksum);
+	comp_vec_func<call_normalize>("normalize(vec4)", 0.001f, 1000.0f, Samples, Checksum);
+	comp_vec_func<call_sin>("sin(vec4)", -100.0f, 100.0f, Samples, Checksum);
+	comp_vec_func<call_cos>("cos(vec4)", -100.0f, 100.0f, Samples, Checksum);
+	comp_vec_func<call_exp>("exp(vec4)", -80.0f, 80.0f, Samples, Checksum);
+	comp_vec_func<call_log>("log(vec4)", 0.001f, 1000.0f, Samples, Checksum);
+
+	std::printf("Checksum: %f\n", static_cast<double>(Checksum));
+
+	return 0;
+}
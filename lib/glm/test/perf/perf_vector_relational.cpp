@@ -0,0 +1,92 @@
+#define GLM_FORCE_INLINE
+#include <glm/ext/vector_relational.hpp>
+#include <glm/ext/vector_float4.hpp>
+#include <glm/trigonometric.hpp>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+// Points of a grid around a box centered on the origin
+static void init_points(std::vector<glm::vec4>& Points, std::size_t Samples)
+{
+	Points.resize(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		float const t = static_cast<float>(i) * 0.0001f;
+		Points[i] = glm::vec4(glm::sin(t * 3.1f), glm::cos(t * 1.7f), glm::sin(t * 0.3f), 1.0f) * 2.0f;
+	}
+}
+
+template<typename clock>
+static int elapsed(typename clock::time_point Start)
+{
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - Start).count());
+}
+
+template<typename vecType>
+static int launch_all(std::vector<glm::vec4> const& Input, std::size_t& Inside, std::size_t& Equal)
+{
+	std::vector<vecType> const Points(Input.begin(), Input.end());
+	vecType const Min(-1.0f, -1.0f, -1.0f, 0.0f);
+	vecType const Max(1.0f, 1.0f, 1.0f, 2.0f);
+
+	Inside = 0;
+	Equal = 0;
+
+	std::chrono::high_resolution_clock::time_point const Start = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0, n = Points.size(); i < n; ++i)
+	{
+		Inside += glm::all(glm::lessThanEqual(Min, Points[i])) && glm::all(glm::lessThanEqual(Points[i], Max)) ? 1 : 0;
+		Equal += glm::any(glm::equal(Points[i], Points[n - 1 - i], 4)) ? 1 : 0;
+	}
+	return elapsed<std::chrono::high_resolution_clock>(Start);
+}
+
+template<typename vecType>
+static int launch_mask(std::vector<glm::vec4> const& Input, std::size_t& Inside, std::size_t& Equal)
+{
+	std::vector<vecType> const Points(Input.begin(), Input.end());
+	vecType const Min(-1.0f, -1.0f, -1.0f, 0.0f);
+	vecType const Max(1.0f, 1.0f, 1.0f, 2.0f);
+
+	Inside = 0;
+	Equal = 0;
+
+	std::chrono::high_resolution_clock::time_point const Start = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0, n = Points.size(); i < n; ++i)
+	{
+		Inside += (glm::lessThanEqualMask(Min, Points[i]) & glm::lessThanEqualMask(Points[i], Max)) == 0xF ? 1 : 0;
+		Equal += glm::equalMask(Points[i], Points[n - 1 - i], 4) != 0 ? 1 : 0;
+	}
+	return elapsed<std::chrono::high_resolution_clock>(Start);
+}
+
+int main()
+{
+	std::size_t const Samples = 1000000;
+
+	int Error = 0;
+
+	std::vector<glm::vec4> Points;
+	init_points(Points, Samples);
+
+	std::size_t Inside = 0, Equal = 0;
+	std::printf("Box and ULP tests of %d points:\n", static_cast<int>(Samples));
+	std::printf("- all(lessThanEqual(vec4)): %d us\n", launch_all<glm::vec4>(Points, Inside, Equal));
+
+	std::size_t MaskInside = 0, MaskEqual = 0;
+	std::printf("- lessThanEqualMask(vec4): %d us\n", launch_mask<glm::vec4>(Points, MaskInside, MaskEqual));
+	Error += Inside == MaskInside && Equal == MaskEqual ? 0 : 1;
+
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		std::printf("- all(lessThanEqual(aligned_vec4)): %d us\n", launch_all<glm::aligned_vec4>(Points, MaskInside, MaskEqual));
+		Error += Inside == MaskInside && Equal == MaskEqual ? 0 : 1;
+		std::printf("- lessThanEqualMask(aligned_vec4): %d us\n", launch_mask<glm::aligned_vec4>(Points, MaskInside, MaskEqual));
+		Error += Inside == MaskInside && Equal == MaskEqual ? 0 : 1;
+#	endif
+
+	return Error;
+}
@@ -0,0 +1,97 @@
+#define GLM_FORCE_INLINE
+#include <glm/ext/vector_soa.hpp>
+#include <glm/ext/vector_float3.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/common.hpp>
+#include <glm/geometric.hpp>
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+// One particle integration step: steer toward the origin, move and clamp to a box
+static void step_aos(std::vector<glm::vec3>& Position, std::vector<glm::vec3>& Velocity, float Delta)
+{
+	for(std::size_t i = 0, n = Position.size(); i < n; ++i)
+	{
+		glm::vec3 const Dir = glm::normalize(-Position[i]);
+		Velocity[i] = glm::mix(Velocity[i], Dir, 0.1f);
+		Position[i] = glm::clamp(Position[i] + Velocity[i] * Delta, -100.0f, 100.0f);
+	}
+}
+
+template<glm::length_t W>
+static void step_soa(std::vector<glm::vec3>& Position, std::vector<glm::vec3>& Velocity, float Delta)
+{
+	typedef glm::soa_vec<3, float, W> soa_t;
+	typedef glm::soa_scalar<float, W> scalar_t;
+
+	for(std::size_t i = 0, n = Position.size(); i < n; i += W)
+	{
+		soa_t p = soa_t::load(&Position[i]);
+		soa_t v = soa_t::load(&Velocity[i]);
+
+		soa_t const Dir = glm::normalize(-p);
+		v = glm::mix(v, Dir, scalar_t(0.1f));
+		p = glm::clamp(p + v * scalar_t(Delta), scalar_t(-100.0f), scalar_t(100.0f));
+
+		p.store(&Position[i]);
+		v.store(&Velocity[i]);
+	}
+}
+
+typedef void (*step_func)(std::vector<glm::vec3>& Position, std::vector<glm::vec3>& Velocity, float Delta);
+
+static int launch(step_func Step, std::vector<glm::vec3>& Position, std::size_t Samples, std::size_t Steps)
+{
+	std::vector<glm::vec3> Velocity(Samples, glm::vec3(0.0f));
+	Position.resize(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		float const t = static_cast<float>(i % 1000);
+		Position[i] = glm::vec3(t * 0.05f - 25.0f, t * 0.02f + 1.0f, 30.0f - t * 0.03f);
+	}
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	for(std::size_t s = 0; s < Steps; ++s)
+		Step(Position, Velocity, 0.01f);
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+int main()
+{
+	std::size_t const Samples = 100000;
+	std::size_t const Steps = 10;
+
+	int Error = 0;
+
+	std::printf("particles step:\n");
+
+	std::vector<glm::vec3> SISD;
+	std::printf("- SISD vec3: %d us\n", launch(step_aos, SISD, Samples, Steps));
+
+	std::vector<glm::vec3> SIMD4;
+	std::printf("- SIMD vec3x4: %d us\n", launch(step_soa<4>, SIMD4, Samples, Steps));
+
+	std::vector<glm::vec3> SIMD8;
+	std::printf("- SIMD vec3x8: %d us\n", launch(step_soa<8>, SIMD8, Samples, Steps));
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		Error += glm::all(glm::equal(SISD[i], SIMD4[i], 0.001f)) ? 0 : 1;
+		Error += glm::all(glm::equal(SISD[i], SIMD8[i], 0.001f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
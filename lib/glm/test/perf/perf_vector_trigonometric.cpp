@@ -0,0 +1,97 @@
+#define GLM_FORCE_INLINE
+#include <glm/trigonometric.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/ext/vector_float4.hpp>
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#include <glm/gtc/type_aligned.hpp>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+template <typename vecType>
+static int launch_vec_func(std::vector<vecType>& O, vecType (*Func)(vecType const&), float Min, float Max, std::size_t Samples)
+{
+	std::vector<vecType> I(Samples);
+	O.resize(Samples);
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	for(glm::length_t j = 0; j < 4; ++j)
+		I[i][j] = Min + (Max - Min) * static_cast<float>(i * 4 + static_cast<std::size_t>(j)) / static_cast<float>(Samples * 4);
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+		O[i] = Func(I[i]);
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+template <typename packedVecType, typename alignedVecType>
+static int comp_vec_func(packedVecType (*PackedFunc)(packedVecType const&), alignedVecType (*AlignedFunc)(alignedVecType const&), float Min, float Max, int MaxULPs, std::size_t Samples)
+{
+	int Error = 0;
+
+	std::vector<packedVecType> SISD;
+	std::printf("- SISD: %d us\n", launch_vec_func<packedVecType>(SISD, PackedFunc, Min, Max, Samples));
+
+	std::vector<alignedVecType> SIMD;
+	std::printf("- SIMD: %d us\n", launch_vec_func<alignedVecType>(SIMD, AlignedFunc, Min, Max, Samples));
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		packedVecType const A = SISD[i];
+		packedVecType const B = SIMD[i];
+		Error += glm::all(glm::equal(A, B, MaxULPs)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template <typename vecType>
+static vecType call_sin(vecType const& v){return glm::sin(v);}
+template <typename vecType>
+static vecType call_cos(vecType const& v){return glm::cos(v);}
+template <typename vecType>
+static vecType call_tan(vecType const& v){return glm::tan(v);}
+template <typename vecType>
+static vecType call_asin(vecType const& v){return glm::asin(v);}
+template <typename vecType>
+static vecType call_acos(vecType const& v){return glm::acos(v);}
+template <typename vecType>
+static vecType call_atan(vecType const& v){return glm::atan(v);}
+
+int main()
+{
+	std::size_t const Samples = 100000;
+
+	int Error = 0;
+
+	std::printf("sin(vec4):\n");
+	Error += comp_vec_func<glm::vec4, glm::aligned_vec4>(call_sin<glm::vec4>, call_sin<glm::aligned_vec4>, -10.0f, 10.0f, 4, Samples);
+
+	std::printf("cos(vec4):\n");
+	Error += comp_vec_func<glm::vec4, glm::aligned_vec4>(call_cos<glm::vec4>, call_cos<glm::aligned_vec4>, -10.0f, 10.0f, 4, Samples);
+
+	std::printf("tan(vec4):\n");
+	Error += comp_vec_func<glm::vec4, glm::aligned_vec4>(call_tan<glm::vec4>, call_tan<glm::aligned_vec4>, -1.5f, 1.5f, 8, Samples);
+
+	std::printf("asin(vec4):\n");
+	Error += comp_vec_func<glm::vec4, glm::aligned_vec4>(call_asin<glm::vec4>, call_asin<glm::aligned_vec4>, -1.0f, 1.0f, 4, Samples);
+
+	std::printf("acos(vec4):\n");
+	Error += comp_vec_func<glm::vec4, glm::aligned_vec4>(call_acos<glm::vec4>, call_acos<glm::aligned_vec4>, -1.0f, 1.0f, 4, Samples);
+
+	std::printf("atan(vec4):\n");
+	Error += comp_vec_func<glm::vec4, glm::aligned_vec4>(call_atan<glm::vec4>, call_atan<glm::aligned_vec4>, -100.0f, 100.0f, 4, Samples);
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif